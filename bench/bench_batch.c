@@ -0,0 +1,129 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef _WIN32
+#define NULL_DEVICE "NUL"
+#else
+#define NULL_DEVICE "/dev/null"
+#endif
+
+#define BATCH_FILE "bench_batch.tmp"
+#define RECORD_FILE "bench_record.tmp"
+
+static unsigned long seed = 1;
+
+static unsigned int nextRandom(void) {
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) & 0x7FFF;
+}
+
+static double now(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void generateRecord(char *record, size_t length) {
+    static const char chars[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                                "abcdefghijklmnopqrstuvwxyz/:.-";
+
+    for (size_t i = 0; i < length; i++) {
+        record[i] = chars[nextRandom() % (sizeof(chars) - 1)];
+    }
+
+    record[length] = '\0';
+}
+
+int main(int argc, char **argv) {
+    const char *qrce = argc > 1 ? argv[1] : "bin/qrce.exe";
+    size_t numRecords = argc > 2 ? strtoul(argv[2], NULL, 10) : 500;
+    unsigned long numThreads = argc > 3 ? strtoul(argv[3], NULL, 10) : 4;
+    char record[256];
+    char command[1024];
+
+    FILE *batch = fopen(BATCH_FILE, "wb");
+
+    if (batch == NULL) {
+        perror(BATCH_FILE);
+        return EXIT_FAILURE;
+    }
+
+    for (size_t i = 0; i < numRecords; i++) {
+        generateRecord(record, 10 + nextRandom() % 190);
+        fprintf(batch, "%s\n", record);
+    }
+
+    fclose(batch);
+
+    // one process per symbol
+    seed = 1;
+    double start = now();
+
+    for (size_t i = 0; i < numRecords; i++) {
+        generateRecord(record, 10 + nextRandom() % 190);
+
+        FILE *file = fopen(RECORD_FILE, "wb");
+
+        if (file == NULL) {
+            perror(RECORD_FILE);
+            return EXIT_FAILURE;
+        }
+
+        fputs(record, file);
+        fclose(file);
+
+        snprintf(command, sizeof(command), "%s < %s > %s", qrce, RECORD_FILE,
+                 NULL_DEVICE);
+
+        if (system(command) != 0) {
+            fprintf(stderr, "Failed: %s\n", command);
+            return EXIT_FAILURE;
+        }
+    }
+
+    double processPerSymbol = now() - start;
+
+    // one process for the whole batch
+    snprintf(command, sizeof(command), "%s /B L < %s > %s", qrce, BATCH_FILE,
+             NULL_DEVICE);
+
+    start = now();
+
+    if (system(command) != 0) {
+        fprintf(stderr, "Failed: %s\n", command);
+        return EXIT_FAILURE;
+    }
+
+    double batchMode = now() - start;
+
+    // one process for the whole batch, encoded on several threads
+    snprintf(command, sizeof(command), "%s /B L /J %lu < %s > %s", qrce,
+             numThreads, BATCH_FILE, NULL_DEVICE);
+
+    start = now();
+
+    if (system(command) != 0) {
+        fprintf(stderr, "Failed: %s\n", command);
+        return EXIT_FAILURE;
+    }
+
+    double parallelBatchMode = now() - start;
+
+    remove(BATCH_FILE);
+    remove(RECORD_FILE);
+
+    printf("records                  %zu\n", numRecords);
+    printf("one process per symbol   %10.0f symbols/sec\n",
+           numRecords / processPerSymbol);
+    printf("batch mode (/B L)        %10.0f symbols/sec\n",
+           numRecords / batchMode);
+    snprintf(command, sizeof(command), "batch mode (/B L /J %lu)", numThreads);
+    printf("%-25s%10.0f symbols/sec\n", command,
+           numRecords / parallelBatchMode);
+    printf("speedup                  %10.1fx / %.1fx\n",
+           processPerSymbol / batchMode, processPerSymbol / parallelBatchMode);
+
+    return 0;
+}
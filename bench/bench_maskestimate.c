@@ -0,0 +1,121 @@
+#include "datamasking.h"
+#include "module.h"
+#include "moduleplacement.h"
+#include "penalty.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static unsigned long seed = 1;
+
+static unsigned int nextRandom(void) {
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) & 0x7FFF;
+}
+
+static double now(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static unsigned int getLowestPattern(const unsigned int *penaltyScores) {
+    unsigned int lowestPattern = 0;
+
+    for (unsigned int pattern = 1; pattern < 8; pattern++) {
+        if (penaltyScores[lowestPattern] > penaltyScores[pattern]) {
+            lowestPattern = pattern;
+        }
+    }
+
+    return lowestPattern;
+}
+
+int main(int argc, char **argv) {
+    unsigned long numSymbols = argc > 1 ? strtoul(argv[1], NULL, 10) : 50;
+    static uint8_t codewords[3706];
+    static ModuleMatrix unmasked;
+    static ModuleMatrix masked;
+    unsigned long totalMatches = 0;
+    unsigned long totalSymbols = 0;
+    double totalDeviation = 0;
+    double totalExact = 0;
+    double totalEstimated = 0;
+
+    // the exact and estimated selections both include applying the pattern
+    printf("Version  Exact(us)  Estimated(us)  Speedup  Same pattern  "
+           "Mean excess  Max excess\n");
+
+    for (unsigned int version = 1; version <= 40; version++) {
+        size_t size = getSymbolSizeInNumModules(version);
+        unsigned long numMatches = 0;
+        double deviation = 0;
+        double maxDeviation = 0;
+        double exact = 0;
+        double estimated = 0;
+
+        for (unsigned long i = 0; i < numSymbols; i++) {
+            for (size_t j = 0; j < sizeof(codewords); j++) {
+                codewords[j] = nextRandom() & 0xFF;
+            }
+
+            placeModules(&unmasked, size, version, codewords);
+
+            double start = now();
+            unsigned int lowestPattern = applyDataMaskPatternLowestPenaltyScore(
+                &masked, &unmasked, size);
+
+            exact += now() - start;
+            start = now();
+
+            unsigned int pattern =
+                applyDataMaskPatternEstimatedLowestPenaltyScore(
+                    &masked, &unmasked, size);
+
+            estimated += now() - start;
+
+            // the penalty score of each pattern, scored in full
+            unsigned int penaltyScores[8];
+
+            for (unsigned int p = 0; p < 8; p++) {
+                applyDataMaskPattern(&masked, &unmasked, size, p);
+                penaltyScores[p] = calculatePackedPenaltyScore(&masked, size);
+            }
+
+            if (getLowestPattern(penaltyScores) != lowestPattern) {
+                fprintf(stderr, "Exact selection differs\n");
+                return EXIT_FAILURE;
+            }
+
+            double excess = (double)(penaltyScores[pattern] -
+                                     penaltyScores[lowestPattern]) /
+                            penaltyScores[lowestPattern];
+
+            numMatches += pattern == lowestPattern;
+            deviation += excess;
+            maxDeviation = excess > maxDeviation ? excess : maxDeviation;
+        }
+
+        printf("%7u  %9.1f  %13.1f  %6.2fx  %11.1f%%  %10.2f%%  %9.2f%%\n",
+               version, exact / numSymbols * 1e6,
+               estimated / numSymbols * 1e6, exact / estimated,
+               100.0 * numMatches / numSymbols,
+               100.0 * deviation / numSymbols, 100.0 * maxDeviation);
+
+        if (size >= MIN_ESTIMATED_MASK_SIZE) {
+            totalMatches += numMatches;
+            totalSymbols += numSymbols;
+            totalDeviation += deviation;
+            totalExact += exact;
+            totalEstimated += estimated;
+        }
+    }
+
+    printf("Versions %u-40: %.2fx faster, same pattern for %.1f%%, "
+           "mean excess penalty %.2f%%\n",
+           (MIN_ESTIMATED_MASK_SIZE - 17) / 4, totalExact / totalEstimated,
+           100.0 * totalMatches / totalSymbols,
+           100.0 * totalDeviation / totalSymbols);
+
+    return EXIT_SUCCESS;
+}
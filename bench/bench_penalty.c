@@ -0,0 +1,142 @@
+#include "datamasking.h"
+#include "module.h"
+#include "moduleplacement.h"
+#include "penalty.h"
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static unsigned long seed = 1;
+
+static unsigned int nextRandom(void) {
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) & 0x7FFF;
+}
+
+static double now(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static unsigned int calculatePenaltyScore(const uint8_t *modules, size_t size) {
+    return calculatePenaltyScoreCondition1(modules, size) +
+           calculatePenaltyScoreCondition2(modules, size) +
+           calculatePenaltyScoreCondition3(modules, size) +
+           calculatePenaltyScoreCondition4(modules, size);
+}
+
+// the mask selection as it was before all patterns were scored in one pass
+static unsigned int
+selectDataMaskPatternInEightPasses(ModuleMatrix *masked,
+                                   const ModuleMatrix *unmasked, size_t size) {
+    unsigned int lowestPenaltyScore = UINT_MAX;
+    unsigned int dataMaskPattern = 0;
+
+    for (unsigned int pattern = 0; pattern < 8; pattern++) {
+        applyDataMaskPattern(masked, unmasked, size, pattern);
+        unsigned int penaltyScore = calculatePackedPenaltyScore(masked, size);
+
+        if (lowestPenaltyScore > penaltyScore) {
+            lowestPenaltyScore = penaltyScore;
+            dataMaskPattern = pattern;
+        }
+    }
+
+    applyDataMaskPattern(masked, unmasked, size, dataMaskPattern);
+
+    return dataMaskPattern;
+}
+
+int main(int argc, char **argv) {
+    unsigned long numIterations = argc > 1 ? strtoul(argv[1], NULL, 10) : 50;
+    static uint8_t codewords[3706];
+    static uint8_t modules[177 * 177];
+    static ModuleMatrix unmasked;
+    static ModuleMatrix masked[8];
+    double totalBytewise = 0;
+    double totalPacked = 0;
+    double totalEightPasses = 0;
+    double totalOnePass = 0;
+    unsigned int checksum = 0;
+
+    printf("Version  Bytewise(us)  Packed(us)  Speedup  "
+           "8 passes(us)  1 pass(us)  Speedup\n");
+
+    for (unsigned int version = 1; version <= 40; version++) {
+        size_t size = getSymbolSizeInNumModules(version);
+
+        for (size_t i = 0; i < sizeof(codewords); i++) {
+            codewords[i] = nextRandom() & 0xFF;
+        }
+
+        placeModules(&unmasked, size, version, codewords);
+
+        for (unsigned int pattern = 0; pattern < 8; pattern++) {
+            applyDataMaskPattern(&masked[pattern], &unmasked, size, pattern);
+        }
+
+        // score all eight masks, as the mask selection does
+        double start = now();
+
+        for (unsigned long i = 0; i < numIterations; i++) {
+            for (unsigned int pattern = 0; pattern < 8; pattern++) {
+                unpackModuleMatrix(modules, &masked[pattern], size);
+                checksum += calculatePenaltyScore(modules, size);
+            }
+        }
+
+        double bytewise = (now() - start) / numIterations;
+
+        start = now();
+
+        for (unsigned long i = 0; i < numIterations; i++) {
+            for (unsigned int pattern = 0; pattern < 8; pattern++) {
+                checksum -= calculatePackedPenaltyScore(&masked[pattern], size);
+            }
+        }
+
+        double packed = (now() - start) / numIterations;
+
+        // select the mask, applying the chosen one
+        start = now();
+
+        for (unsigned long i = 0; i < numIterations; i++) {
+            checksum += selectDataMaskPatternInEightPasses(&masked[0],
+                                                           &unmasked, size);
+        }
+
+        double eightPasses = (now() - start) / numIterations;
+
+        start = now();
+
+        for (unsigned long i = 0; i < numIterations; i++) {
+            checksum -= applyDataMaskPatternLowestPenaltyScore(&masked[0],
+                                                               &unmasked, size);
+        }
+
+        double onePass = (now() - start) / numIterations;
+
+        printf("%7u  %12.1f  %10.1f  %6.2fx  %12.1f  %10.1f  %6.2fx\n",
+               version, bytewise * 1e6, packed * 1e6, bytewise / packed,
+               eightPasses * 1e6, onePass * 1e6, eightPasses / onePass);
+
+        totalBytewise += bytewise;
+        totalPacked += packed;
+        totalEightPasses += eightPasses;
+        totalOnePass += onePass;
+    }
+
+    printf("  Total  %12.1f  %10.1f  %6.2fx  %12.1f  %10.1f  %6.2fx\n",
+           totalBytewise * 1e6, totalPacked * 1e6, totalBytewise / totalPacked,
+           totalEightPasses * 1e6, totalOnePass * 1e6,
+           totalEightPasses / totalOnePass);
+
+    if (checksum != 0) {
+        fprintf(stderr, "Penalty scores differ\n");
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
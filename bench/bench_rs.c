@@ -0,0 +1,122 @@
+#include "errorcorrection.h"
+#include "gf256.h"
+#include "rsblock.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define MAX_NUM_CODEWORDS 3706
+
+static unsigned long seed = 1;
+
+static unsigned int nextRandom(void) {
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) & 0x7FFF;
+}
+
+static double now(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void divideBlocks(uint8_t *ecCodewords, const uint8_t *dataCodewords,
+                         RSBlock rsBlock) {
+    const uint8_t *generatorPolynomial =
+        gf256_getGeneratorPolynomial(rsBlock.numECCodewords);
+
+    for (size_t i = 0; i < rsBlock.numBlocks1 + rsBlock.numBlocks2; i++) {
+        size_t numDataCodewords = i < rsBlock.numBlocks1
+                                      ? rsBlock.numDataCodewords1
+                                      : rsBlock.numDataCodewords2;
+
+        gf256_divideByGeneratorPolynomial(
+            ecCodewords + i * rsBlock.numECCodewords, dataCodewords,
+            numDataCodewords, generatorPolynomial, rsBlock.numECCodewords);
+
+        dataCodewords += numDataCodewords;
+    }
+}
+
+int main(int argc, char **argv) {
+    static const char ecLevels[] = "LMQH";
+    static const char *kernelNames[] = {"scalar", "SSSE3", "AVX2"};
+    unsigned long numIterations = argc > 1 ? strtoul(argv[1], NULL, 10) : 200;
+    GF256Kernel kernel = argc > 2 ? (GF256Kernel)strtoul(argv[2], NULL, 10)
+                                  : GF256_KERNEL_AVX2;
+    uint8_t dataCodewords[MAX_NUM_CODEWORDS];
+    uint8_t reference[MAX_NUM_CODEWORDS];
+    uint8_t ecCodewords[MAX_NUM_CODEWORDS];
+    double totalDivision = 0;
+    double totalRegister = 0;
+    double totalLockstep = 0;
+
+    for (size_t i = 0; i < sizeof(dataCodewords); i++) {
+        dataCodewords[i] = nextRandom() & 0xFF;
+    }
+
+    printf("Kernel: %s\n", kernelNames[gf256_selectKernel(kernel)]);
+    printf("Version EC  Division(us)  Register(us)  Lockstep(us)  Speedup\n");
+
+    for (unsigned int version = 1; version <= 40; version++) {
+        for (int ecLevel = ERROR_CORRECTION_LEVEL_L;
+             ecLevel <= ERROR_CORRECTION_LEVEL_H; ecLevel++) {
+            RSBlock rsBlock = getRSBlock(version, ecLevel);
+            size_t numECCodewords = (rsBlock.numBlocks1 + rsBlock.numBlocks2) *
+                                    rsBlock.numECCodewords;
+
+            double start = now();
+
+            for (unsigned long i = 0; i < numIterations; i++) {
+                divideBlocks(reference, dataCodewords, rsBlock);
+            }
+
+            double division = (now() - start) / numIterations;
+
+            start = now();
+
+            for (unsigned long i = 0; i < numIterations; i++) {
+                encodeErrorCorrectionCodewords(ecCodewords, dataCodewords,
+                                               rsBlock);
+            }
+
+            double shiftRegister = (now() - start) / numIterations;
+
+            if (memcmp(reference, ecCodewords, numECCodewords) != 0) {
+                fprintf(stderr, "Mismatch at version %u-%c\n", version,
+                        ecLevels[ecLevel]);
+                return EXIT_FAILURE;
+            }
+
+            start = now();
+
+            for (unsigned long i = 0; i < numIterations; i++) {
+                encodeErrorCorrectionCodewordsInLockstep(
+                    ecCodewords, dataCodewords, rsBlock);
+            }
+
+            double lockstep = (now() - start) / numIterations;
+
+            if (memcmp(reference, ecCodewords, numECCodewords) != 0) {
+                fprintf(stderr, "Mismatch in lockstep at version %u-%c\n",
+                        version, ecLevels[ecLevel]);
+                return EXIT_FAILURE;
+            }
+
+            printf("%7u  %c  %12.2f  %12.2f  %12.2f  %6.2fx\n", version,
+                   ecLevels[ecLevel], division * 1e6, shiftRegister * 1e6,
+                   lockstep * 1e6, division / shiftRegister);
+
+            totalDivision += division;
+            totalRegister += shiftRegister;
+            totalLockstep += lockstep;
+        }
+    }
+
+    printf("  Total     %12.2f  %12.2f  %12.2f  %6.2fx\n",
+           totalDivision * 1e6, totalRegister * 1e6, totalLockstep * 1e6,
+           totalDivision / totalRegister);
+
+    return EXIT_SUCCESS;
+}
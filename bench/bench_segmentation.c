@@ -0,0 +1,193 @@
+#include "charset.h"
+#include "dataanalysis.h"
+#include "dataencoding.h"
+#include "segment.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define MAX_RECORD_LENGTH 2000
+
+static unsigned long seed = 1;
+
+static unsigned int nextRandom(void) {
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) & 0x7FFF;
+}
+
+static double now(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// appends a run of random characters of the set
+static size_t appendRun(uint8_t *record, size_t length, const char *chars,
+                        size_t runLength) {
+    size_t numChars = strlen(chars);
+
+    for (size_t i = 0; i < runLength && length < MAX_RECORD_LENGTH; i++) {
+        record[length++] = chars[nextRandom() % numChars];
+    }
+
+    return length;
+}
+
+// a payload mixing the kind of runs found in URLs, identifiers and
+// Shift_JIS text; Kanji are used with Kanji mode only
+static size_t generateRecord(uint8_t *record, bool useKanjiMode) {
+    static const char *const sets[] = {
+        "0123456789", "ABCDEFGHIJKLMNOPQRSTUVWXYZ $%*+-./:",
+        "abcdefghijklmnopqrstuvwxyz?&=_", "\x88\x9F\x93\xFA\x96\x7B\x8C\xEA"};
+    size_t targetLength = 20 + nextRandom() % 600;
+    size_t length = 0;
+
+    while (length < targetLength) {
+        unsigned int set = nextRandom() % (useKanjiMode ? 4 : 3);
+        size_t runLength = 1 + nextRandom() % (nextRandom() % 2 ? 6 : 30);
+
+        if (set == 3) {
+            for (size_t i = 0; i < runLength && length + 2 <= targetLength;
+                 i++) {
+                unsigned int k = nextRandom() % 4;
+
+                record[length++] = sets[3][2 * k];
+                record[length++] = sets[3][2 * k + 1];
+            }
+
+            continue;
+        }
+
+        length = appendRun(record, length, sets[set], runLength);
+    }
+
+    return length;
+}
+
+// the smallest version over the three version classes, or -1, and the length
+// of the bit stream in the version class of that version
+static int selectVersion(size_t *numBits, const uint8_t *classes,
+                         const uint16_t *runs, uint8_t *trace, size_t length,
+                         bool useKanjiMode, ErrorCorrectionLevel ecLevel,
+                         bool useOptimalSegmentation) {
+    static Segment storage[NUM_VERSION_CLASSES][MAX_RECORD_LENGTH];
+    SegmentList segments[NUM_VERSION_CLASSES];
+    size_t numBitsByClass[NUM_VERSION_CLASSES];
+
+    for (size_t c = 0; c < NUM_VERSION_CLASSES; c++) {
+        initializeSegmentList(&segments[c], storage[c], MAX_RECORD_LENGTH);
+    }
+
+    VersionClass firstClass;
+    VersionClass lastClass;
+
+    size_t minNumBits = getMinNumBitsFromClasses(classes, length,
+                                                 useKanjiMode);
+
+    if (!selectVersionClasses(&firstClass, &lastClass, minNumBits, length,
+                              ecLevel)) {
+        return -1;
+    }
+
+    // as in qrce_encode, a second pass covers the classes after lastClass
+    for (;;) {
+        if (useOptimalSegmentation) {
+            createOptimalSegmentsByClass(segments, numBitsByClass, trace,
+                                         classes, length, useKanjiMode,
+                                         firstClass, lastClass);
+        } else {
+            createMixedModeSegmentsByClass(segments, numBitsByClass, classes,
+                                           runs, length, useKanjiMode,
+                                           firstClass, lastClass);
+        }
+
+        for (VersionClass versionClass = firstClass; versionClass <= lastClass;
+             versionClass++) {
+            int version = recommendVersionForNumBits(
+                numBitsByClass[versionClass], ecLevel, versionClass);
+
+            if (version != -1) {
+                *numBits = numBitsByClass[versionClass];
+                return version;
+            }
+        }
+
+        if (lastClass == VERSION_CLASS_LARGE) {
+            break;
+        }
+
+        firstClass = lastClass + 1;
+        lastClass = VERSION_CLASS_LARGE;
+    }
+
+    return -1;
+}
+
+int main(int argc, char **argv) {
+    unsigned long numRecords = argc > 1 ? strtoul(argv[1], NULL, 10) : 2000;
+    bool useKanjiMode = argc > 2 && strcmp(argv[2], "K") == 0;
+    static uint8_t record[MAX_RECORD_LENGTH];
+    static uint8_t classes[MAX_RECORD_LENGTH];
+    static uint16_t runs[MAX_RECORD_LENGTH];
+    static uint8_t trace[NUM_VERSION_CLASSES * (MAX_RECORD_LENGTH + 1)];
+
+    printf("%lu records%s\n", numRecords,
+           useKanjiMode ? " with Kanji mode" : "");
+    printf("Level  Annex J(us)  Exact(us)  Bits saved  Shorter  "
+           "Smaller version\n");
+
+    for (ErrorCorrectionLevel ecLevel = ERROR_CORRECTION_LEVEL_L;
+         ecLevel <= ERROR_CORRECTION_LEVEL_H; ecLevel++) {
+        double heuristicTime = 0;
+        double optimalTime = 0;
+        unsigned long bitsSaved = 0;
+        unsigned long numShorter = 0;
+        unsigned long numSmaller = 0;
+
+        seed = 1;
+
+        for (unsigned long i = 0; i < numRecords; i++) {
+            size_t length = generateRecord(record, useKanjiMode);
+            size_t heuristicBits = 0;
+            size_t optimalBits = 0;
+
+            double start = now();
+            analyzeCharacters(classes, runs, record, length, useKanjiMode);
+            int heuristicVersion =
+                selectVersion(&heuristicBits, classes, runs, trace, length,
+                              useKanjiMode, ecLevel, false);
+
+            heuristicTime += now() - start;
+            start = now();
+
+            classifyCharacters(classes, record, length);
+            int optimalVersion =
+                selectVersion(&optimalBits, classes, runs, trace, length,
+                              useKanjiMode, ecLevel, true);
+
+            optimalTime += now() - start;
+
+            // records too long for either are not counted
+            if (heuristicVersion == -1) {
+                numSmaller += optimalVersion != -1;
+                continue;
+            }
+
+            // the bit streams are comparable within a version class
+            if ((heuristicVersion >= 10) + (heuristicVersion >= 27) ==
+                (optimalVersion >= 10) + (optimalVersion >= 27)) {
+                bitsSaved += heuristicBits - optimalBits;
+                numShorter += heuristicBits > optimalBits;
+            }
+
+            numSmaller += optimalVersion < heuristicVersion;
+        }
+
+        printf("%c      %11.2f  %9.2f  %10lu  %7lu  %15lu\n", "LMQH"[ecLevel],
+               heuristicTime / numRecords * 1e6, optimalTime / numRecords * 1e6,
+               bitsSaved, numShorter, numSmaller);
+    }
+
+    return 0;
+}
@@ -0,0 +1,4737 @@
+// Generated by tools/gentables.c. Do not edit.
+
+#include "tables.h"
+
+const SymbolDescriptor symbolDescriptors[40][4] = {
+    {{19, 26, {41, 25, 17, 10}, 21, 0, 1, 19, 0, 7},
+     {16, 26, {34, 20, 14, 8}, 21, 0, 1, 16, 0, 10},
+     {13, 26, {27, 16, 11, 7}, 21, 0, 1, 13, 0, 13},
+     {9, 26, {17, 10, 7, 4}, 21, 0, 1, 9, 0, 17}},
+    {{34, 44, {77, 47, 32, 20}, 25, 7, 1, 34, 0, 10},
+     {28, 44, {63, 38, 26, 16}, 25, 7, 1, 28, 0, 16},
+     {22, 44, {48, 29, 20, 12}, 25, 7, 1, 22, 0, 22},
+     {16, 44, {34, 20, 14, 8}, 25, 7, 1, 16, 0, 28}},
+    {{55, 70, {127, 77, 53, 32}, 29, 7, 1, 55, 0, 15},
+     {44, 70, {101, 61, 42, 26}, 29, 7, 1, 44, 0, 26},
+     {34, 70, {77, 47, 32, 20}, 29, 7, 2, 17, 0, 18},
+     {26, 70, {58, 35, 24, 15}, 29, 7, 2, 13, 0, 22}},
+    {{80, 100, {187, 114, 78, 48}, 33, 7, 1, 80, 0, 20},
+     {64, 100, {149, 90, 62, 38}, 33, 7, 2, 32, 0, 18},
+     {48, 100, {111, 67, 46, 28}, 33, 7, 2, 24, 0, 26},
+     {36, 100, {82, 50, 34, 21}, 33, 7, 4, 9, 0, 16}},
+    {{108, 134, {255, 154, 106, 65}, 37, 7, 1, 108, 0, 26},
+     {86, 134, {202, 122, 84, 52}, 37, 7, 2, 43, 0, 24},
+     {62, 134, {144, 87, 60, 37}, 37, 7, 2, 15, 2, 18},
+     {46, 134, {106, 64, 44, 27}, 37, 7, 2, 11, 2, 22}},
+    {{136, 172, {322, 195, 134, 82}, 41, 7, 2, 68, 0, 18},
+     {108, 172, {255, 154, 106, 65}, 41, 7, 4, 27, 0, 16},
+     {76, 172, {178, 108, 74, 45}, 41, 7, 4, 19, 0, 24},
+     {60, 172, {139, 84, 58, 36}, 41, 7, 4, 15, 0, 28}},
+    {{156, 196, {370, 224, 154, 95}, 45, 0, 2, 78, 0, 20},
+     {124, 196, {293, 178, 122, 75}, 45, 0, 4, 31, 0, 18},
+     {88, 196, {207, 125, 86, 53}, 45, 0, 2, 14, 4, 18},
+     {66, 196, {154, 93, 64, 39}, 45, 0, 4, 13, 1, 26}},
+    {{194, 242, {461, 279, 192, 118}, 49, 0, 2, 97, 0, 24},
+     {154, 242, {365, 221, 152, 93}, 49, 0, 2, 38, 2, 22},
+     {110, 242, {259, 157, 108, 66}, 49, 0, 4, 18, 2, 22},
+     {86, 242, {202, 122, 84, 52}, 49, 0, 4, 14, 2, 26}},
+    {{232, 292, {552, 335, 230, 141}, 53, 0, 2, 116, 0, 30},
+     {182, 292, {432, 262, 180, 111}, 53, 0, 3, 36, 2, 22},
+     {132, 292, {312, 189, 130, 80}, 53, 0, 4, 16, 4, 20},
+     {100, 292, {235, 143, 98, 60}, 53, 0, 4, 12, 4, 24}},
+    {{274, 346, {652, 395, 271, 167}, 57, 0, 2, 68, 2, 18},
+     {216, 346, {513, 311, 213, 131}, 57, 0, 4, 43, 1, 26},
+     {154, 346, {364, 221, 151, 93}, 57, 0, 6, 19, 2, 24},
+     {122, 346, {288, 174, 119, 74}, 57, 0, 6, 15, 2, 28}},
+    {{324, 404, {772, 468, 321, 198}, 61, 0, 4, 81, 0, 20},
+     {254, 404, {604, 366, 251, 155}, 61, 0, 1, 50, 4, 30},
+     {180, 404, {427, 259, 177, 109}, 61, 0, 4, 22, 4, 28},
+     {140, 404, {331, 200, 137, 85}, 61, 0, 3, 12, 8, 24}},
+    {{370, 466, {883, 535, 367, 226}, 65, 0, 2, 92, 2, 24},
+     {290, 466, {691, 419, 287, 177}, 65, 0, 6, 36, 2, 22},
+     {206, 466, {489, 296, 203, 125}, 65, 0, 4, 20, 6, 26},
+     {158, 466, {374, 227, 155, 96}, 65, 0, 7, 14, 4, 28}},
+    {{428, 532, {1022, 619, 425, 262}, 69, 0, 4, 107, 0, 26},
+     {334, 532, {796, 483, 331, 204}, 69, 0, 8, 37, 1, 22},
+     {244, 532, {580, 352, 241, 149}, 69, 0, 8, 20, 4, 24},
+     {180, 532, {427, 259, 177, 109}, 69, 0, 12, 11, 4, 22}},
+    {{461, 581, {1101, 667, 458, 282}, 73, 3, 3, 115, 1, 30},
+     {365, 581, {871, 528, 362, 223}, 73, 3, 4, 40, 5, 24},
+     {261, 581, {621, 376, 258, 159}, 73, 3, 11, 16, 5, 20},
+     {197, 581, {468, 283, 194, 120}, 73, 3, 11, 12, 5, 24}},
+    {{523, 655, {1250, 758, 520, 320}, 77, 3, 5, 87, 1, 22},
+     {415, 655, {991, 600, 412, 254}, 77, 3, 5, 41, 5, 24},
+     {295, 655, {703, 426, 292, 180}, 77, 3, 5, 24, 7, 30},
+     {223, 655, {530, 321, 220, 136}, 77, 3, 11, 12, 7, 24}},
+    {{589, 733, {1408, 854, 586, 361}, 81, 3, 5, 98, 1, 24},
+     {453, 733, {1082, 656, 450, 277}, 81, 3, 7, 45, 3, 28},
+     {325, 733, {775, 470, 322, 198}, 81, 3, 15, 19, 2, 24},
+     {253, 733, {602, 365, 250, 154}, 81, 3, 3, 15, 13, 30}},
+    {{647, 815, {1548, 938, 644, 397}, 85, 3, 1, 107, 5, 28},
+     {507, 815, {1212, 734, 504, 310}, 85, 3, 10, 46, 1, 28},
+     {367, 815, {876, 531, 364, 224}, 85, 3, 1, 22, 15, 28},
+     {283, 815, {674, 408, 280, 173}, 85, 3, 2, 14, 17, 28}},
+    {{721, 901, {1725, 1046, 718, 442}, 89, 3, 5, 120, 1, 30},
+     {563, 901, {1346, 816, 560, 345}, 89, 3, 9, 43, 4, 26},
+     {397, 901, {948, 574, 394, 243}, 89, 3, 17, 22, 1, 28},
+     {313, 901, {746, 452, 310, 191}, 89, 3, 2, 14, 19, 28}},
+    {{795, 991, {1903, 1153, 792, 488}, 93, 3, 3, 113, 4, 28},
+     {627, 991, {1500, 909, 624, 384}, 93, 3, 3, 44, 11, 26},
+     {445, 991, {1063, 644, 442, 272}, 93, 3, 17, 21, 4, 26},
+     {341, 991, {813, 493, 338, 208}, 93, 3, 9, 13, 16, 26}},
+    {{861, 1085, {2061, 1249, 858, 528}, 97, 3, 3, 107, 5, 28},
+     {669, 1085, {1600, 970, 666, 410}, 97, 3, 3, 41, 13, 26},
+     {485, 1085, {1159, 702, 482, 297}, 97, 3, 15, 24, 5, 30},
+     {385, 1085, {919, 557, 382, 235}, 97, 3, 15, 15, 10, 28}},
+    {{932, 1156, {2232, 1352, 929, 572}, 101, 4, 4, 116, 4, 28},
+     {714, 1156, {1708, 1035, 711, 438}, 101, 4, 17, 42, 0, 26},
+     {512, 1156, {1224, 742, 509, 314}, 101, 4, 17, 22, 6, 28},
+     {406, 1156, {969, 587, 403, 248}, 101, 4, 19, 16, 6, 30}},
+    {{1006, 1258, {2409, 1460, 1003, 618}, 105, 4, 2, 111, 7, 28},
+     {782, 1258, {1872, 1134, 779, 480}, 105, 4, 17, 46, 0, 28},
+     {568, 1258, {1358, 823, 565, 348}, 105, 4, 7, 24, 16, 30},
+     {442, 1258, {1056, 640, 439, 270}, 105, 4, 34, 13, 0, 24}},
+    {{1094, 1364, {2620, 1588, 1091, 672}, 109, 4, 4, 121, 5, 30},
+     {860, 1364, {2059, 1248, 857, 528}, 109, 4, 4, 47, 14, 28},
+     {614, 1364, {1468, 890, 611, 376}, 109, 4, 11, 24, 14, 30},
+     {464, 1364, {1108, 672, 461, 284}, 109, 4, 16, 15, 14, 30}},
+    {{1174, 1474, {2812, 1704, 1171, 721}, 113, 4, 6, 117, 4, 30},
+     {914, 1474, {2188, 1326, 911, 561}, 113, 4, 6, 45, 14, 28},
+     {664, 1474, {1588, 963, 661, 407}, 113, 4, 11, 24, 16, 30},
+     {514, 1474, {1228, 744, 511, 315}, 113, 4, 30, 16, 2, 30}},
+    {{1276, 1588, {3057, 1853, 1273, 784}, 117, 4, 8, 106, 4, 26},
+     {1000, 1588, {2395, 1451, 997, 614}, 117, 4, 8, 47, 13, 28},
+     {718, 1588, {1718, 1041, 715, 440}, 117, 4, 7, 24, 22, 30},
+     {538, 1588, {1286, 779, 535, 330}, 117, 4, 22, 15, 13, 30}},
+    {{1370, 1706, {3283, 1990, 1367, 842}, 121, 4, 10, 114, 2, 28},
+     {1062, 1706, {2544, 1542, 1059, 652}, 121, 4, 19, 46, 4, 28},
+     {754, 1706, {1804, 1094, 751, 462}, 121, 4, 28, 22, 6, 28},
+     {596, 1706, {1425, 864, 593, 365}, 121, 4, 33, 16, 4, 30}},
+    {{1468, 1828, {3517, 2132, 1465, 902}, 125, 4, 8, 122, 4, 30},
+     {1128, 1828, {2701, 1637, 1125, 692}, 125, 4, 22, 45, 3, 28},
+     {808, 1828, {1933, 1172, 805, 496}, 125, 4, 8, 23, 26, 30},
+     {628, 1828, {1501, 910, 625, 385}, 125, 4, 12, 15, 28, 30}},
+    {{1531, 1921, {3669, 2223, 1528, 940}, 129, 3, 3, 117, 10, 30},
+     {1193, 1921, {2857, 1732, 1190, 732}, 129, 3, 3, 45, 23, 28},
+     {871, 1921, {2085, 1263, 868, 534}, 129, 3, 4, 24, 31, 30},
+     {661, 1921, {1581, 958, 658, 405}, 129, 3, 11, 15, 31, 30}},
+    {{1631, 2051, {3909, 2369, 1628, 1002}, 133, 3, 7, 116, 7, 30},
+     {1267, 2051, {3035, 1839, 1264, 778}, 133, 3, 21, 45, 7, 28},
+     {911, 2051, {2181, 1322, 908, 559}, 133, 3, 1, 23, 37, 30},
+     {701, 2051, {1677, 1016, 698, 430}, 133, 3, 19, 15, 26, 30}},
+    {{1735, 2185, {4158, 2520, 1732, 1066}, 137, 3, 5, 115, 10, 30},
+     {1373, 2185, {3289, 1994, 1370, 843}, 137, 3, 19, 47, 10, 28},
+     {985, 2185, {2358, 1429, 982, 604}, 137, 3, 15, 24, 25, 30},
+     {745, 2185, {1782, 1080, 742, 457}, 137, 3, 23, 15, 25, 30}},
+    {{1843, 2323, {4417, 2677, 1840, 1132}, 141, 3, 13, 115, 3, 30},
+     {1455, 2323, {3486, 2113, 1452, 894}, 141, 3, 2, 46, 29, 28},
+     {1033, 2323, {2473, 1499, 1030, 634}, 141, 3, 42, 24, 1, 30},
+     {793, 2323, {1897, 1150, 790, 486}, 141, 3, 23, 15, 28, 30}},
+    {{1955, 2465, {4686, 2840, 1952, 1201}, 145, 3, 17, 115, 0, 30},
+     {1541, 2465, {3693, 2238, 1538, 947}, 145, 3, 10, 46, 23, 28},
+     {1115, 2465, {2670, 1618, 1112, 684}, 145, 3, 10, 24, 35, 30},
+     {845, 2465, {2022, 1226, 842, 518}, 145, 3, 19, 15, 35, 30}},
+    {{2071, 2611, {4965, 3009, 2068, 1273}, 149, 3, 17, 115, 1, 30},
+     {1631, 2611, {3909, 2369, 1628, 1002}, 149, 3, 14, 46, 21, 28},
+     {1171, 2611, {2805, 1700, 1168, 719}, 149, 3, 29, 24, 19, 30},
+     {901, 2611, {2157, 1307, 898, 553}, 149, 3, 11, 15, 46, 30}},
+    {{2191, 2761, {5253, 3183, 2188, 1347}, 153, 3, 13, 115, 6, 30},
+     {1725, 2761, {4134, 2506, 1722, 1060}, 153, 3, 14, 46, 23, 28},
+     {1231, 2761, {2949, 1787, 1228, 756}, 153, 3, 44, 24, 7, 30},
+     {961, 2761, {2301, 1394, 958, 590}, 153, 3, 59, 16, 1, 30}},
+    {{2306, 2876, {5529, 3351, 2303, 1417}, 157, 0, 12, 121, 7, 30},
+     {1812, 2876, {4343, 2632, 1809, 1113}, 157, 0, 12, 47, 26, 28},
+     {1286, 2876, {3081, 1867, 1283, 790}, 157, 0, 39, 24, 14, 30},
+     {986, 2876, {2361, 1431, 983, 605}, 157, 0, 22, 15, 41, 30}},
+    {{2434, 3034, {5836, 3537, 2431, 1496}, 161, 0, 6, 121, 14, 30},
+     {1914, 3034, {4588, 2780, 1911, 1176}, 161, 0, 6, 47, 34, 28},
+     {1354, 3034, {3244, 1966, 1351, 832}, 161, 0, 46, 24, 10, 30},
+     {1054, 3034, {2524, 1530, 1051, 647}, 161, 0, 2, 15, 64, 30}},
+    {{2566, 3196, {6153, 3729, 2563, 1577}, 165, 0, 17, 122, 4, 30},
+     {1992, 3196, {4775, 2894, 1989, 1224}, 165, 0, 29, 46, 14, 28},
+     {1426, 3196, {3417, 2071, 1423, 876}, 165, 0, 49, 24, 10, 30},
+     {1096, 3196, {2625, 1591, 1093, 673}, 165, 0, 24, 15, 46, 30}},
+    {{2702, 3362, {6479, 3927, 2699, 1661}, 169, 0, 4, 122, 18, 30},
+     {2102, 3362, {5039, 3054, 2099, 1292}, 169, 0, 13, 46, 32, 28},
+     {1502, 3362, {3599, 2181, 1499, 923}, 169, 0, 48, 24, 14, 30},
+     {1142, 3362, {2735, 1658, 1139, 701}, 169, 0, 42, 15, 32, 30}},
+    {{2812, 3532, {6743, 4087, 2809, 1729}, 173, 0, 20, 117, 4, 30},
+     {2216, 3532, {5313, 3220, 2213, 1362}, 173, 0, 40, 47, 7, 28},
+     {1582, 3532, {3791, 2298, 1579, 972}, 173, 0, 43, 24, 22, 30},
+     {1222, 3532, {2927, 1774, 1219, 750}, 173, 0, 10, 15, 67, 30}},
+    {{2956, 3706, {7089, 4296, 2953, 1817}, 177, 0, 19, 118, 6, 30},
+     {2334, 3706, {5596, 3391, 2331, 1435}, 177, 0, 18, 47, 31, 28},
+     {1666, 3706, {3993, 2420, 1663, 1024}, 177, 0, 34, 24, 34, 30},
+     {1276, 3706, {3057, 1852, 1273, 784}, 177, 0, 20, 15, 61, 30}}};
+
+const uint8_t alignmentPatternCoordinates[40][8] = {
+    {0, 0, 0, 0, 0, 0, 0, 0},
+    {2, 6, 18, 0, 0, 0, 0, 0},
+    {2, 6, 22, 0, 0, 0, 0, 0},
+    {2, 6, 26, 0, 0, 0, 0, 0},
+    {2, 6, 30, 0, 0, 0, 0, 0},
+    {2, 6, 34, 0, 0, 0, 0, 0},
+    {3, 6, 22, 38, 0, 0, 0, 0},
+    {3, 6, 24, 42, 0, 0, 0, 0},
+    {3, 6, 26, 46, 0, 0, 0, 0},
+    {3, 6, 28, 50, 0, 0, 0, 0},
+    {3, 6, 30, 54, 0, 0, 0, 0},
+    {3, 6, 32, 58, 0, 0, 0, 0},
+    {3, 6, 34, 62, 0, 0, 0, 0},
+    {4, 6, 26, 46, 66, 0, 0, 0},
+    {4, 6, 26, 48, 70, 0, 0, 0},
+    {4, 6, 26, 50, 74, 0, 0, 0},
+    {4, 6, 30, 54, 78, 0, 0, 0},
+    {4, 6, 30, 56, 82, 0, 0, 0},
+    {4, 6, 30, 58, 86, 0, 0, 0},
+    {4, 6, 34, 62, 90, 0, 0, 0},
+    {5, 6, 28, 50, 72, 94, 0, 0},
+    {5, 6, 26, 50, 74, 98, 0, 0},
+    {5, 6, 30, 54, 78, 102, 0, 0},
+    {5, 6, 28, 54, 80, 106, 0, 0},
+    {5, 6, 32, 58, 84, 110, 0, 0},
+    {5, 6, 30, 58, 86, 114, 0, 0},
+    {5, 6, 34, 62, 90, 118, 0, 0},
+    {6, 6, 26, 50, 74, 98, 122, 0},
+    {6, 6, 30, 54, 78, 102, 126, 0},
+    {6, 6, 26, 52, 78, 104, 130, 0},
+    {6, 6, 30, 56, 82, 108, 134, 0},
+    {6, 6, 34, 60, 86, 112, 138, 0},
+    {6, 6, 30, 58, 86, 114, 142, 0},
+    {6, 6, 34, 62, 90, 118, 146, 0},
+    {7, 6, 30, 54, 78, 102, 126, 150},
+    {7, 6, 24, 50, 76, 102, 128, 154},
+    {7, 6, 28, 54, 80, 106, 132, 158},
+    {7, 6, 32, 58, 84, 110, 136, 162},
+    {7, 6, 26, 54, 82, 110, 138, 166},
+    {7, 6, 30, 58, 86, 114, 142, 170}};
+
+const uint8_t numBitsCharCountIndicators[3][4] = {
+    {10, 9, 8, 8},
+    {12, 11, 16, 10},
+    {14, 13, 16, 12}};
+
+const uint16_t formatInformationWords[4][8] = {
+    {0x77C4, 0x72F3, 0x7DAA, 0x789D, 0x662F, 0x6318, 0x6C41, 0x6976},
+    {0x5412, 0x5125, 0x5E7C, 0x5B4B, 0x45F9, 0x40CE, 0x4F97, 0x4AA0},
+    {0x355F, 0x3068, 0x3F31, 0x3A06, 0x24B4, 0x2183, 0x2EDA, 0x2BED},
+    {0x1689, 0x13BE, 0x1CE7, 0x19D0, 0x0762, 0x0255, 0x0D0C, 0x083B}};
+
+const uint32_t versionInformationWords[41] = {
+    0x00000, 0x00000, 0x00000, 0x00000, 0x00000, 0x00000,
+    0x00000, 0x07C94, 0x085BC, 0x09A99, 0x0A4D3, 0x0BBF6,
+    0x0C762, 0x0D847, 0x0E60D, 0x0F928, 0x10B78, 0x1145D,
+    0x12A17, 0x13532, 0x149A6, 0x15683, 0x168C9, 0x177EC,
+    0x18EC4, 0x191E1, 0x1AFAB, 0x1B08E, 0x1CC1A, 0x1D33F,
+    0x1ED75, 0x1F250, 0x209D5, 0x216F0, 0x228BA, 0x2379F,
+    0x24B0B, 0x2542E, 0x26A64, 0x27541, 0x28C69};
+
+const uint8_t gf256ExpTable[256] = {
+    1, 2, 4, 8, 16, 32, 64, 128, 29, 58, 116, 232, 205, 135, 19, 38,
+    76, 152, 45, 90, 180, 117, 234, 201, 143, 3, 6, 12, 24, 48, 96, 192,
+    157, 39, 78, 156, 37, 74, 148, 53, 106, 212, 181, 119, 238, 193, 159, 35,
+    70, 140, 5, 10, 20, 40, 80, 160, 93, 186, 105, 210, 185, 111, 222, 161,
+    95, 190, 97, 194, 153, 47, 94, 188, 101, 202, 137, 15, 30, 60, 120, 240,
+    253, 231, 211, 187, 107, 214, 177, 127, 254, 225, 223, 163, 91, 182, 113, 226,
+    217, 175, 67, 134, 17, 34, 68, 136, 13, 26, 52, 104, 208, 189, 103, 206,
+    129, 31, 62, 124, 248, 237, 199, 147, 59, 118, 236, 197, 151, 51, 102, 204,
+    133, 23, 46, 92, 184, 109, 218, 169, 79, 158, 33, 66, 132, 21, 42, 84,
+    168, 77, 154, 41, 82, 164, 85, 170, 73, 146, 57, 114, 228, 213, 183, 115,
+    230, 209, 191, 99, 198, 145, 63, 126, 252, 229, 215, 179, 123, 246, 241, 255,
+    227, 219, 171, 75, 150, 49, 98, 196, 149, 55, 110, 220, 165, 87, 174, 65,
+    130, 25, 50, 100, 200, 141, 7, 14, 28, 56, 112, 224, 221, 167, 83, 166,
+    81, 162, 89, 178, 121, 242, 249, 239, 195, 155, 43, 86, 172, 69, 138, 9,
+    18, 36, 72, 144, 61, 122, 244, 245, 247, 243, 251, 235, 203, 139, 11, 22,
+    44, 88, 176, 125, 250, 233, 207, 131, 27, 54, 108, 216, 173, 71, 142, 1};
+
+const uint8_t gf256LogTable[256] = {
+    0, 0, 1, 25, 2, 50, 26, 198, 3, 223, 51, 238, 27, 104, 199, 75,
+    4, 100, 224, 14, 52, 141, 239, 129, 28, 193, 105, 248, 200, 8, 76, 113,
+    5, 138, 101, 47, 225, 36, 15, 33, 53, 147, 142, 218, 240, 18, 130, 69,
+    29, 181, 194, 125, 106, 39, 249, 185, 201, 154, 9, 120, 77, 228, 114, 166,
+    6, 191, 139, 98, 102, 221, 48, 253, 226, 152, 37, 179, 16, 145, 34, 136,
+    54, 208, 148, 206, 143, 150, 219, 189, 241, 210, 19, 92, 131, 56, 70, 64,
+    30, 66, 182, 163, 195, 72, 126, 110, 107, 58, 40, 84, 250, 133, 186, 61,
+    202, 94, 155, 159, 10, 21, 121, 43, 78, 212, 229, 172, 115, 243, 167, 87,
+    7, 112, 192, 247, 140, 128, 99, 13, 103, 74, 222, 237, 49, 197, 254, 24,
+    227, 165, 153, 119, 38, 184, 180, 124, 17, 68, 146, 217, 35, 32, 137, 46,
+    55, 63, 209, 91, 149, 188, 207, 205, 144, 135, 151, 178, 220, 252, 190, 97,
+    242, 86, 211, 171, 20, 42, 93, 158, 132, 60, 57, 83, 71, 109, 65, 162,
+    31, 45, 67, 216, 183, 123, 164, 118, 196, 23, 73, 236, 127, 12, 111, 246,
+    108, 161, 59, 82, 41, 157, 85, 170, 251, 96, 134, 177, 187, 204, 62, 90,
+    203, 89, 95, 176, 156, 169, 160, 81, 11, 245, 22, 235, 122, 117, 44, 215,
+    79, 174, 213, 233, 230, 231, 173, 232, 116, 214, 244, 234, 168, 80, 88, 175};
+
+const int16_t gf256GeneratorPolynomialOffsets[31] = {
+    -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, 7, -1, -1, 17, -1, 30,
+    45, 61, 78, -1, 96, -1, 116, -1, 138, -1, 162, -1, 188, -1, 216};
+
+const uint8_t gf256GeneratorPolynomials[246] = {
+    21, 102, 238, 149, 146, 229, 87, 45, 32, 94, 64, 70, 118, 61, 46, 67,
+    251, 78, 140, 206, 218, 130, 104, 106, 100, 86, 100, 176, 152, 74, 105, 99,
+    5, 124, 140, 237, 58, 58, 51, 37, 202, 91, 61, 183, 8, 120, 225, 194,
+    182, 169, 147, 191, 91, 3, 76, 161, 102, 109, 107, 104, 120, 136, 163, 243,
+    39, 150, 99, 24, 147, 214, 206, 123, 239, 43, 78, 206, 139, 43, 153, 96,
+    98, 5, 179, 252, 148, 152, 187, 79, 170, 118, 97, 184, 94, 158, 234, 215,
+    190, 188, 212, 212, 164, 156, 239, 83, 225, 221, 180, 202, 187, 26, 163, 61,
+    50, 79, 60, 17, 231, 165, 105, 160, 134, 219, 80, 98, 172, 8, 74, 200,
+    53, 221, 109, 14, 230, 93, 242, 247, 171, 210, 21, 227, 96, 87, 232, 117,
+    0, 111, 218, 228, 226, 192, 152, 169, 180, 159, 126, 251, 117, 211, 48, 135,
+    121, 229, 70, 218, 145, 153, 227, 48, 102, 13, 142, 245, 21, 161, 53, 165,
+    28, 111, 201, 145, 17, 118, 182, 103, 2, 158, 125, 173, 123, 9, 37, 242,
+    119, 212, 195, 42, 87, 245, 43, 21, 201, 232, 27, 205, 147, 195, 190, 110,
+    180, 108, 234, 224, 104, 200, 223, 168, 180, 192, 40, 238, 216, 251, 37, 156,
+    130, 224, 193, 226, 173, 42, 125, 222, 96, 239, 86, 110, 48, 50, 182, 179,
+    31, 216, 152, 145, 173, 41};
+
+const uint8_t gf256MultiplicationTables[62976] = {
+    0, 0, 0, 0, 0, 0, 0, 127, 122, 154, 164, 11, 68, 117, 254, 244,
+    41, 85, 22, 136, 234, 129, 142, 179, 241, 29, 204, 159, 225, 245, 82, 170,
+    44, 13, 201, 158, 143, 200, 14, 39, 73, 188, 31, 1, 123, 255, 58, 133,
+    35, 96, 123, 225, 91, 49, 193, 86, 223, 247, 164, 73, 88, 26, 143, 160,
+    141, 62, 237, 83, 94, 250, 33, 3, 141, 28, 78, 146, 101, 94, 121, 23,
+    184, 69, 214, 16, 62, 2, 246, 227, 116, 23, 70, 65, 120, 108, 71, 127,
+    83, 51, 192, 246, 223, 182, 98, 159, 172, 191, 140, 69, 18, 105, 219, 217,
+    163, 243, 85, 146, 176, 52, 3, 220, 137, 207, 54, 187, 112, 118, 93, 7,
+    124, 199, 166, 188, 233, 34, 125, 230, 99, 173, 248, 156, 66, 6, 7, 56,
+    156, 57, 202, 61, 124, 157, 156, 151, 125, 191, 188, 242, 46, 109, 138, 177,
+    32, 195, 136, 180, 201, 129, 245, 85, 124, 4, 241, 219, 232, 46, 140, 3,
+    126, 107, 127, 227, 106, 249, 130, 240, 216, 142, 254, 166, 102, 253, 138, 66,
+    42, 245, 226, 19, 157, 241, 163, 113, 196, 35, 69, 226, 139, 57, 213, 207,
+    103, 48, 99, 5, 138, 36, 210, 171, 175, 28, 127, 16, 128, 217, 239, 218,
+    91, 251, 170, 57, 125, 104, 6, 36, 129, 48, 157, 118, 44, 115, 165, 15,
+    131, 108, 107, 224, 236, 218, 117, 25, 200, 96, 164, 153, 186, 14, 248, 147,
+    81, 101, 207, 197, 116, 98, 55, 90, 33, 186, 68, 250, 209, 198, 71, 237,
+    37, 59, 128, 75, 98, 76, 169, 80, 132, 12, 14, 112, 37, 114, 137, 251,
+    118, 148, 212, 46, 54, 252, 122, 248, 39, 37, 51, 250, 99, 5, 130, 189,
+    129, 56, 190, 22, 101, 249, 92, 218, 9, 127, 64, 26, 131, 198, 126, 2,
+    59, 53, 155, 13, 117, 143, 31, 247, 170, 228, 119, 239, 43, 20, 179, 223,
+    248, 8, 255, 171, 205, 92, 5, 135, 114, 101, 15, 198, 24, 112, 6, 252,
+    214, 254, 219, 212, 239, 121, 134, 76, 90, 208, 144, 154, 25, 253, 173, 1,
+    225, 81, 204, 102, 135, 55, 165, 234, 21, 185, 231, 9, 132, 84, 247, 217,
+    38, 152, 115, 30, 240, 252, 157, 83, 39, 255, 91, 226, 149, 70, 138, 88,
+    133, 193, 70, 158, 2, 255, 217, 11, 114, 183, 131, 206, 96, 166, 113, 232,
+    19, 136, 138, 21, 198, 10, 9, 72, 185, 75, 67, 185, 112, 147, 236, 178,
+    15, 54, 56, 254, 32, 29, 175, 195, 169, 71, 132, 186, 185, 164, 135, 220,
+    182, 235, 73, 114, 250, 208, 12, 201, 145, 211, 214, 241, 148, 121, 72, 31,
+    96, 39, 236, 88, 230, 55, 101, 250, 131, 231, 28, 147, 87, 30, 27, 216,
+    214, 221, 197, 40, 100, 129, 124, 221, 153, 176, 169, 234, 50, 141, 192, 85,
+    47, 214, 144, 168, 41, 203, 17, 90, 105, 28, 237, 59, 162, 202, 131, 22,
+    102, 119, 159, 169, 142, 246, 151, 232, 196, 110, 180, 66, 105, 232, 146, 94,
+    202, 191, 6, 28, 136, 233, 191, 145, 142, 199, 74, 247, 147, 37, 53, 133,
+    131, 63, 118, 29, 150, 196, 152, 79, 160, 9, 103, 12, 96, 147, 11, 213,
+    21, 24, 28, 224, 74, 228, 15, 106, 98, 134, 68, 65, 160, 122, 235, 236,
+    53, 181, 92, 108, 229, 148, 150, 175, 17, 87, 40, 144, 244, 237, 78, 74,
+    102, 233, 198, 139, 151, 212, 238, 109, 173, 179, 10, 25, 103, 31, 112, 97,
+    44, 117, 99, 253, 187, 123, 37, 89, 202, 239, 184, 169, 18, 254, 128, 181,
+    149, 34, 13, 25, 186, 245, 52, 27, 145, 252, 4, 118, 106, 75, 97, 11,
+    88, 15, 50, 31, 43, 26, 234, 3, 62, 243, 73, 84, 96, 112, 167, 53,
+    183, 60, 213, 238, 195, 86, 40, 123, 163, 170, 148, 89, 242, 35, 63, 214,
+    237, 16, 227, 75, 135, 184, 10, 146, 106, 121, 239, 140, 252, 127, 19, 228,
+    202, 30, 145, 48, 224, 108, 158, 80, 186, 154, 116, 149, 12, 229, 177, 225,
+    171, 181, 195, 115, 159, 43, 69, 160, 241, 182, 242, 17, 152, 180, 189, 61,
+    41, 141, 107, 2, 16, 182, 121, 92, 50, 231, 71, 2, 223, 162, 133, 77,
+    157, 221, 166, 212, 230, 240, 204, 19, 110, 87, 201, 42, 111, 179, 105, 244,
+    243, 194, 110, 26, 211, 18, 21, 168, 243, 175, 76, 172, 104, 143, 12, 248,
+    235, 57, 45, 230, 60, 253, 229, 39, 166, 82, 156, 166, 89, 238, 99, 211,
+    78, 227, 182, 217, 55, 140, 9, 49, 153, 44, 125, 60, 200, 124, 176, 23,
+    159, 140, 33, 4, 227, 207, 109, 5, 40, 42, 64, 150, 175, 22, 228, 115,
+    27, 129, 192, 208, 108, 126, 215, 16, 197, 181, 81, 226, 205, 38, 13, 9,
+    42, 46, 152, 87, 130, 6, 77, 95, 145, 20, 18, 144, 111, 150, 134, 238,
+    110, 136, 52, 100, 210, 243, 111, 224, 59, 197, 121, 30, 108, 16, 154, 161,
+    97, 114, 90, 25, 112, 225, 64, 58, 67, 155, 79, 15, 155, 218, 158, 72,
+    223, 58, 142, 21, 105, 111, 85, 19, 165, 241, 111, 243, 203, 94, 87, 208,
+    113, 203, 146, 228, 233, 189, 24, 14, 177, 8, 64, 226, 249, 109, 143, 63,
+    187, 177, 255, 53, 242, 240, 69, 33, 21, 244, 113, 135, 144, 62, 192, 78,
+    197, 176, 209, 239, 68, 90, 234, 206, 244, 164, 110, 202, 233, 27, 211, 56,
+    59, 17, 176, 115, 191, 216, 124, 78, 174, 60, 54, 173, 177, 167, 151, 209,
+    70, 172, 9, 186, 227, 226, 80, 200, 31, 248, 167, 47, 125, 47, 178, 133,
+    92, 172, 107, 8, 79, 201, 100, 7, 157, 170, 94, 48, 179, 254, 163, 150,
+    238, 43, 177, 61, 77, 82, 139, 34, 180, 206, 71, 215, 246, 128, 102, 193,
+    210, 56, 199, 118, 89, 137, 27, 173, 66, 93, 210, 82, 205, 110, 44, 204,
+    238, 35, 79, 1, 241, 83, 182, 116, 135, 68, 69, 132, 51, 205, 149, 220,
+    117, 132, 210, 76, 183, 15, 120, 126, 192, 167, 205, 57, 188, 137, 99, 12,
+    56, 178, 67, 38, 45, 104, 72, 77, 13, 207, 99, 63, 1, 147, 148, 114,
+    181, 249, 155, 10, 215, 225, 243, 59, 74, 106, 23, 27, 126, 140, 65, 208,
+    206, 28, 95, 11, 236, 58, 49, 149, 45, 158, 93, 147, 64, 171, 49, 38,
+    218, 40, 18, 206, 24, 192, 59, 22, 183, 109, 180, 130, 100, 48, 82, 194,
+    42, 48, 56, 221, 148, 213, 30, 85, 74, 162, 121, 159, 145, 107, 212, 196,
+    17, 136, 130, 93, 244, 171, 190, 139, 44, 137, 25, 129, 203, 197, 106, 119,
+    184, 216, 215, 180, 191, 240, 211, 179, 156, 162, 53, 49, 67, 34, 174, 80,
+    61, 74, 75, 217, 134, 165, 20, 72, 245, 199, 156, 148, 204, 207, 145, 138,
+    189, 6, 48, 199, 139, 228, 11, 51, 181, 193, 218, 71, 123, 116, 73, 47,
+    101, 209, 3, 14, 20, 50, 206, 62, 224, 194, 88, 107, 72, 84, 154, 235,
+    134, 45, 234, 198, 231, 107, 246, 74, 178, 149, 188, 125, 207, 253, 14, 199,
+    137, 195, 109, 79, 36, 225, 29, 246, 185, 247, 235, 47, 165, 104, 119, 55,
+    68, 26, 50, 105, 247, 8, 77, 222, 190, 57, 45, 130, 104, 54, 63, 229,
+    8, 236, 212, 23, 76, 165, 65, 3, 168, 161, 150, 194, 22, 176, 30, 100,
+    62, 233, 184, 140, 20, 21, 32, 75, 86, 52, 201, 6, 124, 251, 146, 41,
+    78, 83, 162, 119, 191, 231, 168, 192, 224, 83, 106, 115, 120, 215, 186, 122,
+    247, 97, 55, 13, 183, 193, 155, 172, 80, 246, 91, 200, 187, 1, 8, 91,
+    178, 46, 73, 53, 178, 249, 70, 126, 177, 54, 79, 40, 93, 77, 58, 196,
+    199, 32, 219, 150, 19, 109, 20, 184, 90, 65, 50, 24, 41, 97, 57, 212,
+    242, 195, 5, 229, 254, 70, 174, 104, 103, 14, 161, 139, 38, 213, 137, 60,
+    63, 96, 221, 89, 175, 19, 152, 52, 36, 168, 216, 33, 160, 105, 41, 232,
+    55, 167, 91, 58, 205, 34, 172, 66, 24, 215, 127, 223, 75, 119, 155, 103,
+    173, 229, 123, 64, 51, 238, 230, 35, 86, 138, 93, 255, 113, 153, 89, 204,
+    46, 86, 187, 4, 249, 34, 45, 117, 103, 122, 82, 134, 88, 183, 209, 108,
+    62, 39, 7, 214, 4, 32, 113, 242, 184, 120, 172, 158, 132, 122, 182, 205,
+    100, 211, 142, 4, 163, 89, 23, 27, 169, 20, 160, 168, 29, 98, 154, 39,
+    167, 81, 181, 209, 253, 229, 93, 61, 245, 190, 149, 136, 133, 38, 220, 174,
+    143, 84, 222, 250, 92, 70, 10, 132, 16, 171, 123, 210, 245, 251, 153, 220,
+    52, 4, 168, 111, 95, 146, 152, 65, 187, 36, 42, 77, 251, 67, 152, 196,
+    94, 176, 233, 240, 7, 237, 69, 208, 3, 24, 237, 203, 114, 58, 170, 153,
+    188, 230, 143, 7, 90, 209, 120, 231, 215, 78, 81, 37, 171, 226, 67, 220,
+    10, 36, 164, 37, 81, 178, 193, 198, 187, 219, 95, 203, 22, 202, 130, 206,
+    156, 219, 113, 175, 110, 5, 18, 227, 161, 235, 11, 101, 65, 103, 98, 47,
+    88, 250, 120, 141, 248, 29, 85, 194, 94, 115, 201, 141, 125, 46, 35, 5,
+    66, 8, 219, 2, 84, 185, 161, 73, 76, 174, 131, 218, 10, 80, 84, 128,
+    49, 252, 160, 144, 244, 95, 196, 68, 67, 44, 213, 230, 54, 31, 157, 60,
+    86, 79, 66, 61, 91, 232, 189, 216, 252, 179, 32, 151, 119, 194, 162, 102,
+    23, 43, 211, 2, 162, 217, 135, 76, 26, 18, 84, 221, 163, 29, 232, 17,
+    86, 33, 92, 45, 174, 25, 12, 154, 190, 35, 87, 52, 189, 7, 222, 203,
+    63, 40, 36, 61, 222, 49, 17, 64, 82, 190, 153, 213, 117, 100, 193, 220,
+    13, 104, 200, 185, 251, 190, 166, 151, 204, 195, 253, 142, 222, 221, 118, 151,
+    242, 60, 216, 161, 167, 236, 51, 249, 120, 173, 32, 41, 95, 194, 228, 180,
+    50, 95, 83, 197, 102, 239, 240, 71, 224, 223, 128, 116, 134, 43, 158, 159,
+    165, 26, 208, 141, 111, 235, 30, 43, 169, 33, 144, 163, 116, 97, 81, 51,
+    133, 155, 231, 1, 1, 42, 210, 222, 170, 38, 87, 126, 80, 72, 122, 161,
+    98, 34, 255, 222, 251, 139, 188, 174, 189, 128, 164, 97, 47, 183, 234, 200,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 216, 194, 159, 111, 199, 94,
+    95, 113, 157, 193, 173, 153, 35, 222, 147, 188, 190, 226, 39, 159, 117, 91,
+    188, 177, 84, 226, 225, 147, 186, 94, 71, 47, 70, 161, 59, 101, 97, 217,
+    78, 35, 159, 237, 217, 206, 252, 59, 62, 168, 211, 226, 234, 182, 101, 127,
+    168, 217, 223, 59, 105, 188, 50, 116, 250, 16, 111, 135, 128, 74, 244, 125,
+    142, 94, 140, 95, 118, 202, 194, 175, 156, 70, 86, 156, 19, 48, 177, 148,
+    157, 222, 1, 135, 35, 199, 175, 129, 229, 118, 124, 77, 187, 217, 251, 5,
+    48, 238, 34, 40, 35, 60, 38, 24, 201, 113, 202, 254, 77, 175, 163, 118,
+    210, 101, 17, 179, 85, 145, 138, 241, 252, 7, 79, 164, 100, 232, 233, 32,
+    222, 19, 29, 148, 245, 250, 188, 42, 118, 79, 25, 77, 66, 229, 104, 59,
+    1, 188, 5, 190, 236, 137, 153, 67, 37, 140, 217, 126, 154, 209, 43, 215,
+    198, 50, 184, 77, 172, 37, 38, 96, 127, 53, 39, 161, 2, 19, 116, 231,
+    185, 15, 184, 107, 120, 208, 159, 210, 70, 147, 67, 31, 215, 236, 248, 154,
+    107, 175, 158, 81, 220, 112, 16, 178, 167, 235, 246, 110, 235, 10, 96, 193,
+    68, 80, 70, 120, 76, 48, 51, 200, 255, 174, 131, 14, 25, 9, 209, 241,
+    143, 226, 137, 225, 154, 67, 91, 236, 185, 202, 87, 32, 22, 142, 93, 29,
+    4, 157, 36, 11, 34, 123, 170, 63, 9, 255, 229, 14, 158, 85, 250, 185,
+    53, 80, 206, 161, 186, 127, 3, 148, 200, 205, 207, 64, 161, 38, 58, 53,
+    247, 233, 16, 15, 80, 47, 102, 120, 101, 68, 106, 40, 101, 84, 236, 158,
+    50, 154, 132, 215, 208, 118, 189, 150, 115, 241, 245, 196, 219, 166, 77, 183,
+    2, 101, 10, 97, 197, 15, 47, 134, 74, 5, 218, 167, 149, 14, 2, 81,
+    112, 247, 215, 196, 175, 252, 41, 191, 86, 179, 145, 100, 109, 154, 119, 62,
+    182, 208, 145, 237, 206, 21, 240, 91, 69, 74, 76, 192, 254, 106, 78, 95,
+    4, 38, 157, 136, 211, 175, 57, 52, 17, 46, 153, 231, 232, 211, 111, 30,
+    109, 214, 240, 189, 35, 185, 48, 17, 240, 113, 170, 136, 175, 204, 190, 120,
+    140, 59, 134, 62, 179, 197, 237, 41, 214, 67, 84, 249, 25, 81, 116, 155,
+    178, 88, 75, 130, 33, 162, 165, 224, 32, 121, 83, 203, 241, 220, 249, 96,
+    58, 143, 231, 39, 12, 186, 108, 29, 203, 20, 192, 159, 136, 160, 140, 240,
+    152, 96, 19, 214, 95, 240, 79, 254, 211, 129, 5, 161, 102, 141, 227, 65,
+    27, 28, 50, 18, 191, 255, 190, 79, 124, 46, 220, 66, 109, 99, 34, 62,
+    3, 217, 15, 223, 41, 134, 182, 197, 111, 137, 219, 27, 144, 176, 238, 216,
+    233, 180, 242, 72, 174, 64, 44, 1, 186, 58, 8, 39, 72, 22, 118, 130,
+    179, 110, 125, 100, 87, 86, 213, 215, 68, 246, 73, 126, 18, 227, 215, 28,
+    33, 170, 156, 52, 214, 17, 213, 189, 136, 109, 188, 107, 233, 111, 106, 160,
+    129, 95, 105, 254, 6, 53, 49, 173, 245, 207, 70, 1, 54, 143, 155, 244,
+    141, 135, 131, 128, 95, 76, 116, 106, 243, 207, 85, 69, 28, 239, 152, 18,
+    43, 27, 110, 14, 32, 30, 160, 94, 204, 240, 202, 136, 212, 80, 248, 220,
+    63, 49, 11, 174, 149, 249, 73, 145, 202, 168, 197, 33, 100, 41, 21, 179,
+    189, 236, 18, 106, 90, 78, 163, 119, 74, 194, 32, 45, 103, 49, 230, 255,
+    247, 149, 171, 81, 154, 115, 191, 243, 121, 144, 48, 203, 244, 32, 7, 178,
+    4, 202, 20, 194, 151, 30, 94, 17, 148, 10, 220, 8, 139, 173, 80, 64,
+    1, 96, 9, 203, 169, 83, 55, 28, 4, 162, 224, 243, 179, 149, 113, 145,
+    168, 115, 195, 252, 191, 130, 46, 84, 67, 229, 82, 99, 172, 123, 63, 200,
+    218, 41, 155, 39, 205, 12, 107, 37, 96, 185, 71, 232, 238, 124, 113, 189,
+    63, 199, 129, 42, 253, 182, 54, 190, 238, 210, 248, 153, 222, 91, 96, 119,
+    138, 148, 152, 157, 225, 212, 156, 190, 8, 76, 82, 86, 7, 242, 38, 138,
+    195, 207, 149, 141, 39, 13, 187, 67, 114, 104, 34, 92, 47, 211, 255, 207,
+    36, 44, 181, 54, 125, 45, 178, 18, 205, 187, 222, 60, 218, 177, 253, 103,
+    70, 111, 21, 121, 65, 83, 29, 239, 162, 22, 219, 174, 96, 34, 253, 226,
+    73, 13, 67, 133, 97, 240, 184, 224, 98, 141, 142, 83, 28, 244, 252, 49,
+    5, 118, 17, 124, 123, 151, 199, 82, 177, 134, 221, 180, 142, 19, 188, 201,
+    152, 35, 44, 71, 168, 239, 50, 162, 232, 43, 121, 176, 150, 25, 112, 45,
+    173, 205, 47, 117, 38, 193, 11, 216, 66, 89, 87, 221, 64, 242, 166, 139,
+    255, 165, 154, 155, 200, 178, 135, 172, 249, 250, 98, 100, 239, 192, 116, 3,
+    211, 78, 24, 105, 216, 58, 55, 2, 235, 108, 20, 16, 71, 24, 69, 251,
+    139, 40, 157, 35, 13, 93, 5, 253, 45, 192, 83, 234, 2, 76, 202, 3,
+    90, 140, 176, 1, 38, 177, 190, 253, 158, 225, 187, 31, 10, 95, 254, 115,
+    33, 146, 89, 191, 228, 110, 151, 158, 204, 7, 219, 130, 54, 56, 100, 36,
+    99, 227, 20, 197, 68, 237, 241, 102, 59, 85, 254, 34, 97, 158, 248, 92,
+    165, 132, 218, 198, 68, 124, 185, 92, 103, 51, 98, 218, 133, 183, 217, 189,
+    6, 175, 30, 163, 82, 17, 113, 151, 222, 15, 222, 109, 129, 204, 149, 79,
+    46, 230, 67, 206, 171, 54, 61, 125, 193, 173, 207, 117, 249, 144, 115, 244,
+    162, 18, 6, 243, 144, 4, 100, 81, 65, 128, 88, 2, 105, 116, 16, 78,
+    144, 44, 153, 66, 199, 109, 174, 42, 79, 63, 13, 237, 236, 25, 123, 220,
+    250, 200, 174, 172, 183, 179, 52, 219, 228, 179, 61, 150, 241, 221, 42, 114,
+    136, 241, 146, 252, 36, 219, 179, 56, 66, 73, 80, 51, 13, 147, 227, 133,
+    236, 73, 223, 136, 37, 104, 177, 34, 183, 103, 13, 218, 101, 214, 253, 170,
+    46, 77, 112, 57, 82, 171, 248, 23, 207, 222, 212, 93, 31, 190, 210, 225,
+    12, 106, 23, 28, 75, 50, 216, 224, 141, 144, 145, 171, 98, 71, 247, 131,
+    140, 2, 108, 3, 43, 245, 186, 133, 104, 236, 75, 92, 51, 114, 182, 52,
+    7, 19, 27, 29, 190, 152, 232, 212, 251, 131, 223, 209, 132, 114, 121, 198,
+    183, 165, 102, 66, 170, 138, 56, 195, 45, 36, 86, 54, 220, 28, 114, 72,
+    167, 172, 234, 122, 9, 71, 65, 221, 64, 60, 93, 188, 133, 253, 137, 13,
+    181, 160, 152, 254, 194, 211, 66, 163, 214, 124, 40, 97, 237, 165, 126, 98,
+    22, 65, 55, 239, 146, 63, 53, 103, 225, 13, 209, 31, 104, 158, 15, 254,
+    137, 77, 151, 66, 200, 82, 42, 123, 103, 197, 81, 143, 8, 45, 15, 12,
+    117, 10, 250, 4, 36, 212, 180, 156, 91, 238, 148, 153, 64, 90, 252, 22,
+    43, 243, 156, 176, 203, 232, 221, 155, 206, 98, 209, 227, 243, 55, 75, 162,
+    41, 230, 22, 160, 78, 140, 52, 105, 20, 211, 180, 39, 99, 251, 242, 61,
+    96, 139, 245, 64, 14, 121, 187, 57, 109, 82, 167, 213, 170, 49, 147, 184,
+    8, 137, 40, 153, 51, 60, 188, 34, 53, 20, 208, 75, 183, 246, 244, 98,
+    227, 83, 168, 213, 165, 16, 11, 71, 160, 128, 2, 192, 18, 139, 125, 210,
+    148, 40, 103, 222, 93, 177, 143, 74, 79, 166, 110, 56, 8, 89, 221, 251,
+    123, 55, 151, 100, 241, 87, 207, 7, 130, 138, 230, 246, 226, 63, 77, 230,
+    155, 229, 99, 25, 92, 168, 58, 253, 210, 137, 92, 187, 60, 104, 193, 105,
+    134, 215, 164, 198, 69, 246, 126, 141, 169, 82, 94, 21, 59, 169, 130, 168,
+    33, 252, 52, 147, 43, 78, 135, 24, 214, 74, 192, 111, 142, 205, 243, 140,
+    24, 119, 17, 20, 159, 30, 19, 12, 193, 248, 226, 103, 126, 147, 31, 84,
+    231, 113, 25, 58, 125, 8, 185, 205, 64, 37, 122, 176, 108, 97, 193, 185,
+    237, 47, 161, 182, 192, 238, 180, 163, 94, 214, 42, 113, 254, 199, 93, 47,
+    9, 53, 45, 39, 223, 181, 37, 97, 16, 152, 209, 247, 178, 72, 24, 235,
+    122, 16, 141, 89, 164, 172, 14, 249, 76, 9, 155, 131, 55, 7, 124, 110,
+    145, 150, 139, 87, 196, 242, 170, 198, 78, 26, 107, 134, 228, 208, 68, 184,
+    94, 187, 150, 216, 244, 233, 35, 142, 27, 201, 195, 122, 227, 131, 72, 88,
+    119, 108, 250, 90, 121, 36, 59, 65, 215, 55, 176, 50, 165, 43, 228, 229,
+    135, 107, 161, 120, 169, 127, 231, 206, 140, 222, 95, 169, 62, 23, 110, 33,
+    184, 191, 17, 31, 42, 242, 130, 166, 58, 195, 89, 44, 171, 65, 242, 48,
+    29, 201, 253, 157, 6, 93, 54, 128, 192, 68, 231, 217, 146, 26, 134, 23,
+    194, 253, 24, 134, 120, 182, 85, 68, 217, 102, 95, 60, 109, 221, 196, 7,
+    1, 166, 56, 245, 229, 98, 181, 31, 91, 104, 198, 248, 103, 132, 120, 163,
+    10, 236, 34, 248, 246, 51, 147, 164, 127, 17, 210, 46, 189, 151, 49, 109,
+    204, 213, 226, 208, 167, 117, 1, 38, 101, 143, 45, 70, 88, 142, 127, 183,
+    158, 73, 162, 209, 114, 55, 197, 79, 77, 195, 100, 89, 205, 86, 242, 125,
+    49, 50, 149, 1, 251, 54, 10, 8, 173, 12, 172, 243, 224, 90, 71, 135,
+    94, 234, 76, 159, 22, 173, 56, 152, 216, 232, 153, 180, 19, 238, 139, 108,
+    132, 178, 174, 167, 128, 249, 81, 11, 227, 87, 92, 112, 49, 200, 71, 167,
+    14, 122, 126, 150, 41, 43, 141, 121, 19, 69, 239, 233, 196, 200, 241, 233,
+    18, 22, 212, 27, 176, 152, 89, 9, 195, 157, 232, 6, 187, 156, 48, 210,
+    173, 116, 27, 95, 119, 105, 124, 194, 111, 163, 48, 181, 110, 4, 203, 216,
+    40, 32, 142, 48, 138, 235, 182, 198, 84, 183, 239, 126, 209, 65, 23, 42,
+    11, 80, 39, 70, 26, 186, 10, 231, 90, 157, 211, 146, 184, 41, 221, 228,
+    85, 150, 199, 92, 166, 201, 4, 152, 137, 6, 180, 5, 125, 2, 126, 11,
+    155, 247, 78, 88, 235, 116, 224, 195, 76, 127, 97, 231, 33, 223, 107, 62,
+    20, 190, 148, 189, 254, 136, 230, 129, 52, 79, 137, 127, 225, 230, 66, 57,
+    178, 99, 213, 220, 51, 33, 57, 36, 221, 86, 117, 61, 138, 173, 174, 224,
+    133, 14, 171, 25, 108, 112, 200, 72, 198, 219, 93, 204, 52, 118, 171, 46,
+    151, 57, 91, 26, 40, 151, 136, 199, 255, 204, 118, 170, 225, 68, 240, 85,
+    23, 168, 56, 146, 41, 219, 124, 133, 194, 33, 237, 184, 87, 21, 169, 145,
+    136, 248, 26, 227, 114, 215, 144, 75, 246, 224, 21, 57, 111, 184, 206, 102,
+    196, 169, 23, 115, 175, 103, 183, 122, 81, 9, 3, 247, 72, 2, 50, 166,
+    12, 67, 60, 91, 164, 34, 226, 51, 161, 30, 212, 129, 163, 52, 99, 124,
+    189, 66, 60, 223, 161, 218, 31, 133, 55, 158, 92, 209, 134, 129, 121, 24,
+    128, 234, 240, 192, 3, 160, 27, 64, 75, 108, 122, 250, 159, 71, 131, 234,
+    239, 61, 147, 174, 229, 149, 88, 25, 220, 155, 114, 252, 230, 245, 89, 36,
+    12, 251, 61, 8, 200, 162, 62, 55, 198, 75, 203, 165, 98, 121, 85, 99,
+    130, 29, 176, 4, 210, 232, 32, 156, 61, 88, 90, 223, 47, 107, 21, 182,
+    127, 237, 160, 153, 47, 132, 147, 218, 65, 84, 158, 126, 26, 199, 247, 70,
+    12, 181, 134, 10, 193, 15, 135, 6, 197, 50, 246, 165, 233, 141, 65, 69,
+    115, 123, 29, 240, 105, 202, 46, 211, 30, 52, 238, 186, 104, 171, 213, 123,
+    122, 49, 255, 167, 84, 228, 176, 105, 74, 20, 189, 111, 160, 214, 201, 37,
+    13, 255, 57, 229, 72, 171, 123, 112, 132, 146, 213, 61, 166, 138, 143, 245,
+    36, 1, 25, 83, 160, 102, 26, 59, 219, 23, 197, 146, 163, 13, 120, 164,
+    133, 84, 28, 73, 154, 227, 62, 204, 74, 208, 127, 68, 115, 206, 26, 169,
+    202, 177, 146, 18, 224, 43, 180, 144, 69, 216, 87, 112, 231, 73, 92, 154,
+    224, 114, 164, 75, 237, 46, 63, 139, 195, 245, 39, 44, 251, 58, 112, 239,
+    131, 161, 181, 186, 62, 97, 185, 223, 24, 212, 91, 99, 42, 213, 249, 63,
+    230, 174, 133, 21, 46, 56, 150, 100, 173, 221, 7, 61, 63, 75, 246, 250,
+    9, 11, 106, 131, 88, 76, 162, 138, 196, 142, 243, 27, 5, 4, 216, 6,
+    86, 247, 28, 76, 108, 116, 194, 90, 135, 119, 203, 54, 105, 23, 208, 197,
+    150, 184, 102, 228, 113, 104, 177, 213, 79, 170, 81, 230, 57, 149, 236, 169,
+    14, 38, 54, 58, 97, 45, 205, 181, 235, 27, 214, 228, 169, 85, 166, 115,
+    146, 196, 118, 218, 163, 191, 21, 228, 242, 145, 115, 87, 204, 132, 123, 125,
+    138, 139, 53, 207, 44, 38, 81, 69, 73, 9, 112, 155, 90, 72, 172, 108,
+    165, 56, 145, 203, 239, 244, 157, 22, 243, 29, 56, 249, 228, 144, 83, 69,
+    201, 244, 18, 142, 130, 167, 60, 82, 204, 42, 14, 170, 77, 255, 31, 102,
+    128, 120, 186, 101, 23, 231, 15, 26, 119, 93, 88, 186, 37, 10, 208, 185,
+    80, 107, 234, 156, 45, 225, 153, 187, 132, 91, 177, 248, 80, 194, 245, 35,
+    6, 212, 67, 5, 238, 137, 205, 3, 199, 87, 252, 196, 44, 130, 110, 195,
+    57, 126, 31, 149, 99, 171, 235, 220, 49, 178, 164, 191, 106, 206, 223, 26,
+    191, 62, 208, 33, 30, 225, 178, 12, 64, 117, 120, 96, 143, 80, 131, 32,
+    15, 154, 51, 132, 141, 164, 84, 246, 206, 151, 215, 88, 172, 235, 74, 250,
+    11, 135, 83, 86, 162, 3, 16, 90, 30, 24, 234, 20, 233, 8, 122, 193,
+    143, 53, 217, 70, 181, 101, 116, 201, 72, 181, 117, 37, 182, 193, 53, 47,
+    128, 180, 144, 119, 234, 74, 113, 159, 106, 94, 29, 117, 229, 44, 86, 251,
+    37, 125, 139, 205, 167, 43, 61, 238, 201, 148, 226, 35, 212, 188, 58, 234,
+    129, 196, 191, 219, 251, 110, 150, 89, 82, 209, 89, 6, 32, 180, 60, 48,
+    201, 40, 207, 16, 44, 93, 156, 5, 104, 210, 40, 187, 117, 78, 244, 159,
+    3, 106, 175, 140, 119, 202, 232, 143, 198, 235, 249, 122, 192, 11, 247, 128,
+    28, 242, 30, 41, 102, 21, 7, 85, 168, 241, 129, 51, 107, 114, 218, 164,
+    83, 183, 73, 98, 59, 109, 179, 176, 69, 203, 148, 233, 22, 19, 166, 172,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 137, 73, 227,
+    17, 177, 17, 52, 13, 46, 43, 83, 132, 120, 15, 146, 219, 34, 127, 34,
+    104, 26, 92, 86, 166, 21, 240, 134, 219, 56, 51, 206, 51, 92, 23, 114,
+    125, 245, 145, 136, 30, 57, 171, 68, 254, 68, 208, 52, 184, 172, 81, 42,
+    253, 151, 112, 72, 85, 79, 85, 228, 57, 150, 135, 2, 174, 133, 17, 171,
+    112, 102, 129, 102, 184, 46, 228, 250, 247, 63, 13, 152, 226, 147, 119, 48,
+    119, 140, 35, 202, 209, 164, 187, 117, 60, 114, 75, 136, 225, 136, 189, 104,
+    109, 69, 162, 84, 231, 181, 59, 168, 153, 80, 153, 137, 101, 67, 110, 241,
+    208, 159, 51, 224, 144, 170, 158, 170, 213, 114, 49, 19, 4, 65, 23, 186,
+    169, 115, 187, 47, 187, 225, 127, 31, 56, 87, 197, 111, 34, 75, 224, 204,
+    31, 204, 109, 92, 213, 233, 243, 126, 26, 171, 2, 3, 221, 174, 221, 89,
+    81, 251, 194, 160, 250, 98, 45, 217, 59, 238, 96, 238, 5, 70, 137, 191,
+    85, 107, 234, 164, 144, 216, 255, 209, 255, 49, 75, 167, 148, 6, 239, 146,
+    120, 228, 150, 13, 223, 13, 103, 208, 218, 138, 89, 168, 211, 241, 173, 117,
+    28, 110, 28, 83, 221, 244, 161, 10, 44, 171, 119, 118, 77, 47, 160, 47,
+    15, 202, 134, 220, 255, 189, 35, 254, 63, 174, 62, 17, 62, 59, 199, 168,
+    247, 172, 57, 91, 102, 221, 61, 73, 33, 73, 183, 228, 98, 38, 8, 130,
+    46, 239, 148, 222, 88, 144, 88, 131, 233, 76, 13, 91, 6, 86, 105, 79,
+    230, 107, 94, 107, 223, 254, 62, 112, 174, 151, 222, 224, 6, 5, 122, 239,
+    122, 235, 243, 16, 91, 253, 19, 166, 68, 150, 221, 133, 62, 133, 218, 184,
+    183, 207, 251, 252, 52, 205, 223, 62, 148, 143, 148, 238, 181, 153, 228, 168,
+    120, 76, 75, 4, 6, 167, 65, 167, 178, 162, 235, 153, 93, 233, 196, 194,
+    77, 229, 182, 240, 182, 134, 175, 197, 178, 14, 109, 188, 90, 175, 118, 193,
+    192, 193, 10, 140, 15, 99, 170, 214, 201, 211, 230, 149, 208, 113, 208, 62,
+    129, 33, 72, 249, 82, 177, 85, 61, 173, 227, 191, 227, 98, 150, 83, 53,
+    12, 195, 57, 220, 116, 78, 242, 14, 242, 86, 155, 125, 30, 95, 71, 65,
+    240, 213, 49, 26, 163, 26, 206, 189, 169, 9, 178, 77, 187, 121, 156, 210,
+    11, 18, 11, 250, 176, 135, 34, 225, 201, 195, 255, 71, 234, 56, 220, 56,
+    166, 167, 245, 95, 20, 88, 75, 118, 14, 9, 41, 109, 41, 146, 170, 219,
+    116, 71, 220, 51, 238, 236, 154, 94, 93, 94, 30, 137, 17, 165, 227, 103,
+    70, 103, 165, 121, 79, 236, 79, 42, 132, 63, 142, 176, 227, 62, 225, 126,
+    65, 124, 34, 124, 118, 147, 77, 243, 69, 114, 182, 104, 55, 162, 109, 147,
+    109, 66, 158, 99, 216, 22, 246, 206, 204, 167, 122, 146, 66, 146, 115, 213,
+    196, 76, 16, 25, 92, 69, 238, 153, 131, 243, 131, 71, 216, 234, 103, 67,
+    157, 36, 195, 53, 161, 176, 61, 176, 27, 207, 152, 26, 182, 12, 172, 74,
+    124, 66, 161, 140, 161, 47, 194, 182, 49, 229, 136, 212, 210, 158, 209, 214,
+    188, 214, 163, 225, 124, 224, 65, 51, 161, 91, 215, 50, 199, 13, 199, 151,
+    236, 82, 203, 18, 183, 217, 221, 12, 10, 244, 195, 244, 203, 251, 32, 182,
+    231, 38, 81, 84, 69, 233, 229, 114, 229, 255, 246, 14, 157, 180, 162, 41,
+    136, 49, 167, 23, 124, 23, 169, 109, 115, 131, 235, 229, 104, 1, 120, 68,
+    6, 205, 6, 157, 96, 93, 168, 184, 97, 16, 135, 163, 124, 53, 3, 53,
+    193, 119, 47, 213, 77, 240, 152, 14, 234, 159, 36, 178, 36, 245, 122, 1,
+    254, 30, 116, 224, 150, 8, 12, 83, 130, 83, 121, 89, 203, 47, 186, 207,
+    149, 31, 65, 239, 66, 51, 66, 77, 84, 229, 4, 233, 75, 237, 153, 154,
+    215, 113, 253, 113, 17, 67, 151, 121, 28, 218, 101, 16, 211, 52, 96, 76,
+    96, 37, 78, 185, 82, 79, 94, 29, 180, 67, 236, 159, 157, 159, 20, 5,
+    30, 198, 73, 177, 143, 61, 10, 15, 142, 44, 142, 32, 8, 48, 237, 26,
+    53, 247, 187, 209, 55, 189, 226, 189, 124, 31, 66, 144, 239, 164, 127, 50,
+    152, 212, 172, 83, 172, 72, 18, 108, 187, 188, 32, 7, 170, 122, 71, 219,
+    99, 219, 196, 49, 166, 106, 24, 155, 114, 35, 51, 164, 202, 210, 202, 240,
+    60, 136, 65, 75, 31, 10, 165, 232, 156, 249, 28, 249, 172, 43, 250, 60,
+    190, 142, 130, 44, 161, 127, 232, 173, 232, 152, 38, 212, 23, 237, 10, 250,
+    253, 183, 98, 52, 91, 52, 129, 103, 79, 18, 121, 154, 107, 116, 254, 129,
+    37, 234, 37, 181, 106, 97, 57, 42, 30, 19, 242, 37, 185, 22, 36, 22,
+    233, 125, 19, 68, 223, 143, 155, 123, 108, 90, 7, 149, 7, 221, 112, 61,
+    111, 140, 11, 227, 227, 142, 201, 112, 165, 112, 81, 83, 247, 190, 40, 176,
+    150, 106, 199, 42, 97, 20, 97, 101, 94, 217, 149, 123, 52, 238, 236, 28,
+    18, 82, 218, 82, 57, 73, 171, 232, 142, 165, 102, 101, 85, 241, 67, 107,
+    67, 13, 68, 133, 195, 221, 33, 30, 193, 197, 41, 188, 186, 188, 60, 15,
+    34, 87, 219, 206, 140, 72, 140, 202, 173, 11, 173, 8, 2, 12, 124, 136,
+    74, 244, 206, 87, 242, 158, 197, 158, 84, 21, 126, 1, 125, 219, 124, 71,
+    30, 17, 143, 116, 143, 96, 24, 80, 42, 46, 95, 4, 223, 252, 130, 248,
+    68, 248, 236, 59, 154, 251, 138, 228, 113, 86, 181, 97, 233, 245, 233, 216,
+    54, 180, 208, 217, 96, 9, 208, 110, 89, 218, 59, 218, 132, 33, 198, 173,
+    44, 241, 129, 89, 39, 186, 203, 138, 203, 176, 44, 232, 134, 127, 117, 249,
+    133, 83, 244, 57, 132, 57, 230, 183, 149, 152, 32, 50, 184, 12, 26, 23,
+    40, 53, 40, 210, 186, 187, 179, 115, 182, 192, 138, 193, 47, 27, 251, 27,
+    142, 173, 201, 206, 134, 39, 72, 3, 136, 204, 10, 74, 10, 186, 160, 231,
+    229, 213, 163, 48, 155, 106, 95, 125, 122, 125, 54, 131, 45, 52, 113, 24,
+    69, 18, 35, 188, 108, 203, 108, 2, 142, 3, 31, 34, 156, 61, 148, 248,
+    132, 95, 5, 95, 94, 153, 113, 98, 215, 13, 181, 29, 177, 103, 78, 180,
+    78, 106, 148, 95, 73, 132, 137, 205, 185, 33, 191, 177, 101, 177, 91, 223,
+    248, 221, 130, 102, 95, 48, 104, 92, 160, 212, 160, 111, 210, 214, 246, 209,
+    226, 39, 182, 179, 100, 147, 26, 147, 51, 197, 164, 139, 36, 115, 175, 63,
+    250, 135, 130, 171, 130, 7, 200, 138, 160, 119, 247, 215, 167, 24, 20, 245,
+    155, 245, 139, 235, 64, 113, 211, 76, 162, 46, 81, 247, 228, 42, 228, 191,
+    230, 110, 90, 128, 200, 218, 168, 138, 207, 215, 228, 215, 227, 241, 28, 39,
+    117, 89, 82, 33, 195, 44, 198, 85, 198, 215, 252, 50, 12, 38, 221, 42,
+    13, 98, 83, 46, 248, 46, 79, 218, 230, 27, 203, 215, 208, 132, 43, 176,
+    63, 73, 63, 123, 215, 200, 48, 152, 83, 168, 2, 240, 136, 12, 135, 12,
+    39, 192, 186, 77, 109, 194, 32, 139, 185, 107, 29, 54, 29, 19, 205, 148,
+    102, 62, 70, 88, 19, 91, 248, 106, 6, 106, 159, 238, 94, 183, 154, 253,
+    45, 154, 18, 27, 123, 183, 123, 171, 227, 112, 156, 201, 121, 85, 28, 201,
+    35, 72, 121, 72, 247, 244, 2, 225, 60, 232, 221, 149, 128, 192, 89, 200,
+    89, 195, 249, 44, 202, 111, 108, 165, 49, 16, 24, 166, 25, 166, 242, 178,
+    139, 94, 105, 131, 55, 184, 89, 251, 183, 168, 183, 198, 191, 165, 117, 58,
+    7, 79, 62, 130, 195, 132, 102, 132, 154, 168, 215, 8, 207, 150, 199, 183,
+    203, 32, 149, 215, 149, 174, 165, 249, 35, 156, 18, 191, 47, 41, 179, 226,
+    231, 226, 34, 134, 51, 242, 56, 169, 202, 166, 96, 80, 243, 86, 243, 22,
+    139, 29, 217, 107, 45, 178, 32, 187, 104, 192, 152, 192, 74, 156, 111, 164,
+    158, 188, 58, 169, 242, 139, 209, 41, 209, 126, 145, 65, 143, 205, 56, 66,
+    117, 134, 197, 35, 39, 35, 40, 10, 60, 145, 146, 127, 3, 252, 207, 38,
+    50, 150, 50, 28, 7, 18, 186, 193, 251, 123, 122, 20, 30, 1, 88, 1,
+    64, 16, 96, 199, 52, 106, 243, 243, 93, 253, 16, 233, 16, 116, 29, 78,
+    236, 103, 238, 139, 107, 191, 110, 103, 217, 103, 248, 62, 132, 61, 195, 85,
+    254, 226, 246, 141, 118, 104, 118, 204, 51, 170, 22, 144, 209, 134, 100, 45,
+    181, 69, 166, 69, 144, 36, 216, 107, 101, 64, 14, 237, 100, 86, 84, 23,
+    84, 164, 41, 246, 64, 54, 196, 118, 73, 244, 142, 171, 198, 171, 149, 98,
+    81, 212, 48, 43, 228, 192, 189, 109, 186, 119, 186, 161, 111, 127, 255, 99,
+    175, 156, 70, 102, 85, 137, 185, 137, 253, 120, 13, 130, 150, 62, 20, 207,
+    47, 182, 152, 8, 152, 201, 117, 35, 169, 197, 186, 108, 87, 205, 37, 239,
+    56, 239, 69, 86, 233, 120, 97, 1, 25, 222, 132, 198, 254, 137, 254, 113,
+    91, 199, 83, 50, 133, 97, 88, 95, 254, 205, 71, 205, 45, 76, 181, 46,
+    199, 20, 233, 209, 22, 29, 220, 246, 220, 25, 65, 155, 5, 148, 144, 145,
+    231, 115, 196, 104, 182, 104, 31, 206, 158, 36, 242, 41, 214, 110, 58, 39,
+    121, 7, 121, 43, 195, 176, 15, 161, 173, 174, 232, 225, 31, 74, 201, 74,
+    119, 212, 194, 114, 84, 60, 38, 97, 168, 252, 91, 120, 91, 67, 217, 236,
+    89, 7, 184, 94, 249, 74, 111, 44, 72, 44, 207, 250, 38, 136, 163, 3,
+    43, 112, 3, 140, 61, 249, 61, 251, 247, 8, 163, 240, 135, 83, 246, 216,
+    180, 14, 55, 14, 167, 224, 122, 222, 5, 22, 219, 127, 145, 87, 31, 134,
+    31, 147, 237, 84, 245, 86, 146, 163, 219, 1, 143, 224, 87, 224, 162, 166,
+    243, 97, 80, 125, 49, 82, 72, 108, 241, 230, 241, 150, 171, 221, 74, 3,
+    249, 73, 212, 147, 84, 194, 40, 194, 202, 188, 175, 55, 246, 104, 193, 93,
+    218, 183, 211, 153, 211, 254, 177, 129, 28, 165, 236, 185, 197, 56, 36, 164,
+    169, 164, 114, 146, 75, 205, 1, 87, 204, 76, 113, 199, 181, 24, 181, 70,
+    159, 101, 230, 82, 211, 180, 202, 170, 255, 134, 214, 134, 26, 136, 23, 155,
+    167, 66, 60, 67, 227, 28, 151, 103, 151, 46, 133, 57, 176, 244, 198, 68,
+    159, 151, 82, 101, 105, 101, 120, 30, 68, 174, 171, 129, 5, 22, 222, 177,
+    116, 216, 116, 76, 19, 106, 133, 248, 5, 125, 144, 5, 137, 71, 22, 71,
+    16, 4, 24, 248, 13, 148, 245, 25, 76, 106, 86, 167, 86, 36, 9, 54,
+    211, 94, 16, 141, 129, 174, 249, 33, 151, 33, 168, 42, 252, 2, 250, 171,
+    248, 8, 231, 26, 48, 38, 48, 156, 39, 210, 41, 169, 47, 128, 142, 60,
+    34, 3, 232, 3, 192, 48, 160, 84, 92, 190, 8, 7, 117, 193, 18, 89,
+    18, 244, 61, 142, 127, 15, 58, 112, 163, 229, 25, 237, 136, 237, 197, 118,
+    41, 235, 9, 213, 226, 42, 172, 250, 252, 57, 252, 241, 123, 7, 192, 90,
+    81, 154, 172, 119, 194, 207, 247, 207, 173, 108, 117, 189, 175, 192, 18, 37,
+    62, 33, 222, 70, 222, 153, 97, 91, 150, 252, 68, 106, 189, 220, 178, 169,
+    118, 169, 21, 66, 145, 71, 88, 255, 31, 52, 149, 81, 184, 199, 184, 33,
+    79, 191, 108, 11, 123, 103, 178, 78, 105, 139, 9, 139, 125, 88, 205, 17,
+    254, 234, 239, 59, 7, 138, 154, 184, 154, 73, 85, 227, 58, 173, 110, 151,
+    23, 166, 245, 114, 21, 114, 209, 115, 55, 45, 64, 100, 109, 158, 239, 22,
+    99, 164, 99, 229, 126, 25, 6, 19, 224, 21, 24, 52, 46, 80, 106, 80,
+    185, 105, 107, 123, 230, 113, 157, 145, 125, 205, 65, 219, 65, 141, 100, 69,
+    80, 181, 245, 229, 9, 159, 94, 54, 235, 54, 1, 71, 143, 129, 17, 78,
+    144, 128, 214, 189, 39, 90, 39, 53, 74, 161, 170, 66, 202, 232, 6, 13,
+    133, 20, 148, 20, 105, 93, 211, 215, 183, 91, 96, 143, 68, 102, 5, 37,
+    5, 93, 80, 253, 252, 228, 223, 24, 43, 212, 190, 250, 244, 250, 108, 27,
+    90, 104, 226, 48, 138, 162, 157, 93, 235, 69, 235, 88, 22, 116, 67, 177,
+    180, 242, 36, 70, 101, 216, 139, 216, 4, 1, 6, 62, 68, 37, 122, 173,
+    15, 134, 201, 58, 201, 48, 12, 40, 21, 23, 161, 2, 53, 237, 21, 190,
+    10, 190, 188, 47, 226, 196, 179, 26, 119, 188, 164, 246, 175, 187, 175, 136,
+    34, 204, 239, 224, 158, 15, 58, 127, 206, 156, 117, 156, 212, 53, 190, 146,
+    21, 15, 135, 179, 54, 45, 141, 196, 141, 224, 56, 144, 185, 70, 139, 255,
+    111, 66, 99, 127, 202, 127, 182, 163, 237, 167, 25, 204, 190, 230, 11, 128,
+    110, 123, 110, 130, 174, 195, 140, 74, 72, 198, 96, 208, 184, 93, 181, 93,
+    222, 185, 177, 241, 191, 217, 78, 233, 153, 91, 76, 4, 76, 234, 180, 159,
+    218, 236, 93, 54, 113, 123, 200, 59, 52, 59, 102, 151, 85, 11, 72, 230,
+    67, 248, 50, 43, 42, 133, 42, 82, 154, 123, 32, 27, 98, 59, 126, 233,
+    19, 25, 75, 25, 14, 141, 9, 93, 238, 243, 179, 247, 160, 240, 8, 250,
+    8, 58, 128, 39, 118, 189, 119, 203, 83, 48, 40, 247, 43, 247, 11, 203,
+    128, 226, 187, 152, 89, 218, 121, 203, 230, 154, 230, 63, 198, 174, 201, 232,
+    28, 33, 92, 162, 243, 213, 84, 213, 99, 209, 220, 180, 29, 141, 169, 213,
+    235, 16, 196, 229, 196, 87, 220, 242, 159, 78, 9, 209, 77, 9, 131, 179,
+    213, 179, 219, 255, 56, 78, 234, 178, 164, 196, 64, 96, 162, 100, 162, 239,
+    242, 22, 101, 185, 54, 220, 66, 155, 88, 145, 170, 145, 179, 229, 100, 24,
+    76, 167, 84, 203, 210, 187, 128, 27, 128, 135, 232, 74, 51, 31, 35, 44,
+    26, 196, 166, 92, 237, 92, 158, 169, 209, 54, 139, 179, 189, 147, 141, 69,
+    77, 92, 77, 170, 164, 255, 29, 216, 55, 197, 21, 86, 125, 126, 146, 126,
+    246, 179, 141, 96, 45, 166, 77, 156, 31, 158, 111, 35, 111, 194, 190, 163,
+    75, 126, 34, 53, 4, 253, 13, 24, 19, 24, 78, 157, 105, 154, 218, 153,
+    64, 141, 180, 238, 9, 162, 9, 122, 144, 71, 177, 137, 29, 56, 11, 111,
+    214, 58, 108, 58, 38, 135, 53, 204, 124, 140, 176, 130, 38, 53, 43, 221,
+    43, 18, 138, 27, 231, 47, 8, 200, 38, 182, 237, 212, 12, 212, 35, 193,
+    188, 115, 41, 231, 90, 175, 255, 14, 197, 189, 197, 23, 204, 146, 88, 122,
+    99, 34, 41, 36, 54, 246, 115, 246, 75, 219, 224, 37, 143, 242, 170, 160,
+    109, 213, 231, 194, 231, 127, 214, 206, 14, 220, 118, 210, 56, 143, 70, 144,
+    242, 144, 243, 245, 4, 223, 120, 205, 167, 177, 198, 165, 129, 67, 129, 199,
+    248, 42, 244, 43, 73, 223, 55, 29, 157, 178, 141, 178, 155, 239, 88, 137,
+    222, 216, 87, 190, 84, 126, 163, 60, 163, 175, 226, 118, 162, 141, 92, 47,
+    98, 32, 48, 81, 50, 81, 249, 121, 11, 188, 210, 27, 110, 235, 105, 211,
+    64, 131, 64, 205, 116, 37, 151, 129, 159, 22, 109, 178, 235, 115, 77, 115,
+    145, 99, 87, 234, 116, 14, 158, 228, 251, 8, 98, 252, 98, 165, 110, 121,
+    193, 39, 138, 230, 124, 25, 155, 21, 204, 21, 41, 77, 179, 16, 131, 49,
+    147, 245, 80, 120, 4, 125, 4, 29, 64, 157, 59, 208, 181, 235, 115, 139,
+    64, 55, 179, 55, 65, 87, 239, 70, 37, 36, 99, 250, 194, 163, 38, 2,
+    38, 117, 90, 193, 109, 118, 160, 27, 94, 82, 123, 217, 211, 217, 68, 17,
+    102, 249, 112, 79, 137, 215, 27, 152, 200, 98, 200, 112, 28, 72, 210, 35,
+    203, 241, 81, 192, 160, 251, 172, 251, 44, 11, 58, 175, 214, 90, 121, 216,
+    137, 67, 234, 29, 234, 24, 6, 20, 132, 133, 222, 1, 64, 107, 208, 157,
+    45, 157, 148, 37, 222, 85, 33, 101, 116, 201, 34, 51, 140, 156, 140, 160,
+    40, 240, 126, 114, 225, 12, 79, 249, 11, 191, 82, 191, 252, 63, 130, 3,
+    135, 112, 132, 198, 176, 232, 174, 227, 174, 200, 50, 172, 40, 212, 244, 252,
+    234, 17, 151, 70, 78, 70, 80, 20, 120, 63, 57, 254, 6, 99, 88, 116,
+    87, 255, 87, 100, 25, 86, 20, 106, 122, 126, 229, 131, 76, 100, 49, 100,
+    56, 14, 36, 105, 159, 235, 246, 108, 202, 175, 117, 128, 117, 12, 3, 10,
+    66, 204, 111, 142, 244, 40, 60, 2, 176, 2, 128, 32, 192, 147, 104, 212,
+    251, 125, 97, 223, 19, 1, 19, 180, 45, 238, 184, 59, 80, 131, 251, 186,
+    231, 32, 207, 32, 232, 58, 156, 197, 206, 193, 11, 114, 243, 4, 49, 126,
+    49, 220, 55, 178, 238, 157, 69, 115, 214, 99, 220, 206, 175, 206, 237, 124,
+    21, 122, 155, 170, 225, 95, 42, 63, 223, 30, 223, 217, 113, 59, 81, 200,
+    46, 153, 217, 241, 7, 236, 208, 236, 133, 102, 73, 44, 61, 191, 17, 80,
+    184, 228, 253, 97, 253, 177, 107, 103, 7, 110, 59, 105, 200, 90, 119, 138,
+    81, 138, 61, 72, 173, 214, 202, 128, 28, 65, 19, 148, 155, 224, 155, 9,
+    69, 131, 253, 153, 4, 100, 199, 200, 172, 168, 46, 168, 85, 82, 241, 128,
+    108, 149, 236, 78, 129, 79, 185, 159, 185, 97, 95, 223, 171, 63, 17, 148,
+    146, 245, 1, 75, 145, 75, 55, 196, 162, 181, 96, 86, 213, 27, 188, 226,
+    90, 32, 90, 3, 201, 140, 158, 51, 210, 173, 157, 103, 218, 105, 238, 105,
+    95, 222, 254, 227, 198, 67, 37, 20, 46, 57, 120, 95, 120, 107, 211, 208,
+    200, 149, 199, 93, 140, 204, 170, 15, 111, 15, 231, 240, 26, 25, 49, 124,
+    40, 5, 133, 73, 30, 222, 30, 211, 253, 52, 50, 98, 248, 80, 131, 94,
+    113, 45, 16, 45, 143, 234, 70, 79, 151, 105, 216, 10, 23, 146, 60, 161,
+    60, 187, 231, 104, 100, 196, 237, 160, 174, 135, 74, 195, 112, 195, 138, 172,
+    207, 240, 194, 2, 50, 39, 206, 169, 210, 193, 210, 190, 161, 225, 219, 145,
+    134, 74, 161, 21, 145, 225, 15, 225, 226, 182, 147, 166, 100, 23, 194, 40,
+    92, 114, 240, 190, 240, 214, 187, 189, 141, 55, 147, 186, 176, 190, 225, 135,
+    142, 135, 90, 152, 119, 92, 147, 40, 207, 57, 247, 2, 150, 63, 150, 110,
+    149, 89, 119, 192, 172, 183, 191, 44, 58, 165, 241, 165, 50, 130, 43, 10,
+    53, 61, 63, 54, 101, 217, 180, 64, 180, 6, 143, 5, 33, 102, 185, 71,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29,
+    196, 111, 163, 112, 74, 10, 105, 105, 139, 132, 151, 32, 134, 26, 58, 149,
+    222, 91, 224, 148, 20, 210, 210, 11, 21, 51, 64, 17, 52, 39, 81, 177,
+    248, 144, 222, 30, 187, 187, 128, 145, 164, 96, 151, 46, 116, 55, 161, 182,
+    221, 53, 40, 185, 185, 22, 42, 102, 128, 34, 104, 105, 243, 206, 21, 173,
+    127, 34, 208, 208, 157, 174, 241, 160, 164, 114, 78, 162, 127, 237, 61, 161,
+    60, 107, 107, 29, 63, 85, 192, 51, 92, 83, 102, 16, 78, 77, 235, 54,
+    2, 2, 150, 187, 194, 224, 181, 70, 232, 110, 95, 113, 167, 106, 80, 111,
+    111, 44, 84, 204, 29, 68, 208, 245, 170, 48, 210, 215, 32, 90, 6, 6,
+    167, 208, 91, 61, 194, 202, 210, 251, 129, 42, 71, 254, 68, 189, 189, 39,
+    65, 255, 93, 85, 228, 207, 63, 238, 137, 55, 180, 78, 212, 212, 172, 197,
+    104, 125, 211, 254, 156, 89, 254, 199, 122, 95, 120, 214, 214, 58, 126, 170,
+    157, 102, 184, 129, 157, 145, 100, 10, 21, 114, 191, 191, 177, 250, 61, 189,
+    224, 162, 166, 204, 32, 156, 154, 203, 108, 4, 4, 49, 107, 153, 221, 119,
+    140, 187, 8, 79, 63, 234, 129, 102, 109, 109, 186, 239, 14, 253, 241, 150,
+    205, 220, 190, 226, 83, 212, 160, 222, 222, 88, 168, 133, 58, 136, 189, 208,
+    24, 209, 65, 35, 158, 170, 183, 183, 211, 44, 18, 26, 14, 167, 247, 73,
+    96, 185, 179, 64, 180, 12, 12, 83, 189, 182, 122, 153, 137, 234, 141, 15,
+    26, 195, 10, 190, 101, 101, 216, 57, 33, 90, 31, 147, 185, 235, 31, 84,
+    142, 225, 136, 103, 103, 78, 130, 227, 186, 170, 213, 164, 47, 112, 247, 254,
+    171, 130, 14, 14, 197, 6, 116, 154, 44, 207, 131, 126, 193, 15, 110, 117,
+    156, 181, 181, 69, 151, 208, 250, 187, 225, 158, 186, 174, 172, 30, 63, 150,
+    220, 220, 206, 19, 71, 218, 61, 251, 37, 178, 225, 147, 244, 190, 240, 177,
+    177, 116, 252, 73, 39, 204, 109, 56, 118, 142, 48, 132, 244, 250, 216, 216,
+    255, 120, 222, 7, 74, 119, 31, 39, 63, 200, 20, 42, 228, 99, 99, 127,
+    233, 122, 103, 221, 89, 2, 227, 80, 107, 100, 96, 238, 10, 10, 244, 109,
+    237, 71, 91, 67, 81, 133, 64, 37, 41, 139, 216, 8, 8, 98, 214, 47,
+    167, 238, 5, 76, 65, 47, 134, 89, 193, 210, 97, 97, 233, 82, 184, 135,
+    104, 31, 107, 16, 158, 126, 201, 31, 204, 218, 218, 105, 195, 28, 231, 255,
+    49, 118, 212, 241, 221, 185, 85, 198, 179, 179, 226, 71, 139, 199, 121, 43,
+    135, 165, 97, 217, 166, 181, 93, 161, 161, 176, 77, 23, 116, 13, 103, 154,
+    97, 14, 122, 214, 255, 87, 200, 200, 59, 201, 128, 84, 139, 125, 189, 48,
+    191, 130, 70, 33, 73, 115, 115, 187, 88, 36, 52, 28, 83, 160, 244, 208,
+    33, 54, 107, 67, 26, 26, 48, 220, 179, 20, 154, 73, 243, 146, 192, 111,
+    123, 128, 117, 24, 24, 166, 103, 113, 244, 47, 15, 238, 86, 175, 204, 11,
+    202, 127, 113, 113, 45, 227, 230, 212, 169, 21, 201, 7, 30, 52, 155, 20,
+    97, 202, 202, 173, 114, 66, 180, 62, 59, 212, 195, 113, 151, 235, 94, 107,
+    163, 163, 38, 246, 213, 148, 184, 33, 111, 203, 62, 168, 1, 223, 13, 206,
+    206, 156, 25, 219, 105, 73, 183, 114, 15, 81, 11, 113, 149, 7, 167, 167,
+    23, 157, 76, 73, 207, 173, 85, 94, 224, 243, 225, 75, 25, 28, 28, 151,
+    12, 232, 41, 88, 131, 72, 154, 143, 80, 145, 1, 19, 117, 117, 28, 136,
+    127, 9, 222, 153, 27, 252, 159, 30, 220, 234, 37, 119, 119, 138, 51, 189,
+    233, 107, 223, 6, 56, 240, 189, 172, 160, 47, 30, 30, 1, 183, 42, 201,
+    237, 197, 33, 105, 65, 69, 60, 126, 49, 165, 165, 129, 38, 142, 169, 122,
+    235, 60, 173, 46, 230, 76, 52, 59, 204, 204, 10, 162, 25, 137, 252, 241,
+    74, 121, 223, 59, 245, 97, 253, 127, 127, 232, 229, 146, 78, 133, 218, 87,
+    189, 176, 152, 133, 43, 247, 22, 22, 99, 97, 5, 110, 3, 192, 112, 236,
+    1, 96, 21, 245, 233, 173, 173, 227, 240, 161, 14, 148, 238, 109, 40, 110,
+    195, 101, 191, 227, 196, 196, 104, 116, 54, 46, 18, 244, 62, 78, 126, 141,
+    40, 84, 213, 198, 198, 254, 207, 244, 206, 167, 178, 35, 138, 17, 46, 88,
+    30, 223, 175, 175, 117, 75, 99, 238, 33, 168, 4, 219, 160, 214, 200, 192,
+    193, 20, 20, 245, 218, 199, 142, 182, 134, 25, 31, 207, 117, 184, 138, 203,
+    125, 125, 126, 94, 80, 174, 48, 156, 162, 23, 128, 74, 82, 11, 173, 16,
+    16, 196, 177, 94, 83, 193, 10, 191, 211, 239, 233, 34, 65, 167, 121, 121,
+    79, 53, 201, 115, 71, 16, 152, 130, 94, 17, 178, 159, 185, 194, 194, 207,
+    164, 109, 19, 208, 62, 133, 70, 49, 178, 194, 213, 179, 171, 171, 68, 32,
+    250, 51, 86, 36, 214, 32, 33, 252, 143, 62, 133, 169, 169, 210, 155, 56,
+    211, 227, 98, 203, 228, 78, 95, 255, 116, 143, 192, 192, 89, 31, 175, 243,
+    101, 120, 236, 181, 255, 167, 111, 170, 145, 123, 123, 217, 142, 11, 147, 242,
+    86, 241, 113, 144, 4, 31, 224, 155, 18, 18, 82, 10, 156, 179, 116, 76,
+    19, 87, 194, 175, 81, 119, 186, 95, 95, 125, 154, 46, 232, 26, 206, 14,
+    147, 173, 12, 33, 61, 176, 54, 54, 246, 30, 185, 200, 156, 212, 41, 194,
+    28, 244, 177, 227, 174, 141, 141, 118, 143, 29, 168, 11, 250, 52, 6, 115,
+    87, 193, 169, 164, 228, 228, 253, 11, 138, 136, 141, 224, 103, 96, 99, 25,
+    140, 66, 146, 230, 230, 107, 176, 72, 104, 56, 166, 122, 164, 12, 186, 252,
+    8, 152, 143, 143, 224, 52, 223, 72, 190, 188, 93, 245, 189, 66, 108, 214,
+    134, 52, 52, 96, 165, 123, 40, 41, 146, 64, 49, 210, 225, 28, 156, 140,
+    93, 93, 235, 33, 236, 8, 175, 136, 251, 57, 157, 222, 246, 29, 234, 48,
+    48, 81, 206, 226, 245, 94, 30, 230, 253, 242, 125, 134, 87, 224, 89, 89,
+    218, 74, 117, 213, 216, 4, 193, 172, 67, 133, 22, 137, 254, 226, 226, 90,
+    219, 209, 181, 79, 42, 220, 104, 44, 38, 102, 195, 244, 139, 139, 209, 95,
+    70, 149, 201, 48, 143, 14, 60, 104, 43, 40, 194, 137, 137, 71, 228, 132,
+    117, 124, 118, 146, 202, 83, 203, 91, 98, 200, 224, 224, 204, 96, 19, 85,
+    250, 108, 181, 155, 226, 51, 203, 188, 214, 91, 91, 76, 241, 183, 53, 109,
+    66, 168, 95, 141, 144, 187, 246, 220, 50, 50, 199, 117, 32, 21, 235, 88,
+    222, 139, 124, 77, 2, 163, 26, 129, 129, 37, 50, 171, 210, 146, 115, 195,
+    79, 19, 238, 114, 233, 16, 232, 232, 174, 182, 60, 242, 20, 105, 228, 30,
+    162, 22, 226, 55, 14, 83, 83, 46, 39, 152, 146, 131, 71, 249, 218, 205,
+    181, 146, 125, 4, 58, 58, 165, 163, 15, 178, 5, 93, 170, 188, 221, 251,
+    223, 150, 50, 56, 56, 51, 24, 205, 82, 176, 27, 183, 120, 178, 88, 175,
+    220, 56, 81, 81, 184, 156, 90, 114, 54, 1, 144, 41, 3, 160, 63, 2,
+    38, 234, 234, 56, 13, 254, 18, 161, 47, 141, 237, 108, 3, 79, 72, 44,
+    131, 131, 179, 137, 105, 50, 39, 53, 54, 229, 35, 60, 165, 201, 74, 238,
+    238, 9, 102, 103, 207, 214, 163, 43, 33, 76, 159, 213, 131, 64, 135, 135,
+    130, 226, 240, 239, 80, 185, 12, 112, 253, 103, 69, 93, 94, 60, 60, 2,
+    115, 84, 143, 199, 151, 17, 180, 146, 196, 53, 23, 84, 85, 85, 137, 247,
+    195, 175, 65, 141, 66, 210, 130, 138, 120, 252, 98, 87, 87, 31, 76, 1,
+    79, 244, 203, 95, 22, 237, 41, 8, 182, 104, 62, 62, 148, 200, 150, 111,
+    114, 209, 120, 71, 92, 209, 152, 104, 118, 133, 133, 20, 89, 50, 15, 229,
+    255, 101, 131, 51, 114, 232, 34, 124, 236, 236, 159, 221, 165, 47, 99, 229,
+    148, 242, 163, 118, 247, 194, 231, 254, 254, 205, 215, 57, 156, 23, 169, 137,
+    54, 204, 213, 135, 136, 237, 151, 151, 70, 83, 174, 188, 145, 179, 174, 103,
+    125, 45, 23, 86, 243, 44, 44, 198, 194, 10, 220, 6, 157, 179, 163, 18,
+    142, 103, 28, 249, 69, 69, 77, 70, 157, 252, 128, 135, 224, 197, 2, 192,
+    42, 247, 207, 71, 71, 219, 253, 95, 28, 53, 193, 253, 1, 109, 99, 90,
+    189, 197, 46, 46, 80, 121, 200, 60, 179, 219, 218, 80, 220, 155, 202, 99,
+    219, 149, 149, 208, 232, 108, 92, 36, 245, 199, 148, 179, 56, 186, 41, 209,
+    252, 252, 91, 108, 251, 124, 162, 239, 124, 156, 252, 7, 80, 168, 183, 145,
+    145, 225, 131, 245, 129, 83, 121, 97, 88, 147, 164, 32, 226, 189, 248, 248,
+    106, 7, 98, 161, 213, 99, 70, 9, 34, 92, 176, 60, 163, 67, 67, 234,
+    150, 198, 193, 66, 77, 91, 205, 77, 255, 192, 118, 169, 42, 42, 97, 18,
+    81, 225, 196, 87, 8, 171, 93, 177, 141, 157, 159, 40, 40, 247, 169, 147,
+    1, 113, 17, 21, 111, 50, 18, 253, 215, 149, 65, 65, 124, 45, 4, 33,
+    247, 11, 50, 62, 131, 234, 109, 9, 139, 250, 250, 252, 188, 160, 65, 96,
+    37, 47, 250, 236, 73, 29, 67, 129, 147, 147, 119, 56, 55, 97, 230, 63,
+    89, 46, 29, 148, 164, 22, 71, 32, 32, 149, 127, 188, 166, 159, 20, 68,
+    234, 114, 55, 212, 92, 77, 73, 73, 30, 251, 43, 134, 25, 14, 99, 187,
+    195, 207, 68, 130, 83, 242, 242, 158, 106, 143, 230, 142, 32, 126, 127, 172,
+    108, 52, 200, 89, 155, 155, 21, 238, 24, 198, 8, 58, 45, 25, 188, 34,
+    121, 35, 111, 153, 153, 131, 85, 218, 38, 189, 124, 48, 221, 211, 129, 9,
+    105, 101, 240, 240, 8, 209, 77, 6, 59, 102, 23, 140, 98, 121, 153, 183,
+    123, 75, 75, 136, 64, 233, 102, 172, 72, 10, 72, 13, 218, 233, 253, 113,
+    34, 34, 3, 196, 126, 70, 42, 82, 177, 64, 66, 229, 3, 124, 23, 79,
+    79, 185, 43, 112, 187, 219, 196, 172, 132, 45, 70, 115, 54, 29, 38, 38,
+    50, 175, 231, 155, 93, 222, 139, 213, 156, 190, 227, 232, 3, 157, 157, 178,
+    62, 67, 251, 202, 240, 150, 17, 243, 29, 147, 162, 9, 244, 244, 57, 186,
+    212, 219, 76, 234, 197, 119, 227, 83, 222, 73, 63, 246, 246, 175, 1, 22,
+    59, 249, 172, 216, 179, 140, 240, 174, 3, 53, 159, 159, 36, 133, 129, 27,
+    127, 182, 255, 226, 61, 8, 62, 221, 43, 36, 36, 164, 20, 37, 123, 232,
+    152, 226, 38, 82, 171, 78, 151, 33, 77, 77, 47, 144, 178, 91, 110, 130,
+    38, 174, 153, 67, 162, 238, 105, 190, 190, 250, 41, 92, 205, 52, 129, 59,
+    106, 246, 224, 210, 164, 99, 215, 215, 113, 173, 203, 237, 178, 155, 28, 59,
+    71, 24, 66, 122, 125, 108, 108, 241, 60, 111, 141, 37, 181, 1, 255, 40,
+    187, 50, 48, 119, 5, 5, 122, 184, 248, 173, 163, 175, 82, 153, 56, 245,
+    127, 219, 65, 7, 7, 236, 3, 58, 77, 22, 233, 79, 93, 87, 86, 15,
+    145, 75, 110, 110, 103, 135, 173, 109, 144, 243, 104, 12, 230, 174, 159, 79,
+    85, 213, 213, 231, 22, 9, 13, 7, 221, 117, 200, 137, 13, 239, 5, 95,
+    188, 188, 108, 146, 158, 45, 129, 199, 206, 192, 198, 50, 5, 132, 57, 209,
+    209, 214, 125, 144, 208, 112, 81, 211, 4, 169, 145, 117, 206, 51, 184, 184,
+    93, 249, 7, 240, 246, 75, 244, 85, 24, 105, 229, 16, 45, 3, 3, 221,
+    104, 163, 144, 97, 101, 233, 145, 119, 202, 149, 90, 39, 106, 106, 86, 236,
+    52, 176, 231, 127, 186, 247, 103, 132, 216, 177, 17, 104, 104, 192, 87, 246,
+    80, 82, 57, 167, 51, 8, 39, 168, 251, 27, 1, 1, 75, 211, 97, 112,
+    212, 35, 128, 98, 185, 223, 56, 37, 5, 186, 186, 203, 66, 197, 16, 67,
+    13, 157, 166, 214, 124, 72, 111, 15, 211, 211, 64, 198, 82, 48, 197, 23,
+    235, 114, 39, 161, 241, 58, 201, 96, 96, 162, 129, 217, 247, 188, 60, 246,
+    182, 72, 2, 129, 112, 195, 9, 9, 41, 5, 78, 215, 58, 38, 209, 231,
+    249, 250, 17, 174, 221, 178, 178, 169, 148, 234, 183, 173, 8, 204, 35, 150,
+    89, 97, 228, 215, 219, 219, 34, 16, 125, 151, 43, 18, 159, 69, 134, 23,
+    44, 15, 225, 217, 217, 180, 171, 191, 119, 158, 84, 130, 129, 233, 180, 92,
+    69, 235, 176, 176, 63, 47, 40, 87, 24, 78, 165, 208, 88, 76, 204, 155,
+    245, 11, 11, 191, 190, 140, 55, 143, 96, 184, 20, 55, 239, 188, 209, 255,
+    98, 98, 52, 58, 27, 23, 9, 122, 3, 28, 120, 208, 86, 80, 153, 15,
+    15, 142, 213, 21, 234, 248, 236, 30, 216, 23, 115, 38, 26, 147, 102, 102,
+    5, 81, 130, 202, 126, 246, 57, 137, 166, 139, 182, 196, 141, 221, 221, 133,
+    192, 38, 170, 233, 216, 36, 77, 201, 40, 198, 142, 135, 180, 180, 14, 68,
+    177, 138, 111, 194, 119, 43, 217, 102, 139, 101, 177, 182, 182, 152, 255, 115,
+    106, 218, 132, 106, 239, 182, 197, 251, 47, 187, 223, 223, 19, 123, 228, 74,
+    92, 158, 77, 190, 7, 61, 107, 241, 165, 100, 100, 147, 234, 64, 42, 203,
+    176, 80, 122, 104, 158, 27, 187, 175, 13, 13, 24, 110, 215, 10, 77, 170,
+    161, 11, 248, 154, 4, 91, 52, 31, 31, 74, 100, 75, 185, 57, 230, 188,
+    207, 151, 57, 116, 17, 62, 118, 118, 193, 224, 220, 153, 191, 252, 155, 158,
+    38, 193, 228, 207, 32, 205, 205, 65, 113, 120, 249, 40, 210, 134, 90, 73,
+    98, 148, 133, 42, 164, 164, 202, 245, 239, 217, 174, 200, 213, 60, 89, 44,
+    217, 110, 28, 166, 166, 92, 78, 45, 57, 27, 142, 200, 248, 54, 143, 169,
+    36, 22, 207, 207, 215, 202, 186, 25, 157, 148, 239, 169, 135, 119, 57, 250,
+    8, 116, 116, 87, 91, 30, 121, 10, 186, 242, 109, 232, 212, 73, 176, 2,
+    29, 29, 220, 223, 137, 89, 140, 160, 73, 101, 167, 235, 163, 49, 100, 112,
+    112, 102, 48, 135, 164, 125, 54, 84, 161, 200, 72, 211, 123, 110, 25, 25,
+    237, 180, 16, 132, 251, 44, 115, 240, 121, 176, 67, 165, 112, 162, 162, 109,
+    37, 180, 228, 108, 2, 110, 52, 22, 19, 51, 239, 122, 203, 203, 230, 161,
+    35, 196, 234, 24, 61, 82, 6, 93, 126, 4, 76, 201, 201, 112, 26, 225,
+    36, 95, 94, 32, 150, 105, 254, 14, 78, 70, 160, 160, 251, 158, 118, 4,
+    217, 68, 7, 199, 216, 6, 158, 144, 88, 27, 27, 123, 15, 210, 100, 78,
+    106, 26, 3, 183, 165, 238, 218, 82, 114, 114, 240, 139, 69, 68, 200, 112,
+    108, 215, 70, 120, 87, 143, 148, 193, 193, 18, 204, 206, 131, 177, 91, 113,
+    19, 41, 219, 39, 197, 158, 168, 168, 153, 72, 89, 163, 55, 65, 86, 66,
+    152, 35, 183, 27, 128, 19, 19, 25, 217, 253, 195, 160, 111, 75, 134, 247,
+    128, 199, 81, 138, 122, 122, 146, 93, 106, 227, 38, 117, 24, 224, 231, 206,
+    138, 186, 188, 120, 120, 4, 230, 168, 3, 147, 51, 5, 36, 136, 109, 250,
+    240, 182, 17, 17, 143, 98, 63, 35, 21, 41, 34, 117, 57, 149, 106, 46,
+    168, 170, 170, 15, 243, 155, 67, 130, 7, 63, 177, 86, 54, 26, 100, 162,
+    195, 195, 132, 119, 12, 99, 4, 29, 132, 185, 25, 9, 240, 229, 196, 174,
+    174, 62, 152, 2, 158, 245, 139, 153, 125, 118, 170, 128, 175, 206, 199, 199,
+    181, 28, 149, 190, 115, 145, 190, 44, 199, 82, 16, 113, 208, 124, 124, 53,
+    141, 49, 222, 228, 191, 163, 232, 168, 241, 96, 59, 218, 21, 21, 190, 9,
+    166, 254, 98, 165, 240, 142, 184, 191, 45, 208, 236, 23, 23, 40, 178, 100,
+    30, 215, 227, 237, 74, 215, 28, 93, 154, 230, 126, 126, 163, 54, 243, 62,
+    81, 249, 202, 27, 102, 228, 205, 68, 248, 197, 197, 35, 167, 87, 94, 198,
+    215, 215, 223, 9, 71, 189, 14, 242, 172, 172, 168, 35, 192, 126, 64, 205,
+    53, 249, 91, 236, 243, 153, 211, 225, 225, 135, 179, 114, 37, 46, 79, 40,
+    61, 52, 79, 131, 211, 217, 136, 136, 12, 55, 229, 5, 168, 85, 15, 108,
+    133, 183, 19, 13, 199, 51, 51, 140, 166, 65, 101, 63, 123, 18, 168, 234,
+    20, 99, 71, 205, 90, 90, 7, 34, 214, 69, 185, 97, 65, 206, 250, 90,
+    46, 172, 251, 88, 88, 145, 153, 20, 165, 12, 39, 92, 10, 149, 249, 94,
+    230, 241, 49, 49, 26, 29, 131, 133, 138, 61, 123, 91, 36, 1, 206, 56,
+    239, 138, 138, 154, 140, 39, 229, 29, 19, 102, 159, 75, 162, 190, 114, 229,
+    227, 227, 17, 8, 176, 197, 155, 9, 221, 151, 4, 157, 84, 243, 131, 142,
+    142, 171, 231, 190, 56, 106, 159, 192, 83, 107, 62, 36, 185, 137, 231, 231,
+    32, 99, 41, 24, 236, 133, 231, 2, 218, 198, 180, 103, 151, 92, 92, 160,
+    242, 141, 120, 123, 171, 250, 198, 181, 101, 196, 45, 157, 53, 53, 43, 118,
+    26, 88, 253, 177, 169, 160, 165, 43, 137, 198, 171, 55, 55, 189, 205, 216,
+    184, 72, 247, 180, 100, 202, 136, 249, 140, 161, 94, 94, 54, 73, 79, 152,
+    206, 237, 147, 53, 123, 112, 105, 82, 191, 229, 229, 182, 216, 235, 248, 89,
+    195, 142, 241, 20, 211, 25, 24, 181, 140, 140, 61, 92, 124, 216, 223, 217,
+    248, 37, 229, 14, 160, 77, 115, 63, 63, 223, 27, 247, 31, 166, 242, 229,
+    225, 138, 173, 208, 7, 121, 86, 86, 84, 159, 96, 63, 32, 232, 194, 176,
+    59, 85, 64, 217, 103, 237, 237, 212, 14, 196, 95, 183, 198, 223, 116, 84,
+    246, 48, 147, 109, 132, 132, 95, 138, 83, 127, 49, 220, 140, 18, 68, 184,
+    125, 120, 91, 134, 134, 201, 49, 145, 159, 132, 154, 145, 214, 43, 27, 13,
+    50, 81, 239, 239, 66, 181, 6, 191, 2, 128, 182, 135, 154, 227, 157, 236,
+    79, 84, 84, 194, 36, 162, 223, 149, 174, 171, 67, 245, 64, 237, 166, 69,
+    61, 61, 73, 160, 53, 255, 19, 180, 16, 75, 186, 127, 7, 39, 35, 80,
+    80, 243, 79, 59, 2, 226, 34, 13, 143, 213, 220, 119, 109, 41, 57, 57,
+    120, 203, 172, 34, 100, 56, 42, 222, 100, 36, 231, 179, 55, 130, 130, 248,
+    90, 8, 66, 243, 22, 55, 26, 11, 135, 151, 249, 61, 235, 235, 115, 222,
+    159, 98, 117, 12, 100, 124, 27, 201, 218, 18, 11, 233, 233, 229, 101, 93,
+    130, 192, 74, 121, 184, 116, 106, 170, 88, 1, 128, 128, 110, 225, 202, 162,
+    70, 80, 94, 233, 197, 146, 58, 134, 31, 59, 59, 238, 112, 110, 194, 209,
+    126, 67, 45, 170, 49, 74, 204, 21, 82, 82, 101, 244, 249, 226, 87, 100,
+    178, 92, 58, 53, 85, 44, 142, 64, 64, 55, 254, 101, 81, 35, 40, 175,
+    152, 85, 150, 37, 102, 132, 41, 41, 188, 122, 242, 113, 165, 50, 136, 201,
+    228, 110, 181, 184, 154, 146, 146, 60, 235, 86, 17, 50, 28, 149, 13, 139,
+    205, 197, 242, 144, 251, 251, 183, 111, 193, 49, 180, 6, 198, 107, 155, 131,
+    136, 25, 166, 249, 249, 33, 212, 3, 209, 1, 64, 219, 175, 244, 32, 248,
+    83, 172, 144, 144, 170, 80, 148, 241, 135, 90, 252, 254, 69, 216, 104, 141,
+    178, 43, 43, 42, 193, 48, 145, 16, 116, 225, 58, 42, 123, 24, 199, 184,
+    66, 66, 161, 69, 167, 177, 150, 110, 90, 50, 101, 68, 242, 70, 222, 47,
+    47, 27, 170, 169, 76, 103, 248, 71, 246, 10, 231, 130, 12, 212, 70, 70,
+    144, 46, 62, 108, 225, 226, 96, 167, 187, 31, 18, 210, 202, 253, 253, 16,
+    191, 154, 12, 118, 204, 125, 99, 212, 188, 98, 152, 192, 148, 148, 155, 59,
+    13, 44, 240, 214, 46, 5, 196, 242, 47, 115, 246, 150, 150, 13, 128, 207,
+    204, 69, 144, 51, 193, 171, 81, 95, 57, 252, 255, 255, 134, 4, 88, 236,
+    195, 138, 20, 144, 26, 169, 207, 231, 226, 68, 68, 6, 149, 252, 140, 84,
+    164, 9, 84, 117, 10, 191, 173, 232, 45, 45, 141, 17, 107, 172, 210, 190,
+    127, 128, 132, 215, 6, 248, 46, 158, 158, 111, 86, 224, 107, 171, 149, 98,
+    68, 235, 116, 118, 178, 36, 247, 247, 228, 210, 119, 75, 45, 143, 69, 21,
+    90, 140, 230, 108, 58, 76, 76, 100, 67, 211, 43, 186, 161, 88, 209, 53,
+    47, 150, 38, 48, 37, 37, 239, 199, 68, 11, 60, 187, 11, 183, 37, 97,
+    219, 205, 6, 39, 39, 121, 124, 134, 235, 137, 253, 22, 115, 74, 194, 171,
+    135, 12, 78, 78, 242, 248, 17, 203, 15, 231, 49, 34, 251, 58, 59, 89,
+    18, 245, 245, 114, 105, 181, 171, 152, 201, 44, 230, 148, 153, 75, 19, 24,
+    156, 156, 249, 237, 34, 139, 30, 211, 151, 238, 219, 166, 161, 146, 126, 241,
+    241, 67, 2, 44, 118, 239, 69, 138, 42, 180, 5, 209, 216, 116, 152, 152,
+    200, 134, 187, 86, 105, 95, 173, 123, 5, 253, 65, 6, 106, 35, 35, 72,
+    23, 31, 54, 254, 113, 176, 191, 106, 94, 49, 76, 96, 74, 74, 195, 147,
+    136, 22, 120, 107, 227, 217, 122, 16, 124, 167, 86, 72, 72, 85, 40, 74,
+    246, 205, 45, 254, 29, 21, 179, 12, 237, 92, 33, 33, 222, 172, 221, 214,
+    75, 55, 217, 76, 164, 75, 156, 51, 66, 154, 154, 94, 61, 121, 182, 220,
+    25, 196, 136, 203, 232, 236, 121, 72, 243, 243, 213, 185, 238, 150, 90, 3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    59, 13, 104, 189, 68, 209, 30, 8, 163, 65, 41, 229, 98, 50, 36, 59,
+    118, 26, 208, 103, 136, 191, 60, 16, 91, 130, 82, 215, 196, 100, 72, 118,
+    77, 23, 184, 218, 204, 110, 34, 24, 248, 195, 123, 50, 166, 86, 108, 77,
+    236, 52, 189, 206, 13, 99, 120, 32, 182, 25, 164, 179, 149, 200, 144, 236,
+    215, 57, 213, 115, 73, 178, 102, 40, 21, 88, 141, 86, 247, 250, 180, 215,
+    154, 46, 109, 169, 133, 220, 68, 48, 237, 155, 246, 100, 81, 172, 216, 154,
+    161, 35, 5, 20, 193, 13, 90, 56, 78, 218, 223, 129, 51, 158, 252, 161,
+    197, 104, 103, 129, 26, 198, 240, 64, 113, 50, 85, 123, 55, 141, 61, 197,
+    254, 101, 15, 60, 94, 23, 238, 72, 210, 115, 124, 158, 85, 191, 25, 254,
+    179, 114, 183, 230, 146, 121, 204, 80, 42, 176, 7, 172, 243, 233, 117, 179,
+    136, 127, 223, 91, 214, 168, 210, 88, 137, 241, 46, 73, 145, 219, 81, 136,
+    41, 92, 218, 79, 23, 165, 136, 96, 199, 43, 241, 200, 162, 69, 173, 41,
+    18, 81, 178, 242, 83, 116, 150, 104, 100, 106, 216, 45, 192, 119, 137, 18,
+    95, 70, 10, 40, 159, 26, 180, 112, 156, 169, 163, 31, 102, 33, 229, 95,
+    100, 75, 98, 149, 219, 203, 170, 120, 63, 232, 138, 250, 4, 19, 193, 100,
+    151, 208, 206, 31, 52, 145, 253, 128, 226, 100, 170, 246, 110, 7, 122, 151,
+    172, 221, 166, 162, 112, 64, 227, 136, 65, 37, 131, 19, 12, 53, 94, 172,
+    225, 202, 30, 120, 188, 46, 193, 144, 185, 230, 248, 33, 170, 99, 50, 225,
+    218, 199, 118, 197, 248, 255, 223, 152, 26, 167, 209, 196, 200, 81, 22, 218,
+    123, 228, 115, 209, 57, 242, 133, 160, 84, 125, 14, 69, 251, 207, 234, 123,
+    64, 233, 27, 108, 125, 35, 155, 168, 247, 60, 39, 160, 153, 253, 206, 64,
+    13, 254, 163, 182, 177, 77, 185, 176, 15, 255, 92, 146, 63, 171, 162, 13,
+    54, 243, 203, 11, 245, 156, 167, 184, 172, 190, 117, 119, 93, 153, 134, 54,
+    82, 184, 169, 158, 46, 87, 13, 192, 147, 86, 255, 141, 89, 138, 71, 82,
+    105, 181, 193, 35, 106, 134, 19, 200, 48, 23, 214, 104, 59, 184, 99, 105,
+    36, 162, 121, 249, 166, 232, 49, 208, 200, 212, 173, 90, 157, 238, 15, 36,
+    31, 175, 17, 68, 226, 57, 47, 216, 107, 149, 132, 191, 255, 220, 43, 31,
+    190, 140, 20, 80, 35, 52, 117, 224, 37, 79, 91, 62, 204, 66, 215, 190,
+    133, 129, 124, 237, 103, 229, 107, 232, 134, 14, 114, 219, 174, 112, 243, 133,
+    200, 150, 196, 55, 171, 139, 73, 240, 126, 205, 9, 233, 8, 38, 159, 200,
+    243, 155, 172, 138, 239, 90, 87, 248, 221, 140, 32, 12, 106, 20, 187, 243,
+    51, 189, 129, 62, 104, 63, 231, 29, 217, 200, 73, 241, 220, 14, 244, 51,
+    8, 176, 233, 131, 44, 238, 249, 21, 122, 137, 96, 20, 190, 60, 208, 8,
+    69, 167, 81, 89, 224, 128, 219, 13, 130, 74, 27, 38, 24, 106, 188, 69,
+    126, 170, 57, 228, 164, 81, 197, 5, 33, 11, 50, 195, 122, 88, 152, 126,
+    223, 137, 60, 240, 101, 92, 159, 61, 111, 209, 237, 66, 73, 198, 100, 223,
+    228, 132, 84, 77, 33, 141, 129, 53, 204, 144, 196, 167, 43, 244, 64, 228,
+    169, 147, 236, 151, 237, 227, 163, 45, 52, 83, 191, 149, 141, 162, 44, 169,
+    146, 158, 132, 42, 169, 50, 189, 37, 151, 18, 150, 112, 239, 144, 8, 146,
+    246, 213, 230, 191, 114, 249, 23, 93, 168, 250, 28, 138, 235, 131, 201, 246,
+    205, 216, 142, 2, 54, 40, 9, 85, 11, 187, 53, 111, 137, 177, 237, 205,
+    128, 207, 54, 216, 250, 70, 43, 77, 243, 120, 78, 93, 47, 231, 129, 128,
+    187, 194, 94, 101, 190, 151, 53, 69, 80, 57, 103, 184, 77, 213, 165, 187,
+    26, 225, 91, 113, 127, 154, 111, 125, 30, 227, 184, 57, 126, 75, 89, 26,
+    33, 236, 51, 204, 59, 75, 113, 117, 189, 162, 145, 220, 28, 121, 125, 33,
+    108, 251, 139, 22, 247, 37, 83, 109, 69, 97, 234, 238, 186, 47, 17, 108,
+    87, 246, 227, 171, 179, 244, 77, 101, 230, 32, 195, 11, 216, 29, 53, 87,
+    164, 109, 79, 33, 92, 174, 26, 157, 59, 172, 227, 7, 178, 9, 142, 164,
+    159, 96, 39, 156, 24, 127, 4, 149, 152, 237, 202, 226, 208, 59, 170, 159,
+    210, 119, 159, 70, 212, 17, 38, 141, 96, 46, 177, 208, 118, 109, 198, 210,
+    233, 122, 247, 251, 144, 192, 56, 133, 195, 111, 152, 53, 20, 95, 226, 233,
+    72, 89, 242, 239, 81, 205, 98, 189, 141, 181, 71, 180, 39, 193, 30, 72,
+    115, 84, 154, 82, 21, 28, 124, 181, 46, 244, 110, 81, 69, 243, 58, 115,
+    62, 67, 34, 136, 217, 114, 94, 173, 214, 55, 21, 99, 227, 165, 86, 62,
+    5, 78, 74, 53, 157, 163, 64, 165, 117, 118, 60, 134, 129, 151, 114, 5,
+    97, 5, 40, 160, 70, 104, 234, 221, 74, 158, 182, 124, 133, 132, 179, 97,
+    90, 8, 64, 29, 2, 185, 244, 213, 233, 223, 159, 153, 231, 182, 151, 90,
+    23, 31, 248, 199, 206, 215, 214, 205, 17, 28, 228, 171, 65, 224, 251, 23,
+    44, 18, 144, 122, 138, 6, 200, 197, 178, 93, 205, 78, 35, 210, 223, 44,
+    141, 49, 149, 110, 75, 11, 146, 253, 252, 135, 18, 207, 16, 76, 35, 141,
+    182, 60, 253, 211, 15, 218, 140, 245, 95, 198, 59, 42, 114, 126, 7, 182,
+    251, 43, 69, 9, 195, 180, 174, 237, 167, 5, 64, 24, 212, 40, 107, 251,
+    192, 38, 45, 180, 135, 101, 176, 229, 4, 68, 105, 253, 182, 26, 79, 192,
+    102, 103, 31, 124, 208, 126, 211, 58, 175, 141, 146, 255, 165, 28, 245, 102,
+    93, 106, 119, 193, 148, 175, 205, 50, 12, 204, 187, 26, 199, 46, 209, 93,
+    16, 125, 207, 27, 88, 193, 239, 42, 244, 15, 192, 40, 97, 120, 189, 16,
+    43, 112, 167, 166, 28, 16, 241, 34, 87, 78, 233, 205, 3, 74, 153, 43,
+    138, 83, 162, 178, 221, 29, 171, 26, 25, 148, 54, 76, 48, 212, 101, 138,
+    177, 94, 202, 15, 153, 204, 181, 18, 186, 213, 31, 169, 82, 230, 65, 177,
+    252, 73, 114, 213, 85, 162, 151, 10, 66, 22, 100, 155, 244, 176, 45, 252,
+    199, 68, 26, 104, 17, 115, 137, 2, 225, 87, 77, 126, 150, 130, 9, 199,
+    163, 15, 120, 253, 202, 184, 35, 122, 222, 191, 199, 132, 146, 145, 200, 163,
+    152, 2, 16, 64, 142, 105, 61, 114, 125, 254, 238, 97, 240, 163, 236, 152,
+    213, 21, 168, 154, 66, 7, 31, 106, 133, 61, 149, 83, 86, 245, 128, 213,
+    238, 24, 192, 39, 6, 214, 1, 98, 38, 124, 188, 182, 52, 199, 164, 238,
+    79, 59, 197, 51, 199, 219, 91, 90, 104, 166, 99, 55, 7, 89, 88, 79,
+    116, 54, 173, 142, 131, 10, 69, 82, 203, 231, 74, 210, 101, 107, 124, 116,
+    57, 33, 21, 84, 79, 100, 103, 74, 51, 36, 49, 224, 195, 61, 16, 57,
+    2, 44, 125, 233, 11, 181, 121, 66, 144, 101, 24, 5, 161, 15, 52, 2,
+    241, 183, 209, 99, 228, 239, 46, 186, 77, 233, 56, 9, 203, 27, 143, 241,
+    202, 186, 185, 222, 160, 62, 48, 178, 238, 168, 17, 236, 169, 41, 171, 202,
+    135, 173, 1, 4, 108, 80, 18, 170, 22, 107, 106, 222, 15, 127, 199, 135,
+    188, 160, 105, 185, 40, 129, 12, 162, 181, 42, 67, 59, 109, 77, 227, 188,
+    29, 131, 108, 173, 233, 140, 86, 154, 251, 240, 156, 186, 94, 211, 31, 29,
+    38, 142, 4, 16, 173, 93, 72, 146, 88, 177, 181, 95, 60, 225, 59, 38,
+    107, 153, 188, 202, 97, 51, 106, 138, 160, 114, 206, 109, 154, 183, 87, 107,
+    80, 148, 212, 119, 37, 226, 116, 130, 3, 51, 231, 136, 248, 133, 115, 80,
+    52, 223, 182, 226, 254, 41, 222, 250, 60, 219, 109, 114, 252, 150, 178, 52,
+    15, 210, 222, 95, 186, 248, 192, 242, 159, 154, 68, 151, 158, 164, 150, 15,
+    66, 197, 102, 133, 118, 150, 226, 234, 103, 89, 63, 165, 56, 242, 250, 66,
+    121, 200, 14, 56, 50, 71, 252, 226, 196, 24, 22, 64, 90, 192, 222, 121,
+    216, 235, 11, 44, 243, 74, 166, 218, 138, 194, 201, 193, 105, 94, 34, 216,
+    227, 230, 99, 145, 183, 155, 184, 210, 41, 131, 224, 36, 11, 108, 6, 227,
+    174, 241, 219, 75, 123, 245, 154, 202, 209, 64, 155, 22, 173, 58, 106, 174,
+    149, 252, 179, 246, 63, 36, 132, 194, 114, 1, 178, 243, 207, 8, 78, 149,
+    85, 218, 158, 66, 184, 65, 52, 39, 118, 69, 219, 14, 121, 18, 1, 85,
+    110, 215, 246, 255, 252, 144, 42, 47, 213, 4, 242, 235, 27, 32, 37, 110,
+    35, 192, 78, 37, 48, 254, 8, 55, 45, 199, 137, 217, 189, 118, 73, 35,
+    24, 205, 38, 152, 116, 47, 22, 63, 142, 134, 160, 60, 223, 68, 109, 24,
+    185, 238, 35, 140, 181, 34, 76, 7, 192, 92, 127, 189, 236, 218, 145, 185,
+    130, 227, 75, 49, 241, 243, 82, 15, 99, 29, 86, 88, 142, 232, 181, 130,
+    207, 244, 243, 235, 61, 157, 112, 23, 155, 222, 45, 106, 40, 190, 217, 207,
+    244, 249, 155, 86, 121, 76, 110, 31, 56, 159, 4, 143, 74, 140, 253, 244,
+    144, 178, 249, 195, 162, 135, 196, 103, 7, 119, 142, 117, 78, 159, 60, 144,
+    171, 191, 145, 126, 230, 86, 218, 111, 164, 54, 167, 144, 44, 173, 24, 171,
+    230, 168, 41, 164, 42, 56, 248, 119, 92, 245, 220, 162, 138, 251, 116, 230,
+    221, 165, 65, 25, 110, 233, 230, 127, 255, 180, 245, 71, 232, 201, 80, 221,
+    124, 134, 68, 13, 175, 228, 188, 71, 177, 110, 42, 198, 219, 87, 172, 124,
+    71, 139, 44, 176, 235, 53, 162, 79, 18, 47, 3, 35, 185, 101, 136, 71,
+    10, 156, 148, 106, 39, 91, 128, 87, 234, 236, 120, 17, 31, 51, 228, 10,
+    49, 145, 252, 215, 99, 138, 158, 95, 73, 173, 81, 244, 125, 1, 192, 49,
+    194, 10, 80, 93, 140, 208, 201, 167, 148, 33, 113, 248, 23, 21, 123, 194,
+    249, 7, 56, 224, 200, 1, 215, 175, 55, 96, 88, 29, 117, 39, 95, 249,
+    180, 16, 128, 58, 4, 111, 245, 183, 207, 163, 35, 47, 211, 113, 51, 180,
+    143, 29, 232, 135, 64, 190, 235, 191, 108, 226, 10, 202, 177, 67, 23, 143,
+    46, 62, 237, 147, 129, 179, 177, 135, 34, 56, 213, 75, 130, 221, 235, 46,
+    21, 51, 133, 46, 197, 98, 175, 143, 129, 121, 252, 174, 224, 239, 207, 21,
+    88, 36, 61, 244, 9, 12, 141, 151, 121, 186, 135, 156, 70, 185, 163, 88,
+    99, 41, 85, 73, 77, 221, 147, 159, 218, 251, 174, 121, 36, 139, 135, 99,
+    7, 98, 55, 220, 150, 22, 57, 231, 229, 19, 36, 131, 32, 152, 70, 7,
+    60, 111, 95, 97, 210, 199, 39, 239, 70, 82, 13, 102, 66, 170, 98, 60,
+    113, 120, 231, 187, 30, 169, 5, 247, 190, 145, 118, 84, 228, 252, 14, 113,
+    74, 117, 143, 6, 90, 120, 27, 255, 29, 208, 95, 177, 134, 206, 42, 74,
+    235, 86, 138, 18, 155, 117, 65, 199, 83, 10, 128, 48, 181, 80, 214, 235,
+    208, 91, 226, 175, 223, 164, 95, 207, 240, 75, 169, 213, 215, 98, 242, 208,
+    157, 76, 90, 117, 19, 202, 125, 215, 8, 136, 210, 231, 113, 52, 158, 157,
+    166, 65, 50, 200, 87, 27, 99, 223, 171, 201, 251, 2, 19, 6, 186, 166,
+    204, 206, 62, 248, 189, 252, 187, 116, 67, 7, 57, 227, 87, 56, 247, 204,
+    247, 195, 86, 69, 249, 45, 165, 124, 224, 70, 16, 6, 53, 10, 211, 247,
+    186, 212, 238, 159, 53, 67, 135, 100, 24, 133, 107, 52, 147, 92, 191, 186,
+    129, 217, 134, 34, 113, 146, 153, 108, 187, 196, 66, 209, 241, 110, 155, 129,
+    32, 250, 131, 54, 176, 159, 195, 84, 245, 30, 157, 80, 194, 240, 103, 32,
+    27, 247, 235, 139, 244, 78, 221, 92, 86, 95, 180, 181, 160, 194, 67, 27,
+    86, 224, 83, 81, 56, 32, 255, 68, 174, 156, 207, 135, 6, 148, 47, 86,
+    109, 237, 59, 236, 124, 241, 225, 76, 13, 221, 230, 98, 100, 166, 11, 109,
+    9, 166, 89, 121, 167, 58, 75, 52, 50, 53, 108, 152, 96, 181, 202, 9,
+    50, 171, 49, 196, 227, 235, 85, 60, 145, 116, 69, 125, 2, 135, 238, 50,
+    127, 188, 137, 30, 47, 133, 119, 36, 105, 183, 62, 79, 164, 209, 130, 127,
+    68, 177, 225, 163, 107, 84, 105, 44, 202, 246, 23, 170, 198, 227, 166, 68,
+    229, 146, 228, 183, 170, 89, 51, 20, 132, 44, 200, 43, 245, 125, 90, 229,
+    222, 159, 140, 10, 238, 136, 45, 28, 39, 109, 225, 206, 151, 79, 126, 222,
+    147, 136, 52, 208, 34, 230, 15, 4, 223, 174, 154, 252, 49, 25, 18, 147,
+    168, 133, 92, 109, 102, 55, 17, 12, 124, 239, 179, 25, 83, 43, 54, 168,
+    91, 30, 240, 231, 137, 109, 70, 244, 161, 99, 147, 21, 57, 63, 141, 91,
+    96, 19, 152, 90, 205, 188, 88, 252, 2, 34, 186, 240, 91, 13, 169, 96,
+    45, 4, 32, 128, 1, 210, 122, 228, 250, 225, 193, 194, 253, 91, 197, 45,
+    22, 9, 72, 61, 69, 3, 100, 236, 89, 160, 232, 39, 159, 105, 225, 22,
+    183, 42, 77, 41, 132, 14, 62, 212, 23, 122, 55, 166, 172, 247, 29, 183,
+    140, 39, 37, 148, 192, 223, 32, 220, 180, 59, 30, 67, 206, 197, 57, 140,
+    193, 48, 157, 78, 12, 177, 2, 196, 76, 248, 101, 113, 104, 147, 85, 193,
+    250, 61, 245, 243, 72, 96, 28, 204, 239, 185, 76, 148, 10, 161, 113, 250,
+    158, 118, 151, 102, 147, 171, 182, 180, 208, 81, 198, 110, 14, 178, 176, 158,
+    165, 123, 255, 219, 215, 122, 168, 188, 115, 16, 239, 139, 108, 128, 148, 165,
+    232, 108, 71, 1, 27, 20, 138, 164, 139, 211, 148, 185, 202, 214, 248, 232,
+    211, 97, 47, 188, 95, 197, 148, 172, 40, 146, 189, 92, 168, 228, 220, 211,
+    114, 66, 42, 168, 158, 200, 206, 148, 102, 72, 98, 221, 155, 122, 32, 114,
+    73, 79, 66, 21, 218, 25, 208, 156, 197, 9, 75, 56, 249, 72, 4, 73,
+    4, 88, 250, 207, 22, 119, 242, 132, 61, 202, 48, 10, 95, 30, 104, 4,
+    63, 85, 146, 114, 82, 166, 236, 140, 158, 139, 25, 239, 61, 44, 76, 63,
+    255, 115, 191, 198, 213, 195, 92, 105, 154, 207, 112, 18, 139, 54, 3, 255,
+    196, 126, 215, 123, 145, 18, 66, 97, 57, 142, 89, 247, 233, 4, 39, 196,
+    137, 105, 111, 161, 93, 124, 96, 121, 193, 77, 34, 197, 79, 82, 75, 137,
+    178, 100, 7, 28, 25, 173, 126, 113, 98, 12, 11, 32, 45, 96, 111, 178,
+    19, 71, 2, 8, 216, 160, 36, 73, 44, 214, 212, 161, 30, 254, 147, 19,
+    40, 74, 106, 181, 156, 113, 58, 65, 143, 151, 253, 68, 124, 204, 183, 40,
+    101, 93, 210, 111, 80, 31, 24, 89, 119, 84, 134, 118, 218, 154, 219, 101,
+    94, 80, 186, 210, 20, 206, 6, 81, 212, 21, 175, 147, 184, 168, 255, 94,
+    58, 27, 216, 71, 207, 5, 172, 41, 235, 253, 37, 105, 188, 187, 62, 58,
+    1, 22, 176, 250, 139, 212, 178, 33, 72, 188, 12, 140, 222, 137, 26, 1,
+    76, 1, 8, 32, 71, 186, 144, 57, 176, 127, 119, 190, 120, 223, 118, 76,
+    119, 12, 96, 157, 3, 107, 142, 49, 19, 62, 94, 91, 26, 237, 82, 119,
+    214, 47, 101, 137, 194, 102, 212, 9, 93, 228, 129, 218, 41, 115, 174, 214,
+    237, 34, 13, 52, 134, 183, 202, 1, 254, 165, 168, 63, 75, 65, 138, 237,
+    160, 53, 181, 238, 74, 217, 232, 25, 6, 102, 211, 13, 237, 23, 230, 160,
+    155, 56, 221, 83, 14, 8, 246, 17, 165, 39, 250, 232, 143, 37, 194, 155,
+    104, 163, 113, 217, 225, 82, 161, 233, 120, 171, 218, 228, 229, 49, 121, 104,
+    83, 174, 25, 100, 165, 131, 191, 225, 219, 234, 243, 1, 135, 3, 93, 83,
+    30, 185, 161, 190, 105, 237, 157, 249, 35, 41, 136, 51, 33, 85, 49, 30,
+    37, 180, 201, 3, 45, 60, 131, 241, 128, 104, 161, 214, 67, 103, 21, 37,
+    132, 151, 204, 23, 236, 49, 217, 201, 206, 178, 126, 87, 112, 249, 233, 132,
+    191, 154, 164, 170, 168, 224, 199, 193, 109, 243, 87, 178, 18, 203, 205, 191,
+    242, 141, 28, 112, 100, 142, 229, 217, 149, 48, 44, 128, 180, 157, 161, 242,
+    201, 128, 116, 205, 32, 95, 251, 209, 54, 113, 5, 101, 214, 175, 133, 201,
+    173, 203, 22, 88, 251, 148, 81, 169, 9, 153, 143, 159, 210, 188, 68, 173,
+    150, 198, 126, 229, 191, 69, 79, 161, 170, 216, 166, 122, 176, 142, 96, 150,
+    219, 209, 198, 63, 115, 43, 109, 185, 82, 27, 221, 72, 22, 216, 12, 219,
+    224, 220, 174, 130, 55, 250, 115, 177, 241, 90, 244, 173, 116, 234, 40, 224,
+    65, 255, 171, 150, 246, 247, 41, 137, 191, 128, 43, 44, 71, 116, 212, 65,
+    122, 242, 195, 43, 178, 38, 55, 129, 28, 193, 2, 201, 37, 70, 240, 122,
+    55, 229, 123, 241, 126, 72, 21, 153, 228, 2, 121, 251, 131, 16, 156, 55,
+    12, 232, 19, 76, 58, 153, 11, 145, 71, 67, 80, 30, 225, 34, 184, 12,
+    170, 169, 33, 132, 109, 130, 104, 78, 236, 138, 171, 28, 242, 36, 2, 170,
+    145, 164, 73, 57, 41, 83, 118, 70, 79, 203, 130, 249, 144, 22, 38, 145,
+    220, 179, 241, 227, 229, 61, 84, 94, 183, 8, 249, 203, 54, 64, 74, 220,
+    231, 190, 153, 94, 161, 236, 74, 86, 20, 73, 208, 46, 84, 114, 110, 231,
+    70, 157, 156, 74, 96, 225, 16, 110, 90, 147, 15, 175, 103, 236, 146, 70,
+    125, 144, 244, 247, 36, 48, 14, 102, 249, 210, 38, 74, 5, 222, 182, 125,
+    48, 135, 76, 45, 232, 94, 44, 126, 1, 17, 93, 120, 163, 136, 218, 48,
+    11, 138, 36, 144, 172, 143, 50, 118, 162, 80, 116, 157, 193, 186, 254, 11,
+    111, 193, 70, 5, 119, 68, 152, 14, 157, 184, 254, 103, 197, 169, 63, 111,
+    84, 204, 46, 184, 51, 149, 134, 6, 62, 249, 215, 130, 167, 155, 27, 84,
+    25, 219, 150, 98, 255, 251, 164, 30, 198, 58, 172, 176, 1, 205, 119, 25,
+    34, 214, 254, 223, 187, 42, 186, 22, 101, 123, 133, 85, 99, 255, 83, 34,
+    131, 245, 251, 203, 122, 39, 224, 46, 43, 161, 90, 212, 80, 97, 175, 131,
+    184, 248, 147, 118, 62, 246, 254, 38, 136, 224, 115, 49, 50, 83, 139, 184,
+    245, 239, 43, 172, 242, 152, 220, 62, 112, 35, 8, 3, 148, 5, 231, 245,
+    206, 226, 67, 17, 182, 73, 194, 54, 211, 98, 33, 230, 246, 55, 195, 206,
+    61, 121, 239, 155, 89, 19, 149, 206, 14, 238, 1, 234, 156, 35, 120, 61,
+    6, 116, 135, 38, 29, 194, 139, 198, 173, 175, 40, 15, 254, 17, 92, 6,
+    75, 99, 63, 252, 209, 172, 169, 222, 85, 108, 83, 61, 88, 71, 48, 75,
+    112, 110, 87, 65, 149, 125, 183, 214, 246, 45, 122, 216, 58, 117, 20, 112,
+    209, 77, 82, 85, 84, 112, 237, 238, 184, 247, 165, 89, 9, 235, 232, 209,
+    234, 64, 58, 232, 16, 161, 243, 230, 27, 182, 140, 188, 107, 217, 204, 234,
+    167, 87, 130, 50, 220, 207, 209, 254, 227, 117, 247, 142, 205, 143, 160, 167,
+    156, 90, 234, 143, 152, 30, 207, 246, 64, 52, 222, 107, 175, 189, 132, 156,
+    248, 17, 136, 26, 67, 213, 101, 142, 127, 220, 84, 145, 171, 174, 69, 248,
+    195, 28, 224, 167, 7, 4, 123, 134, 220, 157, 125, 116, 201, 156, 97, 195,
+    142, 11, 88, 125, 203, 106, 89, 158, 36, 94, 6, 70, 111, 202, 13, 142,
+    181, 6, 48, 192, 143, 187, 71, 150, 135, 31, 47, 163, 13, 248, 41, 181,
+    20, 37, 53, 212, 78, 182, 29, 174, 201, 197, 240, 34, 62, 102, 213, 20,
+    47, 40, 93, 105, 10, 103, 3, 166, 106, 132, 217, 199, 92, 84, 241, 47,
+    98, 63, 229, 179, 198, 9, 33, 190, 146, 71, 162, 245, 250, 2, 157, 98,
+    89, 50, 141, 14, 130, 216, 63, 182, 49, 6, 139, 16, 152, 48, 185, 89,
+    153, 20, 160, 186, 5, 189, 143, 83, 53, 66, 226, 237, 46, 42, 246, 153,
+    162, 25, 200, 7, 65, 108, 145, 91, 150, 3, 203, 8, 76, 24, 210, 162,
+    239, 14, 112, 221, 141, 2, 179, 67, 110, 192, 176, 58, 234, 78, 190, 239,
+    212, 3, 24, 96, 201, 211, 173, 75, 205, 129, 153, 223, 136, 124, 154, 212,
+    117, 32, 29, 116, 8, 222, 247, 115, 131, 91, 70, 94, 187, 226, 102, 117,
+    78, 45, 117, 201, 76, 15, 233, 123, 32, 26, 111, 187, 217, 208, 66, 78,
+    3, 58, 205, 19, 128, 97, 203, 99, 216, 217, 20, 137, 127, 134, 46, 3,
+    56, 55, 165, 174, 196, 176, 213, 107, 123, 152, 61, 108, 29, 180, 10, 56,
+    92, 124, 199, 59, 31, 123, 127, 19, 68, 112, 183, 150, 25, 167, 203, 92,
+    103, 113, 175, 134, 91, 170, 97, 27, 231, 49, 158, 115, 123, 149, 239, 103,
+    42, 102, 23, 92, 151, 196, 67, 3, 31, 242, 229, 65, 221, 195, 131, 42,
+    17, 107, 127, 225, 211, 21, 93, 11, 188, 179, 204, 164, 191, 241, 167, 17,
+    176, 72, 122, 245, 18, 24, 7, 51, 242, 105, 19, 37, 140, 111, 91, 176,
+    139, 69, 18, 72, 86, 201, 25, 59, 81, 40, 58, 192, 238, 93, 127, 139,
+    198, 82, 170, 146, 154, 167, 59, 35, 169, 235, 65, 242, 72, 11, 19, 198,
+    253, 95, 194, 47, 222, 118, 37, 43, 10, 170, 104, 23, 42, 57, 55, 253,
+    14, 196, 110, 165, 49, 44, 114, 211, 215, 38, 72, 27, 64, 45, 140, 14,
+    53, 201, 6, 24, 117, 253, 108, 219, 116, 103, 97, 254, 34, 31, 168, 53,
+    120, 222, 190, 194, 185, 147, 78, 195, 140, 164, 26, 204, 132, 73, 196, 120,
+    67, 211, 214, 127, 253, 66, 80, 203, 47, 229, 51, 41, 230, 123, 224, 67,
+    226, 240, 211, 107, 60, 79, 10, 243, 97, 63, 236, 168, 213, 229, 28, 226,
+    217, 253, 187, 214, 120, 158, 20, 251, 194, 126, 197, 77, 183, 215, 56, 217,
+    148, 234, 3, 12, 180, 240, 54, 227, 58, 189, 190, 127, 17, 129, 84, 148,
+    175, 231, 107, 177, 240, 33, 40, 235, 153, 252, 151, 154, 115, 179, 112, 175,
+    203, 172, 9, 36, 43, 234, 130, 147, 166, 20, 29, 96, 119, 160, 177, 203,
+    240, 161, 97, 153, 111, 59, 156, 155, 5, 85, 52, 133, 21, 146, 149, 240,
+    189, 182, 217, 67, 163, 85, 190, 131, 253, 150, 79, 183, 179, 196, 249, 189,
+    134, 187, 177, 254, 231, 132, 160, 139, 94, 215, 102, 82, 209, 246, 221, 134,
+    39, 152, 180, 234, 38, 137, 250, 179, 16, 13, 185, 211, 226, 104, 33, 39,
+    28, 149, 220, 87, 98, 88, 228, 187, 179, 76, 144, 54, 128, 90, 5, 28,
+    81, 130, 100, 141, 174, 54, 198, 163, 75, 143, 235, 4, 38, 12, 105, 81,
+    106, 143, 12, 48, 234, 231, 216, 171, 232, 206, 194, 225, 68, 62, 77, 106,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 119, 66, 83, 120, 119, 22, 197, 83, 249, 41, 143, 134, 85, 53, 125,
+    99, 79, 238, 132, 166, 240, 238, 44, 151, 166, 239, 82, 3, 17, 170, 106,
+    250, 198, 158, 153, 198, 245, 136, 153, 58, 82, 245, 22, 123, 140, 151, 255,
+    95, 135, 165, 209, 193, 21, 81, 253, 193, 88, 51, 81, 195, 164, 6, 34,
+    73, 212, 233, 145, 33, 182, 87, 2, 133, 182, 78, 246, 2, 58, 141, 137,
+    164, 28, 225, 148, 242, 110, 47, 145, 247, 13, 47, 116, 164, 247, 44, 246,
+    5, 51, 227, 190, 19, 87, 191, 88, 211, 164, 117, 88, 98, 97, 164, 213,
+    223, 138, 181, 182, 139, 110, 52, 240, 159, 42, 162, 231, 159, 176, 102, 162,
+    155, 85, 12, 68, 146, 181, 207, 63, 66, 232, 104, 241, 159, 232, 166, 163,
+    241, 98, 124, 131, 194, 199, 128, 178, 92, 13, 113, 174, 4, 23, 113, 156,
+    241, 4, 116, 7, 15, 85, 56, 223, 53, 249, 220, 6, 236, 87, 111, 6,
+    138, 52, 87, 141, 46, 128, 211, 109, 234, 72, 154, 147, 94, 63, 243, 26,
+    94, 232, 85, 243, 88, 241, 10, 102, 219, 97, 38, 174, 99, 41, 125, 160,
+    98, 41, 254, 144, 160, 161, 216, 133, 224, 142, 84, 91, 205, 44, 176, 187,
+    85, 234, 176, 196, 194, 85, 183, 163, 9, 119, 113, 11, 220, 104, 253, 199,
+    249, 6, 146, 199, 210, 7, 6, 78, 138, 134, 241, 36, 62, 161, 11, 178,
+    35, 84, 89, 211, 35, 125, 204, 89, 43, 170, 24, 136, 57, 119, 131, 126,
+    132, 84, 22, 10, 171, 84, 107, 9, 10, 210, 131, 151, 14, 108, 66, 254,
+    29, 203, 205, 208, 255, 35, 205, 81, 91, 255, 196, 248, 27, 153, 147, 29,
+    121, 184, 26, 186, 146, 172, 91, 186, 71, 158, 172, 61, 209, 148, 31, 198,
+    40, 4, 219, 85, 226, 65, 8, 46, 226, 37, 255, 8, 232, 14, 30, 170,
+    112, 163, 106, 239, 165, 149, 3, 91, 86, 149, 51, 58, 91, 17, 39, 145,
+    44, 37, 150, 23, 140, 234, 12, 197, 174, 222, 12, 9, 104, 174, 7, 92,
+    29, 187, 218, 201, 144, 41, 59, 123, 135, 253, 166, 123, 31, 173, 253, 254,
+    117, 146, 61, 143, 252, 237, 74, 116, 188, 126, 251, 52, 188, 205, 170, 251,
+    176, 255, 20, 204, 171, 194, 76, 65, 198, 203, 60, 168, 76, 203, 219, 111,
+    168, 73, 214, 155, 74, 254, 247, 49, 34, 137, 82, 250, 93, 196, 82, 225,
+    61, 93, 95, 173, 23, 221, 1, 168, 182, 135, 88, 37, 184, 14, 188, 37,
+    247, 248, 14, 166, 132, 152, 91, 84, 157, 203, 228, 23, 125, 107, 170, 201,
+    125, 149, 153, 170, 115, 91, 18, 238, 226, 22, 165, 208, 231, 10, 41, 249,
+    177, 10, 131, 92, 249, 138, 114, 157, 104, 183, 35, 216, 179, 168, 147, 239,
+    12, 57, 147, 185, 14, 12, 156, 9, 17, 255, 72, 124, 95, 22, 121, 228,
+    173, 95, 65, 228, 175, 203, 95, 101, 32, 158, 121, 29, 73, 34, 117, 54,
+    70, 168, 178, 187, 70, 250, 133, 178, 86, 73, 48, 13, 114, 238, 27, 252,
+    21, 49, 234, 225, 195, 49, 236, 64, 225, 175, 96, 191, 139, 39, 219, 102,
+    159, 90, 168, 44, 20, 75, 168, 214, 18, 20, 185, 27, 51, 28, 216, 132,
+    225, 58, 139, 223, 110, 71, 51, 223, 192, 215, 71, 64, 50, 188, 154, 141,
+    177, 156, 89, 196, 135, 189, 227, 70, 135, 162, 182, 227, 149, 237, 54, 47,
+    59, 58, 242, 109, 52, 240, 255, 176, 62, 240, 180, 115, 176, 108, 196, 185,
+    169, 110, 15, 143, 14, 123, 105, 57, 69, 182, 105, 142, 33, 69, 122, 191,
+    53, 62, 145, 80, 8, 171, 170, 30, 123, 22, 206, 30, 152, 228, 22, 131,
+    150, 186, 184, 196, 101, 117, 200, 229, 217, 130, 16, 92, 217, 74, 227, 16,
+    205, 28, 60, 73, 224, 91, 212, 195, 87, 174, 192, 67, 36, 174, 92, 38,
+    67, 52, 53, 179, 207, 181, 110, 169, 160, 24, 55, 6, 182, 172, 55, 102,
+    116, 182, 34, 78, 63, 88, 74, 49, 46, 5, 201, 64, 68, 229, 212, 64,
+    112, 177, 229, 219, 103, 176, 222, 31, 4, 83, 102, 134, 24, 151, 65, 161,
+    24, 18, 208, 65, 14, 184, 58, 107, 169, 143, 61, 82, 118, 111, 213, 18,
+    217, 111, 4, 21, 18, 247, 145, 181, 237, 252, 186, 64, 49, 57, 246, 19,
+    231, 81, 246, 62, 71, 231, 225, 234, 57, 122, 3, 229, 199, 148, 232, 129,
+    81, 180, 41, 129, 40, 130, 180, 24, 195, 182, 252, 86, 208, 186, 247, 167,
+    101, 252, 235, 104, 101, 135, 73, 235, 125, 227, 40, 133, 75, 153, 152, 130,
+    145, 18, 190, 184, 16, 18, 145, 140, 184, 132, 202, 167, 3, 30, 172, 229,
+    225, 222, 139, 120, 77, 152, 139, 171, 222, 77, 146, 177, 43, 148, 225, 243,
+    98, 68, 15, 252, 58, 30, 224, 252, 189, 27, 30, 107, 152, 164, 18, 180,
+    198, 31, 39, 64, 164, 233, 186, 149, 164, 223, 122, 186, 190, 71, 46, 167,
+    2, 77, 113, 19, 176, 211, 171, 233, 237, 211, 201, 191, 233, 71, 110, 161,
+    33, 87, 120, 12, 112, 255, 74, 109, 28, 101, 74, 243, 237, 28, 81, 21,
+    45, 182, 168, 39, 139, 213, 46, 61, 47, 79, 29, 61, 229, 40, 79, 168,
+    60, 162, 48, 253, 18, 246, 182, 97, 250, 214, 73, 143, 250, 55, 47, 73,
+    230, 182, 36, 193, 217, 44, 87, 189, 211, 141, 148, 26, 247, 141, 33, 234,
+    26, 31, 159, 171, 71, 140, 25, 42, 222, 156, 20, 82, 239, 127, 20, 27,
+    184, 239, 9, 228, 39, 208, 115, 70, 173, 123, 77, 99, 16, 188, 7, 99,
+    13, 125, 188, 240, 205, 168, 86, 38, 115, 208, 24, 2, 59, 195, 24, 114,
+    59, 111, 28, 24, 37, 18, 34, 227, 144, 248, 190, 44, 242, 76, 129, 75,
+    10, 76, 121, 217, 75, 220, 59, 173, 101, 197, 205, 195, 79, 189, 213, 71,
+    190, 130, 213, 67, 139, 190, 202, 64, 33, 242, 58, 146, 68, 234, 108, 162,
+    5, 237, 250, 162, 85, 78, 237, 51, 105, 174, 116, 111, 167, 57, 137, 35,
+    140, 77, 121, 107, 140, 233, 23, 121, 172, 146, 96, 26, 228, 193, 54, 229,
+    42, 251, 15, 42, 19, 251, 255, 210, 42, 85, 187, 239, 156, 177, 244, 75,
+    134, 101, 98, 201, 223, 155, 98, 197, 128, 223, 67, 192, 99, 11, 78, 171,
+    204, 35, 180, 21, 139, 140, 227, 21, 211, 69, 140, 186, 233, 236, 141, 27,
+    158, 177, 64, 251, 77, 88, 40, 150, 77, 177, 36, 40, 111, 54, 102, 56,
+    173, 21, 223, 116, 11, 58, 26, 123, 238, 58, 167, 225, 123, 150, 31, 233,
+    190, 248, 32, 162, 23, 68, 163, 220, 142, 102, 163, 157, 179, 142, 128, 100,
+    101, 41, 7, 127, 37, 178, 149, 212, 158, 221, 30, 212, 139, 118, 221, 121,
+    77, 234, 175, 82, 74, 88, 209, 218, 19, 103, 219, 140, 19, 89, 113, 219,
+    55, 199, 108, 94, 118, 116, 249, 218, 104, 100, 37, 136, 244, 100, 79, 180,
+    136, 206, 238, 227, 216, 35, 65, 132, 185, 39, 253, 227, 125, 124, 253, 117,
+    230, 125, 216, 149, 111, 79, 220, 30, 3, 28, 246, 138, 161, 46, 4, 138,
+    99, 35, 46, 33, 188, 224, 201, 137, 43, 126, 127, 185, 210, 114, 138, 113,
+    210, 1, 66, 138, 244, 99, 106, 124, 63, 160, 16, 75, 73, 165, 48, 217,
+    9, 165, 23, 135, 217, 13, 74, 229, 250, 106, 149, 109, 40, 6, 60, 246,
+    44, 129, 60, 45, 213, 44, 27, 49, 105, 109, 149, 202, 234, 141, 215, 75,
+    180, 127, 249, 75, 59, 16, 127, 226, 24, 230, 235, 192, 255, 151, 238, 152,
+    175, 25, 32, 184, 175, 148, 219, 32, 135, 56, 120, 146, 221, 182, 181, 155,
+    174, 216, 91, 115, 192, 216, 130, 30, 115, 126, 17, 247, 20, 136, 131, 200,
+    248, 225, 65, 157, 134, 72, 65, 184, 76, 134, 104, 106, 123, 131, 119, 220,
+    79, 93, 48, 54, 223, 213, 48, 54, 174, 137, 213, 145, 67, 244, 5, 34,
+    233, 50, 62, 127, 110, 12, 113, 69, 110, 204, 232, 113, 68, 156, 126, 176,
+    148, 98, 92, 10, 143, 25, 78, 34, 61, 25, 218, 45, 34, 189, 181, 241,
+    54, 193, 87, 33, 105, 192, 128, 136, 215, 181, 128, 224, 127, 215, 171, 206,
+    125, 161, 62, 8, 166, 204, 17, 247, 202, 132, 205, 247, 246, 186, 132, 82,
+    231, 242, 39, 107, 61, 219, 175, 94, 48, 51, 130, 95, 48, 36, 189, 130,
+    28, 109, 116, 214, 79, 3, 122, 164, 236, 71, 113, 209, 39, 71, 50, 120,
+    209, 229, 68, 251, 80, 26, 54, 7, 199, 163, 222, 183, 36, 175, 222, 8,
+    42, 36, 243, 63, 119, 199, 229, 105, 128, 98, 114, 169, 245, 119, 215, 169,
+    30, 239, 119, 10, 22, 248, 65, 176, 92, 253, 1, 61, 241, 38, 211, 162,
+    241, 124, 142, 211, 223, 201, 114, 244, 6, 215, 147, 53, 205, 134, 100, 128,
+    218, 134, 106, 75, 128, 38, 224, 253, 114, 83, 226, 238, 86, 130, 31, 162,
+    117, 82, 31, 80, 25, 117, 48, 155, 113, 229, 172, 189, 105, 243, 83, 104,
+    224, 38, 42, 104, 70, 220, 38, 201, 178, 254, 99, 249, 136, 20, 144, 28,
+    202, 229, 203, 208, 202, 19, 146, 203, 250, 219, 80, 23, 150, 47, 45, 25,
+    63, 189, 167, 152, 168, 189, 5, 87, 152, 3, 242, 223, 145, 195, 26, 80,
+    122, 112, 36, 97, 109, 32, 36, 63, 5, 109, 21, 137, 83, 6, 60, 69,
+    215, 223, 161, 83, 35, 62, 88, 83, 41, 192, 62, 236, 160, 220, 128, 105,
+    112, 170, 188, 238, 11, 240, 154, 45, 11, 75, 161, 154, 57, 127, 86, 53,
+    223, 251, 196, 136, 30, 124, 178, 201, 85, 124, 93, 100, 201, 192, 86, 217,
+    179, 138, 206, 185, 235, 81, 229, 116, 60, 221, 229, 103, 54, 60, 214, 45,
+    85, 36, 117, 145, 62, 78, 128, 146, 54, 111, 165, 146, 113, 243, 111, 47,
+    4, 218, 162, 32, 164, 67, 45, 207, 85, 207, 105, 55, 85, 163, 244, 105,
+    97, 142, 92, 83, 4, 154, 226, 38, 125, 34, 141, 58, 79, 34, 181, 49,
+    58, 152, 167, 211, 213, 81, 175, 159, 69, 50, 187, 75, 207, 199, 187, 143,
+    99, 207, 142, 220, 95, 66, 174, 240, 24, 224, 227, 204, 9, 156, 191, 204,
+    153, 166, 156, 119, 245, 208, 196, 251, 197, 101, 131, 172, 148, 218, 56, 202,
+    148, 251, 199, 56, 162, 42, 90, 113, 77, 78, 11, 183, 92, 227, 152, 107,
+    178, 227, 237, 2, 107, 91, 3, 213, 247, 24, 123, 118, 212, 19, 122, 94,
+    158, 58, 122, 215, 80, 158, 77, 120, 89, 96, 231, 36, 241, 113, 194, 13,
+    28, 205, 66, 13, 193, 149, 205, 180, 81, 214, 230, 178, 17, 140, 18, 141,
+    233, 177, 146, 3, 233, 110, 94, 146, 209, 113, 72, 159, 175, 88, 174, 103,
+    187, 158, 243, 193, 123, 158, 120, 155, 193, 40, 88, 199, 25, 250, 109, 211,
+    4, 244, 7, 53, 52, 243, 7, 66, 201, 52, 62, 35, 75, 142, 5, 50,
+    84, 161, 37, 112, 119, 103, 139, 112, 84, 12, 103, 199, 10, 196, 8, 80,
+    7, 41, 194, 106, 40, 164, 195, 254, 40, 54, 109, 195, 18, 213, 78, 189,
+    230, 140, 71, 246, 154, 95, 230, 144, 134, 95, 32, 168, 144, 235, 252, 193,
+    59, 179, 185, 58, 149, 213, 198, 32, 101, 14, 198, 26, 250, 101, 253, 135,
+    77, 172, 76, 230, 189, 48, 4, 177, 98, 54, 118, 177, 12, 63, 54, 4,
+    174, 194, 42, 25, 211, 192, 83, 75, 118, 155, 48, 228, 118, 222, 56, 48,
+    74, 36, 68, 219, 61, 237, 97, 88, 249, 1, 217, 99, 156, 1, 200, 253,
+    99, 179, 13, 203, 93, 104, 216, 28, 59, 182, 152, 31, 150, 20, 152, 242,
+    175, 150, 165, 118, 71, 202, 151, 135, 155, 158, 103, 239, 93, 197, 108, 239,
+    228, 106, 197, 92, 95, 200, 76, 194, 178, 230, 253, 40, 183, 142, 97, 25,
+    183, 134, 11, 97, 137, 128, 66, 249, 116, 57, 136, 201, 216, 192, 204, 50,
+    97, 192, 144, 206, 50, 112, 169, 205, 127, 33, 12, 245, 170, 151, 89, 10,
+    199, 233, 89, 170, 156, 199, 102, 210, 65, 232, 222, 83, 114, 15, 70, 46,
+    72, 148, 145, 46, 188, 89, 148, 159, 251, 206, 110, 139, 102, 15, 108, 9,
+    5, 154, 242, 214, 5, 207, 46, 242, 69, 57, 192, 52, 213, 159, 108, 215,
+    84, 114, 216, 161, 174, 114, 217, 235, 161, 188, 16, 79, 178, 128, 170, 17,
+    180, 27, 235, 30, 84, 38, 235, 227, 185, 84, 170, 107, 195, 37, 127, 245,
+    150, 17, 202, 156, 92, 7, 94, 156, 245, 124, 7, 83, 66, 76, 163, 42,
+    192, 235, 114, 133, 196, 143, 163, 43, 196, 151, 29, 163, 134, 157, 198, 22,
+    156, 75, 133, 70, 117, 179, 205, 240, 83, 179, 129, 216, 240, 127, 180, 73,
+    144, 201, 126, 248, 37, 58, 42, 11, 5, 219, 42, 187, 138, 5, 105, 207,
+    197, 7, 54, 33, 127, 128, 235, 93, 73, 86, 163, 93, 173, 79, 86, 144,
+    230, 74, 129, 99, 20, 2, 227, 164, 154, 176, 80, 49, 154, 127, 72, 80,
+    222, 108, 204, 112, 71, 42, 163, 232, 22, 237, 242, 3, 73, 237, 105, 141,
+    3, 39, 69, 67, 246, 18, 31, 222, 139, 89, 116, 52, 246, 193, 116, 83,
+    223, 246, 49, 62, 207, 97, 237, 64, 89, 46, 136, 3, 118, 165, 185, 3,
+    69, 26, 165, 200, 23, 64, 231, 184, 117, 36, 77, 199, 91, 165, 1, 204,
+    91, 39, 123, 1, 29, 200, 202, 82, 14, 254, 74, 121, 55, 44, 231, 82,
+    180, 44, 49, 190, 82, 228, 225, 69, 212, 91, 203, 55, 26, 120, 181, 33,
+    167, 60, 181, 11, 236, 167, 242, 154, 201, 67, 164, 148, 176, 191, 169, 194,
+    99, 244, 68, 194, 29, 41, 244, 11, 179, 70, 197, 241, 161, 205, 220, 230,
+    38, 206, 171, 5, 38, 178, 226, 171, 110, 147, 216, 188, 236, 232, 239, 169,
+    208, 81, 140, 248, 125, 81, 164, 39, 248, 151, 186, 87, 58, 185, 221, 146,
+    202, 159, 200, 74, 13, 245, 200, 158, 117, 13, 129, 193, 219, 173, 70, 130,
+    21, 111, 78, 191, 8, 94, 141, 191, 136, 176, 94, 120, 232, 84, 43, 19,
+    183, 104, 12, 1, 231, 219, 250, 248, 231, 234, 209, 250, 173, 55, 222, 158,
+    165, 60, 6, 56, 241, 144, 153, 169, 128, 144, 252, 20, 169, 84, 30, 81,
+    24, 240, 9, 123, 91, 190, 9, 95, 92, 8, 9, 198, 70, 92, 66, 101,
+    221, 143, 15, 86, 252, 254, 111, 126, 29, 15, 112, 126, 208, 131, 15, 187,
+    76, 82, 9, 90, 99, 129, 157, 32, 185, 228, 9, 226, 185, 2, 132, 9,
+    245, 198, 212, 248, 126, 93, 32, 150, 146, 206, 166, 90, 154, 206, 20, 65,
+    90, 12, 239, 91, 126, 43, 104, 93, 245, 221, 87, 96, 175, 18, 87, 46,
+    19, 175, 26, 148, 215, 233, 212, 55, 218, 80, 12, 32, 34, 252, 106, 32,
+    56, 214, 252, 227, 189, 88, 111, 129, 2, 167, 51, 67, 120, 241, 88, 31,
+    120, 90, 183, 88, 54, 98, 210, 218, 55, 137, 201, 7, 179, 15, 179, 11,
+    103, 15, 76, 114, 11, 207, 75, 93, 92, 98, 188, 180, 100, 252, 150, 117,
+    254, 239, 150, 118, 32, 254, 217, 48, 209, 203, 157, 227, 51, 193, 45, 225,
+    55, 173, 151, 225, 96, 229, 173, 32, 25, 94, 77, 200, 214, 78, 162, 98,
+    67, 50, 64, 109, 67, 53, 171, 64, 19, 112, 240, 57, 167, 113, 119, 43,
+    65, 52, 112, 19, 21, 52, 35, 110, 19, 234, 89, 127, 191, 242, 68, 10,
+    72, 14, 173, 182, 230, 157, 173, 25, 60, 230, 252, 34, 243, 40, 13, 27,
+    141, 237, 223, 218, 244, 181, 229, 218, 15, 249, 181, 5, 11, 124, 174, 88,
+    46, 240, 142, 144, 130, 39, 17, 144, 130, 109, 152, 17, 208, 212, 246, 27,
+    238, 165, 158, 186, 96, 245, 101, 66, 232, 245, 123, 93, 66, 41, 253, 121,
+    157, 187, 144, 227, 217, 47, 108, 163, 183, 96, 108, 65, 15, 183, 63, 134,
+    245, 10, 68, 207, 100, 124, 254, 27, 225, 228, 24, 27, 87, 202, 228, 198,
+    175, 122, 140, 17, 250, 25, 31, 177, 220, 24, 226, 138, 220, 133, 205, 226,
+    136, 37, 252, 125, 53, 196, 184, 20, 3, 171, 90, 177, 242, 171, 147, 8,
+    177, 113, 12, 115, 251, 96, 241, 197, 119, 76, 50, 156, 68, 122, 50, 169,
+    90, 68, 103, 119, 255, 108, 159, 174, 66, 210, 157, 69, 222, 23, 2, 69,
+    191, 159, 23, 158, 94, 112, 234, 202, 155, 63, 177, 210, 29, 13, 179, 119,
+    29, 221, 254, 179, 75, 129, 250, 95, 124, 16, 81, 133, 34, 106, 79, 224,
+    15, 106, 203, 59, 224, 178, 168, 117, 217, 41, 37, 44, 230, 109, 243, 137,
+    21, 135, 243, 241, 105, 21, 164, 211, 249, 78, 214, 122, 171, 67, 188, 132,
+    203, 70, 255, 132, 231, 172, 70, 93, 250, 118, 200, 131, 79, 214, 32, 243,
+    96, 102, 25, 190, 96, 72, 103, 25, 56, 218, 232, 177, 158, 6, 244, 85,
+    197, 23, 36, 74, 198, 23, 94, 162, 74, 193, 243, 103, 55, 203, 51, 137,
+    54, 138, 142, 226, 191, 78, 142, 100, 240, 191, 215, 136, 235, 160, 52, 108,
+    14, 147, 91, 249, 160, 236, 54, 249, 114, 53, 236, 46, 161, 100, 38, 97,
+    89, 115, 240, 20, 161, 115, 72, 67, 161, 16, 84, 72, 251, 126, 238, 147,
+    215, 210, 29, 196, 228, 214, 49, 27, 59, 214, 6, 145, 27, 2, 87, 97,
+    21, 130, 231, 96, 167, 171, 79, 247, 238, 179, 79, 60, 195, 238, 20, 44,
+    237, 130, 125, 184, 231, 2, 122, 56, 181, 189, 203, 56, 42, 6, 189, 237,
+    5, 98, 4, 40, 141, 154, 97, 53, 255, 76, 187, 89, 255, 248, 1, 187,
+    163, 143, 228, 245, 12, 179, 59, 106, 135, 136, 14, 232, 33, 136, 238, 196,
+    232, 90, 166, 107, 115, 89, 134, 70, 9, 200, 17, 200, 29, 169, 17, 212,
+    150, 29, 76, 221, 231, 228, 166, 217, 193, 172, 25, 102, 138, 78, 209, 102,
+    194, 83, 78, 181, 244, 104, 98, 243, 236, 188, 207, 86, 62, 89, 234, 164,
+    62, 160, 50, 234, 96, 43, 226, 215, 69, 103, 210, 251, 166, 73, 27, 185,
+    220, 73, 182, 247, 185, 153, 2, 109, 81, 16, 82, 175, 152, 233, 208, 221,
+    76, 84, 208, 140, 165, 76, 143, 121, 225, 198, 239, 13, 40, 61, 56, 167,
+    159, 31, 44, 167, 154, 96, 31, 118, 80, 110, 64, 186, 56, 85, 94, 119,
+    137, 215, 139, 189, 137, 38, 57, 139, 233, 171, 160, 46, 49, 94, 90, 50,
+    126, 254, 149, 216, 197, 254, 48, 252, 216, 16, 130, 47, 168, 100, 107, 39,
+    81, 49, 103, 83, 45, 77, 103, 10, 174, 45, 6, 249, 163, 63, 155, 52,
+    160, 244, 224, 16, 17, 126, 53, 16, 28, 107, 126, 255, 208, 44, 185, 206,
+    1, 221, 151, 175, 72, 194, 218, 64, 72, 126, 10, 218, 42, 15, 166, 12,
+    120, 138, 179, 163, 95, 63, 128, 137, 56, 63, 104, 207, 137, 211, 38, 41,
+    138, 45, 191, 206, 192, 16, 166, 70, 124, 176, 166, 82, 157, 124, 197, 93,
+    165, 29, 210, 224, 73, 101, 193, 209, 4, 47, 200, 209, 68, 88, 47, 60,
+    116, 42, 155, 135, 213, 52, 6, 142, 22, 253, 41, 90, 22, 150, 95, 41,
+    114, 254, 172, 106, 163, 235, 149, 13, 60, 97, 191, 122, 34, 97, 128, 154,
+    122, 139, 215, 35, 236, 246, 222, 232, 110, 115, 248, 121, 143, 170, 248, 186,
+    200, 143, 157, 172, 175, 123, 9, 129, 111, 203, 162, 143, 59, 220, 210, 143,
+    172, 13, 220, 100, 133, 32, 253, 92, 180, 18, 168, 237, 215, 232, 120, 167,
+    215, 206, 108, 120, 177, 90, 170, 72, 234, 63, 124, 156, 29, 160, 170, 43,
+    223, 160, 216, 169, 43, 72, 115, 37, 206, 191, 10, 1, 255, 82, 57, 108,
+    222, 87, 57, 226, 251, 222, 94, 8, 169, 89, 64, 85, 134, 90, 131, 78,
+    46, 141, 47, 78, 244, 62, 141, 167, 33, 38, 223, 21, 96, 251, 57, 204,
+    170, 131, 210, 110, 170, 91, 245, 210, 194, 1, 184, 166, 8, 41, 217, 76,
+    250, 221, 193, 129, 22, 221, 77, 48, 129, 59, 40, 55, 32, 93, 28, 164,
+    47, 181, 68, 7, 116, 158, 68, 119, 98, 116, 45, 83, 187, 183, 162, 67,
+    35, 138, 100, 51, 69, 39, 230, 51, 97, 167, 39, 212, 122, 52, 49, 247,
+    118, 94, 233, 43, 107, 150, 131, 147, 107, 3, 198, 131, 1, 165, 190, 132,
+    65, 253, 48, 221, 219, 28, 212, 208, 235, 28, 21, 3, 208, 248, 140, 49,
+    2, 20, 200, 77, 190, 148, 133, 18, 37, 99, 133, 47, 81, 37, 238, 247,
+    189, 149, 235, 151, 202, 27, 69, 242, 80, 118, 27, 242, 57, 148, 118, 23,
+    222, 50, 19, 190, 162, 183, 120, 10, 53, 169, 112, 137, 53, 235, 147, 112,
+    89, 84, 180, 226, 154, 156, 22, 115, 184, 66, 235, 35, 241, 66, 253, 86,
+    35, 160, 125, 59, 100, 207, 169, 107, 16, 247, 219, 45, 214, 121, 219, 199,
+    4, 214, 182, 6, 183, 243, 48, 246, 236, 181, 38, 172, 111, 133, 1, 172,
+    209, 193, 133, 79, 47, 56, 117, 101, 195, 145, 214, 105, 244, 188, 33, 116,
+    244, 179, 160, 33, 154, 240, 178, 192, 211, 72, 255, 226, 153, 131, 254, 114,
+    12, 131, 165, 101, 114, 99, 217, 61, 70, 134, 125, 130, 129, 214, 26, 56,
+    135, 132, 26, 159, 55, 135, 117, 162, 177, 209, 121, 34, 5, 36, 7, 109,
+    122, 212, 252, 109, 137, 242, 212, 140, 139, 62, 87, 44, 23, 120, 71, 72,
+    207, 127, 57, 6, 207, 220, 188, 57, 191, 226, 144, 35, 67, 176, 65, 206,
+    107, 184, 61, 106, 126, 184, 202, 121, 106, 70, 203, 31, 165, 22, 133, 60,
+    173, 36, 33, 251, 159, 246, 33, 240, 43, 159, 80, 176, 147, 50, 233, 218,
+    187, 8, 245, 86, 185, 204, 142, 86, 230, 238, 204, 169, 153, 28, 180, 188,
+    239, 198, 107, 186, 14, 106, 104, 251, 14, 132, 143, 104, 124, 70, 150, 1,
+    10, 100, 168, 95, 74, 121, 40, 59, 131, 121, 146, 74, 59, 133, 111, 25,
+    135, 95, 81, 213, 60, 5, 224, 238, 206, 11, 224, 168, 24, 206, 147, 20,
+    149, 16, 160, 14, 82, 153, 212, 151, 172, 157, 115, 151, 190, 221, 157, 106,
+    61, 26, 150, 245, 59, 47, 250, 155, 80, 85, 155, 225, 80, 108, 218, 155,
+    36, 183, 156, 103, 209, 5, 142, 241, 41, 39, 23, 200, 153, 39, 122, 31,
+    200, 221, 158, 19, 225, 132, 48, 243, 146, 102, 190, 209, 61, 17, 190, 64,
+    77, 61, 203, 229, 159, 118, 123, 111, 116, 55, 183, 201, 147, 110, 105, 201,
+    86, 136, 110, 50, 204, 16, 240, 46, 90, 9, 84, 248, 145, 64, 202, 28,
+    145, 52, 233, 202, 231, 19, 154, 69, 152, 209, 103, 96, 8, 230, 2, 153,
+    100, 230, 34, 44, 153, 30, 58, 21, 195, 205, 228, 26, 3, 71, 127, 196,
+    108, 236, 127, 24, 126, 108, 8, 65, 153, 84, 50, 187, 157, 166, 150, 8,
+    134, 63, 148, 8, 14, 187, 63, 241, 104, 22, 210, 103, 142, 224, 197, 217,
+    236, 43, 96, 213, 236, 161, 112, 96, 148, 72, 136, 171, 122, 199, 194, 176,
+    239, 155, 105, 51, 173, 155, 183, 181, 51, 109, 97, 7, 45, 47, 242, 191,
+    211, 160, 2, 175, 198, 37, 2, 141, 231, 198, 123, 26, 139, 186, 208, 173,
+    56, 118, 113, 117, 237, 149, 93, 117, 155, 34, 149, 130, 51, 4, 60, 133,
+    152, 69, 21, 62, 45, 62, 49, 40, 45, 249, 67, 49, 87, 236, 142, 137,
+    51, 19, 43, 33, 206, 90, 124, 98, 80, 90, 239, 134, 98, 174, 197, 1,
+    15, 102, 38, 86, 66, 129, 195, 186, 151, 216, 195, 213, 212, 151, 184, 190,
+    141, 152, 153, 121, 209, 231, 80, 180, 248, 196, 160, 180, 195, 17, 196, 65,
+    151, 2, 30, 204, 76, 172, 132, 31, 115, 1, 194, 50, 115, 17, 22, 194,
+    15, 29, 132, 239, 232, 114, 13, 143, 173, 4, 67, 145, 74, 4, 7, 211,
+    145, 246, 52, 11, 105, 189, 71, 112, 236, 226, 157, 133, 100, 194, 157, 61,
+    129, 100, 224, 79, 135, 254, 66, 24, 247, 73, 51, 234, 199, 55, 186, 234,
+    43, 68, 55, 25, 102, 8, 120, 23, 45, 138, 42, 124, 178, 20, 147, 207,
+    178, 73, 37, 147, 204, 185, 130, 205, 161, 166, 228, 30, 140, 197, 86, 192,
+    183, 197, 95, 224, 192, 53, 144, 13, 75, 244, 147, 153, 125, 195, 92, 144,
+    53, 63, 92, 101, 178, 53, 35, 235, 129, 220, 11, 204, 30, 216, 18, 43,
+    210, 102, 71, 43, 115, 119, 102, 218, 194, 14, 90, 94, 249, 99, 187, 93,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 239, 251, 183, 113, 149, 175, 199, 215, 240, 220, 73, 82, 173, 75,
+    32, 67, 217, 146, 195, 235, 115, 226, 55, 67, 147, 179, 253, 165, 146, 164,
+    71, 150, 64, 134, 175, 57, 44, 16, 196, 147, 162, 236, 84, 100, 13, 121,
+    219, 246, 234, 221, 96, 197, 118, 171, 155, 203, 230, 217, 110, 134, 59, 123,
+    231, 87, 57, 85, 142, 49, 128, 17, 67, 114, 116, 48, 81, 168, 251, 41,
+    252, 172, 23, 139, 112, 7, 35, 122, 160, 82, 154, 224, 88, 32, 149, 59,
+    89, 197, 168, 200, 26, 242, 171, 241, 201, 167, 192, 151, 236, 75, 183, 219,
+    34, 74, 204, 106, 111, 31, 234, 46, 226, 163, 100, 236, 224, 212, 53, 217,
+    43, 139, 209, 175, 220, 17, 118, 246, 211, 174, 114, 170, 1, 98, 29, 34,
+    134, 228, 196, 112, 102, 222, 73, 190, 177, 33, 35, 114, 59, 248, 172, 41,
+    61, 97, 95, 118, 232, 96, 162, 77, 235, 82, 229, 69, 46, 11, 224, 14,
+    70, 244, 93, 164, 41, 221, 7, 155, 21, 60, 126, 253, 34, 146, 222, 215,
+    169, 92, 235, 191, 125, 231, 240, 79, 176, 64, 55, 118, 178, 151, 77, 141,
+    52, 249, 75, 255, 143, 83, 157, 51, 197, 150, 95, 187, 128, 7, 39, 56,
+    138, 90, 196, 37, 2, 173, 34, 24, 189, 112, 28, 4, 115, 171, 68, 148,
+    133, 212, 222, 62, 201, 92, 217, 91, 200, 197, 221, 181, 106, 175, 156, 80,
+    243, 229, 16, 123, 25, 233, 57, 128, 144, 9, 101, 142, 253, 246, 179, 61,
+    86, 11, 191, 67, 165, 34, 236, 241, 187, 65, 228, 73, 2, 196, 58, 68,
+    17, 213, 185, 240, 8, 50, 48, 141, 43, 38, 75, 157, 173, 27, 175, 143,
+    26, 7, 200, 71, 149, 224, 204, 161, 146, 97, 127, 66, 70, 228, 118, 237,
+    69, 82, 122, 194, 190, 236, 122, 27, 123, 208, 7, 206, 184, 149, 182, 56,
+    63, 191, 232, 25, 90, 129, 103, 126, 205, 192, 89, 154, 203, 164, 215, 138,
+    92, 22, 221, 28, 140, 245, 186, 85, 82, 167, 34, 59, 238, 235, 94, 11,
+    16, 93, 172, 202, 148, 78, 33, 190, 154, 22, 139, 53, 14, 43, 42, 120,
+    252, 231, 68, 57, 161, 179, 79, 184, 203, 99, 250, 211, 253, 158, 225, 208,
+    157, 9, 105, 72, 131, 238, 81, 111, 6, 234, 102, 40, 218, 144, 36, 12,
+    125, 128, 110, 236, 121, 51, 154, 7, 104, 239, 150, 227, 3, 166, 39, 102,
+    151, 49, 146, 123, 217, 157, 236, 156, 93, 208, 152, 51, 223, 177, 174, 237,
+    7, 37, 78, 163, 190, 107, 29, 14, 78, 112, 9, 180, 149, 74, 4, 71,
+    68, 48, 103, 224, 56, 8, 81, 144, 170, 127, 219, 223, 206, 99, 101, 150,
+    77, 21, 233, 123, 71, 163, 225, 154, 230, 75, 136, 53, 23, 181, 161, 124,
+    143, 184, 175, 182, 141, 151, 167, 119, 212, 67, 9, 176, 63, 68, 130, 26,
+    102, 171, 127, 100, 230, 228, 32, 220, 135, 52, 13, 209, 37, 160, 251, 215,
+    32, 246, 50, 207, 114, 29, 61, 18, 202, 1, 231, 241, 123, 122, 202, 91,
+    76, 166, 181, 89, 245, 24, 130, 193, 116, 64, 103, 74, 199, 178, 162, 232,
+    172, 22, 99, 134, 87, 68, 197, 255, 107, 130, 213, 146, 4, 149, 116, 136,
+    34, 183, 67, 237, 212, 247, 194, 235, 2, 40, 155, 94, 156, 192, 169, 222,
+    84, 203, 251, 37, 111, 253, 16, 100, 96, 7, 86, 76, 150, 39, 71, 54,
+    67, 3, 52, 14, 141, 142, 128, 6, 167, 21, 245, 168, 145, 155, 102, 251,
+    14, 100, 238, 72, 20, 77, 84, 28, 55, 221, 133, 95, 57, 194, 254, 132,
+    140, 213, 236, 199, 138, 164, 244, 153, 97, 197, 216, 38, 50, 46, 172, 109,
+    57, 83, 124, 9, 165, 149, 39, 239, 212, 218, 184, 87, 244, 54, 246, 189,
+    14, 129, 109, 55, 113, 112, 126, 99, 205, 50, 180, 31, 206, 252, 27, 205,
+    65, 204, 155, 46, 170, 224, 129, 172, 55, 49, 96, 121, 148, 92, 23, 110,
+    135, 157, 178, 41, 139, 85, 179, 9, 184, 44, 167, 56, 5, 247, 105, 170,
+    164, 83, 104, 102, 5, 88, 30, 250, 116, 222, 72, 240, 238, 106, 168, 188,
+    73, 233, 125, 193, 68, 118, 193, 203, 188, 22, 32, 186, 69, 137, 53, 156,
+    66, 97, 41, 44, 11, 106, 171, 141, 118, 186, 41, 185, 231, 109, 181, 85,
+    124, 206, 239, 42, 9, 111, 210, 248, 28, 86, 84, 240, 229, 211, 136, 114,
+    95, 123, 158, 109, 139, 198, 233, 187, 231, 33, 243, 173, 227, 129, 112, 124,
+    79, 165, 175, 167, 215, 63, 38, 141, 201, 248, 62, 179, 223, 189, 39, 18,
+    210, 144, 27, 193, 162, 222, 12, 201, 204, 80, 169, 61, 72, 24, 48, 70,
+    144, 99, 71, 63, 220, 22, 82, 2, 69, 155, 97, 27, 137, 126, 145, 138,
+    250, 29, 220, 197, 242, 102, 41, 14, 208, 195, 49, 219, 6, 81, 78, 204,
+    51, 98, 21, 230, 107, 180, 103, 201, 238, 217, 32, 31, 120, 137, 171, 26,
+    110, 143, 234, 240, 57, 246, 175, 39, 197, 37, 186, 189, 45, 102, 163, 127,
+    65, 199, 14, 74, 156, 91, 214, 13, 24, 86, 80, 138, 125, 106, 221, 186,
+    234, 45, 236, 140, 46, 9, 69, 201, 97, 214, 58, 28, 156, 224, 18, 117,
+    55, 148, 8, 142, 136, 96, 206, 221, 112, 16, 142, 45, 141, 109, 9, 79,
+    213, 162, 199, 72, 65, 220, 37, 43, 238, 158, 169, 130, 162, 61, 73, 254,
+    171, 163, 129, 198, 202, 49, 154, 42, 207, 246, 142, 91, 223, 41, 77, 198,
+    254, 143, 62, 12, 70, 17, 58, 237, 211, 120, 98, 189, 174, 24, 6, 187,
+    209, 150, 13, 106, 46, 119, 95, 248, 3, 109, 67, 113, 7, 51, 83, 238,
+    181, 134, 62, 109, 186, 27, 187, 216, 152, 47, 243, 177, 10, 35, 170, 120,
+    115, 173, 108, 20, 18, 125, 126, 136, 25, 52, 204, 75, 254, 200, 209, 213,
+    64, 165, 19, 104, 26, 191, 253, 134, 201, 249, 140, 155, 11, 156, 14, 20,
+    152, 135, 237, 238, 51, 43, 195, 45, 74, 93, 235, 179, 64, 241, 100, 131,
+    228, 58, 122, 36, 137, 2, 211, 255, 246, 244, 165, 166, 92, 194, 213, 94,
+    163, 84, 20, 230, 51, 118, 36, 73, 243, 188, 47, 102, 137, 182, 152, 81,
+    119, 178, 247, 48, 25, 159, 232, 128, 206, 148, 147, 121, 89, 205, 102, 77,
+    47, 32, 226, 29, 48, 231, 233, 67, 161, 210, 99, 223, 179, 58, 128, 95,
+    69, 44, 198, 17, 174, 136, 151, 227, 214, 25, 183, 57, 8, 55, 232, 13,
+    68, 115, 170, 215, 113, 96, 59, 39, 80, 52, 38, 197, 254, 107, 165, 124,
+    200, 78, 157, 225, 134, 199, 181, 243, 153, 203, 4, 80, 43, 188, 37, 157,
+    79, 161, 168, 139, 235, 74, 105, 60, 2, 130, 12, 100, 195, 135, 219, 96,
+    108, 207, 226, 234, 136, 200, 50, 216, 222, 231, 32, 200, 192, 14, 172, 152,
+    49, 78, 142, 108, 134, 6, 104, 28, 7, 1, 49, 28, 151, 185, 85, 161,
+    107, 79, 193, 146, 199, 62, 43, 77, 72, 95, 222, 147, 29, 12, 83, 42,
+    247, 77, 63, 43, 204, 235, 28, 200, 193, 144, 40, 154, 168, 56, 242, 247,
+    228, 91, 98, 226, 248, 252, 60, 55, 85, 154, 108, 219, 8, 217, 113, 170,
+    110, 167, 23, 190, 114, 153, 225, 21, 5, 183, 197, 147, 9, 85, 245, 47,
+    194, 151, 129, 92, 160, 207, 231, 54, 38, 194, 245, 107, 140, 193, 164, 30,
+    213, 108, 27, 5, 173, 76, 100, 92, 69, 218, 114, 166, 248, 18, 87, 55,
+    78, 195, 181, 169, 109, 174, 66, 183, 211, 45, 208, 117, 181, 113, 8, 206,
+    30, 101, 227, 136, 149, 234, 180, 60, 245, 108, 241, 103, 28, 31, 218, 110,
+    226, 224, 252, 198, 135, 100, 117, 62, 129, 229, 26, 151, 70, 22, 137, 176,
+    29, 185, 18, 60, 181, 148, 42, 47, 85, 125, 88, 119, 54, 135, 130, 133,
+    43, 92, 73, 221, 31, 69, 110, 98, 192, 242, 53, 184, 46, 220, 217, 124,
+    53, 244, 190, 243, 142, 10, 239, 153, 39, 48, 109, 185, 21, 251, 247, 78,
+    19, 39, 121, 82, 11, 170, 123, 18, 109, 88, 83, 112, 10, 243, 210, 73,
+    85, 166, 252, 220, 206, 35, 158, 5, 188, 197, 157, 132, 26, 34, 167, 184,
+    242, 10, 140, 52, 208, 204, 10, 176, 60, 233, 232, 161, 144, 253, 193, 212,
+    77, 101, 146, 207, 250, 159, 63, 55, 189, 193, 169, 70, 47, 118, 96, 33,
+    136, 134, 224, 46, 178, 140, 35, 13, 136, 236, 159, 139, 101, 44, 64, 105,
+    138, 15, 106, 37, 132, 194, 82, 88, 22, 212, 103, 23, 40, 250, 240, 131,
+    135, 190, 122, 211, 35, 119, 41, 137, 114, 27, 207, 70, 75, 7, 236, 105,
+    82, 111, 211, 218, 119, 170, 248, 129, 195, 84, 18, 222, 185, 237, 164, 252,
+    91, 24, 199, 192, 20, 13, 135, 118, 177, 211, 110, 31, 50, 157, 96, 127,
+    56, 172, 168, 253, 215, 187, 13, 228, 190, 246, 33, 218, 11, 145, 207, 107,
+    211, 66, 215, 87, 31, 140, 66, 20, 202, 51, 78, 42, 104, 136, 166, 218,
+    239, 40, 10, 208, 251, 71, 219, 31, 224, 248, 158, 87, 67, 83, 179, 126,
+    76, 7, 143, 237, 124, 123, 20, 188, 108, 110, 117, 87, 89, 128, 179, 143,
+    250, 44, 225, 76, 175, 174, 165, 233, 163, 103, 78, 36, 185, 61, 54, 159,
+    89, 161, 24, 143, 133, 160, 79, 122, 144, 48, 76, 156, 249, 85, 44, 146,
+    241, 72, 169, 125, 81, 221, 40, 235, 111, 57, 73, 162, 96, 140, 61, 198,
+    142, 126, 165, 44, 164, 4, 138, 43, 194, 54, 15, 252, 63, 9, 143, 119,
+    138, 183, 27, 209, 98, 251, 84, 216, 195, 121, 111, 125, 47, 191, 230, 155,
+    233, 58, 165, 151, 249, 204, 82, 28, 189, 155, 98, 171, 12, 162, 156, 133,
+    102, 196, 6, 193, 18, 230, 108, 99, 149, 203, 77, 71, 43, 249, 161, 233,
+    188, 198, 191, 86, 42, 209, 214, 117, 206, 143, 193, 175, 64, 62, 240, 15,
+    75, 52, 220, 3, 201, 253, 197, 42, 97, 4, 91, 32, 6, 120, 176, 226,
+    185, 93, 230, 127, 252, 64, 16, 111, 114, 241, 67, 78, 151, 74, 105, 103,
+    90, 204, 91, 254, 130, 147, 28, 148, 37, 182, 157, 10, 244, 63, 2, 229,
+    174, 176, 170, 16, 18, 172, 47, 216, 60, 215, 252, 36, 177, 26, 48, 172,
+    160, 9, 250, 212, 167, 105, 201, 90, 197, 5, 92, 18, 138, 143, 94, 225,
+    135, 221, 53, 166, 61, 3, 87, 181, 128, 8, 104, 78, 124, 81, 83, 29,
+    194, 177, 116, 56, 37, 221, 36, 234, 110, 53, 16, 1, 13, 192, 129, 167,
+    224, 32, 45, 74, 195, 73, 176, 114, 227, 61, 158, 233, 89, 83, 160, 139,
+    161, 228, 57, 178, 1, 90, 7, 218, 18, 158, 183, 89, 147, 144, 130, 165,
+    74, 86, 193, 33, 79, 25, 238, 161, 176, 171, 135, 49, 112, 142, 99, 76,
+    203, 247, 231, 29, 225, 98, 150, 139, 89, 122, 146, 225, 75, 91, 31, 145,
+    137, 98, 41, 84, 131, 241, 1, 182, 163, 82, 182, 129, 37, 144, 222, 244,
+    216, 70, 121, 190, 96, 6, 46, 186, 33, 245, 122, 192, 154, 145, 225, 3,
+    124, 24, 140, 34, 116, 199, 187, 240, 196, 103, 65, 48, 12, 107, 117, 106,
+    86, 114, 233, 183, 75, 245, 132, 27, 242, 162, 105, 44, 97, 115, 213, 249,
+    191, 49, 26, 212, 92, 238, 190, 237, 6, 218, 134, 226, 14, 102, 166, 193,
+    119, 17, 80, 202, 173, 165, 201, 65, 121, 58, 246, 6, 207, 176, 163, 45,
+    134, 130, 174, 131, 124, 218, 105, 54, 107, 173, 45, 94, 251, 127, 20, 70,
+    73, 240, 230, 71, 216, 40, 147, 33, 222, 71, 254, 2, 234, 137, 11, 163,
+    93, 20, 228, 187, 198, 4, 1, 186, 36, 250, 252, 13, 50, 104, 133, 150,
+    225, 141, 191, 183, 128, 87, 38, 208, 52, 99, 203, 1, 75, 124, 167, 199,
+    66, 65, 17, 81, 246, 229, 45, 28, 6, 147, 237, 241, 231, 17, 143, 239,
+    5, 43, 22, 37, 28, 40, 45, 19, 199, 193, 102, 86, 155, 90, 8, 234,
+    56, 158, 144, 132, 209, 242, 236, 244, 100, 65, 106, 138, 70, 21, 66, 200,
+    148, 186, 203, 123, 128, 255, 200, 27, 213, 116, 244, 72, 15, 4, 187, 227,
+    241, 245, 123, 65, 124, 10, 21, 80, 15, 204, 37, 168, 189, 26, 162, 79,
+    155, 160, 40, 103, 87, 81, 184, 153, 183, 188, 91, 168, 40, 209, 102, 236,
+    72, 146, 251, 101, 94, 204, 184, 170, 15, 232, 34, 19, 156, 127, 216, 13,
+    47, 190, 229, 217, 219, 38, 135, 94, 15, 113, 45, 162, 238, 121, 243, 96,
+    50, 35, 205, 29, 129, 53, 59, 242, 178, 135, 224, 138, 154, 211, 123, 214,
+    52, 183, 194, 255, 132, 79, 44, 126, 27, 177, 107, 21, 204, 154, 94, 64,
+    217, 58, 96, 211, 207, 134, 95, 185, 198, 163, 123, 116, 29, 190, 35, 97,
+    233, 49, 76, 149, 167, 4, 63, 90, 22, 235, 107, 232, 91, 55, 196, 44,
+    138, 88, 145, 34, 65, 13, 51, 219, 177, 50, 115, 114, 16, 110, 205, 26,
+    136, 230, 101, 163, 38, 83, 212, 162, 244, 12, 65, 238, 58, 32, 189, 37,
+    237, 89, 81, 116, 73, 179, 226, 192, 118, 78, 160, 104, 76, 151, 225, 214,
+    87, 248, 141, 156, 39, 223, 166, 72, 85, 177, 227, 225, 103, 191, 188, 75,
+    168, 132, 250, 179, 173, 223, 254, 77, 17, 147, 119, 251, 47, 139, 8, 160,
+    86, 101, 74, 39, 158, 95, 77, 11, 203, 148, 254, 104, 192, 138, 186, 36,
+    207, 119, 166, 185, 3, 117, 51, 20, 109, 72, 18, 6, 210, 120, 4, 25,
+    24, 200, 155, 19, 171, 192, 216, 131, 217, 201, 13, 141, 100, 173, 61, 131,
+    179, 104, 141, 103, 92, 196, 91, 28, 145, 209, 116, 130, 45, 206, 189, 63,
+    161, 211, 64, 141, 157, 28, 69, 45, 98, 156, 1, 216, 17, 12, 208, 56,
+    14, 2, 78, 40, 247, 252, 8, 179, 130, 250, 146, 64, 72, 138, 188, 71,
+    240, 123, 215, 144, 98, 56, 51, 111, 170, 95, 214, 158, 159, 57, 147, 124,
+    86, 154, 144, 190, 161, 59, 141, 195, 132, 30, 63, 240, 17, 73, 111, 229,
+    218, 46, 251, 209, 176, 253, 120, 169, 58, 24, 166, 84, 243, 154, 126, 86,
+    133, 203, 56, 141, 159, 61, 80, 41, 77, 112, 213, 227, 17, 37, 102, 53,
+    185, 129, 117, 23, 113, 223, 50, 118, 112, 106, 148, 226, 249, 243, 213, 182,
+    196, 217, 237, 229, 120, 110, 170, 41, 216, 171, 16, 175, 226, 73, 22, 8,
+    98, 199, 81, 118, 42, 50, 136, 178, 227, 123, 117, 224, 48, 236, 59, 219,
+    220, 83, 46, 97, 228, 47, 223, 42, 10, 115, 151, 59, 18, 170, 247, 94,
+    153, 51, 51, 168, 153, 16, 113, 128, 24, 253, 250, 175, 222, 105, 191, 225,
+    215, 29, 64, 161, 31, 184, 93, 131, 211, 108, 76, 153, 247, 214, 5, 159,
+    85, 60, 183, 216, 54, 10, 240, 67, 234, 242, 70, 195, 139, 78, 7, 10,
+    76, 205, 248, 119, 151, 155, 239, 152, 71, 152, 200, 184, 138, 169, 228, 81,
+    237, 36, 174, 110, 156, 155, 119, 79, 218, 65, 168, 99, 127, 201, 31, 6,
+    35, 134, 29, 248, 231, 60, 49, 208, 87, 12, 3, 211, 132, 115, 187, 90,
+    189, 234, 119, 226, 16, 129, 60, 202, 219, 13, 55, 201, 117, 120, 107, 136,
+    12, 43, 40, 69, 176, 53, 224, 93, 117, 152, 118, 70, 23, 138, 172, 234,
+    247, 216, 255, 206, 56, 62, 169, 220, 217, 221, 229, 145, 19, 200, 234, 124,
+    31, 215, 24, 35, 72, 191, 173, 145, 110, 11, 41, 1, 172, 195, 190, 131,
+    202, 63, 198, 69, 52, 51, 140, 44, 15, 125, 58, 111, 36, 120, 119, 53,
+    84, 94, 170, 250, 176, 238, 219, 200, 59, 93, 154, 210, 253, 184, 212, 164,
+    62, 103, 249, 21, 138, 185, 105, 124, 108, 19, 25, 23, 86, 184, 146, 167,
+    62, 138, 220, 196, 157, 249, 106, 109, 92, 165, 131, 232, 174, 102, 195, 23,
+    85, 112, 206, 86, 149, 150, 48, 178, 74, 46, 133, 55, 175, 248, 106, 245,
+    97, 251, 1, 20, 195, 47, 78, 96, 218, 111, 42, 235, 243, 156, 64, 3,
+    221, 132, 244, 84, 198, 195, 51, 243, 7, 50, 119, 36, 10, 168, 42, 14,
+    38, 78, 242, 164, 22, 73, 246, 36, 218, 176, 166, 224, 20, 251, 185, 146,
+    170, 81, 201, 181, 69, 213, 131, 230, 49, 243, 42, 108, 239, 178, 185, 176,
+    153, 209, 115, 195, 229, 165, 129, 70, 33, 10, 101, 151, 39, 21, 52, 68,
+    83, 109, 249, 20, 5, 104, 10, 94, 54, 55, 180, 165, 162, 64, 215, 201,
+    125, 22, 254, 38, 217, 87, 220, 250, 189, 133, 20, 125, 120, 207, 205, 95,
+    61, 231, 159, 181, 154, 202, 57, 131, 233, 35, 82, 126, 163, 12, 237, 96,
+    10, 136, 205, 59, 214, 231, 55, 129, 25, 192, 48, 177, 126, 110, 103, 159,
+    79, 140, 94, 236, 192, 66, 13, 17, 221, 92, 121, 5, 70, 26, 145, 149,
+    208, 238, 218, 35, 153, 59, 48, 158, 68, 67, 112, 23, 89, 70, 159, 136,
+    13, 197, 35, 11, 202, 88, 128, 210, 9, 30, 212, 74, 21, 153, 164, 176,
+    44, 181, 226, 62, 148, 122, 95, 247, 71, 5, 249, 194, 157, 24, 184, 210,
+    132, 243, 245, 39, 206, 46, 80, 233, 253, 27, 19, 97, 244, 187, 70, 238,
+    82, 15, 228, 54, 131, 140, 33, 213, 231, 152, 104, 180, 212, 182, 4, 103,
+    15, 188, 255, 68, 196, 117, 90, 30, 150, 14, 197, 210, 164, 222, 187, 169,
+    238, 73, 237, 31, 155, 168, 36, 161, 111, 199, 121, 245, 114, 163, 49, 113,
+    124, 126, 30, 149, 164, 77, 54, 227, 4, 226, 182, 85, 85, 229, 182, 48,
+    147, 157, 40, 26, 19, 236, 127, 187, 220, 62, 100, 39, 192, 254, 186, 30,
+    1, 65, 6, 50, 239, 205, 227, 48, 54, 233, 113, 117, 68, 100, 25, 108,
+    112, 69, 77, 231, 179, 107, 26, 213, 97, 241, 66, 169, 22, 63, 131, 214,
+    187, 132, 159, 190, 250, 150, 38, 196, 221, 2, 145, 45, 11, 251, 187, 116,
+    163, 149, 98, 22, 179, 174, 62, 5, 132, 40, 137, 102, 156, 84, 208, 13,
+    81, 169, 195, 80, 20, 189, 92, 85, 137, 116, 17, 135, 78, 177, 108, 136,
+    153, 95, 252, 226, 227, 19, 205, 47, 235, 142, 171, 62, 221, 237, 33, 174,
+    134, 166, 123, 252, 152, 14, 3, 199, 248, 246, 4, 117, 28, 79, 72, 66,
+    230, 121, 118, 122, 50, 174, 53, 69, 35, 132, 33, 100, 40, 101, 216, 220,
+    234, 174, 178, 29, 123, 3, 233, 88, 223, 152, 67, 65, 87, 207, 199, 158,
+    111, 173, 127, 1, 117, 202, 139, 223, 160, 10, 114, 211, 99, 2, 142, 93,
+    91, 206, 156, 72, 111, 122, 108, 35, 178, 95, 48, 3, 23, 93, 158, 244,
+    61, 96, 180, 53, 43, 57, 250, 213, 171, 244, 66, 131, 121, 81, 186, 22,
+    190, 183, 228, 242, 152, 37, 239, 170, 88, 57, 255, 144, 79, 250, 162, 167,
+    80, 203, 222, 114, 146, 89, 119, 222, 88, 219, 205, 150, 56, 71, 191, 38,
+    235, 245, 253, 128, 254, 49, 75, 203, 192, 5, 122, 145, 1, 252, 87, 88,
+    85, 8, 9, 86, 153, 108, 30, 229, 126, 18, 47, 254, 205, 224, 148, 83,
+    144, 143, 165, 212, 64, 4, 52, 39, 62, 166, 167, 128, 3, 238, 9, 115,
+    54, 191, 196, 235, 168, 173, 155, 242, 222, 250, 94, 99, 209, 43, 236, 21,
+    190, 2, 163, 16, 3, 60, 88, 113, 210, 160, 115, 177, 126, 32, 8, 185,
+    207, 116, 87, 51, 239, 133, 164, 56, 103, 43, 196, 75, 24, 89, 37, 23,
+    204, 149, 32, 143, 224, 66, 122, 42, 99, 239, 151, 247, 141, 25, 181, 18,
+    5, 84, 21, 7, 12, 159, 36, 209, 216, 198, 55, 139, 154, 142, 86, 239,
+    95, 207, 101, 145, 99, 172, 227, 100, 147, 160, 77, 105, 240, 92, 106, 82,
+    31, 189, 242, 132, 69, 210, 186, 62, 84, 191, 177, 234, 129, 3, 159, 67,
+    128, 124, 253, 30, 150, 104, 165, 6, 143, 231, 187, 68, 6, 155, 20, 172,
+    88, 148, 112, 160, 180, 76, 59, 35, 133, 69, 86, 117, 151, 84, 194, 8,
+    182, 64, 12, 240, 125, 217, 111, 186, 209, 254, 229, 128, 32, 222, 120, 175,
+    117, 121, 35, 239, 203, 39, 141, 5, 38, 232, 124, 181, 197, 195, 249, 76,
+    228, 255, 134, 156, 51, 148, 210, 206, 180, 133, 182, 225, 25, 59, 56, 53,
+    74, 113, 11, 4, 49, 237, 166, 59, 21, 25, 68, 89, 255, 179, 180, 112,
+    24, 118, 147, 227, 39, 20, 245, 126, 4, 215, 65, 125, 73, 32, 36, 69,
+    94, 173, 120, 179, 229, 72, 200, 239, 66, 15, 145, 120, 134, 170, 185, 252,
+    109, 23, 243, 230, 88, 240, 60, 218, 127, 52, 96, 69, 93, 18, 233, 181,
+    83, 210, 143, 180, 151, 10, 184, 36, 9, 3, 144, 207, 215, 52, 200, 189,
+    46, 98, 163, 14, 198, 230, 58, 65, 152, 103, 208, 145, 188, 223, 19, 167,
+    106, 81, 122, 6, 174, 119, 29, 16, 208, 156, 248, 162, 166, 58, 83, 36,
+    164, 214, 255, 254, 189, 209, 94, 171, 84, 66, 125, 215, 216, 225, 127, 168,
+    153, 127, 232, 112, 74, 167, 72, 201, 220, 106, 32, 2, 26, 157, 31, 83,
+    221, 64, 118, 132, 95, 1, 223, 8, 143, 30, 44, 182, 105, 80, 183, 214,
+    63, 16, 4, 210, 90, 148, 155, 146, 125, 228, 219, 122, 33, 207, 178, 166,
+    93, 11, 95, 213, 114, 121, 181, 111, 44, 227, 232, 75, 28, 173, 209, 19,
+    251, 244, 240, 64, 127, 150, 171, 235, 2, 180, 14, 169, 36, 33, 115, 178,
+    59, 61, 25, 87, 148, 172, 159, 66, 158, 50, 237, 79, 185, 216, 177, 142,
+    180, 101, 203, 225, 80, 5, 57, 231, 191, 1, 71, 160, 193, 95, 125, 75,
+    19, 98, 224, 1, 198, 152, 139, 243, 211, 58, 223, 196, 49, 11, 46, 164,
+    202, 58, 134, 205, 39, 214, 54, 68, 194, 161, 126, 113, 255, 135, 232, 153,
+    178, 244, 57, 223, 150, 182, 62, 63, 15, 196, 82, 168, 27, 255, 2, 113,
+    91, 164, 93, 15, 142, 174, 3, 25, 249, 232, 255, 24, 27, 250, 182, 180,
+    34, 50, 130, 54, 113, 31, 74, 61, 161, 245, 173, 140, 242, 97, 192, 12,
+    92, 105, 66, 247, 244, 157, 158, 228, 253, 76, 52, 90, 106, 91, 2, 189,
+    137, 94, 241, 34, 98, 180, 45, 15, 41, 63, 223, 6, 248, 48, 5, 68,
+    232, 147, 107, 253, 149, 206, 130, 96, 24, 214, 198, 196, 104, 119, 109, 159,
+    194, 147, 24, 79, 34, 175, 56, 133, 162, 35, 193, 68, 234, 212, 172, 228,
+    207, 115, 150, 247, 21, 54, 249, 89, 210, 88, 194, 230, 183, 239, 5, 47,
+    27, 149, 90, 220, 81, 32, 229, 234, 176, 11, 127, 19, 226, 165, 110, 125,
+    99, 98, 52, 181, 184, 193, 97, 199, 12, 169, 17, 217, 28, 204, 81, 159,
+    238, 34, 140, 153, 131, 196, 45, 110, 166, 16, 252, 117, 88, 139, 177, 135,
+    113, 220, 55, 176, 160, 137, 71, 87, 143, 130, 242, 116, 241, 12, 131, 125,
+    91, 90, 17, 25, 65, 27, 79, 114, 240, 38, 26, 45, 53, 163, 1, 208,
+    202, 47, 246, 17, 49, 90, 152, 137, 248, 169, 210, 108, 214, 71, 90, 188,
+    235, 254, 40, 140, 146, 253, 209, 142, 173, 80, 23, 82, 101, 29, 67, 232,
+    157, 107, 27, 34, 97, 222, 63, 182, 241, 205, 116, 194, 59, 66, 161, 142,
+    225, 4, 201, 15, 22, 91, 186, 40, 213, 107, 145, 8, 2, 105, 212, 185,
+    22, 255, 116, 171, 14, 216, 230, 135, 243, 122, 120, 32, 177, 75, 219, 251,
+    72, 233, 229, 26, 100, 208, 23, 49, 223, 7, 99, 115, 29, 174, 76, 189,
+    104, 198, 167, 18, 82, 107, 241, 127, 208, 230, 47, 219, 42, 33, 176, 229,
+    108, 254, 177, 84, 139, 2, 150, 248, 83, 147, 132, 130, 34, 162, 241, 215,
+    90, 56, 12, 59, 199, 255, 100, 249, 33, 137, 198, 60, 67, 85, 210, 126,
+    184, 133, 247, 115, 44, 120, 30, 109, 211, 34, 3, 195, 10, 86, 44, 74,
+    56, 80, 90, 38, 147, 159, 204, 172, 43, 180, 60, 217, 180, 178, 159, 249,
+    235, 157, 200, 140, 19, 116, 62, 212, 236, 239, 242, 38, 16, 201, 112, 33,
+    61, 21, 191, 249, 197, 245, 200, 130, 212, 9, 140, 42, 132, 141, 255, 50,
+    199, 80, 168, 186, 120, 46, 53, 41, 129, 208, 121, 66, 172, 105, 93, 31,
+    53, 105, 139, 246, 29, 227, 141, 54, 183, 232, 245, 144, 30, 8, 107, 219,
+    255, 247, 218, 146, 60, 135, 136, 76, 74, 225, 71, 52, 188, 194, 179, 67,
+    75, 152, 38, 101, 246, 130, 248, 20, 42, 160, 30, 133, 74, 77, 103, 52,
+    89, 158, 43, 93, 80, 206, 25, 121, 79, 101, 191, 15, 217, 82, 186, 145,
+    46, 102, 244, 213, 11, 30, 137, 92, 174, 162, 109, 47, 115, 101, 182, 77,
+    80, 191, 204, 197, 144, 57, 235, 202, 188, 133, 65, 89, 218, 94, 230, 202,
+    113, 154, 160, 99, 133, 151, 61, 114, 203, 137, 101, 23, 109, 73, 30, 205,
+    68, 38, 37, 254, 173, 26, 94, 97, 215, 175, 171, 76, 19, 188, 130, 178,
+    169, 188, 209, 137, 226, 41, 93, 198, 23, 51, 122, 228, 139, 15, 202, 46,
+    30, 226, 90, 89, 193, 242, 251, 192, 100, 70, 135, 58, 31, 106, 118, 249,
+    121, 19, 241, 25, 237, 40, 84, 93, 60, 23, 148, 154, 206, 104, 178, 33,
+    86, 186, 160, 129, 221, 9, 41, 187, 246, 177, 104, 115, 153, 227, 21, 158,
+    88, 252, 54, 127, 214, 42, 50, 242, 158, 202, 99, 30, 175, 164, 105, 63,
+    92, 204, 245, 183, 22, 60, 15, 184, 133, 41, 188, 128, 175, 116, 192, 187,
+    131, 17, 190, 111, 145, 91, 246, 232, 58, 97, 106, 210, 11, 241, 58, 219,
+    7, 108, 115, 205, 247, 61, 60, 16, 214, 171, 227, 243, 70, 194, 207, 98,
+    152, 55, 83, 8, 126, 180, 44, 203, 214, 205, 182, 110, 149, 88, 169, 57,
+    120, 19, 13, 152, 148, 223, 142, 104, 101, 153, 123, 134, 150, 45, 76, 202,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 152, 185, 240, 5, 111, 99, 6, 220, 112, 150, 69, 36,
+    187, 22, 228, 198, 121, 121, 165, 174, 45, 111, 253, 10, 222, 198, 12, 165,
+    224, 49, 138, 72, 107, 44, 213, 145, 242, 242, 87, 65, 181, 214, 13, 15,
+    177, 165, 10, 121, 144, 167, 207, 108, 208, 58, 49, 87, 139, 139, 242, 239,
+    90, 222, 231, 20, 161, 145, 24, 87, 221, 98, 9, 144, 214, 88, 183, 63,
+    249, 249, 174, 130, 194, 103, 23, 17, 206, 242, 30, 139, 173, 244, 76, 180,
+    109, 78, 83, 249, 128, 128, 11, 44, 119, 177, 26, 30, 127, 87, 20, 242,
+    61, 83, 131, 216, 189, 116, 98, 174, 11, 11, 249, 195, 239, 8, 234, 27,
+    16, 52, 18, 46, 77, 197, 198, 252, 6, 98, 134, 104, 114, 114, 92, 109,
+    180, 161, 211, 40, 95, 63, 48, 174, 167, 196, 18, 61, 177, 176, 115, 126,
+    239, 239, 65, 25, 44, 24, 35, 45, 48, 92, 54, 114, 215, 82, 87, 25,
+    10, 166, 151, 184, 150, 150, 228, 183, 153, 206, 46, 34, 129, 249, 60, 11,
+    71, 245, 152, 117, 218, 156, 166, 239, 29, 29, 22, 88, 1, 119, 222, 39,
+    238, 154, 58, 215, 55, 99, 221, 81, 97, 138, 66, 41, 100, 100, 179, 246,
+    238, 127, 52, 60, 254, 174, 40, 249, 122, 166, 27, 173, 103, 232, 196, 65,
+    22, 22, 239, 155, 118, 198, 196, 57, 145, 205, 46, 37, 10, 48, 94, 137,
+    220, 254, 32, 135, 111, 111, 74, 53, 195, 16, 201, 54, 32, 104, 36, 92,
+    154, 151, 145, 229, 12, 196, 17, 208, 228, 228, 184, 218, 91, 169, 57, 51,
+    79, 11, 34, 128, 234, 1, 212, 193, 183, 210, 245, 22, 157, 157, 29, 116,
+    117, 95, 187, 80, 190, 126, 96, 65, 83, 149, 36, 122, 127, 125, 230, 252,
+    195, 195, 130, 50, 237, 230, 75, 85, 209, 29, 102, 157, 35, 3, 97, 94,
+    196, 107, 2, 58, 186, 186, 39, 156, 88, 48, 70, 90, 96, 184, 108, 228,
+    179, 164, 174, 50, 20, 81, 51, 109, 49, 49, 213, 115, 192, 137, 182, 95,
+    15, 219, 106, 56, 195, 50, 235, 22, 175, 71, 215, 171, 72, 72, 112, 221,
+    47, 129, 92, 68, 31, 239, 120, 22, 142, 247, 45, 234, 169, 37, 81, 195,
+    58, 58, 44, 176, 183, 56, 172, 65, 112, 140, 126, 202, 254, 97, 104, 206,
+    18, 51, 181, 5, 67, 67, 137, 30, 2, 238, 161, 78, 193, 41, 116, 179,
+    110, 198, 167, 162, 194, 9, 132, 82, 200, 200, 123, 241, 154, 87, 81, 75,
+    174, 74, 114, 111, 30, 80, 226, 134, 121, 31, 96, 148, 177, 177, 222, 95,
+    193, 254, 104, 120, 225, 65, 80, 239, 244, 81, 54, 71, 206, 205, 149, 130,
+    44, 44, 195, 43, 89, 71, 152, 125, 142, 34, 86, 51, 132, 199, 115, 99,
+    117, 219, 113, 68, 85, 85, 102, 133, 236, 145, 149, 114, 63, 135, 92, 74,
+    20, 96, 188, 15, 165, 225, 64, 19, 222, 222, 148, 106, 116, 40, 101, 119,
+    80, 228, 90, 150, 100, 246, 249, 43, 30, 247, 164, 213, 167, 167, 49, 196,
+    155, 32, 143, 108, 64, 208, 72, 184, 41, 51, 63, 215, 24, 149, 34, 189,
+    213, 213, 109, 169, 3, 153, 127, 105, 47, 179, 78, 100, 89, 165, 122, 243,
+    163, 131, 198, 123, 172, 172, 200, 7, 182, 79, 114, 102, 158, 22, 68, 29,
+    201, 2, 181, 159, 115, 185, 247, 44, 39, 39, 58, 232, 46, 246, 130, 99,
+    241, 117, 66, 193, 185, 148, 240, 187, 200, 175, 19, 234, 94, 94, 159, 70,
+    234, 190, 107, 160, 97, 252, 192, 130, 166, 55, 72, 244, 254, 250, 209, 229,
+    155, 155, 25, 100, 114, 7, 155, 165, 14, 159, 198, 94, 214, 161, 13, 208,
+    69, 236, 53, 35, 226, 226, 188, 202, 199, 209, 150, 170, 191, 58, 204, 39,
+    70, 6, 194, 188, 149, 214, 4, 116, 105, 105, 78, 37, 95, 104, 102, 175,
+    208, 89, 202, 251, 54, 144, 135, 152, 46, 192, 224, 178, 16, 16, 235, 139,
+    176, 96, 140, 180, 192, 109, 216, 213, 123, 85, 65, 100, 40, 162, 102, 218,
+    98, 98, 183, 230, 40, 217, 124, 177, 175, 14, 222, 9, 11, 195, 4, 64,
+    147, 180, 130, 28, 27, 27, 18, 72, 157, 15, 113, 190, 30, 171, 212, 112,
+    155, 100, 203, 44, 67, 142, 179, 75, 144, 144, 224, 167, 5, 182, 129, 187,
+    113, 200, 210, 172, 235, 242, 142, 8, 248, 152, 87, 141, 233, 233, 69, 9,
+    94, 31, 184, 136, 62, 195, 240, 44, 1, 243, 90, 201, 79, 74, 162, 155,
+    116, 116, 88, 125, 198, 166, 72, 141, 81, 160, 246, 240, 113, 101, 31, 237,
+    244, 92, 70, 93, 13, 13, 253, 211, 115, 112, 69, 130, 224, 5, 252, 137,
+    225, 194, 208, 129, 36, 102, 119, 10, 134, 134, 15, 60, 235, 201, 181, 135,
+    143, 102, 250, 85, 145, 84, 149, 165, 159, 112, 147, 204, 255, 255, 170, 146,
+    4, 193, 95, 156, 159, 82, 232, 123, 220, 145, 83, 89, 153, 18, 21, 164,
+    141, 141, 246, 255, 156, 120, 175, 153, 240, 49, 238, 167, 172, 7, 22, 125,
+    34, 4, 241, 98, 244, 244, 83, 81, 41, 174, 162, 150, 65, 148, 228, 222,
+    60, 160, 217, 17, 242, 62, 192, 53, 127, 127, 161, 190, 177, 23, 82, 147,
+    46, 247, 226, 2, 76, 54, 156, 53, 73, 40, 36, 243, 6, 6, 4, 16,
+    159, 225, 208, 240, 223, 130, 160, 195, 245, 162, 108, 142, 129, 135, 55, 25,
+    88, 88, 155, 86, 7, 88, 32, 245, 176, 225, 166, 31, 133, 52, 41, 170,
+    58, 145, 211, 223, 33, 33, 62, 248, 178, 142, 45, 250, 1, 68, 172, 102,
+    21, 147, 230, 198, 234, 171, 226, 136, 170, 170, 204, 23, 42, 55, 221, 255,
+    110, 39, 170, 186, 101, 5, 163, 226, 81, 189, 6, 78, 211, 211, 105, 185,
+    197, 63, 55, 228, 126, 19, 184, 148, 40, 192, 101, 30, 87, 223, 128, 38,
+    161, 161, 53, 212, 93, 134, 199, 225, 17, 112, 190, 72, 88, 86, 32, 58,
+    236, 201, 100, 224, 216, 216, 144, 122, 232, 80, 202, 238, 160, 213, 180, 49,
+    200, 241, 239, 86, 60, 243, 85, 183, 83, 83, 98, 149, 112, 233, 58, 235,
+    207, 182, 178, 237, 184, 103, 170, 114, 135, 229, 177, 113, 42, 42, 199, 59,
+    43, 64, 3, 216, 128, 189, 144, 109, 82, 102, 126, 179, 48, 55, 68, 103,
+    183, 183, 218, 79, 179, 249, 243, 221, 239, 222, 150, 177, 34, 240, 59, 151,
+    139, 33, 160, 161, 206, 206, 127, 225, 6, 47, 254, 210, 94, 123, 156, 200,
+    178, 87, 244, 251, 91, 27, 145, 246, 69, 69, 141, 14, 158, 150, 14, 215,
+    49, 24, 154, 20, 194, 193, 177, 223, 224, 13, 117, 48, 60, 60, 40, 160,
+    113, 158, 228, 204, 33, 44, 136, 58, 143, 4, 119, 35, 230, 111, 243, 88,
+    78, 78, 116, 205, 233, 39, 20, 201, 78, 79, 142, 230, 255, 146, 50, 7,
+    93, 121, 23, 158, 55, 55, 209, 99, 92, 241, 25, 198, 255, 234, 132, 159,
+    111, 53, 253, 107, 141, 67, 38, 201, 188, 188, 35, 140, 196, 72, 233, 195,
+    144, 137, 130, 67, 31, 163, 184, 79, 54, 85, 194, 15, 197, 197, 134, 34,
+    201, 97, 214, 93, 194, 229, 157, 25, 81, 110, 144, 245, 225, 233, 191, 215,
+    43, 43, 50, 200, 81, 216, 38, 88, 173, 134, 155, 197, 33, 248, 213, 209,
+    90, 255, 91, 17, 82, 82, 151, 102, 228, 14, 43, 87, 28, 35, 145, 188,
+    177, 95, 26, 189, 138, 197, 106, 70, 217, 217, 101, 137, 124, 183, 219, 82,
+    115, 64, 151, 96, 193, 201, 95, 153, 49, 211, 142, 128, 160, 160, 192, 39,
+    147, 191, 49, 73, 99, 116, 133, 78, 140, 12, 153, 101, 55, 177, 8, 232,
+    210, 210, 156, 74, 11, 6, 193, 76, 12, 23, 131, 146, 252, 154, 220, 65,
+    140, 167, 236, 46, 171, 171, 57, 228, 190, 208, 204, 67, 189, 178, 137, 235,
+    108, 61, 19, 45, 92, 157, 221, 121, 32, 32, 203, 11, 38, 105, 60, 70,
+    210, 209, 143, 55, 28, 171, 86, 9, 231, 139, 57, 191, 89, 89, 110, 165,
+    125, 192, 5, 117, 157, 218, 173, 183, 246, 170, 130, 200, 80, 89, 204, 169,
+    196, 196, 115, 209, 229, 121, 245, 112, 242, 185, 171, 107, 134, 60, 199, 236,
+    235, 79, 40, 111, 189, 189, 214, 127, 80, 175, 248, 127, 67, 28, 161, 18,
+    22, 155, 8, 128, 59, 117, 25, 56, 54, 54, 36, 144, 200, 22, 8, 122,
+    44, 127, 167, 206, 102, 13, 77, 164, 128, 99, 253, 254, 79, 79, 129, 62,
+    39, 30, 226, 97, 60, 75, 181, 224, 43, 200, 139, 88, 134, 1, 123, 150,
+    61, 61, 221, 83, 191, 167, 18, 100, 83, 40, 179, 60, 91, 94, 206, 124,
+    61, 23, 159, 80, 68, 68, 120, 253, 10, 113, 31, 107, 226, 141, 185, 69,
+    203, 249, 1, 16, 237, 45, 174, 7, 207, 207, 138, 18, 146, 200, 239, 110,
+    141, 238, 191, 153, 187, 111, 68, 52, 86, 59, 74, 193, 182, 182, 47, 188,
+    188, 62, 109, 13, 124, 155, 253, 88, 2, 251, 180, 143, 158, 148, 89, 43,
+    232, 232, 176, 250, 36, 135, 157, 8, 19, 248, 251, 132, 114, 109, 241, 171,
+    37, 130, 189, 237, 145, 145, 21, 84, 145, 81, 144, 7, 162, 93, 241, 253,
+    226, 202, 62, 199, 245, 184, 140, 186, 26, 26, 231, 187, 9, 232, 96, 2,
+    205, 62, 247, 33, 146, 92, 123, 227, 78, 174, 104, 124, 99, 99, 66, 21,
+    230, 224, 138, 25, 221, 10, 229, 15, 223, 153, 189, 31, 72, 204, 238, 20,
+    17, 17, 30, 120, 126, 89, 122, 28, 178, 105, 227, 211, 175, 15, 248, 59,
+    243, 218, 10, 210, 104, 104, 187, 214, 203, 143, 119, 19, 3, 204, 233, 170,
+    63, 168, 55, 87, 35, 224, 59, 133, 227, 227, 73, 57, 83, 54, 135, 22,
+    108, 175, 239, 118, 79, 62, 114, 115, 152, 246, 223, 67, 154, 154, 236, 151,
+    8, 159, 190, 37, 35, 164, 205, 246, 165, 63, 166, 178, 47, 36, 42, 85,
+    7, 7, 241, 227, 144, 38, 78, 32, 76, 199, 203, 42, 213, 169, 227, 150,
+    148, 50, 206, 147, 126, 126, 84, 77, 37, 240, 67, 47, 253, 98, 193, 83,
+    69, 14, 44, 250, 68, 8, 255, 196, 245, 245, 166, 162, 189, 73, 179, 42,
+    146, 1, 199, 143, 53, 152, 105, 222, 255, 30, 27, 2, 140, 140, 3, 12,
+    82, 65, 89, 49, 130, 53, 213, 161, 120, 93, 175, 34, 249, 124, 157, 106,
+    254, 254, 95, 97, 202, 248, 169, 52, 237, 86, 211, 125, 8, 203, 234, 6,
+    66, 106, 121, 172, 135, 135, 250, 207, 127, 46, 164, 59, 92, 243, 217, 4,
+    152, 108, 37, 106, 146, 80, 72, 251, 12, 12, 8, 32, 231, 151, 84, 62,
+    51, 144, 223, 216, 232, 250, 96, 78, 41, 70, 172, 61, 117, 117, 173, 142,
+    35, 223, 189, 253, 163, 25, 93, 155, 247, 89, 216, 1, 31, 19, 110, 50,
+    176, 176, 43, 172, 187, 102, 77, 248, 204, 122, 91, 71, 135, 207, 157, 37,
+    164, 5, 138, 244, 201, 201, 142, 2, 14, 176, 64, 247, 125, 223, 81, 62,
+    23, 104, 82, 73, 116, 63, 187, 163, 66, 66, 124, 237, 150, 9, 176, 242,
+    18, 188, 87, 226, 103, 254, 23, 109, 207, 41, 95, 101, 59, 59, 217, 67,
+    121, 1, 90, 233, 2, 136, 69, 204, 42, 59, 209, 145, 201, 75, 217, 13,
+    73, 73, 133, 46, 225, 184, 170, 236, 109, 235, 67, 16, 90, 173, 148, 181,
+    114, 93, 61, 203, 48, 48, 32, 128, 84, 110, 167, 227, 220, 78, 73, 105,
+    202, 10, 91, 217, 162, 103, 12, 156, 187, 187, 210, 111, 204, 215, 87, 230,
+    179, 45, 79, 181, 186, 156, 30, 253, 25, 113, 232, 90, 194, 194, 119, 193,
+    151, 126, 110, 213, 252, 38, 109, 53, 80, 157, 202, 60, 174, 163, 29, 76,
+    95, 95, 106, 181, 15, 199, 158, 208, 147, 69, 107, 233, 32, 11, 143, 24,
+    21, 181, 249, 138, 38, 38, 207, 27, 186, 17, 147, 223, 34, 224, 97, 144,
+    176, 172, 64, 116, 197, 143, 200, 221, 173, 173, 61, 244, 34, 168, 99, 218,
+    77, 131, 103, 76, 192, 58, 5, 80, 126, 153, 44, 27, 212, 212, 152, 90,
+    205, 160, 137, 193, 93, 183, 117, 98, 141, 255, 195, 172, 120, 251, 170, 115,
+    166, 166, 196, 55, 85, 25, 121, 196, 50, 212, 115, 190, 253, 105, 134, 136,
+    195, 237, 78, 181, 223, 223, 97, 153, 224, 207, 116, 203, 131, 113, 121, 199,
+    109, 206, 73, 228, 19, 215, 127, 226, 84, 84, 147, 118, 120, 118, 132, 206,
+    236, 18, 127, 27, 29, 88, 12, 192, 168, 193, 155, 36, 45, 45, 54, 216,
+    86, 128, 6, 173, 29, 103, 61, 218, 164, 204, 252, 123, 96, 110, 136, 206,
+    115, 115, 169, 158, 206, 57, 246, 168, 114, 4, 59, 6, 212, 90, 185, 95,
+    219, 120, 108, 8, 10, 10, 12, 48, 123, 239, 251, 167, 195, 161, 49, 127,
+    68, 253, 118, 51, 11, 66, 93, 95, 129, 129, 254, 223, 227, 86, 11, 162,
+    172, 194, 55, 163, 52, 107, 51, 23, 176, 84, 185, 153, 248, 248, 91, 113,
+    12, 94, 225, 185, 188, 246, 37, 141, 121, 174, 245, 235, 182, 54, 63, 241,
+    138, 138, 7, 28, 148, 231, 17, 188, 211, 149, 35, 81, 9, 56, 176, 207,
+    13, 32, 219, 55, 243, 243, 162, 178, 33, 49, 28, 179, 98, 48, 41, 40,
+    153, 159, 127, 163, 221, 26, 234, 96, 120, 120, 80, 93, 185, 136, 236, 182,
+    13, 83, 47, 244, 233, 9, 58, 135, 102, 12, 14, 166, 1, 1, 245, 243,
+    226, 33, 213, 133, 66, 88, 13, 116, 3, 8, 238, 70, 209, 222, 251, 176,
+    156, 156, 232, 135, 122, 152, 37, 128, 45, 59, 11, 168, 115, 158, 171, 98,
+    106, 200, 31, 118, 229, 229, 77, 41, 207, 78, 40, 143, 156, 158, 1, 209,
+    227, 57, 100, 14, 186, 242, 46, 33, 110, 110, 191, 198, 87, 247, 216, 138,
+    243, 253, 7, 13, 147, 175, 33, 42, 1, 228, 202, 231, 23, 23, 26, 104,
+    184, 255, 50, 145, 227, 201, 21, 35, 222, 106, 231, 214, 7, 134, 76, 143,
+    101, 101, 70, 5, 32, 70, 194, 148, 140, 170, 19, 255, 174, 252, 162, 242,
+    188, 144, 168, 73, 28, 28, 227, 171, 149, 144, 207, 155, 61, 15, 25, 134,
+    62, 91, 109, 158, 108, 170, 153, 30, 151, 151, 17, 68, 13, 41, 63, 158,
+    82, 108, 31, 90, 78, 205, 40, 186, 215, 188, 125, 216, 238, 238, 180, 234,
+    143, 194, 177, 186, 153, 215, 39, 50, 162, 220, 61, 247, 223, 207, 99, 179,
+    86, 86, 100, 141, 23, 123, 65, 191, 246, 180, 33, 238, 210, 74, 120, 211,
+    100, 217, 135, 117, 47, 47, 193, 35, 162, 173, 76, 176, 71, 17, 43, 151,
+    66, 237, 183, 191, 180, 227, 182, 34, 164, 164, 51, 204, 58, 20, 188, 181,
+    40, 114, 45, 75, 50, 123, 242, 155, 15, 245, 82, 228, 221, 221, 150, 98,
+    213, 28, 86, 174, 56, 70, 63, 101, 127, 190, 52, 103, 9, 151, 212, 140,
+    175, 175, 202, 15, 77, 165, 166, 171, 87, 37, 57, 185, 15, 40, 113, 67,
+    178, 129, 48, 74, 214, 214, 111, 161, 248, 115, 171, 164, 230, 128, 51, 192,
+    159, 143, 190, 47, 98, 187, 1, 29, 93, 93, 157, 78, 96, 202, 91, 161,
+    137, 227, 53, 28, 239, 25, 251, 11, 217, 173, 229, 219, 36, 36, 56, 224,
+    59, 99, 98, 146, 198, 232, 23, 156, 5, 24, 47, 202, 110, 127, 16, 205,
+    185, 185, 37, 148, 163, 218, 146, 151, 169, 139, 17, 64, 117, 142, 106, 238,
+    213, 105, 244, 11, 192, 192, 128, 58, 22, 12, 159, 152, 24, 46, 27, 57,
+    229, 41, 165, 130, 5, 83, 197, 92, 75, 75, 114, 213, 142, 181, 111, 157,
+    119, 77, 29, 229, 149, 191, 224, 166, 190, 69, 33, 154, 50, 50, 215, 123,
+    97, 189, 133, 134, 103, 121, 15, 203, 216, 122, 38, 90, 184, 39, 167, 242,
+    64, 64, 139, 22, 249, 4, 117, 131, 8, 26, 9, 23, 168, 236, 99, 126,
+    3, 49, 67, 52, 57, 57, 46, 184, 76, 210, 120, 140, 185, 191, 3, 110,
+    56, 75, 172, 18, 211, 11, 114, 99, 178, 178, 220, 87, 212, 107, 136, 137,
+    214, 220, 5, 178, 72, 221, 233, 54, 104, 29, 150, 165, 203, 203, 121, 249,
+    250, 157, 10, 234, 39, 169, 71, 115, 241, 73, 25, 141, 160, 178, 133, 79,
+    149, 149, 230, 191, 98, 36, 250, 239, 72, 202, 65, 175, 129, 223, 92, 169,
+    27, 164, 97, 137, 236, 236, 67, 17, 215, 242, 247, 224, 249, 111, 75, 214,
+    17, 120, 147, 197, 203, 158, 80, 222, 103, 103, 177, 254, 79, 75, 7, 229,
+    150, 12, 77, 10, 97, 238, 214, 225, 112, 136, 180, 24, 30, 30, 20, 80,
+    160, 67, 237, 254, 134, 56, 95, 36, 44, 43, 16, 29, 118, 234, 50, 112,
+    108, 108, 72, 61, 56, 250, 29, 251, 233, 91, 89, 248, 92, 189, 85, 57,
+    205, 252, 214, 182, 21, 21, 237, 147, 141, 44, 16, 244, 88, 254, 83, 129,
+    204, 26, 154, 85, 29, 198, 231, 225, 158, 158, 31, 124, 21, 149, 224, 241,
+    55, 157, 85, 93, 188, 140, 223, 113, 166, 208, 3, 39, 231, 231, 186, 210,
+    78, 60, 217, 194, 120, 150, 119, 221, 86, 141, 11, 176, 17, 2, 246, 49,
+    122, 122, 167, 166, 214, 133, 41, 199, 23, 245, 113, 1, 38, 27, 78, 148,
+    170, 20, 18, 247, 3, 3, 2, 8, 99, 83, 36, 200, 166, 80, 123, 120,
+    182, 188, 129, 248, 122, 46, 35, 160, 136, 136, 240, 231, 251, 234, 212, 205,
+    201, 51, 125, 164, 198, 42, 196, 220, 193, 56, 199, 102, 241, 241, 85, 73,
+    20, 226, 62, 214, 217, 7, 111, 138, 139, 239, 2, 32, 199, 90, 65, 14,
+    131, 131, 9, 36, 140, 91, 206, 211, 182, 100, 105, 86, 251, 121, 71, 4,
+    124, 76, 165, 200, 250, 250, 172, 138, 57, 141, 195, 220, 7, 193, 99, 47,
+    107, 222, 136, 104, 172, 118, 148, 159, 113, 113, 94, 101, 161, 52, 51, 217,
+    104, 162, 101, 243, 27, 72, 205, 76, 23, 96, 112, 89, 8, 8, 251, 203,
+    101, 124, 218, 26, 248, 43, 231, 176, 4, 235, 117, 3, 33, 53, 178, 86,
+    205, 205, 125, 233, 253, 197, 42, 31, 151, 72, 225, 108, 116, 125, 48, 39,
+    154, 35, 86, 144, 180, 180, 216, 71, 72, 19, 39, 16, 38, 237, 235, 21,
+    228, 218, 255, 75, 74, 25, 103, 199, 63, 63, 42, 168, 208, 170, 215, 21,
+    73, 142, 237, 201, 148, 76, 186, 111, 241, 15, 131, 1, 70, 70, 143, 6,
+    63, 162, 61, 14, 89, 186, 255, 231, 217, 137, 124, 147, 247, 109, 5, 105,
+    52, 52, 211, 107, 167, 27, 205, 11, 54, 217, 249, 59, 169, 31, 57, 183,
+    76, 123, 225, 175, 77, 77, 118, 197, 18, 205, 192, 4, 135, 124, 243, 66,
+    57, 184, 246, 219, 156, 65, 208, 248, 198, 198, 132, 42, 138, 116, 48, 1,
+    232, 31, 245, 158, 73, 46, 179, 255, 39, 87, 52, 62, 191, 191, 33, 132,
+    209, 221, 9, 50, 167, 20, 215, 30, 163, 47, 103, 62, 144, 133, 193, 40,
+    34, 34, 60, 240, 73, 100, 249, 55, 200, 119, 209, 194, 211, 185, 34, 26,
+    43, 147, 37, 238, 91, 91, 153, 94, 252, 178, 244, 56, 121, 210, 219, 187,
+    67, 30, 237, 118, 251, 169, 20, 185, 208, 208, 107, 177, 100, 11, 4, 61,
+    22, 177, 221, 103, 51, 136, 168, 82, 64, 191, 240, 127, 169, 169, 206, 31,
+    139, 3, 238, 38, 6, 133, 207, 73, 126, 77, 110, 174, 70, 221, 118, 23,
+    219, 219, 146, 114, 19, 186, 30, 35, 105, 230, 201, 149, 14, 219, 43, 138,
+    253, 203, 146, 209, 162, 162, 55, 220, 166, 108, 19, 44, 216, 67, 195, 236,
+    158, 124, 228, 230, 45, 241, 163, 134, 41, 41, 197, 51, 62, 213, 227, 41,
+    183, 32, 197, 48, 238, 234, 161, 194, 150, 231, 71, 64, 80, 80, 96, 157,
+    16, 35, 97, 74, 70, 85, 135, 241, 87, 126, 81, 121, 94, 72, 84, 170,
+    14, 14, 255, 219, 136, 154, 145, 79, 41, 54, 129, 45, 39, 232, 20, 93,
+    229, 94, 176, 108, 119, 119, 90, 117, 61, 76, 156, 64, 152, 147, 139, 84,
+    183, 79, 219, 49, 53, 100, 129, 59, 252, 252, 168, 154, 165, 245, 108, 69,
+    247, 240, 141, 136, 199, 217, 158, 21, 142, 114, 101, 253, 133, 133, 13, 52,
+    74, 253, 134, 94, 231, 196, 159, 166, 138, 28, 88, 233, 136, 16, 227, 149,
+    247, 247, 81, 89, 210, 68, 118, 91, 136, 167, 153, 122, 250, 138, 29, 205,
+    51, 6, 7, 83, 142, 142, 244, 247, 103, 146, 123, 84, 57, 2, 147, 3,
+    106, 45, 210, 161, 227, 60, 54, 4, 5, 5, 6, 24, 255, 43, 139, 81,
+    86, 97, 149, 223, 26, 187, 151, 133, 88, 42, 210, 194, 124, 124, 163, 182,
+    164, 130, 178, 98, 25, 106, 183, 95, 240, 186, 67, 68, 239, 248, 39, 212,
+    225, 225, 190, 194, 60, 59, 66, 103, 118, 9, 177, 131, 128, 44, 6, 96,
+    84, 238, 195, 18, 152, 152, 27, 108, 137, 237, 79, 104, 199, 172, 187, 250,
+    16, 139, 201, 12, 132, 212, 242, 69, 19, 19, 233, 131, 17, 84, 191, 109,
+    168, 207, 189, 38, 96, 29, 140, 40, 63, 194, 22, 131, 106, 106, 76, 45,
+    254, 92, 85, 118, 184, 251, 175, 8, 45, 216, 74, 212, 57, 160, 144, 235,
+    24, 24, 16, 64, 102, 229, 165, 115, 215, 152, 169, 212, 93, 78, 15, 240,
+    130, 182, 116, 45, 97, 97, 181, 238, 211, 51, 168, 124, 102, 61, 163, 173,
+    205, 233, 192, 156, 82, 140, 69, 122, 234, 234, 71, 1, 75, 138, 88, 121,
+    9, 94, 165, 113, 189, 127, 133, 184, 233, 154, 161, 188, 147, 147, 226, 175,
+    70, 163, 103, 231, 91, 50, 186, 43, 243, 178, 173, 2, 62, 38, 220, 100,
+    125, 125, 86, 69, 222, 26, 151, 226, 52, 81, 188, 247, 131, 36, 232, 38,
+    133, 48, 56, 162, 4, 4, 243, 235, 107, 204, 154, 237, 133, 244, 182, 142,
+    19, 131, 39, 74, 85, 10, 9, 245, 143, 143, 1, 4, 243, 117, 106, 232,
+    234, 151, 176, 82, 99, 21, 98, 110, 238, 28, 237, 51, 246, 246, 164, 170,
+    28, 125, 128, 243, 250, 163, 162, 124, 46, 208, 164, 146, 232, 126, 107, 91,
+    132, 132, 248, 199, 132, 196, 112, 246, 149, 192, 164, 160, 94, 70, 225, 182,
+    83, 104, 143, 157, 253, 253, 93, 105, 49, 18, 125, 249, 36, 101, 174, 217,
+    206, 225, 46, 218, 131, 82, 190, 202, 118, 118, 175, 134, 169, 171, 141, 252,
+    75, 6, 168, 5, 190, 119, 107, 254, 56, 68, 90, 12, 15, 15, 10, 40,
+    242, 2, 180, 207, 4, 13, 138, 133, 84, 118, 191, 63, 143, 150, 175, 26,
+    146, 146, 23, 92, 106, 187, 68, 202, 107, 110, 140, 89, 36, 224, 250, 27,
+    52, 128, 75, 220, 235, 235, 178, 242, 223, 109, 73, 197, 218, 203, 134, 32,
+    180, 71, 53, 119, 228, 186, 122, 139, 96, 96, 64, 29, 71, 212, 185, 192,
+    181, 168, 128, 252, 196, 209, 112, 83, 95, 172, 158, 77, 25, 25, 229, 179,
+    168, 220, 83, 219, 165, 156, 146, 210, 137, 20, 182, 175, 89, 206, 24, 37,
+    107, 107, 185, 222, 48, 101, 163, 222, 202, 255, 148, 14, 249, 130, 243, 139,
+    226, 216, 252, 227, 18, 18, 28, 112, 133, 179, 174, 209, 123, 90, 158, 119,
+    105, 37, 60, 231, 50, 226, 205, 180, 153, 153, 238, 159, 29, 10, 94, 212,
+    20, 57, 152, 171, 25, 179, 121, 195, 137, 244, 41, 114, 224, 224, 75, 49,
+    51, 252, 220, 183, 229, 76, 218, 106, 160, 39, 137, 120, 65, 91, 58, 152,
+    190, 190, 212, 119, 171, 69, 44, 178, 138, 47, 220, 182, 208, 177, 204, 92,
+    250, 77, 222, 94, 199, 199, 113, 217, 30, 147, 33, 189, 59, 138, 214, 207,
+    64, 22, 3, 48, 42, 119, 239, 9, 76, 76, 131, 54, 134, 42, 209, 184,
+    84, 233, 208, 19, 48, 128, 70, 20, 145, 97, 11, 207, 53, 53, 38, 152,
+    105, 34, 59, 163, 68, 221, 194, 61, 125, 69, 128, 232, 151, 3, 141, 167,
+    71, 71, 122, 245, 241, 155, 203, 166, 43, 190, 196, 225, 13, 211, 197, 204,
+    44, 21, 105, 97, 62, 62, 223, 91, 68, 77, 198, 169, 154, 27, 206, 152,
+    157, 116, 10, 160, 252, 47, 88, 54, 181, 181, 45, 180, 220, 244, 54, 172,
+    245, 120, 200, 68, 237, 226, 79, 132, 71, 57, 188, 240, 204, 204, 136, 26,
+    135, 93, 15, 159, 186, 115, 234, 196, 7, 227, 155, 69, 240, 235, 73, 230,
+    81, 81, 149, 110, 31, 228, 255, 154, 213, 16, 236, 24, 119, 117, 222, 97,
+    75, 253, 173, 32, 40, 40, 48, 192, 170, 50, 242, 149, 100, 181, 230, 97,
+    231, 210, 17, 13, 155, 199, 156, 119, 163, 163, 194, 47, 50, 139, 2, 144,
+    11, 214, 224, 189, 151, 68, 84, 41, 32, 209, 120, 177, 218, 218, 103, 129,
+    221, 131, 232, 139, 27, 226, 242, 147, 218, 129, 146, 213, 38, 179, 254, 217,
+    168, 168, 59, 236, 69, 58, 24, 142, 116, 129, 244, 79, 170, 23, 215, 241,
+    157, 165, 26, 31, 209, 209, 158, 66, 240, 236, 21, 129, 197, 36, 254, 54,
+    58, 176, 24, 157, 77, 159, 43, 72, 90, 90, 108, 173, 104, 85, 229, 132,
+    170, 71, 248, 234, 74, 38, 93, 185, 246, 137, 207, 142, 35, 35, 201, 3,
+    172, 29, 12, 71, 58, 206, 122, 169, 85, 133, 229, 246, 192, 220, 13, 129,
+    230, 230, 79, 33, 52, 164, 252, 66, 85, 173, 124, 117, 37, 19, 160, 210,
+    123, 202, 233, 71, 159, 159, 234, 143, 129, 114, 241, 77, 228, 8, 118, 12,
+    181, 180, 111, 190, 171, 240, 216, 16, 20, 20, 24, 96, 25, 203, 1, 72,
+    139, 107, 112, 208, 197, 34, 42, 154, 16, 230, 60, 214, 109, 109, 189, 206,
+    246, 195, 235, 83, 155, 95, 98, 254, 136, 231, 236, 102, 22, 132, 186, 190,
+    31, 31, 225, 163, 110, 122, 27, 86, 244, 60, 100, 34, 248, 113, 169, 66,
+    173, 146, 94, 120, 102, 102, 68, 13, 219, 172, 22, 89, 69, 153, 110, 91,
+    104, 214, 102, 46, 125, 168, 111, 47, 237, 237, 182, 226, 67, 21, 230, 92,
+    42, 250, 104, 135, 24, 64, 35, 10, 198, 190, 139, 233, 148, 148, 19, 76,
+    24, 188, 223, 111, 101, 241, 74, 7, 242, 65, 247, 203, 113, 108, 126, 255,
+    9, 9, 14, 56, 128, 5, 47, 106, 10, 146, 76, 219, 130, 215, 178, 239,
+    202, 122, 154, 57, 112, 112, 171, 150, 53, 211, 34, 101, 187, 55, 70, 162,
+    18, 112, 125, 131, 26, 64, 171, 110, 251, 251, 89, 121, 173, 106, 210, 96,
+    212, 84, 64, 126, 98, 230, 56, 167, 161, 86, 79, 168, 130, 130, 252, 215,
+    66, 98, 56, 123, 196, 96, 82, 80, 47, 35, 254, 91, 167, 52, 201, 192,
+    240, 240, 160, 186, 218, 219, 200, 126, 171, 3, 84, 140, 95, 181, 187, 127,
+    28, 34, 45, 6, 137, 137, 5, 20, 111, 13, 197, 113, 26, 166, 94, 245,
+    207, 18, 116, 19, 204, 24, 28, 81, 2, 2, 247, 251, 247, 180, 53, 116,
+    117, 197, 88, 41, 191, 132, 49, 55, 119, 14, 248, 151, 123, 123, 82, 85,
+    217, 66, 183, 23, 132, 176, 26, 232, 6, 16, 193, 140, 191, 161, 235, 125,
+    37, 37, 205, 19, 65, 251, 71, 18, 235, 211, 28, 52, 118, 134, 132, 168,
+    4, 183, 15, 187, 92, 92, 104, 189, 244, 45, 74, 29, 90, 118, 22, 77,
+    230, 33, 75, 196, 212, 141, 62, 236, 215, 215, 154, 82, 108, 148, 186, 24,
+    53, 21, 16, 145, 150, 183, 14, 224, 111, 155, 218, 42, 174, 174, 63, 252,
+    131, 156, 80, 3, 37, 33, 2, 191, 219, 114, 200, 28, 105, 249, 92, 66,
+    220, 220, 99, 145, 27, 37, 160, 6, 74, 66, 4, 99, 171, 228, 141, 56,
+    210, 239, 184, 132, 165, 165, 198, 63, 174, 243, 173, 9, 251, 231, 14, 26,
+    59, 67, 66, 84, 2, 213, 137, 211, 46, 46, 52, 208, 54, 74, 93, 12,
+    148, 132, 8, 198, 75, 213, 7, 112, 185, 195, 109, 21, 87, 87, 145, 126,
+    109, 227, 100, 63, 219, 143, 42, 70, 161, 212, 211, 177, 14, 17, 152, 3,
+    202, 202, 140, 10, 245, 90, 148, 58, 180, 236, 44, 154, 209, 66, 150, 149,
+    181, 7, 124, 197, 179, 179, 41, 164, 64, 140, 153, 53, 5, 73, 38, 227,
+    65, 229, 89, 249, 101, 61, 77, 146, 56, 56, 219, 75, 216, 53, 105, 48,
+    106, 42, 32, 63, 49, 115, 28, 221, 222, 43, 169, 84, 65, 65, 126, 229,
+    55, 61, 131, 43, 122, 30, 50, 17, 124, 182, 218, 33, 216, 73, 47, 60,
+    51, 51, 34, 136, 175, 132, 115, 46, 21, 125, 52, 205, 12, 32, 159, 5,
+    99, 95, 203, 250, 74, 74, 135, 38, 26, 82, 126, 33, 164, 216, 62, 180,
+    156, 135, 80, 105, 179, 101, 250, 173, 193, 193, 117, 201, 130, 235, 142, 36,
+    203, 187, 56, 104, 236, 17, 21, 77, 8, 115, 30, 107, 184, 184, 208, 103,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 89, 179, 131, 176, 182, 244, 19, 189, 69, 40,
+    28, 137, 29, 123, 67, 253, 86, 218, 230, 26, 145, 245, 178, 123, 27, 125,
+    113, 245, 38, 103, 138, 80, 56, 15, 58, 246, 134, 231, 172, 169, 209, 52,
+    63, 247, 235, 200, 152, 205, 199, 1, 53, 218, 207, 120, 36, 134, 39, 141,
+    197, 26, 250, 115, 55, 46, 174, 2, 121, 246, 54, 250, 226, 247, 76, 206,
+    9, 160, 112, 30, 116, 241, 17, 211, 69, 79, 191, 104, 126, 243, 32, 69,
+    181, 74, 84, 3, 95, 115, 76, 136, 108, 151, 105, 138, 82, 46, 19, 149,
+    89, 114, 239, 6, 203, 141, 45, 135, 147, 2, 106, 169, 131, 240, 72, 17,
+    78, 7, 151, 52, 233, 230, 110, 92, 65, 4, 146, 62, 174, 55, 37, 246,
+    121, 20, 198, 216, 84, 152, 83, 124, 212, 201, 191, 60, 136, 70, 208, 241,
+    242, 241, 108, 233, 217, 243, 152, 129, 18, 93, 224, 60, 232, 255, 34, 187,
+    138, 158, 99, 208, 252, 251, 171, 66, 239, 89, 111, 7, 139, 60, 87, 117,
+    252, 181, 245, 132, 97, 70, 220, 68, 133, 202, 109, 14, 64, 138, 119, 148,
+    168, 6, 190, 230, 152, 13, 216, 51, 210, 9, 164, 92, 38, 55, 178, 228,
+    195, 12, 25, 57, 244, 36, 30, 242, 173, 91, 221, 37, 196, 186, 207, 114,
+    231, 161, 112, 237, 84, 254, 82, 249, 139, 7, 90, 19, 59, 4, 212, 79,
+    27, 253, 144, 34, 156, 14, 51, 104, 207, 209, 220, 184, 130, 8, 210, 180,
+    217, 163, 141, 240, 199, 242, 94, 213, 140, 171, 129, 117, 112, 149, 153, 11,
+    58, 162, 19, 253, 57, 124, 65, 110, 74, 241, 242, 40, 145, 173, 168, 45,
+    166, 248, 181, 143, 99, 120, 13, 140, 189, 255, 96, 207, 194, 222, 252, 5,
+    225, 149, 212, 133, 180, 164, 187, 131, 246, 114, 53, 162, 235, 150, 44, 10,
+    249, 255, 216, 207, 175, 251, 45, 31, 36, 186, 221, 120, 205, 227, 68, 107,
+    9, 33, 198, 189, 229, 235, 160, 76, 91, 127, 25, 15, 62, 162, 97, 146,
+    193, 241, 208, 152, 7, 150, 95, 251, 32, 167, 116, 30, 75, 132, 195, 178,
+    222, 14, 11, 120, 174, 234, 229, 119, 247, 21, 194, 140, 165, 136, 23, 137,
+    218, 28, 18, 55, 64, 2, 104, 250, 24, 197, 235, 194, 249, 254, 234, 110,
+    129, 113, 243, 82, 241, 147, 75, 233, 128, 9, 238, 53, 77, 12, 97, 209,
+    45, 26, 173, 102, 185, 18, 85, 184, 76, 110, 121, 213, 155, 24, 217, 186,
+    109, 133, 251, 248, 114, 108, 104, 50, 177, 239, 164, 105, 22, 69, 26, 180,
+    159, 207, 10, 237, 50, 114, 245, 72, 60, 249, 71, 182, 167, 74, 149, 105,
+    131, 228, 211, 95, 224, 199, 168, 225, 164, 239, 107, 193, 118, 248, 138, 13,
+    84, 11, 226, 98, 137, 224, 158, 159, 144, 162, 182, 29, 78, 251, 53, 26,
+    11, 14, 180, 38, 118, 8, 181, 158, 54, 231, 61, 68, 37, 28, 102, 208,
+    131, 191, 165, 109, 25, 16, 82, 189, 55, 150, 192, 252, 166, 35, 115, 207,
+    33, 205, 56, 103, 37, 45, 213, 101, 67, 119, 136, 229, 185, 117, 175, 91,
+    7, 253, 147, 249, 188, 183, 5, 75, 31, 234, 224, 55, 47, 22, 116, 89,
+    38, 231, 224, 198, 44, 235, 177, 9, 128, 68, 249, 159, 25, 194, 2, 145,
+    163, 202, 121, 204, 146, 67, 183, 18, 114, 248, 130, 220, 148, 255, 249, 80,
+    63, 71, 77, 90, 81, 237, 119, 3, 198, 240, 26, 5, 103, 227, 43, 75,
+    1, 108, 34, 11, 234, 237, 122, 111, 81, 211, 76, 150, 52, 254, 144, 42,
+    252, 31, 246, 22, 192, 131, 153, 161, 229, 10, 223, 55, 181, 23, 117, 85,
+    107, 27, 241, 228, 106, 89, 203, 49, 88, 20, 153, 48, 26, 17, 83, 254,
+    204, 138, 240, 63, 105, 220, 118, 96, 178, 25, 60, 131, 45, 43, 201, 225,
+    239, 227, 173, 131, 67, 235, 90, 62, 72, 105, 167, 240, 135, 219, 136, 214,
+    18, 66, 145, 103, 215, 203, 182, 80, 46, 51, 245, 31, 73, 131, 13, 65,
+    187, 121, 154, 160, 203, 43, 68, 152, 119, 125, 70, 62, 93, 152, 182, 254,
+    50, 30, 124, 89, 194, 57, 159, 255, 189, 45, 14, 49, 190, 235, 64, 83,
+    232, 60, 4, 43, 53, 78, 132, 234, 111, 228, 135, 17, 131, 118, 160, 86,
+    77, 204, 232, 49, 166, 73, 121, 201, 150, 21, 155, 121, 161, 28, 22, 240,
+    65, 201, 215, 238, 243, 42, 153, 5, 87, 13, 46, 15, 169, 56, 207, 166,
+    24, 201, 23, 232, 5, 77, 4, 225, 203, 103, 238, 81, 218, 248, 1, 215,
+    200, 21, 56, 205, 36, 110, 128, 4, 208, 233, 48, 151, 203, 153, 239, 225,
+    201, 220, 31, 226, 251, 164, 255, 59, 150, 207, 125, 221, 3, 180, 102, 29,
+    35, 42, 142, 177, 243, 104, 212, 167, 92, 31, 173, 126, 25, 33, 7, 58,
+    29, 18, 193, 106, 154, 24, 194, 191, 90, 52, 71, 204, 111, 36, 170, 109,
+    152, 220, 242, 183, 43, 48, 68, 161, 66, 218, 44, 236, 209, 2, 31, 28,
+    91, 69, 114, 95, 233, 144, 206, 6, 20, 173, 186, 197, 175, 105, 218, 23,
+    235, 237, 228, 216, 208, 100, 127, 195, 85, 210, 44, 138, 52, 117, 35, 131,
+    20, 199, 246, 218, 89, 167, 93, 25, 247, 101, 149, 76, 99, 74, 72, 169,
+    111, 119, 98, 175, 197, 153, 133, 50, 100, 228, 247, 144, 120, 239, 142, 113,
+    83, 148, 55, 210, 27, 213, 187, 190, 221, 147, 77, 223, 85, 195, 61, 87,
+    116, 32, 206, 27, 157, 204, 22, 188, 43, 91, 6, 174, 248, 67, 139, 73,
+    171, 197, 196, 54, 214, 159, 236, 237, 9, 26, 168, 22, 217, 196, 15, 221,
+    33, 35, 61, 89, 113, 58, 156, 235, 106, 52, 143, 44, 111, 93, 191, 238,
+    187, 171, 156, 236, 19, 84, 60, 88, 126, 164, 39, 224, 122, 241, 251, 193,
+    22, 28, 117, 76, 236, 16, 119, 33, 108, 211, 122, 136, 74, 56, 204, 189,
+    27, 99, 87, 218, 50, 32, 79, 175, 246, 252, 90, 228, 100, 156, 41, 251,
+    102, 1, 87, 67, 143, 64, 77, 185, 177, 192, 163, 213, 164, 103, 110, 49,
+    157, 229, 81, 70, 230, 131, 66, 135, 112, 206, 74, 90, 183, 202, 134, 238,
+    13, 215, 253, 212, 237, 129, 43, 17, 66, 251, 163, 171, 94, 14, 109, 181,
+    9, 167, 225, 16, 96, 244, 156, 34, 111, 234, 67, 182, 14, 231, 59, 239,
+    101, 115, 10, 150, 62, 201, 221, 110, 94, 44, 232, 178, 76, 211, 54, 89,
+    192, 6, 184, 19, 40, 82, 32, 91, 22, 31, 35, 178, 158, 147, 8, 246,
+    14, 168, 221, 38, 221, 145, 88, 203, 127, 18, 29, 136, 239, 35, 50, 153,
+    4, 63, 91, 137, 242, 133, 57, 134, 115, 36, 132, 34, 219, 123, 201, 230,
+    14, 53, 170, 11, 46, 16, 25, 68, 24, 116, 164, 95, 223, 156, 226, 209,
+    228, 237, 25, 165, 53, 227, 239, 160, 126, 142, 154, 180, 162, 199, 238, 6,
+    145, 253, 52, 10, 206, 219, 189, 94, 154, 21, 131, 23, 252, 29, 59, 166,
+    134, 61, 191, 188, 173, 251, 199, 39, 210, 16, 95, 46, 86, 150, 2, 216,
+    68, 22, 201, 199, 244, 222, 162, 187, 152, 49, 104, 225, 61, 84, 229, 62,
+    241, 44, 15, 37, 129, 104, 242, 226, 218, 122, 177, 246, 190, 50, 133, 74,
+    43, 28, 107, 142, 3, 36, 96, 217, 157, 27, 47, 95, 215, 20, 163, 110,
+    119, 46, 234, 170, 214, 54, 255, 213, 212, 178, 139, 98, 176, 40, 196, 168,
+    172, 239, 97, 224, 176, 211, 50, 6, 246, 35, 203, 77, 188, 40, 130, 104,
+    109, 120, 33, 221, 47, 96, 52, 34, 166, 225, 133, 9, 253, 126, 210, 165,
+    236, 192, 121, 50, 120, 27, 90, 86, 143, 223, 118, 211, 183, 146, 16, 21,
+    150, 180, 184, 86, 206, 44, 241, 187, 58, 207, 46, 193, 188, 76, 30, 42,
+    195, 219, 71, 27, 134, 203, 180, 124, 144, 210, 83, 253, 19, 171, 13, 177,
+    36, 132, 63, 206, 179, 139, 154, 104, 196, 171, 48, 63, 167, 193, 213, 250,
+    79, 116, 14, 208, 78, 76, 114, 94, 217, 212, 34, 126, 113, 160, 92, 102,
+    247, 62, 146, 27, 26, 130, 107, 242, 41, 93, 139, 86, 136, 45, 238, 250,
+    140, 124, 40, 19, 223, 214, 65, 202, 129, 166, 95, 170, 119, 123, 52, 38,
+    200, 171, 222, 247, 8, 224, 29, 137, 186, 45, 113, 225, 100, 60, 248, 178,
+    153, 114, 35, 227, 103, 90, 28, 98, 97, 203, 128, 166, 205, 120, 227, 158,
+    242, 81, 210, 200, 235, 15, 220, 90, 63, 106, 122, 33, 95, 159, 55, 17,
+    102, 188, 92, 141, 8, 86, 106, 156, 21, 201, 222, 213, 19, 34, 27, 236,
+    93, 172, 154, 133, 205, 98, 81, 146, 242, 143, 81, 229, 233, 44, 163, 61,
+    205, 104, 86, 10, 7, 101, 64, 215, 217, 120, 155, 184, 183, 136, 99, 122,
+    49, 42, 43, 242, 95, 56, 44, 253, 130, 143, 179, 193, 251, 84, 47, 10,
+    174, 26, 92, 30, 79, 112, 104, 153, 168, 66, 233, 204, 63, 64, 199, 167,
+    175, 72, 230, 47, 108, 247, 248, 192, 186, 4, 222, 133, 131, 81, 48, 143,
+    46, 205, 10, 154, 8, 223, 139, 206, 193, 162, 169, 237, 2, 179, 141, 42,
+    112, 135, 218, 226, 179, 63, 152, 57, 25, 39, 77, 247, 151, 71, 220, 217,
+    234, 16, 84, 105, 107, 48, 225, 114, 72, 220, 29, 8, 189, 207, 96, 51,
+    139, 47, 195, 223, 143, 165, 62, 217, 235, 85, 227, 118, 49, 131, 17, 111,
+    158, 184, 11, 59, 115, 142, 206, 7, 223, 86, 146, 222, 125, 36, 189, 143,
+    5, 108, 160, 118, 250, 167, 6, 117, 204, 58, 70, 84, 1, 127, 251, 208,
+    181, 83, 184, 62, 71, 252, 50, 66, 14, 116, 163, 20, 133, 197, 122, 206,
+    85, 233, 68, 87, 231, 89, 168, 40, 251, 195, 17, 38, 212, 88, 159, 129,
+    58, 36, 159, 212, 41, 48, 153, 99, 180, 104, 142, 133, 222, 72, 73, 218,
+    45, 165, 249, 115, 86, 96, 99, 151, 28, 100, 159, 196, 138, 222, 241, 64,
+    146, 12, 195, 51, 10, 39, 123, 127, 31, 105, 199, 149, 136, 95, 132, 169,
+    88, 197, 191, 4, 62, 56, 182, 138, 228, 190, 207, 61, 129, 12, 40, 71,
+    105, 151, 209, 236, 7, 25, 238, 49, 172, 185, 123, 16, 170, 3, 249, 197,
+    140, 192, 215, 214, 206, 93, 248, 98, 67, 210, 169, 46, 203, 199, 213, 173,
+    189, 200, 254, 155, 170, 185, 88, 9, 104, 234, 70, 27, 40, 147, 26, 97,
+    42, 158, 125, 51, 198, 16, 248, 224, 226, 18, 183, 194, 27, 244, 62, 48,
+    160, 1, 185, 102, 241, 169, 178, 83, 186, 50, 243, 202, 55, 152, 198, 148,
+    144, 79, 222, 238, 196, 67, 151, 47, 23, 100, 168, 26, 49, 227, 12, 198,
+    224, 119, 114, 176, 218, 29, 141, 52, 157, 19, 146, 153, 113, 53, 134, 145,
+    200, 213, 243, 61, 240, 195, 1, 226, 166, 53, 110, 185, 54, 183, 107, 97,
+    167, 59, 154, 163, 170, 155, 145, 102, 112, 141, 70, 55, 18, 95, 227, 29,
+    114, 48, 43, 204, 40, 156, 241, 225, 124, 185, 59, 110, 122, 174, 232, 64,
+    129, 54, 39, 133, 44, 101, 86, 182, 12, 65, 237, 134, 11, 146, 75, 151,
+    149, 108, 35, 29, 107, 240, 55, 194, 52, 56, 105, 77, 74, 63, 17, 58,
+    174, 123, 93, 72, 173, 141, 4, 153, 177, 35, 197, 199, 18, 52, 77, 44,
+    175, 149, 30, 167, 66, 70, 122, 178, 226, 116, 37, 203, 212, 104, 232, 144,
+    70, 119, 164, 192, 94, 145, 234, 189, 2, 46, 95, 61, 57, 79, 180, 174,
+    195, 209, 69, 157, 3, 88, 222, 186, 99, 193, 107, 75, 37, 197, 38, 168,
+    120, 176, 252, 85, 78, 221, 244, 255, 235, 159, 90, 235, 93, 10, 213, 53,
+    120, 246, 96, 237, 58, 33, 101, 203, 191, 168, 24, 7, 18, 229, 122, 106,
+    44, 56, 234, 152, 197, 32, 238, 66, 216, 187, 244, 13, 148, 112, 133, 103,
+    54, 198, 174, 169, 100, 64, 117, 139, 105, 40, 115, 212, 253, 255, 157, 147,
+    232, 132, 137, 11, 198, 154, 96, 28, 72, 179, 245, 181, 158, 67, 241, 229,
+    180, 213, 200, 37, 82, 235, 204, 2, 174, 134, 3, 128, 154, 111, 127, 157,
+    91, 183, 199, 240, 114, 85, 2, 33, 219, 152, 23, 195, 208, 139, 179, 253,
+    64, 125, 204, 181, 153, 135, 202, 66, 85, 206, 220, 98, 39, 215, 162, 140,
+    209, 27, 132, 19, 224, 129, 148, 180, 115, 137, 17, 193, 26, 179, 12, 125,
+    95, 210, 145, 35, 177, 49, 148, 51, 152, 154, 253, 250, 215, 73, 37, 83,
+    247, 219, 139, 70, 231, 181, 199, 31, 86, 34, 132, 235, 91, 75, 188, 28,
+    218, 119, 18, 83, 223, 32, 192, 245, 37, 68, 190, 6, 68, 175, 224, 214,
+    151, 86, 30, 99, 160, 149, 199, 12, 81, 174, 137, 250, 38, 239, 180, 177,
+    222, 201, 134, 113, 28, 211, 118, 195, 202, 230, 20, 49, 124, 143, 167, 220,
+    188, 88, 205, 121, 152, 187, 135, 122, 5, 193, 170, 39, 101, 126, 143, 206,
+    8, 184, 97, 244, 228, 33, 234, 130, 43, 99, 9, 78, 108, 178, 157, 12,
+    109, 38, 80, 164, 64, 182, 44, 62, 70, 121, 33, 59, 16, 241, 28, 77,
+    167, 76, 53, 1, 30, 188, 219, 210, 67, 25, 5, 158, 48, 183, 91, 2,
+    98, 198, 70, 43, 250, 87, 54, 185, 167, 63, 176, 139, 254, 36, 58, 13,
+    195, 70, 100, 47, 8, 126, 182, 15, 249, 23, 114, 17, 230, 72, 254, 140,
+    51, 59, 72, 208, 41, 176, 134, 110, 120, 166, 21, 5, 245, 242, 175, 205,
+    148, 11, 119, 189, 21, 68, 171, 246, 143, 209, 28, 106, 73, 22, 92, 32,
+    50, 136, 48, 232, 85, 190, 163, 37, 217, 191, 76, 247, 40, 70, 57, 37,
+    15, 215, 12, 62, 64, 169, 47, 243, 115, 21, 3, 100, 69, 63, 72, 74,
+    213, 199, 50, 87, 106, 219, 195, 93, 252, 1, 41, 117, 89, 147, 193, 12,
+    63, 231, 104, 20, 129, 171, 140, 116, 177, 231, 220, 47, 208, 224, 185, 41,
+    53, 252, 68, 232, 130, 241, 105, 61, 142, 14, 16, 94, 103, 188, 41, 42,
+    27, 46, 229, 58, 118, 81, 17, 122, 99, 101, 71, 235, 147, 78, 185, 32,
+    190, 92, 62, 15, 170, 154, 173, 218, 246, 135, 51, 121, 13, 243, 126, 30,
+    4, 22, 197, 148, 95, 58, 47, 169, 172, 49, 4, 173, 136, 44, 143, 147,
+    245, 161, 89, 107, 45, 98, 208, 223, 122, 168, 215, 124, 255, 88, 245, 130,
+    135, 29, 62, 216, 156, 46, 176, 137, 69, 226, 48, 25, 147, 34, 44, 114,
+    49, 102, 110, 173, 30, 74, 31, 208, 249, 217, 169, 244, 127, 241, 97, 100,
+    23, 148, 86, 56, 214, 1, 6, 72, 192, 175, 71, 249, 156, 96, 79, 45,
+    186, 73, 58, 217, 125, 237, 10, 239, 21, 197, 128, 219, 224, 82, 81, 90,
+    39, 54, 94, 190, 179, 40, 91, 220, 238, 92, 201, 73, 177, 108, 227, 183,
+    181, 121, 11, 196, 125, 80, 126, 133, 221, 14, 5, 220, 72, 97, 171, 116,
+    213, 192, 172, 23, 160, 74, 227, 163, 237, 222, 236, 165, 149, 77, 69, 195,
+    194, 221, 125, 187, 100, 12, 241, 70, 139, 154, 101, 80, 25, 208, 218, 240,
+    66, 167, 204, 254, 198, 115, 116, 41, 110, 6, 33, 36, 237, 207, 150, 225,
+    38, 173, 79, 10, 60, 234, 211, 82, 94, 192, 104, 68, 81, 223, 23, 18,
+    231, 252, 185, 87, 197, 157, 242, 100, 240, 54, 180, 172, 3, 163, 7, 115,
+    235, 244, 231, 43, 4, 175, 162, 212, 165, 222, 216, 230, 177, 153, 166, 236,
+    82, 182, 146, 86, 236, 187, 115, 57, 32, 42, 49, 117, 109, 172, 129, 88,
+    255, 107, 116, 131, 92, 159, 101, 152, 60, 84, 181, 8, 240, 137, 150, 222,
+    34, 200, 40, 132, 157, 209, 226, 16, 55, 126, 10, 69, 131, 130, 173, 161,
+    155, 171, 142, 54, 17, 139, 117, 248, 61, 185, 166, 231, 38, 75, 26, 127,
+    72, 21, 126, 129, 123, 11, 194, 24, 13, 134, 167, 127, 102, 69, 120, 145,
+    186, 110, 59, 48, 89, 130, 30, 207, 152, 155, 234, 254, 41, 208, 149, 75,
+    96, 126, 83, 159, 183, 233, 158, 232, 28, 189, 156, 152, 228, 188, 175, 181,
+    68, 252, 112, 99, 22, 251, 214, 138, 64, 34, 242, 193, 130, 97, 1, 198,
+    223, 101, 178, 102, 73, 175, 213, 9, 226, 93, 184, 204, 243, 124, 57, 54,
+    52, 25, 214, 249, 82, 186, 11, 172, 13, 90, 193, 233, 5, 248, 187, 238,
+    59, 124, 69, 136, 42, 139, 113, 49, 202, 112, 79, 193, 72, 81, 91, 128,
+    39, 243, 148, 13, 80, 38, 163, 177, 130, 137, 31, 81, 190, 73, 238, 246,
+    104, 76, 141, 75, 161, 243, 16, 221, 58, 15, 9, 149, 32, 1, 52, 125,
+    12, 236, 251, 97, 242, 127, 117, 55, 206, 182, 247, 41, 246, 199, 171, 250,
+    105, 90, 226, 223, 200, 120, 237, 121, 47, 228, 70, 219, 206, 180, 56, 196,
+    194, 139, 29, 81, 135, 240, 48, 233, 97, 111, 126, 140, 254, 196, 106, 204,
+    90, 82, 211, 207, 123, 57, 148, 81, 251, 75, 22, 5, 219, 33, 249, 162,
+    185, 141, 203, 30, 165, 180, 126, 212, 244, 66, 190, 35, 110, 34, 204, 101,
+    184, 7, 130, 146, 122, 18, 15, 121, 216, 163, 224, 156, 98, 93, 233, 57,
+    253, 222, 56, 248, 42, 127, 41, 242, 16, 172, 212, 37, 42, 143, 161, 183,
+    38, 68, 54, 197, 186, 69, 41, 23, 135, 196, 162, 57, 249, 3, 73, 31,
+    87, 149, 156, 123, 178, 10, 99, 108, 42, 76, 167, 62, 106, 234, 209, 30,
+    68, 35, 104, 246, 162, 215, 207, 88, 91, 122, 135, 208, 172, 20, 14, 202,
+    128, 179, 175, 240, 43, 109, 115, 13, 198, 244, 251, 100, 76, 232, 237, 142,
+    148, 109, 233, 60, 18, 67, 157, 200, 236, 13, 125, 183, 149, 23, 87, 1,
+    98, 84, 86, 249, 190, 112, 88, 231, 25, 3, 123, 159, 235, 168, 94, 20,
+    65, 52, 184, 60, 158, 224, 59, 231, 213, 73, 8, 132, 75, 90, 92, 43,
+    103, 22, 246, 211, 29, 233, 23, 238, 94, 38, 15, 21, 208, 47, 77, 132,
+    207, 133, 126, 128, 147, 83, 67, 144, 209, 94, 216, 243, 237, 157, 105, 8,
+    161, 23, 137, 156, 206, 52, 121, 113, 109, 61, 214, 123, 95, 25, 204, 37,
+    155, 14, 187, 71, 143, 18, 48, 226, 27, 162, 96, 3, 92, 135, 20, 41,
+    16, 163, 11, 129, 159, 89, 79, 199, 4, 123, 7, 84, 224, 19, 66, 17,
+    227, 179, 234, 115, 7, 148, 85, 139, 23, 8, 130, 34, 12, 58, 82, 161,
+    225, 78, 113, 230, 169, 217, 123, 126, 45, 114, 50, 78, 154, 243, 51, 142,
+    165, 175, 201, 32, 168, 210, 214, 96, 223, 228, 240, 106, 248, 206, 155, 134,
+    33, 243, 223, 219, 47, 7, 184, 212, 138, 221, 254, 8, 48, 122, 78, 17,
+    144, 165, 58, 16, 103, 131, 192, 102, 11, 94, 155, 163, 3, 87, 124, 175,
+    203, 170, 219, 236, 98, 27, 201, 22, 185, 160, 209, 119, 211, 219, 78, 118,
+    135, 42, 30, 44, 63, 82, 157, 112, 61, 246, 243, 238, 34, 222, 33, 109,
+    22, 118, 230, 1, 129, 14, 163, 172, 57, 161, 250, 72, 103, 3, 10, 216,
+    93, 236, 123, 109, 162, 221, 160, 130, 245, 188, 196, 38, 191, 37, 36, 218,
+    185, 181, 49, 217, 236, 194, 204, 25, 233, 83, 12, 234, 133, 116, 140, 168,
+    2, 254, 235, 189, 119, 166, 109, 124, 142, 229, 100, 132, 28, 232, 176, 224,
+    143, 90, 51, 128, 159, 21, 71, 214, 247, 52, 106, 221, 46, 129, 216, 63,
+    130, 158, 141, 29, 91, 40, 23, 151, 244, 129, 170, 207, 136, 174, 211, 178,
+    77, 80, 235, 155, 34, 76, 181, 176, 35, 31, 2, 155, 148, 39, 66, 117,
+    185, 114, 205, 134, 207, 59, 80, 43, 168, 102, 116, 150, 83, 170, 178, 234,
+    116, 72, 35, 181, 82, 96, 47, 198, 117, 208, 1, 23, 161, 144, 146, 169,
+    90, 87, 239, 230, 172, 192, 45, 251, 160, 5, 228, 148, 60, 123, 48, 248,
+    29, 158, 188, 235, 209, 84, 12, 141, 9, 252, 61, 53, 198, 51, 56, 200,
+    35, 149, 9, 161, 255, 128, 57, 24, 155, 102, 20, 78, 246, 254, 62, 210,
+    147, 55, 159, 128, 187, 120, 149, 97, 26, 28, 186, 168, 37, 145, 134, 29,
+    87, 179, 160, 36, 216, 200, 2, 194, 13, 190, 21, 79, 176, 151, 99, 8,
+    124, 112, 113, 9, 213, 97, 131, 122, 31, 24, 80, 142, 210, 51, 84, 13,
+    150, 255, 6, 99, 112, 181, 57, 88, 109, 128, 200, 26, 192, 135, 73, 194,
+    182, 148, 67, 198, 191, 197, 14, 50, 193, 98, 69, 111, 246, 32, 73, 6,
+    239, 151, 5, 157, 179, 177, 129, 186, 237, 196, 230, 118, 141, 130, 119, 150,
+    86, 210, 179, 8, 85, 143, 242, 236, 70, 96, 229, 107, 103, 160, 124, 49,
+    134, 185, 79, 92, 139, 147, 183, 71, 103, 141, 225, 43, 73, 111, 176, 18,
+    208, 201, 140, 54, 80, 59, 223, 10, 204, 236, 61, 103, 164, 250, 34, 165,
+    253, 162, 84, 20, 243, 239, 134, 19, 106, 44, 193, 206, 52, 194, 84, 33,
+    250, 102, 145, 32, 237, 221, 217, 36, 115, 153, 54, 245, 124, 96, 93, 2,
+    111, 204, 109, 113, 215, 145, 76, 146, 130, 157, 168, 245, 197, 173, 110, 226,
+    117, 8, 42, 186, 187, 24, 254, 57, 255, 79, 121, 166, 105, 100, 251, 137,
+    110, 45, 145, 53, 61, 158, 161, 193, 149, 134, 51, 94, 46, 200, 166, 252,
+    250, 22, 223, 144, 232, 52, 43, 5, 141, 188, 32, 229, 226, 60, 195, 92,
+    213, 68, 191, 61, 77, 52, 98, 219, 24, 145, 221, 238, 228, 125, 169, 58,
+    7, 104, 39, 38, 57, 47, 226, 106, 17, 63, 20, 135, 225, 107, 174, 101,
+    206, 83, 161, 85, 181, 179, 26, 19, 100, 219, 111, 245, 4, 112, 128, 202,
+    141, 183, 251, 122, 253, 155, 2, 217, 81, 106, 220, 111, 108, 115, 214, 194,
+    83, 118, 41, 91, 73, 43, 212, 4, 120, 202, 75, 111, 17, 100, 20, 66,
+    192, 230, 113, 8, 149, 63, 5, 172, 207, 65, 216, 222, 63, 204, 224, 7,
+    140, 110, 36, 190, 219, 58, 228, 96, 86, 133, 80, 37, 255, 223, 248, 111,
+    118, 220, 102, 127, 99, 183, 58, 154, 55, 3, 158, 18, 248, 233, 75, 254,
+    19, 216, 169, 5, 30, 117, 231, 41, 244, 65, 205, 128, 31, 108, 78, 23,
+    88, 202, 172, 113, 24, 130, 199, 17, 22, 57, 150, 51, 55, 216, 173, 242,
+    78, 48, 169, 152, 93, 170, 29, 226, 176, 248, 5, 249, 132, 236, 64, 227,
+    112, 41, 166, 45, 70, 58, 214, 253, 110, 153, 104, 112, 210, 154, 148, 126,
+    34, 116, 65, 246, 186, 144, 71, 7, 8, 47, 31, 137, 85, 77, 216, 109,
+    123, 205, 151, 178, 136, 247, 63, 15, 2, 11, 236, 74, 161, 29, 153, 218,
+    127, 70, 151, 147, 36, 104, 154, 88, 67, 55, 60, 83, 132, 140, 244, 121,
+    217, 232, 74, 139, 181, 208, 38, 245, 20, 35, 146, 156, 137, 229, 6, 31,
+    32, 218, 153, 247, 183, 132, 143, 50, 172, 145, 36, 37, 205, 61, 140, 238,
+    85, 157, 188, 63, 201, 103, 4, 92, 190, 122, 114, 158, 117, 65, 155, 191,
+    138, 39, 148, 142, 15, 94, 227, 105, 175, 130, 140, 79, 24, 213, 163, 1,
+    49, 99, 35, 155, 125, 165, 27, 210, 6, 176, 161, 105, 198, 159, 214, 150,
+    74, 151, 76, 77, 240, 125, 229, 170, 156, 167, 245, 227, 203, 35, 95, 3,
+    34, 217, 112, 107, 197, 43, 15, 191, 80, 196, 237, 6, 166, 87, 202, 125,
+    19, 249, 90, 214, 180, 203, 186, 20, 183, 106, 240, 241, 192, 199, 116, 66,
+    202, 139, 99, 77, 48, 14, 36, 215, 244, 212, 237, 120, 57, 164, 1, 158,
+    227, 76, 133, 239, 104, 203, 215, 240, 32, 176, 102, 212, 194, 205, 101, 33,
+    88, 112, 201, 45, 151, 64, 193, 132, 173, 107, 245, 26, 53, 224, 23, 206,
+    108, 145, 65, 79, 200, 128, 1, 195, 74, 157, 33, 180, 210, 57, 232, 67,
+    233, 147, 40, 155, 84, 51, 58, 75, 167, 85, 89, 117, 234, 11, 210, 80,
+    230, 181, 231, 227, 39, 59, 205, 21, 15, 22, 145, 41, 192, 56, 144, 123,
+    247, 119, 179, 184, 81, 224, 80, 65, 244, 94, 98, 19, 209, 156, 18, 109,
+    210, 212, 150, 226, 118, 97, 102, 130, 33, 134, 255, 215, 117, 183, 141, 74,
+    164, 203, 133, 4, 65, 17, 6, 29, 41, 222, 254, 39, 182, 115, 120, 53,
+    124, 103, 195, 67, 158, 247, 225, 227, 153, 141, 92, 106, 69, 224, 127, 4,
+    24, 61, 39, 134, 147, 253, 228, 170, 4, 66, 171, 45, 46, 155, 189, 11,
+    123, 231, 128, 250, 133, 119, 47, 19, 137, 132, 202, 78, 103, 26, 178, 182,
+    184, 144, 107, 179, 161, 130, 102, 156, 195, 7, 211, 173, 201, 9, 24, 113,
+    170, 129, 165, 196, 78, 179, 89, 5, 191, 54, 21, 38, 221, 31, 53, 117,
+    230, 15, 34, 159, 52, 123, 243, 50, 38, 116, 248, 71, 74, 184, 250, 30,
+    9, 175, 192, 100, 118, 136, 176, 213, 196, 133, 165, 142, 24, 250, 190, 185,
+    63, 70, 127, 98, 53, 102, 45, 41, 231, 233, 179, 146, 74, 166, 243, 171,
+    11, 140, 65, 73, 61, 9, 137, 178, 108, 223, 112, 78, 49, 160, 250, 146,
+    240, 111, 28, 124, 21, 177, 154, 121, 211, 119, 147, 62, 172, 68, 21, 203,
+    182, 150, 101, 56, 169, 238, 36, 166, 163, 64, 157, 247, 74, 136, 138, 196,
+    16, 142, 26, 176, 6, 118, 243, 190, 121, 177, 180, 149, 103, 91, 245, 154,
+    123, 237, 219, 125, 97, 12, 136, 67, 221, 177, 51, 172, 60, 198, 93, 55,
+    147, 24, 162, 65, 15, 233, 76, 195, 117, 127, 56, 191, 11, 243, 107, 69,
+    32, 17, 121, 238, 65, 190, 142, 99, 225, 188, 89, 51, 170, 217, 228, 138,
+    161, 143, 17, 226, 56, 187, 236, 155, 137, 209, 40, 98, 248, 3, 83, 165,
+    101, 176, 135, 242, 45, 107, 248, 60, 146, 82, 142, 79, 255, 38, 204, 249,
+    52, 235, 229, 120, 16, 88, 51, 106, 97, 232, 188, 158, 19, 244, 10, 159,
+    73, 78, 202, 252, 3, 129, 16, 109, 194, 245, 213, 66, 201, 25, 86, 198,
+    18, 156, 74, 71, 137, 47, 255, 186, 217, 65, 70, 169, 12, 228, 223, 142,
+    150, 191, 159, 195, 176, 220, 131, 105, 216, 121, 39, 24, 218, 76, 160, 85,
+    128, 113, 88, 124, 140, 242, 66, 118, 32, 255, 56, 154, 83, 152, 129, 202,
+    164, 168, 108, 184, 179, 232, 197, 89, 68, 245, 145, 137, 1, 139, 118, 37,
+    222, 128, 194, 109, 106, 2, 60, 101, 171, 185, 134, 50, 10, 33, 96, 115,
+    182, 4, 196, 145, 140, 86, 233, 174, 108, 111, 51, 177, 191, 213, 29, 77,
+    149, 143, 79, 9, 124, 250, 171, 127, 135, 108, 218, 140, 15, 180, 253, 154,
+    83, 126, 125, 11, 225, 72, 116, 26, 155, 140, 200, 94, 16, 252, 113, 30,
+    239, 46, 228, 34, 209, 144, 10, 205, 254, 187, 87, 188, 103, 167, 222, 164,
+    212, 215, 13, 135, 50, 227, 185, 244, 2, 56, 64, 101, 225, 5, 102, 118,
+    144, 189, 82, 125, 17, 220, 240, 81, 42, 10, 247, 249, 67, 135, 53, 22,
+    238, 103, 184, 182, 229, 198, 38, 73, 65, 192, 84, 244, 236, 216, 55, 113,
+    180, 4, 21, 93, 211, 12, 127, 146, 42, 136, 75, 241, 3, 191, 56, 212,
+    146, 44, 184, 64, 100, 13, 96, 205, 170, 97, 91, 74, 175, 99, 115, 59,
+    200, 65, 181, 75, 43, 105, 215, 4, 164, 201, 121, 118, 35, 48, 252, 187,
+    189, 80, 62, 150, 152, 243, 80, 140, 114, 74, 30, 179, 24, 124, 128, 79,
+    94, 251, 230, 42, 6, 200, 138, 126, 144, 148, 193, 64, 211, 60, 196, 190,
+    13, 14, 93, 84, 156, 198, 67, 128, 165, 215, 80, 18, 108, 100, 1, 97,
+    183, 147, 100, 174, 212, 171, 155, 186, 229, 2, 82, 234, 178, 59, 159, 24,
+    126, 211, 208, 40, 31, 75, 238, 32, 231, 30, 98, 95, 136, 7, 160, 42,
+    78, 99, 175, 64, 220, 229, 40, 9, 54, 50, 142, 190, 5, 232, 127, 211,
+    165, 94, 189, 221, 111, 82, 106, 229, 136, 205, 25, 255, 210, 122, 1, 28,
+    32, 188, 92, 91, 252, 99, 19, 170, 174, 96, 42, 122, 118, 108, 149, 182,
+    90, 2, 132, 160, 231, 6, 177, 73, 206, 101, 82, 84, 54, 92, 215, 116,
+    236, 162, 34, 244, 198, 202, 142, 203, 59, 156, 111, 64, 97, 184, 151, 214,
+    209, 228, 128, 168, 196, 201, 169, 138, 62, 125, 219, 177, 205, 54, 109, 70,
+    137, 90, 240, 77, 124, 30, 73, 41, 71, 169, 241, 19, 102, 242, 26, 251,
+    252, 60, 8, 44, 151, 53, 190, 116, 94, 79, 37, 173, 202, 153, 241, 93,
+    226, 174, 35, 218, 6, 114, 225, 71, 75, 209, 193, 239, 88, 110, 207, 186,
+    69, 98, 8, 71, 13, 88, 3, 59, 247, 95, 178, 214, 90, 196, 189, 163,
+    244, 77, 179, 248, 227, 176, 28, 209, 139, 247, 187, 172, 16, 134, 178, 119,
+    174, 95, 71, 191, 254, 94, 162, 151, 85, 226, 114, 69, 247, 25, 19, 58,
+    124, 173, 37, 92, 125, 15, 138, 217, 96, 50, 59, 68, 88, 228, 98, 204,
+    220, 71, 174, 170, 144, 138, 202, 89, 54, 225, 56, 39, 150, 80, 125, 73,
+    120, 185, 14, 62, 132, 214, 77, 178, 60, 148, 62, 189, 239, 175, 79, 245,
+    254, 255, 194, 200, 46, 53, 172, 112, 177, 2, 12, 144, 157, 67, 101, 39,
+    189, 13, 89, 91, 92, 72, 187, 215, 222, 65, 51, 78, 239, 141, 231, 216,
+    234, 138, 12, 182, 142, 239, 37, 192, 158, 90, 105, 146, 116, 175, 250, 199,
+    20, 195, 42, 151, 29, 171, 221, 164, 162, 180, 215, 92, 166, 112, 40, 174,
+    122, 47, 49, 135, 230, 78, 9, 184, 105, 106, 75, 113, 59, 190, 51, 65,
+    78, 108, 188, 97, 123, 80, 182, 165, 193, 184, 143, 146, 127, 216, 219, 115,
+    119, 242, 22, 149, 250, 160, 23, 223, 63, 209, 205, 164, 165, 24, 132, 144,
+    147, 27, 98, 163, 152, 142, 33, 40, 240, 143, 107, 85, 252, 23, 167, 28,
+    10, 165, 144, 194, 75, 232, 183, 157, 69, 46, 93, 148, 219, 91, 199, 161,
+    197, 87, 165, 164, 36, 172, 188, 81, 131, 127, 14, 192, 171, 20, 88, 85,
+    30, 105, 141, 129, 33, 187, 84, 162, 55, 154, 138, 155, 153, 167, 250, 107,
+    200, 24, 255, 140, 11, 41, 202, 160, 50, 189, 169, 253, 132, 83, 110, 41,
+    9, 43, 47, 83, 233, 214, 141, 48, 227, 5, 22, 82, 137, 93, 100, 103,
+    79, 231, 21, 166, 133, 225, 145, 230, 232, 82, 220, 12, 66, 72, 199, 131,
+    49, 223, 76, 71, 158, 20, 120, 201, 187, 164, 220, 82, 18, 86, 94, 166,
+    207, 177, 7, 96, 219, 10, 44, 164, 15, 186, 200, 206, 158, 211, 42, 81,
+    188, 157, 208, 136, 162, 163, 46, 36, 211, 229, 111, 174, 151, 39, 249, 200,
+    253, 108, 117, 69, 6, 91, 229, 46, 83, 56, 20, 87, 61, 153, 150, 205,
+    115, 39, 138, 92, 186, 53, 171, 182, 147, 95, 151, 174, 14, 230, 203, 245,
+    211, 86, 8, 67, 89, 181, 87, 161, 173, 209, 127, 47, 81, 197, 164, 113,
+    57, 172, 87, 85, 72, 69, 101, 162, 27, 254, 28, 157, 75, 40, 176, 170,
+    60, 210, 7, 31, 66, 107, 168, 89, 197, 107, 230, 114, 64, 84, 98, 234,
+    218, 69, 31, 176, 227, 214, 232, 27, 184, 35, 202, 45, 120, 168, 156, 216,
+    101, 194, 246, 160, 113, 87, 159, 109, 3, 57, 254, 173, 171, 230, 238, 249,
+    44, 55, 233, 93, 119, 16, 253, 15, 49, 161, 68, 141, 80, 21, 39, 191,
+    217, 32, 110, 252, 20, 138, 27, 25, 71, 95, 46, 163, 126, 191, 135, 85,
+    87, 48, 21, 61, 59, 54, 196, 91, 45, 1, 66, 80, 253, 3, 214, 170,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 122, 118, 169, 70, 178, 237, 216, 102,
+    115, 150, 229, 73, 130, 72, 61, 43, 206, 1, 237, 247, 127, 217, 144, 117,
+    244, 236, 79, 140, 121, 199, 173, 204, 230, 49, 215, 146, 25, 144, 122, 86,
+    129, 2, 199, 243, 254, 175, 61, 234, 142, 154, 230, 202, 203, 42, 117, 170,
+    149, 167, 50, 219, 155, 216, 71, 125, 79, 3, 42, 4, 129, 118, 173, 159,
+    245, 197, 158, 5, 242, 147, 71, 133, 209, 98, 179, 57, 50, 61, 244, 172,
+    31, 4, 147, 251, 225, 67, 122, 201, 143, 179, 55, 67, 64, 126, 159, 227,
+    162, 244, 86, 112, 176, 117, 201, 135, 209, 5, 126, 12, 158, 154, 234, 188,
+    1, 41, 209, 137, 139, 84, 234, 73, 55, 83, 100, 171, 43, 173, 142, 250,
+    158, 6, 84, 8, 31, 236, 71, 35, 123, 95, 120, 207, 57, 185, 50, 47,
+    68, 197, 129, 226, 169, 229, 179, 209, 80, 7, 185, 255, 96, 53, 215, 86,
+    247, 151, 33, 10, 249, 59, 142, 23, 191, 196, 123, 114, 100, 122, 245, 69,
+    62, 8, 59, 235, 223, 134, 244, 143, 141, 225, 136, 76, 75, 214, 86, 113,
+    204, 82, 158, 59, 230, 50, 200, 110, 240, 9, 214, 28, 160, 95, 100, 250,
+    3, 123, 110, 134, 128, 252, 35, 219, 89, 245, 172, 224, 125, 234, 143, 19,
+    191, 10, 252, 24, 33, 41, 201, 101, 121, 13, 199, 192, 50, 17, 251, 189,
+    42, 99, 73, 169, 255, 162, 178, 56, 113, 11, 17, 239, 94, 240, 89, 16,
+    2, 82, 191, 15, 11, 168, 201, 146, 110, 166, 200, 75, 86, 71, 1, 233,
+    33, 12, 168, 16, 62, 197, 142, 70, 120, 36, 22, 73, 185, 69, 17, 244,
+    29, 48, 45, 2, 212, 15, 60, 194, 239, 13, 69, 231, 65, 28, 30, 51,
+    246, 190, 240, 131, 114, 111, 100, 94, 136, 151, 31, 217, 79, 215, 123, 191,
+    160, 14, 111, 227, 192, 106, 179, 172, 140, 200, 89, 197, 192, 130, 188, 56,
+    251, 1, 250, 144, 205, 159, 70, 148, 110, 15, 130, 20, 191, 179, 35, 217,
+    243, 51, 66, 20, 239, 118, 1, 46, 99, 149, 246, 228, 200, 244, 247, 138,
+    124, 16, 118, 203, 163, 17, 245, 3, 137, 69, 235, 82, 93, 155, 217, 72,
+    16, 3, 19, 173, 74, 188, 202, 161, 178, 17, 155, 60, 220, 200, 101, 118,
+    7, 223, 13, 152, 150, 177, 172, 226, 133, 164, 33, 118, 209, 100, 141, 220,
+    253, 18, 177, 56, 93, 190, 200, 233, 125, 169, 164, 222, 36, 92, 116, 132,
+    246, 50, 196, 63, 83, 44, 176, 247, 51, 19, 92, 207, 34, 103, 88, 156,
+    6, 246, 220, 17, 29, 229, 70, 171, 178, 247, 69, 221, 250, 201, 3, 38,
+    99, 20, 229, 48, 66, 82, 143, 202, 124, 128, 117, 87, 175, 8, 158, 205,
+    193, 97, 160, 148, 120, 129, 62, 13, 173, 21, 8, 199, 61, 139, 31, 191,
+    242, 26, 147, 157, 100, 34, 235, 103, 84, 198, 146, 79, 227, 89, 121, 112,
+    226, 22, 34, 195, 188, 253, 178, 32, 136, 108, 58, 219, 214, 207, 51, 1,
+    39, 80, 119, 6, 97, 17, 68, 91, 44, 23, 207, 52, 195, 36, 34, 85,
+    4, 164, 99, 30, 22, 77, 143, 57, 220, 81, 141, 150, 172, 142, 2, 207,
+    66, 24, 77, 32, 124, 151, 1, 140, 126, 210, 202, 88, 164, 160, 87, 95,
+    175, 199, 104, 223, 46, 198, 63, 228, 140, 25, 160, 215, 3, 78, 145, 249,
+    240, 72, 44, 146, 111, 138, 34, 245, 58, 96, 90, 4, 181, 30, 120, 153,
+    195, 26, 138, 211, 130, 56, 60, 102, 138, 62, 133, 212, 221, 103, 250, 147,
+    73, 246, 191, 77, 55, 86, 69, 178, 13, 27, 103, 36, 253, 225, 172, 19,
+    241, 97, 253, 27, 228, 222, 200, 188, 13, 51, 62, 175, 158, 179, 246, 99,
+    93, 28, 222, 219, 157, 212, 123, 69, 139, 23, 84, 93, 86, 51, 16, 218,
+    126, 165, 219, 230, 28, 251, 203, 72, 147, 29, 51, 44, 226, 13, 235, 48,
+    5, 141, 178, 151, 157, 25, 101, 112, 235, 2, 233, 61, 135, 35, 140, 53,
+    220, 30, 25, 40, 99, 123, 70, 175, 127, 251, 27, 209, 47, 244, 189, 22,
+    152, 148, 12, 116, 5, 107, 177, 30, 18, 31, 244, 223, 28, 162, 214, 218,
+    251, 102, 132, 40, 195, 236, 2, 92, 198, 55, 241, 213, 141, 245, 243, 9,
+    248, 32, 236, 139, 91, 34, 247, 6, 129, 16, 45, 110, 113, 1, 218, 58,
+    181, 161, 20, 156, 15, 189, 206, 34, 54, 33, 1, 124, 36, 251, 103, 115,
+    15, 138, 203, 164, 186, 43, 175, 144, 32, 6, 38, 71, 148, 101, 137, 95,
+    121, 34, 43, 120, 165, 141, 202, 236, 117, 252, 98, 226, 8, 198, 119, 246,
+    83, 144, 195, 14, 22, 45, 180, 116, 183, 35, 198, 143, 218, 84, 90, 153,
+    14, 163, 26, 45, 49, 127, 69, 217, 23, 85, 66, 236, 191, 200, 7, 165,
+    231, 36, 127, 112, 186, 97, 141, 207, 116, 213, 179, 107, 131, 146, 157, 191,
+    100, 195, 167, 165, 61, 128, 58, 142, 41, 37, 146, 135, 197, 184, 29, 186,
+    250, 79, 85, 161, 72, 184, 232, 21, 241, 100, 149, 126, 166, 88, 125, 243,
+    102, 38, 184, 131, 68, 206, 176, 37, 128, 57, 252, 231, 250, 85, 48, 115,
+    130, 242, 112, 55, 36, 16, 64, 216, 168, 39, 85, 116, 59, 23, 32, 80,
+    12, 241, 165, 34, 58, 215, 140, 75, 121, 243, 138, 167, 233, 143, 6, 76,
+    198, 40, 215, 96, 132, 164, 3, 137, 118, 135, 12, 100, 136, 58, 84, 45,
+    10, 101, 111, 238, 107, 199, 59, 103, 8, 41, 58, 151, 251, 125, 147, 252,
+    248, 29, 234, 174, 67, 16, 33, 135, 159, 194, 93, 53, 240, 31, 124, 26,
+    71, 42, 16, 147, 122, 11, 62, 99, 130, 107, 67, 232, 241, 253, 249, 225,
+    236, 84, 184, 124, 114, 87, 65, 49, 137, 43, 253, 100, 5, 210, 174, 22,
+    249, 52, 59, 39, 200, 68, 203, 206, 168, 145, 57, 158, 219, 178, 242, 224,
+    217, 44, 68, 155, 101, 231, 121, 64, 131, 66, 146, 97, 122, 169, 19, 168,
+    219, 7, 220, 215, 89, 250, 207, 203, 23, 45, 169, 108, 26, 62, 233, 53,
+    13, 216, 116, 171, 177, 131, 102, 2, 78, 160, 238, 12, 194, 34, 136, 182,
+    88, 46, 131, 104, 155, 72, 68, 170, 119, 174, 221, 237, 3, 110, 190, 100,
+    61, 54, 11, 69, 64, 106, 181, 157, 150, 47, 110, 159, 228, 145, 212, 223,
+    8, 85, 198, 60, 44, 154, 3, 114, 165, 162, 7, 49, 69, 1, 4, 131,
+    132, 48, 154, 64, 248, 51, 2, 5, 114, 35, 111, 122, 158, 119, 219, 20,
+    214, 52, 226, 120, 199, 73, 57, 168, 74, 49, 119, 183, 135, 234, 146, 112,
+    252, 185, 137, 176, 85, 93, 174, 190, 67, 147, 208, 163, 92, 145, 126, 213,
+    5, 50, 93, 179, 6, 156, 63, 239, 134, 207, 32, 246, 231, 176, 118, 216,
+    48, 5, 53, 234, 222, 217, 67, 254, 203, 51, 176, 68, 121, 69, 175, 154,
+    253, 144, 88, 57, 222, 9, 68, 247, 116, 192, 180, 8, 119, 60, 240, 47,
+    155, 52, 9, 187, 25, 112, 120, 204, 135, 230, 241, 127, 108, 228, 156, 145,
+    7, 86, 81, 65, 245, 116, 205, 4, 85, 53, 228, 76, 102, 169, 232, 185,
+    9, 124, 23, 181, 167, 206, 233, 59, 146, 241, 99, 154, 110, 172, 138, 121,
+    26, 54, 206, 72, 231, 223, 69, 38, 115, 10, 190, 243, 21, 35, 49, 93,
+    225, 103, 134, 211, 236, 228, 183, 82, 212, 55, 35, 191, 152, 6, 213, 83,
+    255, 194, 231, 54, 213, 161, 141, 101, 26, 102, 124, 67, 33, 123, 241, 198,
+    186, 56, 161, 171, 39, 181, 246, 138, 133, 180, 78, 112, 103, 76, 85, 3,
+    105, 240, 153, 10, 163, 51, 204, 237, 116, 57, 76, 92, 88, 108, 102, 255,
+    11, 46, 168, 186, 172, 102, 32, 169, 252, 87, 171, 209, 56, 235, 139, 144,
+    59, 58, 102, 88, 217, 26, 203, 96, 113, 88, 1, 252, 30, 139, 248, 207,
+    143, 193, 78, 152, 186, 163, 182, 187, 245, 59, 139, 175, 166, 195, 91, 21,
+    10, 7, 121, 51, 39, 50, 202, 224, 203, 4, 207, 122, 19, 70, 5, 106,
+    165, 60, 50, 80, 198, 246, 140, 67, 112, 113, 208, 117, 149, 223, 18, 134,
+    184, 146, 42, 51, 145, 14, 56, 65, 107, 61, 223, 167, 185, 47, 28, 54,
+    254, 235, 54, 191, 94, 245, 103, 44, 45, 53, 24, 232, 10, 214, 127, 60,
+    36, 62, 245, 163, 56, 89, 177, 169, 132, 157, 159, 249, 236, 24, 191, 74,
+    94, 163, 253, 161, 136, 158, 66, 23, 234, 63, 24, 84, 71, 128, 33, 220,
+    235, 204, 21, 80, 155, 197, 4, 184, 145, 110, 255, 183, 7, 247, 251, 18,
+    237, 64, 197, 11, 182, 68, 243, 12, 145, 186, 188, 22, 41, 40, 220, 222,
+    226, 248, 26, 254, 133, 191, 198, 57, 35, 65, 40, 252, 201, 157, 99, 121,
+    31, 32, 90, 220, 226, 2, 169, 116, 119, 95, 40, 37, 30, 103, 129, 68,
+    108, 66, 2, 248, 72, 235, 206, 230, 101, 86, 243, 154, 80, 239, 113, 18,
+    4, 201, 205, 108, 156, 47, 188, 111, 162, 67, 239, 15, 55, 50, 94, 147,
+    30, 9, 139, 85, 105, 86, 67, 61, 64, 12, 76, 142, 53, 202, 15, 190,
+    242, 68, 86, 240, 87, 7, 137, 197, 100, 127, 34, 19, 219, 187, 155, 91,
+    51, 154, 169, 199, 183, 130, 50, 149, 60, 69, 187, 7, 40, 222, 25, 176,
+    234, 229, 196, 217, 16, 145, 238, 241, 166, 61, 155, 28, 44, 90, 117, 232,
+    115, 70, 145, 3, 169, 168, 180, 47, 144, 147, 109, 159, 162, 124, 54, 151,
+    213, 171, 126, 85, 174, 18, 72, 195, 189, 71, 124, 244, 214, 113, 36, 90,
+    28, 91, 52, 90, 98, 254, 138, 175, 46, 170, 132, 197, 99, 141, 14, 87,
+    211, 72, 254, 224, 105, 194, 7, 131, 102, 45, 157, 28, 208, 19, 82, 201,
+    93, 60, 97, 140, 225, 197, 51, 124, 29, 73, 19, 23, 22, 27, 151, 246,
+    232, 183, 123, 214, 27, 57, 39, 99, 200, 155, 83, 87, 122, 29, 116, 1,
+    82, 74, 57, 19, 151, 109, 58, 105, 146, 193, 210, 144, 169, 212, 255, 5,
+    187, 13, 182, 30, 248, 85, 73, 42, 156, 75, 212, 228, 232, 180, 170, 28,
+    233, 158, 170, 95, 144, 109, 205, 42, 255, 200, 55, 252, 81, 176, 250, 251,
+    204, 76, 109, 27, 136, 129, 125, 74, 147, 232, 3, 25, 34, 128, 21, 76,
+    140, 94, 210, 181, 211, 248, 199, 208, 2, 77, 128, 236, 247, 88, 237, 63,
+    29, 114, 229, 211, 233, 170, 96, 230, 25, 249, 224, 110, 72, 32, 128, 173,
+    77, 78, 170, 232, 118, 46, 64, 160, 103, 4, 76, 149, 91, 71, 184, 128,
+    106, 111, 5, 39, 202, 104, 189, 134, 131, 79, 71, 31, 9, 247, 208, 213,
+    24, 255, 87, 68, 116, 179, 5, 150, 242, 251, 9, 83, 207, 3, 12, 152,
+    145, 80, 179, 192, 21, 85, 6, 15, 98, 137, 254, 2, 198, 94, 221, 240,
+    129, 109, 236, 26, 77, 75, 49, 179, 95, 81, 94, 55, 106, 140, 150, 122,
+    236, 19, 24, 200, 13, 116, 168, 90, 20, 202, 222, 193, 214, 147, 118, 206,
+    16, 82, 116, 51, 235, 250, 59, 229, 150, 101, 177, 142, 191, 153, 112, 60,
+    103, 92, 59, 136, 84, 219, 75, 229, 222, 83, 153, 196, 148, 35, 171, 144,
+    237, 58, 201, 65, 134, 32, 66, 19, 35, 153, 186, 106, 253, 62, 248, 52,
+    142, 84, 32, 59, 244, 22, 124, 198, 151, 76, 96, 7, 52, 205, 154, 117,
+    80, 15, 95, 35, 127, 118, 197, 31, 64, 85, 205, 204, 139, 207, 236, 179,
+    25, 214, 134, 205, 255, 231, 239, 223, 197, 168, 109, 248, 228, 174, 130, 98,
+    15, 86, 231, 200, 10, 185, 65, 44, 99, 160, 47, 139, 77, 10, 55, 185,
+    182, 62, 136, 177, 102, 230, 191, 73, 193, 87, 10, 63, 117, 96, 209, 89,
+    239, 104, 118, 78, 141, 136, 139, 129, 77, 63, 114, 33, 171, 121, 249, 221,
+    175, 88, 136, 43, 202, 211, 242, 128, 149, 30, 223, 8, 63, 101, 83, 231,
+    62, 169, 151, 104, 41, 49, 196, 246, 97, 89, 101, 220, 181, 10, 98, 245,
+    27, 132, 57, 194, 244, 79, 38, 77, 171, 14, 165, 179, 178, 233, 131, 139,
+    46, 90, 79, 216, 52, 124, 207, 106, 97, 242, 144, 132, 70, 162, 254, 43,
+    216, 152, 64, 250, 48, 161, 190, 160, 224, 91, 162, 47, 75, 165, 95, 31,
+    26, 173, 232, 75, 127, 27, 204, 4, 156, 93, 193, 24, 153, 68, 13, 113,
+    176, 92, 27, 208, 43, 144, 136, 73, 96, 219, 65, 13, 205, 246, 20, 98,
+    239, 203, 36, 81, 27, 12, 48, 90, 126, 93, 246, 39, 84, 73, 24, 60,
+    238, 65, 167, 199, 6, 220, 97, 200, 122, 108, 22, 138, 128, 212, 119, 39,
+    49, 94, 220, 35, 213, 63, 181, 163, 148, 55, 14, 129, 180, 49, 185, 174,
+    9, 250, 243, 195, 2, 156, 74, 12, 255, 95, 49, 212, 170, 230, 37, 214,
+    16, 170, 145, 120, 88, 41, 6, 228, 87, 89, 14, 98, 138, 2, 8, 27,
+    21, 96, 41, 128, 237, 102, 4, 10, 106, 220, 56, 62, 234, 196, 222, 130,
+    36, 207, 235, 43, 8, 74, 53, 48, 219, 97, 196, 119, 146, 191, 148, 127,
+    228, 70, 222, 244, 33, 238, 171, 40, 177, 104, 217, 240, 147, 146, 114, 77,
+    148, 98, 238, 115, 19, 201, 57, 224, 158, 48, 119, 178, 147, 3, 115, 78,
+    194, 254, 60, 185, 17, 218, 79, 102, 90, 99, 3, 132, 108, 16, 169, 149,
+    229, 111, 15, 125, 170, 186, 65, 97, 134, 59, 189, 91, 184, 63, 252, 183,
+    10, 100, 186, 123, 12, 37, 126, 195, 159, 25, 166, 59, 24, 87, 153, 7,
+    245, 173, 88, 18, 58, 119, 193, 156, 196, 101, 87, 140, 115, 252, 238, 182,
+    17, 131, 64, 241, 211, 125, 236, 173, 96, 10, 106, 201, 161, 175, 134, 225,
+    139, 102, 125, 136, 242, 138, 67, 41, 107, 245, 233, 183, 97, 144, 52, 203,
+    19, 156, 143, 128, 35, 231, 187, 202, 69, 103, 144, 127, 141, 83, 211, 92,
+    231, 61, 176, 114, 161, 18, 136, 243, 232, 157, 117, 16, 238, 120, 253, 94,
+    43, 104, 18, 107, 50, 224, 240, 133, 157, 75, 25, 52, 19, 255, 80, 149,
+    155, 11, 144, 89, 108, 48, 192, 117, 229, 105, 255, 156, 77, 57, 96, 240,
+    19, 209, 255, 254, 216, 213, 37, 63, 14, 172, 162, 130, 247, 232, 135, 8,
+    170, 106, 213, 152, 204, 79, 205, 111, 105, 167, 86, 184, 106, 56, 253, 89,
+    125, 58, 71, 203, 117, 160, 186, 35, 100, 107, 56, 111, 179, 150, 93, 26,
+    18, 248, 46, 119, 83, 129, 207, 118, 57, 255, 198, 41, 220, 69, 9, 242,
+    52, 108, 129, 144, 211, 163, 138, 76, 104, 142, 135, 49, 225, 108, 23, 16,
+    74, 105, 35, 96, 94, 13, 52, 217, 250, 109, 108, 103, 172, 122, 26, 57,
+    230, 20, 97, 251, 42, 70, 98, 186, 223, 206, 17, 187, 197, 213, 115, 164,
+    181, 110, 70, 99, 45, 12, 183, 166, 156, 98, 200, 189, 152, 171, 186, 220,
+    172, 88, 244, 242, 71, 157, 78, 143, 123, 111, 171, 148, 82, 213, 39, 211,
+    227, 153, 211, 108, 183, 95, 7, 202, 52, 204, 248, 134, 66, 246, 255, 145,
+    105, 112, 95, 75, 78, 119, 241, 9, 153, 239, 122, 42, 5, 178, 223, 172,
+    71, 90, 29, 207, 192, 190, 194, 186, 167, 113, 178, 188, 49, 174, 97, 124,
+    23, 117, 156, 224, 206, 152, 170, 6, 210, 253, 47, 20, 91, 102, 133, 199,
+    232, 114, 152, 184, 176, 216, 204, 227, 109, 3, 53, 166, 124, 117, 114, 96,
+    161, 107, 202, 93, 217, 46, 184, 236, 38, 115, 117, 79, 207, 1, 92, 150,
+    22, 92, 77, 105, 69, 204, 64, 79, 229, 174, 75, 191, 112, 203, 11, 61,
+    118, 116, 204, 176, 175, 52, 139, 192, 108, 42, 228, 47, 247, 33, 152, 41,
+    150, 56, 174, 246, 242, 131, 54, 22, 184, 117, 33, 71, 208, 237, 27, 181,
+    226, 176, 2, 229, 60, 11, 237, 131, 3, 159, 156, 45, 105, 91, 113, 107,
+    247, 118, 11, 67, 81, 155, 182, 42, 152, 198, 171, 163, 142, 230, 53, 229,
+    112, 9, 121, 100, 235, 19, 76, 64, 57, 119, 230, 180, 46, 66, 38, 95,
+    20, 14, 242, 102, 78, 100, 137, 221, 139, 8, 131, 244, 38, 140, 10, 212,
+    87, 120, 100, 160, 145, 241, 5, 134, 110, 120, 91, 32, 252, 137, 81, 187,
+    248, 158, 102, 189, 164, 196, 55, 255, 153, 121, 137, 87, 238, 40, 149, 243,
+    224, 226, 189, 234, 55, 163, 36, 17, 109, 57, 84, 102, 63, 28, 112, 130,
+    214, 122, 163, 83, 111, 94, 56, 108, 154, 148, 20, 172, 133, 78, 252, 119,
+    30, 175, 177, 47, 189, 84, 77, 169, 24, 123, 78, 164, 16, 135, 168, 25,
+    225, 203, 108, 99, 188, 247, 206, 88, 90, 106, 48, 205, 20, 177, 254, 120,
+    72, 124, 247, 91, 112, 178, 127, 79, 155, 189, 197, 37, 14, 26, 22, 62,
+    41, 252, 213, 132, 150, 249, 195, 83, 134, 125, 26, 172, 15, 107, 239, 58,
+    21, 39, 35, 239, 197, 48, 99, 148, 188, 91, 231, 95, 13, 33, 132, 46,
+    201, 126, 48, 168, 142, 29, 66, 165, 111, 81, 138, 169, 119, 221, 187, 242,
+    207, 205, 2, 22, 143, 105, 185, 5, 7, 127, 221, 95, 241, 196, 210, 208,
+    203, 133, 42, 160, 43, 151, 8, 109, 63, 220, 227, 115, 14, 243, 235, 36,
+    199, 128, 151, 22, 113, 136, 251, 24, 177, 243, 131, 230, 153, 122, 208, 11,
+    76, 74, 6, 58, 140, 187, 214, 15, 9, 129, 122, 225, 14, 81, 107, 109,
+    63, 105, 101, 44, 82, 80, 165, 161, 217, 237, 52, 225, 23, 99, 145, 114,
+    70, 130, 80, 229, 143, 39, 198, 242, 69, 31, 204, 106, 224, 189, 125, 199,
+    170, 123, 209, 168, 149, 43, 172, 89, 136, 131, 189, 18, 240, 254, 86, 135,
+    62, 64, 180, 165, 217, 4, 79, 232, 238, 190, 80, 74, 60, 206, 31, 136,
+    216, 132, 4, 237, 144, 203, 129, 209, 68, 54, 29, 227, 107, 233, 151, 142,
+    157, 40, 181, 3, 190, 134, 34, 163, 22, 133, 233, 26, 239, 18, 17, 164,
+    202, 172, 251, 41, 160, 195, 226, 36, 8, 143, 135, 216, 37, 94, 101, 222,
+    89, 134, 195, 30, 110, 100, 188, 59, 176, 218, 82, 111, 18, 46, 58, 66,
+    123, 25, 98, 145, 167, 22, 88, 245, 151, 135, 46, 233, 17, 189, 44, 78,
+    60, 18, 11, 170, 210, 172, 134, 122, 128, 24, 152, 1, 106, 137, 30, 97,
+    249, 136, 172, 253, 174, 14, 15, 151, 70, 100, 162, 236, 96, 65, 94, 28,
+    243, 142, 125, 72, 232, 193, 35, 74, 55, 137, 65, 10, 209, 215, 159, 226,
+    200, 254, 68, 38, 171, 107, 43, 182, 102, 41, 79, 147, 115, 25, 100, 55,
+    120, 138, 107, 14, 80, 161, 50, 125, 178, 136, 237, 96, 25, 134, 243, 208,
+    21, 191, 170, 218, 241, 81, 89, 28, 182, 139, 134, 249, 47, 120, 162, 8,
+    201, 215, 149, 175, 32, 63, 193, 255, 81, 122, 43, 56, 88, 180, 234, 205,
+    230, 140, 63, 6, 79, 77, 117, 94, 179, 161, 60, 233, 146, 210, 25, 153,
+    34, 236, 206, 113, 218, 252, 215, 230, 40, 141, 210, 241, 48, 148, 229, 43,
+    61, 59, 218, 35, 89, 248, 108, 51, 183, 75, 252, 170, 65, 36, 144, 155,
+    103, 142, 248, 245, 177, 226, 72, 180, 71, 77, 115, 101, 235, 21, 180, 85,
+    196, 221, 25, 227, 195, 108, 173, 176, 169, 143, 21, 2, 206, 59, 216, 193,
+    56, 182, 104, 180, 196, 225, 9, 67, 92, 73, 21, 151, 198, 7, 28, 174,
+    187, 144, 225, 221, 210, 153, 14, 27, 66, 192, 193, 242, 118, 12, 209, 37,
+    47, 223, 240, 222, 68, 79, 33, 133, 117, 145, 12, 42, 173, 64, 158, 110,
+    204, 90, 39, 56, 189, 38, 164, 143, 186, 120, 194, 5, 223, 151, 102, 248,
+    58, 146, 38, 46, 44, 54, 51, 241, 182, 44, 142, 126, 15, 203, 124, 233,
+    201, 238, 39, 76, 93, 223, 91, 211, 244, 147, 203, 217, 83, 239, 163, 132,
+    205, 115, 246, 177, 54, 114, 78, 198, 141, 43, 166, 174, 244, 58, 232, 2,
+    164, 148, 114, 38, 51, 218, 116, 210, 183, 5, 95, 247, 132, 159, 150, 160,
+    254, 189, 67, 231, 118, 114, 213, 41, 106, 149, 159, 209, 76, 3, 228, 167,
+    57, 159, 185, 61, 79, 181, 227, 10, 107, 26, 113, 60, 237, 170, 146, 84,
+    37, 150, 181, 213, 205, 117, 73, 56, 67, 233, 16, 123, 253, 88, 59, 108,
+    24, 140, 148, 117, 111, 226, 175, 127, 235, 151, 88, 34, 178, 172, 217, 77,
+    207, 33, 73, 190, 61, 218, 135, 84, 227, 141, 110, 229, 162, 125, 233, 235,
+    133, 152, 218, 54, 13, 31, 250, 148, 181, 87, 224, 248, 143, 55, 95, 50,
+    144, 27, 139, 172, 32, 53, 212, 192, 75, 153, 55, 193, 114, 198, 106, 225,
+    59, 205, 6, 50, 68, 29, 42, 152, 5, 188, 185, 119, 187, 237, 147, 189,
+    4, 154, 29, 197, 243, 176, 199, 126, 65, 187, 175, 116, 246, 240, 242, 254,
+    118, 42, 92, 62, 57, 165, 174, 150, 202, 155, 240, 50, 140, 105, 87, 11,
+    58, 228, 215, 187, 207, 73, 192, 209, 50, 239, 221, 220, 144, 64, 29, 71,
+    154, 156, 73, 205, 236, 92, 128, 93, 64, 146, 126, 253, 125, 164, 24, 183,
+    65, 121, 56, 149, 18, 8, 32, 108, 84, 157, 164, 58, 147, 133, 16, 40,
+    206, 8, 152, 55, 182, 142, 109, 29, 212, 222, 10, 78, 137, 208, 103, 17,
+    27, 158, 142, 62, 18, 243, 189, 183, 180, 126, 49, 113, 4, 99, 181, 123,
+    167, 72, 239, 7, 11, 152, 90, 58, 213, 159, 99, 201, 109, 42, 45, 194,
+    48, 227, 174, 136, 232, 123, 10, 49, 249, 235, 18, 166, 131, 6, 24, 45,
+    63, 160, 123, 157, 42, 170, 12, 30, 74, 149, 7, 206, 90, 150, 210, 87,
+    138, 125, 247, 239, 1, 78, 37, 6, 241, 161, 150, 106, 85, 115, 156, 107,
+    196, 15, 225, 4, 145, 188, 167, 253, 31, 218, 197, 52, 154, 150, 98, 123,
+    190, 162, 188, 110, 212, 5, 49, 244, 190, 121, 72, 66, 35, 81, 127, 155,
+    108, 76, 32, 125, 24, 222, 95, 80, 112, 163, 81, 153, 171, 220, 161, 129,
+    197, 38, 48, 141, 26, 232, 77, 180, 40, 137, 161, 159, 177, 59, 236, 129,
+    32, 164, 232, 102, 203, 233, 118, 215, 191, 80, 153, 203, 168, 5, 149, 210,
+    91, 31, 68, 214, 51, 115, 209, 170, 238, 165, 5, 145, 180, 48, 230, 162,
+    49, 202, 127, 1, 99, 47, 224, 120, 206, 184, 118, 13, 168, 171, 150, 215,
+    161, 166, 47, 149, 53, 70, 75, 61, 75, 188, 214, 71, 209, 194, 56, 30,
+    189, 46, 147, 68, 42, 227, 171, 252, 111, 167, 194, 98, 74, 159, 219, 72,
+    199, 116, 143, 130, 17, 64, 132, 38, 70, 47, 105, 212, 231, 124, 237, 104,
+    1, 168, 64, 118, 245, 44, 248, 145, 189, 2, 38, 196, 163, 173, 92, 64,
+    53, 185, 140, 157, 101, 52, 208, 67, 207, 169, 173, 129, 138, 245, 104, 228,
+    51, 152, 192, 14, 104, 135, 41, 234, 160, 30, 190, 70, 254, 236, 151, 62,
+    128, 170, 135, 133, 11, 131, 197, 123, 73, 238, 105, 72, 218, 106, 241, 140,
+    211, 136, 91, 15, 124, 164, 170, 21, 78, 171, 106, 114, 116, 90, 85, 14,
+    50, 177, 17, 135, 227, 211, 195, 163, 151, 77, 218, 237, 213, 65, 25, 196,
+    30, 172, 211, 141, 20, 111, 130, 88, 72, 199, 184, 193, 81, 62, 27, 197,
+    228, 219, 63, 164, 87, 9, 36, 239, 208, 173, 62, 122, 107, 182, 18, 45,
+    198, 93, 94, 11, 154, 20, 110, 111, 113, 124, 13, 127, 204, 209, 99, 146,
+    159, 174, 20, 126, 234, 192, 191, 178, 188, 43, 247, 77, 40, 249, 182, 9,
+    2, 234, 232, 54, 78, 153, 94, 185, 81, 175, 249, 137, 149, 25, 47, 199,
+    195, 208, 236, 156, 7, 13, 11, 31, 154, 126, 228, 66, 75, 242, 239, 167,
+    67, 176, 13, 86, 137, 187, 249, 29, 185, 166, 69, 218, 181, 224, 211, 121,
+    233, 232, 1, 11, 201, 186, 210, 140, 141, 177, 224, 161, 246, 98, 105, 104,
+    55, 60, 163, 16, 126, 202, 166, 211, 124, 79, 51, 208, 82, 98, 149, 241,
+    194, 178, 202, 165, 119, 20, 196, 247, 77, 74, 10, 86, 204, 39, 126, 181,
+    15, 217, 214, 153, 208, 42, 168, 218, 12, 179, 39, 82, 8, 205, 84, 130,
+    54, 21, 114, 153, 245, 158, 76, 154, 75, 28, 87, 123, 121, 207, 27, 11,
+    92, 180, 158, 173, 104, 248, 131, 212, 76, 99, 219, 223, 71, 115, 148, 252,
+    56, 138, 178, 50, 251, 135, 38, 32, 146, 181, 115, 90, 23, 33, 19, 161,
+    194, 249, 61, 21, 140, 89, 225, 86, 173, 45, 128, 233, 96, 95, 97, 93,
+    221, 182, 89, 94, 150, 87, 190, 62, 184, 143, 148, 83, 62, 180, 57, 48,
+    222, 187, 101, 160, 226, 23, 92, 118, 19, 183, 180, 169, 233, 142, 46, 75,
+    52, 71, 205, 150, 254, 54, 133, 8, 37, 186, 159, 48, 47, 136, 26, 226,
+    125, 184, 54, 189, 86, 61, 13, 146, 78, 49, 100, 208, 76, 219, 93, 110,
+    86, 44, 122, 121, 173, 192, 39, 201, 179, 185, 219, 74, 41, 228, 157, 231,
+    192, 171, 130, 26, 135, 241, 40, 196, 195, 139, 72, 162, 54, 24, 96, 180,
+    252, 186, 241, 78, 168, 146, 48, 120, 186, 221, 43, 92, 53, 28, 240, 162,
+    176, 29, 173, 235, 180, 80, 93, 159, 50, 187, 28, 185, 215, 75, 160, 13,
+    193, 130, 83, 147, 12, 165, 194, 141, 244, 216, 44, 9, 29, 181, 238, 78,
+    98, 188, 165, 70, 183, 126, 119, 91, 187, 244, 250, 213, 190, 72, 26, 235,
+    135, 78, 201, 64, 159, 253, 211, 101, 172, 189, 72, 177, 200, 167, 231, 46,
+    53, 110, 28, 31, 117, 98, 111, 65, 18, 233, 251, 155, 4, 37, 148, 24,
+    227, 190, 98, 181, 73, 209, 74, 177, 79, 24, 181, 89, 199, 143, 183, 39,
+    97, 127, 30, 210, 134, 109, 169, 51, 45, 191, 143, 66, 54, 8, 218, 196,
+    32, 73, 63, 240, 176, 82, 12, 213, 174, 178, 28, 196, 9, 4, 16, 54,
+    42, 192, 82, 29, 199, 204, 8, 20, 90, 63, 150, 182, 2, 191, 212, 179,
+    221, 36, 249, 141, 139, 76, 45, 29, 228, 193, 191, 234, 184, 21, 152, 97,
+    212, 165, 112, 124, 201, 149, 161, 25, 72, 131, 203, 86, 16, 148, 106, 96,
+    171, 194, 149, 238, 57, 99, 53, 254, 174, 211, 217, 58, 123, 120, 121, 127,
+    59, 21, 46, 31, 146, 220, 87, 75, 101, 195, 120, 25, 70, 186, 165, 139,
+    213, 140, 161, 245, 66, 193, 75, 80, 127, 208, 175, 253, 59, 57, 228, 154,
+    53, 196, 193, 230, 38, 143, 114, 221, 175, 250, 8, 179, 240, 44, 147, 54,
+    12, 70, 74, 180, 185, 113, 217, 177, 251, 197, 44, 17, 89, 86, 226, 168,
+    33, 96, 238, 121, 59, 6, 230, 156, 153, 225, 120, 111, 34, 169, 158, 204,
+    180, 198, 6, 21, 216, 32, 79, 55, 91, 22, 71, 63, 137, 235, 62, 250,
+    234, 119, 157, 38, 160, 225, 163, 231, 122, 199, 235, 226, 167, 249, 223, 66,
+    215, 222, 30, 250, 73, 105, 130, 194, 17, 118, 103, 182, 109, 126, 229, 115,
+    20, 200, 105, 246, 24, 74, 252, 155, 173, 168, 183, 188, 251, 132, 90, 164,
+    98, 224, 130, 255, 239, 54, 216, 88, 218, 201, 132, 1, 103, 147, 108, 238,
+    35, 50, 81, 118, 48, 174, 47, 14, 247, 71, 176, 36, 116, 238, 159, 37,
+    149, 202, 174, 5, 230, 229, 193, 113, 89, 68, 248, 48, 130, 67, 247, 104,
+    132, 209, 85, 109, 246, 166, 162, 14, 91, 203, 67, 242, 153, 60, 81, 4,
+    34, 27, 128, 255, 187, 250, 197, 71, 192, 20, 212, 143, 95, 67, 17, 223,
+    11, 204, 250, 13, 249, 9, 134, 82, 88, 109, 41, 185, 9, 23, 29, 33,
+    179, 130, 49, 198, 221, 11, 44, 244, 197, 205, 23, 250, 134, 208, 22, 39,
+    214, 247, 207, 115, 194, 61, 104, 139, 38, 37, 3, 29, 70, 211, 107, 137,
+    138, 206, 61, 254, 7, 166, 187, 184, 172, 129, 102, 53, 112, 208, 176, 237,
+    85, 179, 230, 84, 196, 155, 86, 162, 68, 207, 208, 9, 120, 127, 43, 205,
+    211, 122, 125, 228, 95, 36, 13, 251, 205, 39, 234, 32, 193, 240, 231, 188,
+    86, 208, 36, 214, 100, 221, 253, 23, 169, 12, 212, 162, 237, 201, 213, 157,
+    190, 177, 15, 105, 67, 184, 218, 151, 152, 209, 201, 33, 27, 4, 109, 98,
+    39, 150, 50, 104, 38, 227, 160, 55, 43, 22, 61, 178, 216, 96, 157, 234,
+    215, 210, 227, 37, 154, 114, 192, 253, 93, 224, 155, 46, 148, 14, 120, 81,
+    88, 128, 216, 251, 90, 40, 160, 193, 25, 211, 14, 210, 229, 171, 80, 136,
+    38, 191, 227, 225, 173, 183, 74, 126, 28, 69, 89, 25, 243, 205, 19, 16,
+    73, 212, 183, 45, 133, 158, 135, 222, 92, 201, 74, 167, 31, 90, 146, 24,
+    111, 211, 188, 80, 113, 133, 46, 59, 135, 213, 90, 218, 250, 71, 23, 171,
+    210, 83, 172, 109, 212, 112, 231, 178, 250, 116, 142, 139, 234, 93, 105, 70,
+    200, 214, 112, 222, 123, 49, 186, 52, 168, 37, 5, 43, 102, 157, 63, 212,
+    137, 226, 107, 194, 104, 21, 84, 109, 6, 215, 157, 41, 4, 232, 42, 65,
+    36, 237, 92, 238, 166, 31, 131, 236, 114, 227, 145, 82, 165, 138, 18, 249,
+    104, 216, 31, 61, 187, 91, 9, 152, 94, 155, 245, 168, 20, 242, 91, 138,
+    1, 117, 116, 27, 39, 194, 47, 210, 166, 217, 242, 202, 196, 130, 153, 237,
+    208, 1, 19, 98, 223, 216, 46, 32, 148, 210, 70, 192, 188, 26, 104, 175,
+    233, 218, 216, 206, 69, 244, 52, 114, 170, 119, 186, 36, 109, 53, 246, 70,
+    231, 68, 163, 137, 62, 82, 85, 132, 39, 219, 53, 57, 58, 45, 164, 7,
+    209, 40, 194, 235, 84, 140, 196, 105, 163, 129, 34, 107, 151, 183, 230, 85,
+    119, 220, 140, 198, 90, 24, 115, 81, 171, 94, 107, 173, 230, 97, 28, 15,
+    208, 23, 199, 34, 21, 255, 219, 126, 185, 221, 97, 49, 37, 193, 227, 36,
+    37, 196, 141, 103, 45, 75, 105, 165, 69, 176, 245, 249, 142, 39, 156, 3,
+    246, 222, 75, 53, 164, 183, 78, 187, 95, 178, 36, 33, 159, 166, 177, 195,
+    54, 38, 16, 176, 12, 111, 161, 40, 56, 223, 166, 194, 219, 110, 222, 206,
+    219, 47, 187, 216, 115, 190, 14, 137, 104, 133, 237, 17, 132, 241, 227, 63,
+    210, 224, 190, 150, 156, 238, 255, 18, 161, 89, 18, 158, 193, 83, 214, 239,
+    27, 19, 8, 88, 6, 185, 222, 20, 28, 225, 83, 97, 227, 55, 111, 103,
+    47, 195, 244, 84, 10, 121, 163, 69, 142, 180, 58, 131, 157, 97, 153, 105,
+    83, 226, 121, 101, 98, 65, 194, 248, 85, 181, 93, 18, 184, 148, 123, 35,
+    253, 34, 223, 202, 31, 41, 164, 66, 157, 227, 148, 146, 29, 152, 82, 141,
+    46, 234, 37, 221, 129, 45, 73, 12, 185, 231, 94, 40, 182, 204, 23, 147,
+    205, 228, 45, 109, 125, 173, 133, 219, 84, 156, 140, 155, 51, 192, 145, 106,
+    202, 113, 187, 97, 52, 132, 42, 184, 3, 229, 192, 154, 2, 116, 21, 174,
+    218, 6, 106, 81, 248, 234, 228, 192, 95, 214, 137, 186, 175, 92, 109, 197,
+    76, 230, 234, 158, 131, 2, 184, 49, 160, 112, 195, 23, 74, 7, 60, 166,
+    44, 64, 108, 243, 45, 20, 80, 238, 130, 231, 7, 105, 252, 219, 40, 68,
+    44, 184, 154, 210, 138, 133, 128, 158, 215, 65, 150, 99, 224, 139, 22, 122,
+    236, 232, 133, 125, 67, 104, 11, 157, 86, 206, 51, 148, 56, 104, 88, 248,
+    164, 215, 115, 42, 98, 195, 43, 81, 34, 233, 104, 138, 60, 177, 155, 232,
+    216, 84, 213, 94, 243, 66, 45, 82, 49, 112, 65, 241, 249, 27, 108, 44,
+    109, 234, 66, 142, 189, 199, 54, 119, 162, 34, 124, 24, 65, 175, 245, 52,
+    66, 230, 164, 184, 123, 83, 81, 7, 163, 235, 175, 121, 194, 30, 166, 2,
+    217, 125, 4, 215, 120, 22, 199, 27, 6, 35, 37, 90, 210, 182, 226, 214,
+    243, 236, 22, 134, 162, 43, 113, 84, 163, 11, 173, 145, 202, 251, 31, 125,
+    117, 181, 192, 19, 80, 254, 223, 253, 61, 237, 251, 113, 221, 242, 225, 33,
+    45, 145, 75, 91, 1, 209, 106, 215, 224, 18, 242, 200, 203, 38, 152, 128,
+    114, 238, 209, 117, 92, 132, 76, 190, 87, 231, 226, 29, 179, 60, 178, 177,
+    147, 132, 23, 129, 73, 110, 165, 171, 188, 239, 60, 130, 35, 93, 220, 203,
+    40, 28, 249, 204, 156, 200, 15, 167, 11, 16, 27, 245, 76, 5, 20, 181,
+    174, 240, 200, 93, 63, 255, 10, 17, 82, 106, 80, 138, 46, 37, 215, 193,
+    120, 134, 254, 188, 206, 77, 41, 158, 96, 241, 37, 170, 64, 38, 154, 100,
+    220, 240, 182, 64, 229, 15, 162, 107, 237, 33, 204, 103, 85, 149, 110, 227,
+    47, 242, 15, 174, 193, 80, 55, 251, 166, 134, 31, 6, 87, 226, 122, 13,
+    158, 183, 41, 46, 215, 221, 83, 200, 225, 243, 226, 89, 190, 137, 167, 142,
+    221, 217, 103, 201, 110, 91, 72, 34, 218, 114, 168, 204, 126, 56, 224, 25,
+    177, 244, 91, 166, 222, 188, 112, 216, 167, 175, 206, 143, 220, 182, 144, 68,
+    169, 228, 77, 133, 252, 112, 221, 50, 127, 245, 182, 81, 161, 101, 224, 173,
+    41, 53, 40, 69, 23, 156, 229, 238, 60, 67, 127, 94, 103, 168, 154, 79,
+    48, 246, 156, 85, 32, 19, 77, 50, 83, 67, 129, 3, 165, 113, 61, 136,
+    79, 213, 154, 23, 229, 224, 167, 100, 254, 247, 113, 162, 95, 202, 221, 71,
+    223, 139, 216, 198, 101, 243, 129, 176, 180, 212, 96, 135, 40, 127, 225, 240,
+    144, 248, 243, 182, 224, 121, 254, 158, 165, 253, 113, 128, 215, 30, 89, 214,
+    199, 66, 133, 206, 170, 55, 220, 219, 94, 249, 30, 65, 159, 160, 110, 235,
+    43, 103, 151, 74, 28, 52, 44, 124, 82, 229, 183, 21, 49, 239, 155, 166,
+    17, 250, 52, 69, 30, 214, 195, 116, 81, 17, 62, 12, 174, 217, 244, 26,
+    33, 115, 82, 92, 179, 167, 166, 141, 223, 251, 217, 178, 97, 15, 83, 1,
+    42, 78, 70, 195, 151, 96, 198, 53, 101, 182, 211, 190, 26, 66, 21, 92,
+    143, 252, 96, 77, 1, 58, 132, 87, 80, 56, 239, 133, 37, 141, 30, 83,
+    22, 32, 54, 247, 152, 10, 40, 119, 65, 253, 141, 186, 126, 227, 20, 34,
+    222, 162, 9, 79, 238, 167, 107, 249, 131, 135, 4, 44, 3, 210, 111, 10,
+    14, 254, 167, 190, 255, 149, 185, 189, 164, 212, 160, 9, 92, 74, 179, 159,
+    240, 17, 225, 101, 129, 154, 82, 33, 192, 255, 74, 73, 128, 76, 41, 200,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 246, 51, 183, 4, 136, 98,
+    199, 152, 77, 56, 206, 24, 145, 40, 209, 117, 233, 42, 135, 68, 70, 144,
+    146, 77, 43, 94, 241, 102, 115, 8, 13, 196, 147, 45, 154, 112, 129, 48,
+    63, 80, 191, 234, 207, 84, 19, 136, 140, 61, 57, 154, 86, 188, 7, 85,
+    196, 12, 133, 166, 84, 181, 215, 72, 79, 40, 174, 120, 110, 159, 38, 126,
+    148, 204, 202, 173, 171, 215, 125, 226, 255, 204, 230, 16, 26, 149, 59, 90,
+    41, 224, 31, 96, 126, 160, 99, 201, 131, 168, 38, 13, 5, 122, 114, 41,
+    172, 101, 9, 255, 81, 20, 146, 247, 252, 194, 100, 216, 209, 120, 239, 136,
+    178, 188, 106, 130, 161, 73, 67, 234, 224, 100, 135, 59, 14, 170, 149, 24,
+    23, 81, 168, 119, 179, 144, 158, 80, 65, 240, 220, 35, 76, 252, 53, 133,
+    137, 71, 75, 179, 250, 217, 248, 153, 34, 28, 159, 51, 111, 239, 254, 168,
+    80, 72, 208, 216, 13, 86, 165, 214, 178, 193, 207, 215, 217, 254, 209, 135,
+    227, 133, 209, 32, 52, 55, 118, 180, 82, 221, 62, 192, 252, 93, 198, 143,
+    27, 77, 76, 26, 10, 244, 228, 82, 69, 202, 21, 182, 102, 36, 188, 85,
+    177, 44, 31, 229, 240, 216, 109, 117, 23, 250, 242, 103, 203, 94, 76, 100,
+    118, 31, 110, 148, 18, 227, 162, 40, 57, 243, 229, 153, 200, 173, 191, 240,
+    195, 13, 121, 101, 212, 25, 95, 146, 134, 201, 221, 200, 19, 118, 228, 208,
+    21, 44, 177, 145, 34, 1, 133, 149, 113, 232, 82, 37, 168, 16, 61, 51,
+    216, 214, 192, 89, 79, 133, 56, 40, 28, 73, 55, 48, 46, 162, 77, 238,
+    123, 61, 33, 160, 130, 253, 165, 70, 152, 229, 106, 23, 15, 142, 150, 123,
+    233, 175, 234, 122, 128, 52, 166, 192, 138, 118, 54, 5, 239, 184, 19, 213,
+    116, 51, 113, 207, 237, 83, 73, 30, 4, 54, 194, 241, 237, 47, 68, 56,
+    35, 102, 222, 195, 225, 77, 160, 144, 189, 173, 26, 172, 87, 177, 121, 159,
+    131, 179, 175, 225, 191, 19, 27, 28, 243, 60, 171, 4, 25, 91, 172, 117,
+    110, 136, 44, 133, 203, 217, 190, 155, 254, 219, 197, 35, 61, 172, 148, 77,
+    219, 23, 191, 64, 104, 110, 236, 117, 164, 167, 124, 157, 229, 186, 145, 3,
+    54, 154, 152, 52, 20, 245, 213, 164, 138, 137, 45, 36, 8, 68, 224, 12,
+    43, 237, 233, 159, 178, 133, 116, 146, 64, 118, 223, 176, 31, 112, 82, 101,
+    71, 233, 161, 215, 42, 113, 204, 72, 101, 170, 127, 88, 62, 215, 253, 173,
+    218, 234, 46, 233, 249, 206, 139, 188, 152, 200, 236, 62, 220, 53, 220, 66,
+    123, 76, 237, 200, 184, 192, 115, 239, 51, 181, 75, 194, 255, 156, 16, 228,
+    12, 248, 222, 88, 126, 115, 247, 107, 36, 219, 89, 80, 114, 251, 215, 47,
+    141, 71, 99, 253, 155, 26, 242, 202, 181, 50, 190, 57, 17, 143, 167, 141,
+    38, 236, 210, 232, 238, 84, 250, 153, 16, 183, 192, 127, 173, 229, 10, 50,
+    35, 191, 92, 24, 57, 125, 87, 31, 53, 192, 13, 178, 213, 189, 42, 88,
+    127, 63, 68, 2, 23, 55, 226, 205, 164, 74, 77, 32, 122, 102, 173, 177,
+    157, 178, 158, 23, 112, 80, 35, 142, 157, 92, 247, 93, 131, 154, 90, 15,
+    44, 213, 53, 98, 156, 85, 147, 76, 42, 245, 219, 34, 12, 90, 91, 14,
+    56, 146, 110, 96, 92, 89, 154, 193, 246, 122, 66, 93, 25, 231, 87, 140,
+    45, 215, 212, 46, 30, 1, 49, 246, 207, 67, 206, 161, 217, 100, 212, 59,
+    93, 89, 187, 66, 140, 69, 136, 207, 134, 249, 196, 253, 83, 106, 88, 145,
+    163, 187, 228, 29, 201, 244, 29, 104, 81, 157, 9, 236, 108, 10, 195, 109,
+    38, 183, 232, 102, 226, 131, 199, 166, 146, 60, 8, 108, 153, 255, 63, 199,
+    170, 108, 217, 255, 206, 116, 33, 50, 13, 117, 183, 159, 57, 19, 11, 169,
+    64, 226, 212, 172, 154, 33, 178, 161, 199, 94, 136, 112, 70, 204, 161, 155,
+    223, 154, 93, 61, 103, 71, 52, 69, 174, 127, 242, 35, 27, 123, 67, 223,
+    99, 38, 49, 109, 63, 116, 206, 174, 102, 3, 146, 162, 147, 37, 246, 111,
+    229, 48, 71, 85, 117, 103, 93, 235, 209, 146, 72, 120, 54, 56, 251, 120,
+    75, 8, 50, 182, 69, 234, 220, 13, 88, 23, 139, 175, 97, 43, 225, 171,
+    151, 70, 122, 69, 53, 154, 192, 11, 76, 124, 195, 106, 245, 46, 8, 210,
+    18, 21, 201, 63, 90, 218, 136, 1, 102, 239, 209, 214, 232, 8, 30, 196,
+    171, 46, 99, 128, 208, 220, 197, 234, 85, 83, 248, 39, 215, 105, 63, 6,
+    108, 41, 45, 104, 40, 247, 183, 85, 9, 15, 93, 29, 212, 132, 88, 190,
+    2, 114, 24, 107, 54, 63, 70, 65, 238, 115, 133, 3, 170, 44, 110, 103,
+    37, 24, 34, 81, 90, 72, 16, 136, 221, 24, 86, 199, 207, 35, 121, 23,
+    232, 57, 128, 236, 163, 125, 62, 224, 164, 202, 142, 207, 95, 179, 172, 123,
+    167, 140, 85, 122, 145, 95, 130, 27, 183, 15, 121, 17, 81, 153, 74, 87,
+    185, 164, 226, 90, 28, 130, 116, 237, 84, 226, 133, 144, 202, 73, 254, 176,
+    124, 179, 231, 71, 169, 201, 92, 207, 239, 129, 11, 101, 45, 141, 197, 124,
+    165, 106, 162, 209, 50, 148, 66, 43, 57, 40, 49, 139, 41, 95, 56, 225,
+    141, 186, 6, 171, 140, 33, 107, 29, 87, 49, 142, 52, 165, 132, 246, 152,
+    199, 141, 109, 157, 230, 195, 102, 119, 150, 153, 227, 37, 32, 213, 24, 237,
+    161, 176, 252, 230, 243, 214, 83, 183, 65, 156, 79, 239, 170, 5, 171, 251,
+    168, 111, 7, 177, 50, 80, 201, 255, 159, 169, 231, 32, 110, 171, 216, 136,
+    72, 171, 178, 160, 228, 235, 179, 94, 7, 142, 198, 231, 43, 52, 249, 137,
+    119, 100, 97, 114, 34, 3, 83, 7, 76, 197, 190, 152, 5, 164, 108, 137,
+    116, 198, 74, 182, 8, 255, 186, 28, 40, 252, 158, 78, 230, 54, 100, 147,
+    193, 74, 103, 155, 185, 205, 193, 168, 233, 47, 32, 115, 157, 254, 71, 215,
+    20, 100, 70, 99, 184, 48, 114, 250, 174, 62, 106, 157, 26, 121, 79, 254,
+    118, 172, 97, 77, 231, 235, 208, 198, 137, 207, 133, 76, 151, 22, 81, 26,
+    245, 190, 232, 174, 248, 208, 49, 39, 183, 103, 84, 176, 254, 126, 136, 4,
+    46, 110, 217, 135, 85, 148, 154, 64, 244, 204, 71, 127, 39, 121, 33, 46,
+    224, 160, 65, 84, 227, 180, 118, 28, 79, 156, 99, 86, 23, 159, 196, 188,
+    75, 53, 29, 230, 192, 59, 97, 233, 179, 99, 203, 254, 70, 1, 39, 184,
+    243, 186, 27, 41, 180, 30, 88, 183, 106, 196, 37, 170, 59, 152, 84, 247,
+    171, 68, 24, 180, 182, 28, 176, 50, 144, 188, 123, 216, 220, 177, 249, 38,
+    150, 175, 251, 236, 244, 223, 210, 178, 211, 179, 237, 212, 138, 249, 157, 66,
+    112, 57, 220, 192, 184, 178, 41, 159, 241, 244, 132, 186, 50, 211, 174, 5,
+    90, 179, 181, 92, 60, 2, 98, 241, 131, 134, 134, 10, 107, 196, 48, 208,
+    238, 7, 188, 204, 74, 162, 163, 251, 127, 112, 179, 153, 50, 24, 122, 146,
+    240, 188, 168, 216, 129, 95, 175, 200, 181, 118, 186, 178, 107, 132, 5, 138,
+    13, 131, 17, 239, 149, 231, 166, 212, 176, 63, 91, 107, 213, 58, 119, 108,
+    24, 204, 61, 20, 125, 42, 38, 188, 203, 146, 156, 171, 192, 154, 124, 205,
+    33, 144, 246, 175, 201, 38, 254, 100, 143, 245, 58, 208, 162, 39, 18, 197,
+    216, 20, 155, 218, 76, 115, 205, 204, 217, 27, 147, 81, 57, 120, 16, 216,
+    47, 227, 121, 198, 141, 212, 42, 69, 213, 93, 149, 44, 85, 194, 221, 91,
+    28, 185, 48, 49, 20, 21, 127, 232, 130, 149, 4, 189, 126, 147, 73, 216,
+    175, 227, 129, 232, 66, 100, 26, 234, 115, 35, 114, 38, 22, 79, 128, 217,
+    181, 69, 41, 66, 121, 95, 136, 160, 254, 220, 39, 129, 70, 112, 15, 92,
+    212, 242, 226, 11, 163, 83, 255, 101, 7, 157, 243, 213, 187, 15, 82, 1,
+    147, 188, 13, 224, 140, 133, 95, 43, 163, 41, 186, 122, 206, 142, 104, 138,
+    65, 254, 249, 70, 54, 246, 134, 163, 198, 76, 101, 143, 186, 228, 4, 231,
+    152, 179, 238, 17, 116, 98, 95, 166, 185, 255, 168, 212, 126, 2, 112, 102,
+    20, 238, 237, 18, 98, 218, 126, 232, 129, 65, 204, 6, 57, 89, 59, 74,
+    241, 222, 215, 96, 142, 170, 234, 206, 186, 203, 191, 57, 144, 240, 148, 233,
+    201, 236, 9, 35, 11, 158, 116, 97, 245, 82, 96, 246, 6, 21, 103, 128,
+    109, 138, 252, 91, 45, 116, 187, 174, 108, 112, 235, 240, 150, 16, 100, 113,
+    138, 201, 165, 26, 176, 46, 11, 67, 194, 86, 223, 75, 51, 140, 244, 138,
+    106, 41, 154, 67, 92, 244, 30, 114, 163, 233, 199, 241, 107, 2, 33, 6,
+    218, 54, 43, 124, 88, 15, 117, 28, 102, 199, 65, 119, 157, 22, 152, 248,
+    155, 212, 247, 92, 16, 185, 36, 42, 143, 126, 180, 169, 13, 2, 204, 195,
+    191, 177, 205, 16, 60, 149, 107, 37, 47, 252, 19, 182, 48, 196, 93, 129,
+    234, 50, 30, 86, 101, 220, 228, 40, 75, 135, 249, 33, 95, 93, 23, 203,
+    75, 92, 198, 29, 189, 165, 151, 201, 170, 166, 237, 78, 179, 210, 126, 12,
+    216, 82, 90, 208, 80, 243, 115, 170, 18, 30, 189, 111, 113, 25, 53, 199,
+    80, 81, 231, 158, 35, 86, 34, 250, 175, 121, 49, 120, 221, 148, 22, 99,
+    225, 231, 57, 64, 186, 58, 181, 21, 176, 97, 4, 228, 48, 214, 108, 126,
+    140, 130, 193, 230, 23, 6, 73, 88, 220, 206, 74, 48, 68, 162, 76, 9,
+    2, 17, 56, 3, 195, 124, 125, 238, 162, 102, 29, 170, 16, 147, 254, 44,
+    206, 28, 154, 94, 216, 125, 111, 252, 180, 144, 32, 13, 167, 48, 172, 147,
+    131, 70, 242, 46, 205, 114, 29, 197, 91, 250, 124, 221, 85, 137, 1, 131,
+    190, 123, 66, 163, 151, 9, 47, 82, 107, 11, 206, 126, 60, 54, 92, 90,
+    204, 176, 178, 208, 251, 153, 19, 25, 147, 206, 149, 37, 69, 246, 83, 5,
+    170, 244, 63, 190, 25, 54, 115, 30, 242, 34, 162, 47, 148, 174, 111, 85,
+    217, 180, 56, 25, 232, 199, 179, 197, 228, 1, 34, 150, 248, 38, 84, 14,
+    189, 6, 99, 10, 115, 90, 125, 132, 232, 17, 159, 36, 170, 84, 195, 153,
+    168, 217, 23, 61, 137, 146, 225, 125, 248, 123, 211, 142, 79, 143, 184, 131,
+    195, 31, 22, 202, 90, 7, 151, 248, 87, 212, 94, 234, 160, 57, 1, 240,
+    38, 229, 181, 67, 29, 150, 222, 167, 105, 246, 42, 53, 145, 142, 28, 151,
+    5, 181, 124, 138, 89, 191, 100, 53, 132, 86, 114, 80, 98, 11, 82, 190,
+    112, 223, 7, 105, 12, 75, 5, 66, 214, 58, 174, 98, 1, 104, 175, 140,
+    211, 49, 12, 52, 181, 200, 47, 51, 156, 166, 225, 247, 214, 28, 229, 97,
+    130, 6, 144, 170, 60, 47, 42, 54, 87, 21, 241, 45, 147, 7, 218, 39,
+    209, 155, 204, 238, 49, 47, 219, 74, 64, 183, 48, 199, 95, 125, 229, 209,
+    251, 177, 161, 38, 70, 41, 27, 101, 29, 191, 156, 163, 2, 246, 160, 7,
+    10, 63, 169, 157, 183, 131, 25, 237, 119, 156, 208, 239, 166, 115, 130, 37,
+    158, 195, 73, 10, 75, 235, 77, 222, 14, 127, 100, 160, 143, 227, 35, 79,
+    211, 64, 220, 75, 173, 13, 80, 64, 53, 33, 22, 161, 142, 146, 6, 211,
+    131, 198, 159, 87, 181, 213, 102, 201, 164, 11, 149, 208, 78, 6, 134, 83,
+    144, 75, 121, 93, 213, 203, 123, 188, 14, 1, 145, 211, 86, 104, 239, 15,
+    238, 200, 194, 228, 68, 6, 166, 14, 152, 151, 102, 120, 206, 89, 93, 169,
+    188, 36, 67, 57, 95, 203, 199, 64, 62, 122, 7, 226, 69, 160, 2, 150,
+    52, 67, 179, 201, 97, 45, 10, 85, 216, 15, 232, 145, 148, 113, 16, 227,
+    105, 56, 80, 229, 33, 156, 209, 108, 200, 59, 159, 148, 206, 43, 151, 30,
+    189, 81, 80, 109, 47, 9, 217, 73, 222, 251, 248, 16, 129, 144, 200, 182,
+    86, 40, 142, 171, 13, 217, 229, 117, 111, 135, 159, 77, 207, 94, 64, 230,
+    39, 225, 142, 179, 40, 200, 140, 198, 109, 96, 228, 233, 65, 124, 212, 39,
+    52, 242, 153, 180, 40, 73, 71, 60, 135, 126, 106, 217, 64, 171, 185, 224,
+    93, 179, 132, 74, 99, 173, 7, 236, 70, 106, 31, 172, 158, 225, 236, 69,
+    194, 154, 211, 203, 189, 145, 15, 131, 23, 152, 51, 44, 162, 52, 247, 97,
+    205, 65, 237, 189, 98, 78, 104, 210, 91, 65, 74, 248, 20, 83, 240, 169,
+    193, 155, 134, 176, 226, 89, 75, 30, 112, 37, 139, 209, 127, 240, 73, 16,
+    115, 206, 168, 125, 225, 252, 13, 8, 92, 220, 175, 19, 170, 53, 41, 128,
+    245, 133, 142, 254, 78, 242, 66, 92, 221, 93, 133, 253, 31, 121, 105, 158,
+    202, 144, 17, 228, 97, 11, 59, 29, 248, 245, 28, 175, 9, 186, 8, 98,
+    208, 17, 246, 3, 130, 168, 219, 117, 236, 56, 158, 37, 198, 172, 46, 35,
+    149, 101, 150, 106, 58, 209, 157, 118, 194, 207, 123, 198, 139, 225, 116, 155,
+    108, 113, 100, 90, 89, 189, 139, 148, 224, 59, 4, 77, 71, 31, 211, 251,
+    26, 50, 132, 95, 233, 139, 160, 191, 140, 2, 78, 109, 251, 105, 54, 82,
+    117, 60, 176, 115, 212, 149, 74, 73, 118, 45, 168, 243, 75, 136, 48, 117,
+    113, 56, 122, 49, 249, 105, 115, 11, 241, 202, 56, 4, 126, 107, 69, 189,
+    155, 60, 159, 7, 47, 183, 13, 24, 162, 56, 90, 102, 125, 100, 61, 101,
+    246, 173, 165, 127, 239, 76, 49, 67, 235, 197, 245, 163, 185, 121, 187, 123,
+    199, 181, 9, 239, 39, 132, 139, 87, 138, 97, 126, 207, 98, 231, 162, 116,
+    255, 91, 122, 237, 36, 214, 80, 83, 60, 63, 129, 37, 155, 162, 12, 218,
+    224, 114, 165, 157, 109, 121, 82, 35, 255, 245, 21, 105, 100, 187, 65, 10,
+    180, 123, 119, 184, 120, 4, 196, 255, 27, 17, 22, 65, 18, 153, 229, 27,
+    149, 187, 178, 205, 219, 113, 245, 147, 144, 127, 93, 81, 240, 252, 62, 148,
+    86, 178, 48, 79, 17, 20, 214, 149, 96, 189, 193, 14, 101, 133, 148, 89,
+    91, 235, 254, 224, 123, 47, 100, 48, 244, 57, 253, 101, 77, 173, 231, 39,
+    97, 145, 232, 223, 6, 150, 40, 189, 90, 65, 202, 195, 47, 149, 146, 5,
+    227, 116, 178, 169, 111, 40, 102, 243, 31, 190, 67, 141, 119, 236, 105, 121,
+    214, 21, 10, 9, 26, 27, 34, 195, 55, 211, 81, 181, 125, 126, 182, 214,
+    183, 116, 233, 141, 244, 137, 255, 142, 174, 225, 155, 45, 196, 17, 139, 51,
+    243, 182, 222, 249, 214, 241, 59, 238, 36, 155, 156, 42, 238, 216, 48, 133,
+    122, 40, 250, 84, 76, 101, 139, 57, 37, 75, 157, 41, 248, 135, 66, 61,
+    241, 67, 143, 76, 225, 200, 24, 235, 135, 129, 242, 74, 61, 204, 1, 93,
+    69, 33, 180, 99, 76, 92, 17, 173, 197, 121, 183, 211, 29, 1, 202, 150,
+    3, 247, 116, 189, 89, 78, 36, 151, 173, 40, 43, 169, 152, 230, 135, 133,
+    175, 54, 59, 162, 114, 240, 32, 173, 94, 219, 245, 196, 195, 185, 209, 44,
+    227, 15, 224, 16, 229, 177, 9, 206, 86, 240, 70, 28, 188, 230, 52, 96,
+    178, 224, 117, 133, 242, 145, 7, 181, 84, 138, 183, 186, 55, 88, 170, 153,
+    167, 182, 56, 111, 96, 98, 40, 42, 254, 205, 25, 55, 8, 103, 4, 162,
+    176, 177, 220, 232, 112, 34, 122, 96, 100, 129, 54, 158, 233, 26, 137, 72,
+    175, 110, 184, 93, 139, 122, 35, 57, 252, 59, 146, 173, 67, 219, 31, 205,
+    132, 200, 52, 201, 230, 70, 228, 76, 44, 158, 29, 175, 119, 138, 82, 132,
+    242, 190, 10, 8, 37, 169, 203, 185, 216, 85, 201, 240, 250, 209, 119, 110,
+    53, 57, 197, 180, 154, 235, 49, 26, 192, 201, 217, 224, 13, 93, 225, 165,
+    78, 31, 140, 224, 30, 184, 181, 249, 217, 22, 91, 166, 227, 202, 14, 39,
+    251, 183, 107, 30, 164, 2, 251, 110, 86, 161, 198, 125, 75, 120, 83, 128,
+    123, 225, 72, 62, 138, 211, 10, 224, 137, 99, 189, 39, 249, 83, 143, 92,
+    59, 101, 26, 221, 5, 23, 190, 86, 91, 82, 105, 244, 129, 1, 208, 9,
+    130, 225, 239, 140, 108, 241, 17, 91, 145, 152, 205, 86, 173, 217, 141, 117,
+    121, 206, 22, 106, 167, 236, 16, 41, 1, 124, 107, 203, 104, 200, 42, 97,
+    131, 22, 186, 198, 202, 3, 105, 213, 8, 211, 45, 123, 193, 34, 232, 196,
+    190, 81, 111, 227, 77, 181, 252, 4, 224, 204, 40, 193, 199, 36, 60, 48,
+    222, 209, 128, 177, 234, 227, 140, 26, 38, 220, 47, 121, 190, 150, 164, 159,
+    123, 64, 166, 92, 186, 140, 236, 122, 196, 169, 252, 205, 31, 130, 133, 12,
+    114, 178, 118, 148, 255, 161, 179, 192, 1, 73, 201, 129, 105, 139, 99, 114,
+    61, 253, 50, 154, 75, 201, 151, 224, 66, 148, 63, 138, 184, 140, 110, 137,
+    98, 181, 232, 99, 78, 197, 47, 27, 241, 63, 22, 163, 53, 207, 143, 197,
+    18, 70, 22, 33, 232, 194, 247, 164, 192, 241, 12, 42, 206, 29, 218, 9,
+    229, 182, 90, 232, 107, 65, 195, 252, 56, 193, 154, 36, 209, 185, 165, 250,
+    57, 188, 81, 217, 221, 95, 39, 55, 93, 77, 163, 38, 200, 165, 64, 31,
+    216, 224, 203, 253, 49, 32, 200, 226, 9, 143, 87, 52, 125, 92, 22, 134,
+    153, 172, 163, 150, 102, 5, 245, 9, 212, 82, 46, 211, 124, 249, 185, 66,
+    15, 122, 68, 183, 153, 44, 236, 116, 199, 243, 112, 134, 36, 210, 32, 149,
+    103, 68, 255, 12, 41, 134, 184, 245, 60, 228, 91, 207, 147, 255, 214, 4,
+    66, 12, 169, 108, 86, 248, 176, 30, 234, 56, 204, 147, 130, 238, 223, 181,
+    15, 241, 180, 134, 156, 87, 222, 199, 24, 28, 211, 36, 120, 25, 191, 210,
+    55, 90, 172, 168, 94, 222, 169, 176, 39, 44, 45, 237, 43, 181, 243, 184,
+    32, 111, 72, 84, 3, 252, 117, 79, 26, 4, 133, 155, 99, 127, 135, 32,
+    120, 55, 209, 31, 154, 233, 163, 215, 52, 32, 109, 87, 134, 76, 146, 212,
+    164, 58, 243, 46, 2, 223, 37, 239, 21, 109, 83, 105, 214, 74, 94, 229,
+    38, 113, 96, 149, 186, 31, 201, 100, 60, 172, 202, 165, 213, 80, 150, 19,
+    239, 66, 190, 186, 46, 139, 32, 121, 233, 225, 174, 19, 167, 13, 247, 39,
+    7, 124, 173, 132, 27, 208, 60, 122, 17, 87, 169, 210, 44, 247, 5, 213,
+    150, 184, 145, 58, 103, 87, 51, 143, 73, 81, 199, 156, 123, 185, 252, 24,
+    173, 164, 180, 189, 160, 251, 230, 73, 36, 60, 96, 139, 38, 62, 239, 53,
+    244, 23, 4, 105, 9, 132, 234, 145, 45, 109, 68, 142, 51, 249, 230, 107,
+    116, 4, 15, 98, 103, 222, 226, 50, 106, 147, 160, 162, 211, 33, 70, 172,
+    68, 233, 67, 242, 98, 240, 167, 53, 44, 198, 223, 211, 114, 128, 145, 237,
+    85, 54, 226, 241, 103, 58, 158, 25, 136, 180, 213, 193, 146, 135, 139, 218,
+    32, 113, 106, 86, 77, 158, 89, 222, 105, 116, 119, 42, 125, 194, 8, 213,
+    96, 177, 216, 252, 5, 25, 159, 209, 46, 12, 146, 176, 165, 129, 148, 96,
+    136, 89, 159, 71, 192, 46, 245, 160, 207, 77, 45, 137, 22, 228, 148, 49,
+    78, 164, 199, 38, 21, 244, 227, 17, 6, 45, 163, 7, 152, 18, 4, 34,
+    112, 6, 155, 248, 250, 193, 89, 204, 58, 73, 32, 59, 225, 88, 129, 56,
+    41, 188, 173, 250, 222, 229, 110, 33, 179, 38, 248, 100, 92, 96, 183, 249,
+    151, 212, 171, 97, 241, 78, 8, 114, 6, 124, 111, 44, 63, 183, 245, 187,
+    117, 61, 64, 26, 83, 96, 69, 59, 27, 140, 249, 92, 135, 228, 58, 151,
+    182, 233, 248, 167, 170, 15, 2, 27, 97, 246, 131, 14, 247, 30, 219, 2,
+    130, 163, 86, 180, 55, 68, 22, 204, 235, 226, 95, 195, 127, 227, 236, 159,
+    144, 86, 74, 168, 132, 91, 51, 18, 94, 164, 214, 22, 129, 252, 120, 108,
+    184, 180, 133, 125, 121, 189, 235, 47, 38, 50, 59, 129, 55, 74, 114, 104,
+    132, 22, 214, 198, 17, 142, 204, 196, 182, 116, 41, 156, 84, 8, 144, 151,
+    108, 107, 96, 162, 169, 204, 28, 20, 138, 241, 166, 10, 73, 245, 126, 97,
+    50, 108, 230, 60, 249, 68, 89, 94, 53, 65, 222, 170, 175, 117, 112, 50,
+    205, 147, 124, 194, 17, 14, 193, 151, 185, 249, 127, 84, 40, 36, 104, 108,
+    136, 43, 220, 107, 89, 238, 233, 229, 226, 127, 230, 205, 123, 151, 213, 2,
+    68, 49, 237, 76, 168, 28, 103, 12, 198, 20, 230, 180, 250, 21, 205, 34,
+    35, 72, 73, 168, 155, 47, 141, 164, 98, 6, 204, 83, 42, 212, 229, 36,
+    169, 20, 87, 60, 55, 193, 19, 63, 74, 102, 101, 216, 219, 229, 176, 113,
+    77, 175, 46, 122, 15, 57, 223, 250, 237, 246, 187, 1, 158, 3, 109, 27,
+    155, 62, 44, 137, 180, 14, 51, 237, 174, 181, 187, 156, 153, 126, 135, 91,
+    24, 98, 160, 206, 117, 25, 15, 43, 188, 110, 114, 20, 171, 205, 242, 158,
+    161, 160, 133, 235, 188, 201, 93, 114, 2, 253, 76, 215, 119, 134, 58, 49,
+    161, 83, 210, 241, 84, 106, 63, 1, 56, 51, 10, 119, 248, 9, 74, 250,
+    234, 118, 138, 159, 139, 79, 58, 190, 244, 41, 48, 123, 3, 132, 189, 64,
+    184, 69, 126, 163, 152, 58, 211, 87, 178, 99, 200, 106, 21, 172, 228, 160,
+    196, 22, 164, 97, 224, 163, 14, 210, 24, 150, 10, 132, 177, 116, 65, 196,
+    2, 208, 68, 80, 127, 110, 157, 206, 35, 56, 137, 46, 106, 121, 113, 139,
+    223, 167, 241, 188, 141, 192, 247, 228, 211, 137, 41, 142, 67, 5, 187, 98,
+    24, 104, 119, 141, 94, 102, 37, 81, 223, 243, 177, 56, 215, 194, 25, 12,
+    61, 73, 120, 94, 84, 108, 181, 54, 12, 102, 144, 10, 176, 21, 19, 94,
+    235, 73, 78, 219, 96, 77, 62, 232, 158, 72, 123, 217, 234, 19, 127, 50,
+    174, 42, 255, 90, 59, 14, 169, 78, 191, 43, 133, 193, 98, 94, 171, 148,
+    128, 115, 96, 147, 190, 250, 215, 191, 235, 127, 88, 25, 72, 94, 179, 108,
+    110, 214, 242, 19, 75, 217, 243, 118, 122, 225, 105, 89, 231, 215, 248, 106,
+    69, 242, 192, 33, 95, 76, 140, 82, 54, 202, 58, 99, 37, 91, 4, 241,
+    93, 14, 20, 126, 79, 39, 115, 27, 50, 199, 238, 37, 189, 195, 169, 127,
+    59, 86, 190, 168, 253, 251, 104, 99, 202, 233, 204, 38, 197, 11, 166, 13,
+    244, 95, 116, 87, 124, 104, 150, 157, 81, 230, 25, 74, 33, 155, 146, 20,
+    150, 203, 154, 161, 28, 254, 200, 93, 3, 219, 70, 158, 187, 128, 165, 150,
+    71, 26, 167, 213, 174, 78, 169, 249, 85, 140, 219, 243, 84, 185, 141, 214,
+    25, 40, 234, 241, 193, 218, 253, 16, 55, 219, 108, 68, 160, 128, 106, 66,
+    44, 95, 1, 57, 12, 187, 27, 145, 35, 174, 119, 183, 204, 143, 85, 22,
+    55, 189, 156, 12, 17, 166, 86, 179, 221, 70, 164, 61, 198, 161, 65, 131,
+    213, 137, 178, 134, 166, 194, 37, 165, 210, 82, 113, 45, 14, 65, 58, 248,
+    61, 150, 242, 186, 183, 139, 246, 101, 28, 2, 63, 187, 172, 208, 195, 30,
+    193, 141, 153, 213, 136, 12, 81, 28, 45, 51, 203, 165, 69, 190, 63, 233,
+    49, 253, 81, 58, 241, 163, 61, 248, 18, 107, 40, 167, 30, 145, 206, 156,
+    195, 81, 6, 109, 204, 240, 129, 178, 186, 79, 101, 72, 134, 114, 190, 139,
+    147, 128, 124, 244, 14, 217, 138, 93, 4, 49, 104, 134, 123, 143, 58, 195,
+    54, 182, 50, 45, 162, 208, 203, 74, 112, 147, 2, 168, 173, 129, 231, 243,
+    13, 25, 66, 161, 250, 203, 80, 209, 194, 90, 20, 170, 173, 30, 205, 63,
+    53, 226, 32, 219, 210, 112, 160, 215, 66, 37, 191, 216, 141, 118, 35, 53,
+    129, 86, 52, 105, 163, 174, 37, 124, 10, 167, 120, 218, 238, 195, 67, 88,
+    113, 162, 171, 15, 56, 156, 203, 230, 177, 120, 170, 8, 51, 60, 103, 162,
+    160, 218, 94, 18, 175, 146, 161, 235, 237, 32, 31, 61, 141, 113, 172, 80,
+    1, 75, 26, 175, 215, 234, 197, 15, 208, 166, 40, 184, 153, 138, 226, 170,
+    111, 243, 124, 8, 206, 72, 100, 91, 43, 20, 71, 219, 136, 226, 252, 180,
+    222, 19, 35, 154, 131, 188, 128, 209, 78, 223, 1, 123, 80, 141, 5, 145,
+    218, 192, 213, 207, 130, 248, 181, 78, 104, 249, 40, 32, 148, 158, 11, 222,
+    71, 73, 3, 231, 207, 99, 193, 165, 212, 228, 51, 234, 82, 139, 196, 104,
+    39, 3, 67, 167, 47, 117, 80, 146, 142, 120, 19, 252, 212, 175, 128, 75,
+    111, 221, 186, 123, 21, 148, 198, 71, 14, 197, 140, 212, 62, 69, 217, 70,
+    231, 150, 6, 26, 212, 100, 153, 151, 78, 83, 254, 245, 107, 14, 252, 190,
+    65, 3, 72, 85, 30, 153, 21, 27, 33, 223, 197, 138, 153, 41, 187, 139,
+    103, 63, 30, 27, 46, 45, 102, 88, 89, 104, 243, 194, 135, 130, 199, 103,
+    196, 156, 215, 236, 114, 142, 17, 75, 124, 19, 42, 7, 208, 3, 191, 5,
+    183, 45, 176, 66, 116, 134, 193, 18, 85, 42, 239, 194, 208, 185, 182, 130,
+    148, 237, 40, 166, 253, 79, 159, 43, 17, 125, 217, 178, 150, 60, 224, 74,
+    11, 191, 254, 253, 146, 32, 38, 138, 1, 134, 28, 143, 239, 62, 176, 119,
+    81, 51, 128, 85, 8, 199, 127, 22, 103, 14, 77, 47, 108, 176, 185, 126,
+    230, 129, 77, 250, 223, 229, 26, 16, 184, 165, 67, 38, 73, 106, 82, 29,
+    247, 23, 1, 225, 156, 249, 132, 184, 167, 186, 16, 178, 250, 254, 87, 135,
+    221, 136, 245, 157, 141, 62, 216, 66, 131, 104, 30, 61, 134, 165, 218, 105,
+    22, 245, 140, 228, 23, 231, 62, 242, 210, 33, 137, 61, 34, 213, 194, 22,
+    118, 58, 237, 247, 56, 67, 18, 105, 16, 196, 189, 34, 241, 6, 225, 212,
+    137, 246, 90, 67, 78, 165, 111, 237, 12, 14, 231, 18, 60, 130, 209, 105,
+    149, 45, 86, 84, 47, 111, 218, 88, 25, 77, 171, 234, 197, 112, 33, 74,
+    145, 69, 92, 70, 55, 202, 49, 212, 116, 191, 39, 236, 153, 131, 246, 145,
+    11, 223, 239, 126, 28, 238, 77, 18, 230, 210, 220, 125, 146, 94, 166, 226,
+    224, 161, 157, 149, 160, 168, 223, 19, 100, 220, 32, 129, 232, 43, 216, 226,
+    200, 180, 178, 103, 11, 53, 221, 118, 8, 154, 142, 62, 187, 235, 52, 100,
+    21, 190, 207, 11, 93, 99, 30, 24, 111, 230, 64, 214, 117, 255, 70, 13,
+    19, 110, 153, 178, 95, 75, 82, 193, 179, 32, 83, 46, 93, 70, 118, 61,
+    5, 4, 156, 218, 235, 210, 108, 164, 234, 120, 125, 230, 181, 55, 148, 146,
+    236, 90, 77, 251, 150, 13, 96, 234, 226, 112, 243, 55, 43, 222, 99, 176,
+    171, 60, 167, 64, 179, 254, 36, 31, 69, 231, 5, 112, 202, 191, 208, 157,
+    242, 167, 201, 46, 244, 98, 239, 210, 230, 22, 255, 137, 112, 8, 252, 214,
+    138, 103, 43, 120, 35, 14, 94, 115, 26, 48, 89, 112, 180, 204, 2, 81,
+    88, 214, 110, 116, 56, 17, 61, 48, 50, 206, 27, 79, 250, 13, 202, 36,
+    217, 55, 92, 160, 203, 61, 159, 146, 250, 200, 122, 202, 241, 71, 87, 254,
+    195, 152, 98, 134, 203, 151, 247, 91, 111, 242, 107, 246, 147, 119, 18, 195,
+    78, 21, 12, 251, 205, 206, 121, 37, 144, 102, 142, 160, 172, 158, 90, 191,
+    38, 46, 134, 216, 236, 178, 213, 231, 128, 142, 101, 75, 11, 174, 9, 194,
+    252, 131, 196, 211, 89, 232, 227, 182, 244, 199, 72, 177, 160, 166, 120, 126,
+    31, 74, 43, 89, 24, 169, 253, 157, 190, 198, 116, 225, 3, 75, 20, 208,
+    45, 174, 101, 239, 153, 196, 73, 140, 255, 58, 89, 218, 185, 20, 51, 247,
+    221, 228, 87, 39, 218, 242, 164, 70, 227, 247, 42, 210, 200, 107, 130, 20,
+    117, 246, 238, 109, 240, 8, 149, 227, 54, 34, 43, 215, 224, 35, 82, 144,
+    99, 222, 174, 207, 228, 202, 89, 67, 83, 97, 156, 220, 105, 41, 182, 152,
+    7, 174, 29, 124, 44, 130, 36, 47, 215, 54, 55, 107, 121, 135, 171, 226,
+    247, 59, 61, 254, 186, 162, 253, 229, 124, 53, 172, 121, 96, 158, 218, 177,
+    147, 43, 95, 84, 240, 243, 52, 191, 101, 250, 102, 19, 236, 139, 83, 136,
+    122, 161, 58, 165, 62, 52, 75, 192, 34, 40, 177, 55, 192, 103, 159, 28,
+    202, 23, 53, 178, 182, 203, 225, 221, 246, 94, 200, 96, 245, 114, 231, 202,
+    154, 71, 212, 27, 6, 51, 72, 5, 88, 132, 135, 47, 251, 170, 39, 227,
+    48, 168, 31, 116, 79, 36, 179, 226, 117, 135, 177, 25, 211, 78, 194, 63,
+    205, 163, 12, 49, 80, 103, 180, 130, 137, 155, 94, 55, 57, 10, 219, 232,
+    121, 79, 222, 80, 204, 251, 37, 125, 117, 59, 69, 193, 203, 169, 29, 95,
+    122, 154, 24, 179, 143, 66, 208, 32, 92, 172, 63, 223, 76, 29, 231, 165,
+    62, 97, 134, 7, 238, 197, 210, 242, 177, 42, 20, 18, 52, 54, 68, 155,
+    110, 187, 162, 119, 250, 252, 113, 177, 115, 232, 200, 82, 49, 3, 102, 167,
+    21, 106, 252, 18, 218, 10, 165, 30, 149, 238, 135, 145, 37, 51, 188, 108,
+    227, 252, 88, 182, 207, 7, 245, 15, 227, 1, 65, 223, 43, 90, 149, 34,
+    11, 102, 251, 113, 161, 239, 177, 255, 118, 193, 72, 43, 37, 84, 57, 52,
+    66, 11, 107, 99, 134, 71, 102, 98, 91, 58, 154, 78, 42, 4, 72, 197,
+    54, 187, 48, 81, 218, 102, 14, 10, 193, 173, 96, 23, 244, 80, 233, 168,
+    152, 202, 11, 114, 74, 150, 39, 82, 237, 19, 132, 122, 255, 134, 3, 152,
+    223, 141, 55, 158, 215, 19, 124, 50, 46, 48, 213, 242, 197, 106, 219, 190,
+    246, 39, 4, 57, 3, 62, 185, 22, 145, 213, 244, 211, 48, 203, 19, 31,
+    249, 148, 122, 133, 2, 186, 138, 66, 117, 198, 152, 184, 34, 71, 151, 242,
+    115, 187, 58, 2, 137, 49, 198, 248, 164, 27, 113, 246, 189, 29, 79, 130,
+    68, 90, 228, 238, 73, 205, 203, 109, 16, 182, 53, 43, 168, 79, 162, 111,
+    6, 243, 232, 103, 178, 156, 72, 51, 71, 80, 86, 79, 45, 209, 19, 23,
+    67, 108, 118, 89, 228, 253, 64, 71, 188, 171, 240, 192, 95, 99, 58, 254,
+    143, 171, 10, 104, 152, 87, 188, 249, 194, 98, 170, 70, 241, 29, 162, 109,
+    210, 10, 151, 245, 247, 149, 155, 111, 191, 88, 219, 30, 221, 32, 215, 127,
+    18, 129, 172, 253, 140, 56, 101, 209, 104, 192, 121, 221, 234, 23, 1, 166,
+    44, 107, 55, 58, 28, 134, 144, 24, 25, 103, 131, 169, 125, 136, 101, 18,
+    226, 149, 46, 80, 235, 144, 193, 73, 249, 63, 14, 119, 168, 9, 115, 105,
+    110, 176, 73, 47, 83, 113, 112, 222, 192, 196, 80, 84, 225, 135, 50, 110,
+    16, 206, 15, 12, 185, 115, 32, 107, 180, 241, 35, 136, 135, 55, 194, 89,
+    161, 171, 41, 238, 215, 16, 167, 23, 160, 35, 59, 144, 8, 89, 125, 127,
+    165, 205, 224, 68, 244, 192, 200, 31, 108, 33, 207, 52, 15, 144, 67, 220,
+    109, 186, 11, 244, 70, 114, 254, 106, 202, 123, 45, 175, 39, 220, 185, 248,
+    6, 7, 253, 9, 30, 65, 230, 186, 196, 152, 43, 42, 153, 185, 109, 44,
+    229, 118, 57, 71, 134, 171, 62, 135, 21, 141, 104, 143, 209, 140, 213, 152,
+    88, 33, 58, 67, 238, 9, 164, 21, 249, 97, 19, 69, 142, 67, 14, 201,
+    249, 31, 88, 181, 166, 151, 64, 164, 4, 237, 177, 11, 189, 7, 168, 153,
+    54, 88, 210, 63, 20, 16, 74, 79, 139, 111, 173, 170, 143, 253, 233, 191,
+    238, 220, 106, 114, 151, 117, 41, 203, 98, 52, 157, 143, 175, 221, 226, 35,
+    253, 75, 3, 13, 106, 50, 194, 197, 39, 167, 127, 244, 187, 7, 126, 95,
+    174, 143, 36, 164, 15, 194, 132, 131, 26, 186, 223, 87, 156, 62, 5, 221,
+    60, 109, 119, 239, 175, 44, 182, 81, 219, 137, 28, 78, 235, 115, 214, 60,
+    85, 4, 236, 137, 104, 83, 20, 92, 194, 69, 113, 85, 185, 247, 62, 4,
+    103, 36, 50, 163, 155, 10, 173, 227, 68, 113, 126, 90, 235, 220, 172, 95,
+    145, 250, 150, 240, 166, 29, 246, 223, 144, 124, 9, 187, 20, 221, 15, 198,
+    103, 78, 239, 166, 3, 184, 29, 239, 27, 91, 25, 152, 81, 104, 235, 37,
+    56, 199, 1, 84, 216, 206, 253, 247, 136, 130, 33, 222, 125, 235, 40, 230,
+    118, 202, 52, 167, 10, 46, 97, 172, 182, 164, 210, 245, 31, 2, 189, 18,
+    25, 223, 195, 5, 216, 255, 34, 182, 63, 45, 128, 249, 131, 163, 130, 76,
+    166, 52, 251, 156, 28, 237, 142, 42, 108, 103, 240, 245, 68, 65, 158, 111,
+    176, 251, 20, 115, 135, 172, 71, 175, 7, 234, 242, 129, 44, 212, 83, 197,
+    32, 82, 2, 248, 214, 139, 208, 141, 84, 194, 27, 44, 105, 145, 113, 159,
+    240, 171, 143, 136, 53, 25, 97, 236, 157, 221, 177, 122, 211, 141, 63, 161,
+    87, 201, 18, 82, 137, 97, 66, 207, 137, 6, 210, 183, 16, 187, 90, 246,
+    159, 68, 205, 149, 97, 162, 222, 219, 154, 119, 229, 8, 221, 133, 80, 159,
+    147, 72, 127, 53, 101, 179, 152, 217, 157, 110, 210, 124, 3, 141, 240, 138,
+    15, 174, 115, 93, 98, 76, 155, 21, 194, 210, 184, 22, 120, 96, 161, 191,
+    29, 127, 201, 219, 5, 52, 76, 165, 94, 242, 97, 49, 85, 35, 246, 128,
+    81, 184, 105, 5, 197, 244, 142, 83, 22, 187, 149, 29, 14, 67, 72, 12,
+    130, 189, 207, 218, 176, 68, 188, 9, 113, 196, 23, 40, 251, 72, 238, 170,
+    149, 79, 229, 135, 62, 25, 23, 24, 228, 121, 236, 53, 227, 95, 123, 157,
+    2, 146, 143, 31, 210, 11, 198, 228, 122, 231, 99, 124, 82, 131, 182, 123,
+    208, 128, 169, 65, 34, 45, 114, 119, 170, 232, 235, 184, 8, 91, 148, 155,
+    84, 169, 81, 185, 100, 41, 150, 143, 51, 221, 132, 53, 126, 9, 109, 5,
+    220, 15, 196, 119, 205, 198, 156, 151, 94, 54, 255, 126, 44, 91, 146, 26,
+    33, 139, 187, 191, 67, 173, 51, 49, 163, 29, 77, 39, 21, 2, 36, 236,
+    27, 211, 24, 166, 109, 51, 7, 5, 106, 131, 3, 151, 36, 140, 44, 66,
+    205, 153, 243, 85, 157, 255, 24, 84, 129, 58, 169, 18, 215, 113, 180, 205,
+    214, 130, 156, 176, 180, 147, 172, 238, 235, 218, 128, 161, 61, 77, 12, 215,
+    201, 33, 104, 16, 46, 86, 145, 225, 38, 128, 253, 220, 155, 229, 112, 159,
+    41, 72, 191, 111, 87, 233, 114, 101, 162, 175, 167, 190, 78, 110, 186, 154,
+    91, 76, 141, 87, 128, 62, 109, 214, 199, 155, 161, 42, 120, 247, 26, 209,
+    188, 125, 51, 135, 118, 203, 167, 68, 61, 222, 29, 220, 31, 26, 171, 96,
+    173, 221, 139, 231, 98, 64, 141, 217, 18, 3, 174, 104, 250, 184, 44, 17,
+    47, 69, 91, 49, 204, 10, 247, 18, 181, 164, 91, 238, 60, 227, 234, 34,
+    74, 65, 95, 59, 96, 112, 107, 144, 253, 100, 198, 111, 220, 117, 138, 154,
+    101, 95, 158, 250, 92, 187, 248, 239, 111, 132, 30, 244, 136, 115, 47, 88,
+    197, 232, 147, 251, 224, 17, 72, 185, 64, 55, 206, 136, 227, 24, 170, 136,
+    79, 235, 231, 230, 217, 108, 197, 75, 225, 64, 84, 192, 66, 142, 9, 59,
+    207, 253, 6, 167, 92, 197, 200, 70, 82, 17, 109, 247, 120, 213, 182, 131,
+    59, 227, 177, 8, 132, 24, 79, 216, 172, 237, 125, 60, 201, 112, 133, 59,
+    25, 193, 164, 34, 218, 243, 240, 183, 113, 27, 118, 219, 127, 16, 21, 48,
+    158, 173, 69, 199, 250, 120, 143, 224, 23, 118, 50, 159, 163, 119, 30, 255,
+    117, 17, 37, 174, 161, 147, 48, 56, 187, 72, 240, 50, 99, 185, 110, 180,
+    69, 77, 188, 161, 79, 125, 85, 68, 169, 251, 253, 115, 226, 54, 236, 171,
+    254, 32, 42, 96, 33, 71, 138, 147, 233, 240, 3, 221, 46, 236, 100, 35,
+    78, 88, 90, 199, 86, 119, 251, 109, 64, 222, 144, 168, 6, 229, 234, 158,
+    52, 8, 23, 43, 198, 254, 19, 64, 240, 110, 184, 107, 237, 195, 222, 21,
+    60, 245, 13, 230, 94, 176, 151, 205, 59, 235, 221, 34, 144, 111, 128, 110,
+    129, 13, 219, 48, 191, 62, 41, 207, 91, 179, 104, 64, 218, 174, 17, 152,
+    57, 181, 85, 116, 251, 92, 4, 163, 74, 195, 42, 218, 166, 210, 73, 13,
+    158, 203, 211, 209, 175, 216, 151, 150, 223, 128, 168, 157, 132, 1, 18, 118,
+    131, 231, 12, 83, 184, 151, 141, 140, 177, 148, 188, 215, 76, 226, 192, 55,
+    105, 62, 143, 200, 120, 69, 137, 87, 183, 160, 49, 38, 195, 132, 97, 105,
+    92, 11, 71, 167, 11, 211, 196, 128, 7, 175, 36, 6, 65, 208, 233, 109,
+    88, 34, 94, 138, 182, 98, 133, 20, 243, 36, 119, 85, 64, 242, 207, 223,
+    65, 38, 83, 26, 243, 78, 14, 248, 71, 21, 54, 189, 120, 244, 34, 174,
+    79, 185, 88, 243, 10, 183, 182, 193, 120, 219, 201, 68, 148, 130, 190, 118,
+    192, 224, 214, 61, 231, 200, 145, 222, 165, 234, 9, 41, 202, 190, 33, 233,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 252, 9, 28, 13,
+    18, 251, 208, 150, 103, 174, 100, 41, 167, 12, 247, 56, 117, 119, 233, 127,
+    181, 100, 121, 147, 176, 74, 58, 197, 229, 18, 56, 26, 36, 235, 189, 49,
+    206, 65, 200, 82, 83, 24, 243, 112, 234, 238, 207, 254, 119, 200, 242, 59,
+    125, 148, 116, 151, 25, 27, 36, 23, 54, 16, 109, 167, 169, 239, 172, 123,
+    244, 20, 4, 72, 159, 153, 38, 129, 194, 172, 139, 168, 205, 222, 78, 82,
+    215, 36, 112, 52, 72, 203, 103, 98, 129, 130, 141, 164, 166, 48, 251, 224,
+    201, 193, 131, 225, 238, 141, 249, 118, 250, 53, 232, 51, 43, 45, 108, 57,
+    90, 48, 183, 244, 230, 44, 233, 141, 1, 60, 12, 216, 188, 182, 106, 158,
+    91, 233, 128, 229, 74, 127, 210, 246, 50, 54, 72, 46, 108, 32, 218, 83,
+    79, 195, 69, 246, 245, 40, 8, 144, 35, 47, 76, 31, 153, 69, 11, 77,
+    135, 161, 156, 164, 206, 63, 84, 35, 126, 219, 10, 197, 40, 109, 33, 223,
+    82, 36, 255, 168, 86, 88, 165, 96, 44, 33, 114, 222, 55, 235, 166, 97,
+    179, 72, 224, 104, 144, 139, 206, 196, 31, 25, 7, 85, 81, 96, 235, 221,
+    143, 159, 27, 223, 193, 7, 239, 236, 233, 106, 205, 102, 79, 65, 252, 101,
+    130, 112, 30, 82, 120, 183, 99, 124, 246, 108, 28, 229, 250, 232, 242, 160,
+    116, 99, 150, 127, 89, 32, 247, 163, 86, 90, 216, 114, 180, 96, 115, 245,
+    209, 88, 207, 7, 2, 120, 24, 173, 101, 113, 212, 33, 182, 207, 29, 215,
+    148, 254, 185, 241, 170, 83, 196, 127, 166, 155, 163, 99, 182, 246, 171, 46,
+    165, 116, 239, 149, 16, 6, 61, 94, 3, 171, 100, 68, 36, 180, 131, 52,
+    100, 108, 144, 92, 216, 64, 169, 166, 158, 155, 138, 241, 247, 80, 16, 61,
+    70, 94, 152, 62, 47, 138, 22, 154, 19, 95, 37, 85, 152, 101, 140, 81,
+    202, 187, 121, 48, 249, 53, 238, 216, 80, 92, 231, 5, 51, 41, 113, 65,
+    154, 238, 111, 9, 163, 21, 31, 144, 129, 126, 168, 70, 252, 171, 20, 151,
+    80, 218, 66, 163, 164, 72, 227, 77, 172, 176, 87, 192, 88, 66, 228, 161,
+    110, 203, 81, 194, 125, 119, 180, 75, 238, 80, 196, 1, 55, 116, 38, 138,
+    3, 68, 20, 117, 217, 199, 190, 191, 237, 38, 157, 50, 222, 129, 107, 7,
+    123, 144, 221, 208, 61, 11, 129, 149, 62, 50, 14, 170, 162, 192, 203, 167,
+    3, 35, 54, 163, 159, 14, 195, 197, 207, 212, 135, 204, 135, 153, 193, 221,
+    47, 240, 81, 3, 89, 156, 106, 131, 5, 204, 60, 159, 118, 84, 223, 220,
+    42, 106, 186, 86, 127, 158, 189, 9, 158, 130, 229, 202, 25, 224, 60, 164,
+    240, 115, 198, 248, 241, 216, 56, 215, 233, 205, 249, 93, 232, 198, 49, 254,
+    178, 64, 243, 91, 98, 139, 249, 199, 11, 27, 236, 50, 151, 221, 162, 209,
+    86, 212, 207, 239, 156, 186, 16, 34, 93, 162, 72, 109, 2, 10, 201, 158,
+    172, 180, 173, 228, 117, 192, 230, 247, 191, 176, 131, 14, 4, 240, 48, 71,
+    202, 226, 181, 66, 113, 131, 58, 179, 53, 225, 111, 255, 80, 189, 177, 233,
+    103, 59, 54, 97, 216, 30, 231, 39, 163, 252, 199, 127, 191, 149, 92, 61,
+    196, 231, 67, 32, 133, 171, 85, 58, 73, 166, 149, 254, 81, 43, 91, 198,
+    113, 241, 75, 92, 87, 232, 195, 55, 32, 12, 122, 188, 6, 75, 200, 136,
+    72, 117, 27, 104, 181, 175, 137, 243, 67, 208, 139, 80, 22, 95, 47, 117,
+    240, 228, 52, 15, 85, 123, 147, 195, 179, 47, 177, 27, 248, 63, 33, 173,
+    200, 216, 61, 184, 173, 128, 79, 81, 33, 43, 9, 255, 243, 160, 32, 122,
+    140, 188, 45, 124, 94, 9, 44, 41, 38, 190, 74, 170, 52, 209, 33, 181,
+    191, 123, 159, 199, 70, 133, 109, 214, 84, 172, 215, 66, 249, 203, 196, 3,
+    235, 109, 85, 186, 150, 244, 112, 111, 45, 202, 5, 162, 137, 107, 242, 96,
+    239, 106, 193, 173, 160, 184, 211, 10, 102, 82, 226, 130, 41, 193, 222, 18,
+    91, 42, 62, 61, 209, 195, 25, 175, 155, 144, 34, 246, 136, 196, 165, 132,
+    7, 180, 36, 50, 19, 37, 11, 253, 156, 165, 167, 129, 235, 96, 4, 248,
+    31, 252, 77, 140, 229, 75, 40, 51, 160, 169, 132, 91, 85, 144, 219, 154,
+    69, 125, 174, 157, 176, 132, 213, 95, 220, 139, 162, 153, 227, 245, 81, 129,
+    247, 176, 248, 165, 199, 7, 224, 114, 242, 156, 44, 162, 48, 10, 71, 226,
+    5, 224, 172, 204, 108, 193, 152, 92, 250, 238, 117, 150, 193, 160, 149, 2,
+    110, 232, 76, 9, 6, 136, 40, 234, 175, 147, 97, 99, 199, 76, 39, 100,
+    161, 31, 214, 14, 6, 231, 105, 155, 211, 91, 69, 148, 9, 70, 40, 32,
+    161, 132, 223, 210, 218, 228, 136, 28, 114, 40, 94, 247, 17, 85, 236, 203,
+    246, 61, 167, 189, 122, 22, 31, 55, 124, 100, 28, 73, 89, 157, 139, 83,
+    6, 70, 108, 91, 35, 28, 155, 151, 131, 181, 19, 133, 10, 52, 187, 176,
+    104, 237, 207, 161, 27, 202, 120, 96, 254, 145, 124, 107, 115, 49, 133, 36,
+    150, 120, 226, 4, 51, 255, 41, 64, 19, 47, 159, 167, 94, 253, 162, 6,
+    178, 37, 212, 27, 10, 133, 120, 35, 236, 168, 163, 165, 84, 212, 105, 172,
+    254, 33, 103, 18, 239, 38, 131, 170, 76, 6, 114, 144, 213, 139, 176, 50,
+    173, 137, 143, 27, 153, 223, 74, 218, 225, 176, 16, 63, 78, 107, 93, 215,
+    33, 25, 215, 137, 50, 221, 120, 85, 253, 230, 145, 237, 255, 173, 112, 179,
+    207, 135, 239, 186, 205, 145, 98, 225, 121, 128, 251, 182, 221, 16, 203, 132,
+    32, 38, 168, 195, 154, 72, 245, 196, 88, 161, 135, 139, 186, 240, 6, 197,
+    120, 245, 27, 114, 201, 202, 193, 115, 196, 11, 239, 147, 22, 54, 197, 100,
+    51, 167, 89, 191, 172, 181, 131, 195, 37, 105, 32, 68, 186, 89, 144, 218,
+    4, 20, 143, 33, 56, 2, 243, 158, 4, 205, 21, 242, 84, 9, 61, 150,
+    11, 185, 116, 251, 80, 30, 201, 59, 15, 61, 233, 73, 180, 94, 181, 228,
+    69, 117, 71, 213, 234, 157, 209, 243, 99, 125, 27, 28, 8, 253, 96, 142,
+    137, 217, 119, 132, 226, 27, 116, 123, 106, 223, 222, 227, 185, 124, 91, 216,
+    248, 102, 1, 101, 4, 211, 127, 53, 175, 241, 151, 182, 252, 174, 158, 251,
+    87, 127, 13, 232, 218, 149, 228, 38, 160, 103, 127, 207, 206, 118, 108, 194,
+    173, 60, 211, 78, 91, 229, 147, 254, 99, 55, 184, 122, 149, 211, 134, 64,
+    23, 75, 170, 116, 92, 110, 99, 194, 220, 141, 188, 84, 202, 146, 183, 103,
+    252, 233, 100, 198, 22, 64, 81, 5, 32, 183, 255, 211, 167, 1, 144, 177,
+    146, 81, 55, 225, 162, 86, 182, 145, 226, 255, 150, 184, 174, 205, 155, 110,
+    64, 24, 244, 101, 12, 150, 141, 13, 144, 234, 54, 208, 110, 88, 43, 236,
+    176, 173, 102, 7, 133, 81, 242, 145, 9, 193, 108, 86, 53, 111, 29, 26,
+    185, 242, 244, 158, 32, 160, 12, 21, 119, 67, 15, 251, 134, 189, 11, 160,
+    44, 190, 94, 234, 253, 213, 104, 30, 170, 246, 59, 155, 123, 94, 127, 54,
+    237, 126, 66, 71, 139, 74, 19, 246, 148, 70, 219, 54, 75, 16, 58, 195,
+    90, 217, 159, 38, 223, 129, 210, 228, 206, 58, 6, 165, 93, 52, 120, 130,
+    141, 173, 122, 109, 71, 29, 158, 162, 66, 86, 18, 227, 251, 93, 64, 244,
+    5, 101, 90, 248, 188, 18, 88, 82, 76, 97, 148, 73, 113, 164, 102, 96,
+    85, 230, 78, 52, 37, 248, 118, 202, 92, 81, 183, 204, 112, 18, 179, 135,
+    9, 118, 33, 193, 252, 43, 174, 140, 104, 191, 66, 119, 99, 246, 35, 147,
+    140, 23, 218, 177, 168, 69, 179, 132, 239, 139, 149, 6, 203, 218, 170, 105,
+    49, 245, 224, 222, 148, 182, 94, 122, 113, 13, 243, 5, 235, 185, 190, 152,
+    15, 73, 68, 188, 154, 252, 124, 121, 126, 190, 211, 250, 129, 191, 218, 27,
+    90, 137, 10, 89, 15, 214, 249, 192, 195, 212, 159, 71, 93, 109, 187, 20,
+    204, 164, 217, 25, 82, 159, 161, 36, 182, 84, 124, 122, 166, 128, 22, 84,
+    29, 45, 41, 86, 164, 122, 251, 110, 250, 97, 76, 44, 185, 211, 48, 102,
+    231, 251, 216, 183, 6, 30, 70, 191, 191, 155, 50, 67, 43, 61, 68, 241,
+    13, 149, 87, 21, 14, 117, 72, 100, 38, 74, 22, 231, 37, 87, 83, 31,
+    203, 192, 8, 237, 67, 146, 46, 78, 57, 198, 148, 103, 106, 59, 51, 60,
+    169, 121, 191, 92, 83, 61, 255, 152, 144, 51, 42, 140, 123, 138, 50, 40,
+    62, 229, 154, 5, 215, 150, 80, 102, 93, 79, 21, 182, 170, 61, 171, 41,
+    138, 250, 65, 39, 125, 21, 183, 190, 165, 11, 89, 47, 194, 236, 134, 8,
+    197, 109, 128, 240, 58, 225, 113, 159, 13, 49, 92, 17, 255, 141, 168, 88,
+    200, 113, 206, 45, 21, 65, 99, 234, 219, 247, 162, 31, 243, 125, 237, 87,
+    147, 14, 221, 228, 249, 37, 88, 89, 96, 20, 142, 217, 10, 221, 69, 133,
+    216, 159, 45, 184, 39, 254, 190, 18, 225, 134, 61, 193, 244, 160, 185, 205,
+    94, 41, 175, 97, 21, 99, 103, 166, 191, 185, 60, 22, 104, 213, 23, 125,
+    233, 193, 234, 49, 159, 93, 55, 4, 220, 205, 152, 18, 12, 13, 80, 201,
+    67, 59, 194, 198, 147, 152, 78, 200, 95, 62, 177, 28, 21, 200, 246, 60,
+    141, 166, 231, 146, 187, 99, 252, 59, 171, 1, 167, 241, 54, 76, 43, 185,
+    38, 252, 55, 91, 239, 116, 139, 217, 12, 211, 210, 43, 187, 182, 138, 53,
+    18, 140, 80, 64, 95, 21, 163, 185, 169, 213, 13, 56, 228, 80, 188, 243,
+    34, 170, 197, 139, 240, 218, 206, 38, 169, 77, 90, 163, 117, 34, 52, 105,
+    248, 25, 84, 129, 220, 162, 228, 71, 81, 52, 197, 96, 146, 224, 255, 78,
+    241, 122, 83, 103, 244, 44, 62, 110, 248, 200, 56, 146, 178, 39, 11, 166,
+    12, 140, 216, 182, 70, 56, 43, 51, 27, 119, 38, 23, 13, 115, 79, 106,
+    230, 215, 238, 248, 159, 102, 92, 187, 21, 43, 252, 158, 121, 251, 49, 201,
+    243, 92, 82, 160, 171, 61, 28, 210, 20, 104, 107, 125, 208, 199, 131, 95,
+    54, 137, 240, 192, 225, 63, 248, 214, 230, 98, 23, 72, 49, 240, 217, 8,
+    102, 227, 82, 128, 232, 97, 119, 112, 194, 60, 83, 201, 81, 39, 148, 233,
+    70, 51, 15, 238, 147, 21, 254, 55, 132, 148, 160, 155, 214, 169, 104, 69,
+    38, 94, 35, 83, 188, 231, 89, 12, 121, 74, 181, 54, 20, 23, 240, 70,
+    197, 77, 91, 87, 168, 181, 210, 69, 225, 66, 206, 36, 218, 87, 63, 94,
+    174, 28, 137, 154, 30, 228, 209, 31, 179, 27, 7, 126, 176, 58, 178, 40,
+    29, 209, 171, 214, 81, 8, 244, 225, 195, 76, 27, 73, 152, 12, 228, 61,
+    183, 11, 125, 100, 71, 15, 3, 54, 47, 163, 148, 169, 223, 125, 32, 126,
+    156, 214, 186, 179, 63, 69, 7, 68, 138, 247, 52, 171, 208, 165, 25, 77,
+    224, 3, 244, 14, 90, 212, 125, 214, 106, 25, 89, 237, 44, 156, 128, 118,
+    66, 50, 179, 15, 100, 167, 240, 170, 231, 209, 63, 199, 227, 71, 224, 123,
+    131, 19, 195, 105, 135, 63, 196, 223, 242, 29, 235, 113, 190, 59, 175, 2,
+    118, 92, 32, 60, 128, 127, 91, 238, 68, 75, 23, 67, 246, 100, 42, 22,
+    50, 91, 189, 76, 66, 87, 209, 180, 167, 32, 139, 21, 64, 76, 77, 155,
+    41, 144, 247, 149, 176, 95, 19, 11, 105, 253, 12, 151, 240, 247, 54, 228,
+    143, 137, 159, 230, 91, 41, 151, 24, 82, 183, 157, 13, 78, 62, 147, 188,
+    23, 83, 228, 51, 28, 138, 229, 232, 69, 147, 79, 119, 63, 195, 165, 35,
+    149, 22, 195, 59, 44, 108, 151, 200, 102, 83, 178, 99, 69, 119, 27, 155,
+    74, 210, 64, 136, 105, 178, 61, 169, 8, 40, 3, 66, 105, 31, 223, 54,
+    62, 151, 71, 94, 1, 253, 214, 74, 226, 123, 236, 163, 63, 165, 169, 247,
+    220, 214, 68, 58, 184, 98, 57, 135, 112, 4, 251, 33, 8, 135, 42, 249,
+    168, 18, 122, 49, 22, 111, 232, 235, 160, 60, 143, 118, 30, 122, 207, 146,
+    117, 188, 119, 213, 140, 13, 231, 44, 26, 124, 250, 111, 207, 188, 30, 24,
+    177, 99, 31, 211, 213, 75, 102, 9, 171, 30, 182, 1, 197, 246, 77, 16,
+    138, 234, 142, 183, 201, 39, 191, 251, 198, 250, 54, 56, 16, 231, 192, 1,
+    15, 175, 238, 21, 217, 54, 232, 246, 212, 163, 161, 219, 118, 227, 146, 186,
+    219, 220, 111, 109, 161, 84, 82, 17, 183, 235, 55, 57, 122, 216, 7, 106,
+    108, 82, 145, 101, 100, 233, 155, 30, 111, 248, 182, 173, 237, 204, 2, 202,
+    8, 187, 254, 106, 67, 255, 51, 113, 229, 65, 33, 235, 174, 254, 26, 205,
+    169, 55, 213, 76, 147, 241, 170, 160, 255, 55, 210, 92, 111, 21, 154, 67,
+    228, 243, 196, 73, 144, 54, 200, 148, 27, 154, 99, 94, 25, 125, 239, 137,
+    93, 206, 254, 131, 129, 236, 216, 153, 71, 120, 187, 156, 182, 215, 59, 225,
+    198, 110, 109, 244, 55, 187, 17, 128, 46, 150, 73, 232, 161, 199, 226, 142,
+    147, 23, 8, 15, 32, 214, 223, 181, 17, 219, 204, 217, 179, 25, 132, 139,
+    130, 223, 104, 19, 158, 220, 115, 45, 184, 220, 198, 153, 165, 7, 101, 168,
+    137, 57, 115, 206, 229, 207, 200, 145, 44, 128, 162, 10, 64, 115, 227, 187,
+    83, 2, 61, 127, 68, 213, 218, 148, 183, 252, 181, 62, 238, 151, 23, 231,
+    66, 195, 63, 169, 89, 247, 75, 117, 245, 23, 154, 40, 227, 72, 7, 186,
+    57, 162, 110, 223, 89, 172, 113, 63, 217, 227, 49, 109, 65, 135, 43, 220,
+    128, 48, 245, 202, 24, 49, 7, 26, 61, 201, 108, 189, 197, 171, 114, 210,
+    75, 87, 161, 169, 190, 77, 85, 68, 230, 139, 220, 228, 245, 71, 28, 181,
+    173, 85, 126, 137, 141, 131, 86, 120, 220, 176, 86, 197, 125, 71, 204, 14,
+    23, 162, 249, 63, 18, 159, 216, 172, 106, 222, 58, 52, 111, 249, 245, 33,
+    64, 93, 24, 42, 32, 185, 74, 200, 111, 188, 28, 152, 112, 12, 157, 22,
+    181, 147, 47, 148, 31, 169, 211, 75, 218, 157, 140, 178, 240, 23, 34, 239,
+    238, 134, 30, 235, 17, 103, 22, 93, 88, 97, 188, 201, 231, 183, 208, 60,
+    73, 241, 118, 43, 246, 188, 254, 108, 199, 252, 132, 142, 18, 143, 2, 230,
+    3, 156, 198, 203, 63, 207, 216, 224, 64, 187, 39, 4, 60, 134, 159, 84,
+    67, 216, 135, 255, 119, 182, 190, 75, 11, 148, 38, 241, 53, 140, 171, 108,
+    150, 32, 116, 155, 180, 175, 35, 76, 163, 31, 185, 213, 129, 116, 12, 87,
+    186, 104, 240, 25, 247, 157, 58, 252, 39, 119, 123, 250, 241, 142, 16, 178,
+    19, 163, 212, 116, 214, 104, 80, 170, 52, 16, 117, 196, 10, 34, 202, 220,
+    7, 71, 244, 218, 142, 58, 33, 89, 132, 172, 36, 219, 235, 186, 128, 245,
+    10, 202, 180, 237, 101, 36, 176, 164, 152, 194, 53, 146, 251, 78, 232, 215,
+    156, 193, 241, 207, 227, 2, 64, 242, 76, 182, 119, 205, 127, 189, 93, 146,
+    208, 64, 201, 55, 40, 136, 15, 87, 226, 85, 204, 192, 170, 209, 156, 104,
+    74, 237, 236, 137, 184, 162, 115, 133, 224, 36, 123, 19, 18, 236, 66, 159,
+    229, 86, 65, 5, 30, 92, 208, 205, 184, 42, 76, 254, 45, 67, 136, 160,
+    31, 174, 132, 189, 149, 83, 146, 108, 167, 136, 59, 12, 85, 28, 123, 192,
+    208, 99, 132, 238, 198, 241, 70, 59, 5, 46, 169, 127, 77, 138, 123, 21,
+    195, 11, 55, 12, 139, 169, 73, 210, 98, 247, 221, 161, 44, 106, 152, 227,
+    212, 10, 150, 173, 98, 128, 205, 86, 234, 134, 140, 45, 182, 124, 222, 115,
+    62, 205, 48, 65, 210, 189, 231, 100, 53, 113, 188, 244, 226, 26, 251, 10,
+    203, 111, 97, 45, 30, 146, 136, 101, 41, 229, 248, 242, 252, 97, 187, 233,
+    31, 99, 169, 54, 201, 120, 160, 249, 240, 225, 43, 156, 172, 193, 5, 4,
+    185, 158, 127, 93, 92, 146, 17, 141, 73, 5, 194, 122, 175, 41, 147, 243,
+    180, 15, 20, 178, 30, 177, 239, 157, 155, 181, 35, 142, 186, 218, 107, 40,
+    133, 85, 175, 50, 164, 35, 95, 72, 113, 168, 248, 244, 72, 6, 8, 191,
+    12, 74, 63, 11, 252, 27, 71, 167, 29, 214, 156, 16, 240, 34, 70, 77,
+    17, 71, 38, 219, 193, 226, 194, 49, 81, 29, 44, 168, 58, 90, 82, 172,
+    85, 244, 235, 220, 233, 194, 152, 88, 111, 187, 96, 204, 211, 235, 173, 115,
+    12, 60, 140, 99, 173, 20, 48, 165, 40, 161, 130, 58, 50, 90, 143, 245,
+    78, 206, 111, 96, 26, 204, 137, 179, 102, 143, 212, 224, 188, 118, 182, 166,
+    99, 43, 100, 134, 86, 122, 136, 255, 26, 55, 174, 42, 28, 234, 144, 200,
+    76, 148, 44, 211, 74, 174, 166, 62, 139, 157, 16, 199, 159, 34, 120, 139,
+    68, 129, 88, 105, 125, 153, 202, 3, 187, 230, 103, 240, 57, 227, 197, 172,
+    255, 202, 223, 173, 59, 215, 42, 2, 134, 57, 92, 156, 114, 145, 53, 206,
+    212, 118, 102, 120, 79, 242, 99, 184, 166, 122, 227, 45, 61, 102, 84, 5,
+    246, 9, 100, 80, 122, 48, 64, 145, 96, 106, 229, 88, 179, 216, 2, 81,
+    232, 254, 148, 128, 211, 13, 10, 82, 136, 2, 45, 150, 70, 67, 94, 149,
+    124, 215, 41, 10, 179, 49, 160, 204, 186, 158, 42, 113, 73, 122, 75, 82,
+    9, 233, 130, 78, 250, 42, 115, 97, 87, 22, 178, 94, 128, 222, 53, 7,
+    161, 202, 112, 90, 221, 48, 78, 88, 238, 118, 188, 106, 124, 158, 107, 49,
+    79, 78, 10, 242, 231, 92, 136, 155, 153, 197, 17, 16, 151, 218, 29, 253,
+    116, 223, 226, 35, 26, 98, 184, 34, 227, 7, 77, 176, 141, 226, 129, 90,
+    42, 130, 198, 201, 101, 204, 13, 29, 133, 33, 205, 107, 19, 113, 134, 10,
+    189, 110, 79, 26, 150, 112, 164, 207, 56, 134, 248, 201, 154, 200, 252, 12,
+    171, 243, 89, 62, 251, 250, 199, 174, 59, 28, 167, 213, 239, 74, 176, 178,
+    192, 40, 1, 175, 20, 167, 138, 23, 173, 35, 90, 109, 87, 250, 69, 51,
+    233, 1, 23, 56, 92, 178, 195, 252, 72, 70, 71, 138, 181, 95, 232, 208,
+    161, 195, 243, 132, 29, 105, 96, 168, 78, 225, 97, 36, 223, 17, 122, 159,
+    245, 93, 111, 135, 188, 82, 67, 194, 42, 198, 206, 81, 99, 111, 120, 44,
+    208, 183, 46, 250, 178, 232, 125, 41, 205, 234, 170, 9, 146, 243, 11, 174,
+    27, 94, 180, 250, 95, 177, 39, 46, 214, 11, 1, 191, 96, 253, 20, 63,
+    207, 159, 201, 98, 35, 186, 110, 8, 165, 135, 45, 36, 24, 26, 160, 143,
+    134, 118, 153, 145, 59, 45, 156, 141, 190, 124, 127, 56, 51, 150, 213, 111,
+    49, 65, 190, 158, 194, 41, 73, 13, 191, 22, 87, 183, 243, 1, 112, 238,
+    142, 73, 229, 30, 14, 54, 69, 253, 42, 141, 241, 120, 7, 81, 211, 57,
+    107, 198, 229, 118, 75, 2, 83, 255, 108, 152, 86, 111, 76, 229, 110, 182,
+    195, 232, 11, 175, 214, 132, 237, 117, 21, 170, 3, 175, 12, 104, 129, 95,
+    236, 14, 164, 199, 25, 239, 191, 16, 249, 129, 23, 37, 115, 162, 49, 106,
+    24, 187, 185, 86, 107, 113, 9, 106, 36, 5, 160, 128, 190, 42, 91, 111,
+    79, 183, 26, 112, 213, 160, 101, 251, 68, 73, 151, 11, 228, 178, 165, 91,
+    121, 138, 217, 252, 67, 171, 196, 169, 25, 38, 172, 87, 58, 192, 243, 15,
+    96, 196, 28, 104, 244, 3, 173, 206, 253, 169, 129, 76, 79, 154, 180, 91,
+    234, 68, 104, 210, 237, 50, 168, 31, 165, 89, 213, 142, 162, 104, 151, 192,
+    57, 221, 227, 156, 1, 160, 157, 65, 93, 97, 100, 205, 141, 234, 12, 251,
+    74, 62, 95, 39, 208, 46, 60, 241, 23, 12, 238, 83, 137, 151, 217, 89,
+    255, 244, 166, 206, 245, 88, 124, 220, 237, 141, 112, 57, 121, 78, 22, 81,
+    24, 5, 173, 113, 140, 112, 86, 102, 54, 238, 76, 46, 3, 253, 186, 195,
+    231, 163, 172, 74, 138, 35, 20, 16, 222, 66, 225, 105, 109, 114, 68, 14,
+    57, 20, 47, 245, 134, 164, 118, 235, 26, 230, 158, 212, 209, 179, 193, 237,
+    35, 204, 184, 107, 42, 86, 229, 33, 242, 235, 98, 143, 251, 184, 164, 93,
+    75, 122, 56, 185, 230, 239, 130, 217, 195, 72, 17, 123, 68, 98, 220, 66,
+    141, 90, 18, 25, 135, 156, 139, 240, 78, 220, 221, 206, 251, 48, 2, 124,
+    40, 208, 214, 250, 189, 147, 27, 190, 108, 15, 253, 157, 223, 126, 237, 177,
+    209, 196, 46, 144, 98, 253, 175, 16, 204, 219, 164, 29, 212, 217, 202, 247,
+    175, 104, 203, 40, 11, 161, 153, 180, 120, 114, 26, 137, 164, 179, 199, 239,
+    215, 153, 214, 131, 124, 145, 158, 216, 205, 194, 238, 224, 153, 120, 166, 143,
+    162, 78, 53, 207, 140, 102, 30, 193, 59, 42, 225, 110, 21, 53, 93, 43,
+    177, 79, 208, 138, 49, 203, 242, 237, 139, 131, 118, 25, 197, 224, 81, 230,
+    43, 106, 233, 249, 78, 93, 8, 17, 160, 81, 36, 184, 1, 5, 234, 79,
+    76, 188, 70, 166, 101, 211, 178, 24, 242, 148, 119, 108, 40, 46, 253, 140,
+    151, 154, 182, 174, 77, 119, 185, 138, 223, 132, 129, 72, 176, 181, 90, 171,
+    119, 40, 98, 142, 149, 58, 19, 69, 143, 34, 10, 180, 226, 237, 95, 209,
+    248, 19, 192, 25, 111, 206, 187, 141, 169, 174, 126, 188, 65, 56, 15, 41,
+    60, 213, 191, 62, 123, 54, 14, 252, 125, 116, 121, 80, 58, 191, 75, 177,
+    162, 16, 245, 223, 85, 167, 98, 177, 83, 195, 223, 191, 91, 123, 219, 23,
+    220, 58, 249, 196, 8, 3, 144, 47, 143, 219, 50, 34, 18, 90, 207, 26,
+    155, 152, 54, 146, 45, 24, 213, 122, 115, 22, 250, 200, 142, 30, 6, 108,
+    94, 91, 53, 79, 163, 250, 64, 252, 37, 177, 105, 123, 103, 145, 42, 159,
+    63, 227, 5, 236, 20, 184, 158, 225, 41, 18, 241, 84, 43, 44, 220, 48,
+    22, 158, 57, 111, 149, 251, 83, 190, 126, 138, 14, 136, 9, 243, 104, 75,
+    189, 87, 50, 154, 221, 6, 245, 28, 180, 181, 250, 177, 212, 50, 178, 199,
+    88, 37, 29, 236, 130, 131, 18, 133, 27, 8, 184, 221, 218, 249, 86, 179,
+    122, 10, 2, 36, 193, 194, 19, 206, 97, 86, 203, 84, 232, 111, 39, 41,
+    132, 100, 123, 30, 200, 83, 253, 73, 211, 191, 126, 147, 219, 142, 221, 246,
+    27, 38, 155, 210, 19, 126, 149, 163, 249, 58, 203, 226, 120, 109, 103, 19,
+    218, 168, 45, 223, 180, 17, 26, 186, 124, 130, 42, 206, 110, 81, 114, 173,
+    166, 26, 236, 48, 73, 112, 241, 39, 97, 118, 67, 4, 236, 184, 64, 120,
+    29, 254, 182, 193, 136, 150, 46, 134, 241, 200, 84, 44, 100, 182, 103, 152,
+    132, 174, 191, 117, 157, 127, 95, 9, 254, 67, 144, 238, 122, 80, 210, 232,
+    47, 154, 217, 190, 132, 191, 189, 83, 209, 210, 30, 11, 52, 228, 133, 176,
+    83, 64, 11, 42, 128, 152, 154, 43, 82, 61, 243, 55, 125, 190, 38, 22,
+    210, 231, 24, 51, 253, 243, 108, 213, 3, 15, 35, 209, 175, 73, 23, 39,
+    146, 99, 74, 189, 53, 147, 151, 30, 218, 178, 209, 46, 167, 144, 241, 76,
+    72, 151, 21, 70, 179, 69, 25, 20, 182, 82, 51, 48, 164, 115, 39, 26,
+    156, 124, 59, 101, 46, 166, 213, 102, 56, 9, 215, 205, 138, 59, 158, 238,
+    126, 155, 87, 70, 74, 91, 47, 61, 182, 136, 247, 140, 251, 210, 95, 76,
+    137, 170, 34, 94, 77, 126, 62, 178, 63, 95, 231, 125, 206, 209, 109, 131,
+    55, 44, 155, 118, 88, 216, 51, 141, 204, 166, 121, 198, 138, 238, 54, 43,
+    148, 185, 128, 13, 210, 121, 122, 79, 16, 80, 6, 132, 203, 37, 135, 123,
+    74, 35, 227, 27, 171, 8, 29, 239, 45, 226, 193, 19, 225, 206, 105, 114,
+    103, 29, 3, 220, 160, 26, 60, 65, 210, 62, 163, 108, 124, 51, 142, 188,
+    2, 231, 177, 148, 217, 246, 197, 91, 126, 87, 79, 243, 165, 177, 136, 116,
+    109, 196, 114, 19, 46, 55, 191, 97, 110, 200, 94, 42, 101, 73, 213, 189,
+    126, 250, 50, 99, 11, 32, 166, 140, 16, 213, 241, 231, 221, 142, 72, 214,
+    224, 8, 235, 66, 16, 19, 84, 239, 77, 36, 244, 98, 44, 222, 205, 203,
+    93, 120, 3, 236, 60, 244, 131, 57, 234, 101, 238, 183, 28, 1, 247, 79,
+    2, 232, 132, 121, 42, 138, 144, 75, 139, 210, 58, 243, 40, 15, 234, 147,
+    137, 144, 250, 170, 90, 47, 212, 114, 5, 26, 211, 88, 52, 248, 233, 222,
+    131, 101, 60, 48, 127, 198, 62, 187, 183, 150, 204, 18, 75, 60, 113, 2,
+    151, 241, 154, 32, 249, 19, 207, 85, 38, 3, 57, 72, 228, 203, 88, 25,
+    216, 202, 201, 131, 194, 225, 37, 109, 254, 88, 8, 145, 39, 187, 160, 229,
+    9, 201, 1, 115, 143, 78, 99, 235, 145, 233, 108, 112, 32, 211, 157, 2,
+    30, 67, 193, 42, 175, 108, 205, 241, 181, 91, 95, 171, 245, 192, 29, 126,
+    157, 181, 179, 125, 246, 71, 8, 89, 135, 223, 106, 58, 107, 52, 40, 85,
+    26, 8, 180, 98, 5, 17, 101, 110, 236, 219, 57, 105, 171, 165, 222, 218,
+    95, 168, 164, 34, 115, 203, 110, 114, 244, 173, 14, 212, 216, 164, 63, 202,
+    200, 207, 43, 60, 16, 210, 37, 100, 185, 94, 14, 76, 56, 6, 192, 11,
+    212, 199, 153, 74, 129, 218, 231, 171, 109, 192, 70, 89, 120, 133, 17, 249,
+    222, 237, 113, 71, 199, 133, 4, 137, 16, 107, 225, 212, 134, 227, 102, 226,
+    215, 130, 66, 203, 65, 225, 52, 135, 79, 110, 183, 152, 34, 228, 109, 74,
+    213, 126, 212, 31, 119, 197, 133, 253, 33, 239, 145, 218, 162, 245, 171, 180,
+    244, 133, 77, 20, 255, 36, 141, 93, 59, 255, 73, 93, 227, 110, 185, 184,
+    222, 42, 41, 134, 213, 251, 149, 146, 61, 108, 141, 53, 54, 41, 198, 188,
+    50, 250, 195, 15, 199, 246, 85, 80, 241, 149, 105, 46, 185, 132, 77, 175,
+    114, 247, 98, 170, 72, 27, 100, 74, 131, 77, 191, 47, 130, 176, 249, 202,
+    186, 129, 225, 27, 31, 197, 173, 47, 142, 240, 107, 37, 113, 179, 118, 223,
+    145, 220, 218, 245, 110, 107, 34, 29, 92, 49, 146, 205, 70, 136, 253, 22,
+    13, 62, 125, 185, 233, 94, 15, 12, 214, 191, 129, 231, 228, 171, 51, 138,
+    219, 15, 91, 142, 236, 123, 168, 8, 95, 147, 217, 1, 59, 46, 16, 30,
+    64, 177, 163, 119, 34, 171, 133, 175, 123, 50, 21, 11, 25, 163, 208, 38,
+    33, 165, 230, 90, 163, 154, 197, 12, 41, 213, 192, 136, 39, 31, 199, 94,
+    133, 167, 114, 151, 14, 69, 252, 116, 172, 199, 169, 181, 145, 239, 220, 159,
+    109, 165, 145, 47, 87, 14, 202, 77, 15, 114, 230, 129, 215, 131, 141, 63,
+    88, 29, 89, 20, 128, 230, 219, 107, 166, 4, 122, 254, 145, 172, 141, 34,
+    69, 245, 26, 219, 104, 220, 130, 168, 112, 143, 122, 7, 45, 106, 176, 107,
+    53, 130, 162, 248, 22, 78, 64, 59, 136, 183, 169, 53, 115, 229, 119, 124,
+    193, 51, 46, 211, 132, 155, 126, 79, 178, 243, 150, 234, 247, 46, 41, 80,
+    219, 144, 14, 105, 116, 190, 181, 56, 97, 30, 167, 234, 166, 157, 74, 250,
+    35, 151, 137, 119, 199, 132, 127, 149, 66, 74, 80, 195, 107, 218, 52, 172,
+    114, 89, 220, 163, 178, 69, 226, 126, 175, 219, 98, 218, 130, 19, 86, 165,
+    29, 96, 247, 137, 48, 98, 14, 52, 122, 143, 216, 103, 142, 80, 192, 174,
+    160, 190, 50, 232, 200, 117, 6, 243, 37, 31, 161, 157, 104, 23, 30, 246,
+    133, 6, 119, 167, 202, 197, 226, 162, 151, 75, 228, 185, 150, 174, 95, 79,
+    97, 154, 170, 136, 209, 11, 165, 213, 247, 142, 56, 119, 71, 170, 252, 15,
+    7, 27, 172, 240, 107, 66, 248, 180, 132, 85, 143, 217, 6, 52, 206, 161,
+    118, 7, 82, 237, 130, 249, 209, 8, 242, 206, 133, 156, 183, 81, 150, 53,
+    165, 125, 172, 151, 250, 142, 133, 28, 46, 89, 239, 126, 36, 35, 173, 69,
+    212, 161, 116, 104, 222, 239, 247, 66, 128, 186, 48, 84, 89, 116, 176, 154,
+    232, 117, 85, 138, 73, 247, 139, 87, 131, 47, 90, 125, 161, 214, 157, 23,
+    107, 139, 142, 209, 48, 240, 10, 145, 64, 111, 148, 141, 222, 101, 56, 45,
+    224, 24, 39, 44, 119, 59, 94, 53, 62, 79, 187, 150, 169, 39, 5, 121,
+    253, 46, 68, 195, 188, 102, 136, 128, 204, 158, 232, 187, 135, 182, 67, 5,
+    208, 55, 169, 13, 75, 56, 82, 233, 28, 67, 124, 234, 77, 100, 126, 6,
+    193, 17, 60, 203, 34, 206, 44, 186, 176, 194, 101, 143, 211, 115, 189, 120,
+    146, 255, 236, 86, 241, 101, 225, 216, 147, 229, 21, 1, 61, 24, 32, 198,
+    48, 53, 252, 44, 215, 108, 1, 166, 116, 127, 74, 64, 231, 136, 5, 41,
+    68, 1, 152, 75, 35, 175, 47, 196, 36, 3, 4, 209, 6, 37, 145, 139,
+    126, 131, 173, 221, 128, 107, 78, 8, 120, 17, 35, 168, 134, 173, 19, 227,
+    238, 113, 97, 150, 216, 10, 24, 220, 20, 222, 65, 29, 25, 45, 201, 244,
+    39, 103, 185, 48, 13, 102, 202, 215, 51, 201, 106, 112, 94, 59, 91, 83,
+    22, 53, 76, 255, 106, 5, 75, 216, 49, 64, 232, 43, 117, 67, 70, 152,
+    91, 62, 111, 183, 31, 232, 24, 174, 105, 208, 253, 50, 234, 60, 80, 242,
+    120, 254, 155, 78, 86, 238, 140, 2, 210, 79, 177, 160, 46, 73, 134, 200,
+    170, 140, 97, 61, 217, 154, 199, 247, 243, 39, 116, 229, 78, 238, 246, 233,
+    255, 1, 32, 121, 38, 91, 181, 232, 177, 208, 160, 73, 104, 32, 234, 149,
+    20, 68, 137, 165, 15, 46, 104, 232, 92, 21, 38, 127, 152, 175, 68, 80,
+    129, 87, 66, 208, 196, 167, 73, 54, 221, 68, 147, 6, 164, 14, 179, 96,
+    14, 142, 245, 169, 1, 116, 66, 178, 21, 69, 72, 171, 203, 105, 29, 247,
+    20, 137, 117, 199, 202, 72, 125, 85, 45, 153, 106, 57, 242, 135, 233, 164,
+    19, 143, 146, 36, 114, 235, 44, 130, 108, 101, 234, 207, 97, 254, 156, 184,
+    127, 44, 4, 198, 157, 211, 80, 252, 235, 156, 205, 179, 37, 159, 255, 131,
+    219, 4, 128, 249, 152, 113, 238, 135, 254, 103, 186, 57, 189, 128, 143, 110,
+    80, 13, 30, 174, 23, 149, 209, 190, 55, 100, 47, 21, 188, 170, 228, 208,
+    63, 125, 25, 191, 139, 16, 83, 70, 8, 228, 246, 253, 224, 71, 36, 107,
+    217, 170, 133, 157, 73, 191, 37, 208, 148, 199, 197, 15, 109, 89, 230, 23,
+    221, 72, 246, 38, 36, 197, 132, 35, 215, 172, 130, 10, 37, 163, 153, 144,
+    91, 68, 245, 70, 243, 105, 161, 38, 202, 85, 17, 47, 168, 63, 31, 89,
+    145, 161, 253, 176, 103, 230, 184, 207, 60, 184, 189, 135, 109, 84, 152, 225,
+    90, 134, 13, 93, 62, 65, 21, 103, 55, 166, 57, 216, 83, 13, 118, 24,
+    170, 56, 246, 157, 192, 177, 161, 138, 127, 175, 72, 119, 61, 40, 105, 116,
+    153, 77, 226, 95, 66, 209, 208, 167, 230, 105, 15, 139, 26, 114, 204, 88,
+    189, 198, 21, 193, 145, 255, 140, 118, 10, 92, 79, 254, 154, 9, 246, 42,
+    155, 22, 110, 24, 11, 79, 146, 185, 196, 243, 167, 95, 65, 207, 9, 204,
+    131, 4, 92, 224, 109, 242, 43, 215, 61, 5, 1, 18, 238, 97, 135, 103,
+    190, 43, 235, 42, 116, 185, 157, 154, 88, 212, 45, 219, 181, 20, 49, 71,
+    196, 29, 135, 172, 201, 17, 5, 90, 113, 248, 161, 230, 124, 135, 96, 130,
+    185, 103, 211, 200, 164, 221, 49, 214, 167, 239, 225, 209, 163, 179, 227, 133,
+    110, 29, 242, 98, 4, 143, 72, 153, 201, 227, 25, 17, 9, 45, 233, 13,
+    106, 226, 101, 245, 217, 52, 235, 20, 139, 222, 194, 90, 60, 57, 13, 202,
+    82, 215, 237, 249, 229, 194, 107, 207, 62, 198, 79, 108, 150, 235, 121, 248,
+    203, 207, 59, 130, 236, 112, 166, 115, 155, 53, 250, 242, 39, 160, 4, 134,
+    80, 166, 18, 92, 142, 140, 117, 169, 143, 240, 93, 239, 253, 223, 86, 37,
+    69, 159, 10, 8, 111, 33, 254, 186, 184, 57, 34, 7, 146, 10, 153, 244,
+    67, 82, 59, 251, 115, 249, 65, 226, 239, 36, 134, 179, 34, 49, 110, 33,
+    200, 45, 9, 130, 205, 78, 203, 120, 39, 110, 224, 103, 243, 24, 1, 62,
+    117, 30, 40, 121, 60, 127, 195, 39, 43, 119, 70, 1, 105, 169, 214, 80,
+    23, 170, 67, 100, 85, 70, 190, 144, 226, 77, 237, 245, 137, 23, 52, 116,
+    46, 132, 19, 177, 76, 217, 34, 40, 206, 165, 33, 104, 98, 221, 170, 27,
+    224, 34, 199, 3, 82, 7, 215, 48, 144, 12, 16, 99, 24, 148, 126, 22,
+    229, 54, 142, 83, 58, 177, 37, 32, 253, 68, 140, 154, 34, 142, 76, 171,
+    159, 217, 153, 98, 108, 5, 12, 110, 10, 111, 174, 128, 130, 152, 234, 122,
+    157, 189, 210, 24, 136, 51, 101, 229, 151, 234, 53, 56, 47, 147, 163, 167,
+    162, 58, 88, 77, 116, 180, 164, 69, 170, 245, 203, 165, 207, 153, 45, 176,
+    222, 107, 192, 133, 187, 203, 71, 230, 24, 120, 5, 198, 94, 51, 68, 64,
+    102, 79, 116, 211, 205, 91, 175, 140, 104, 149, 218, 136, 171, 28, 41, 250,
+    14, 175, 62, 117, 168, 50, 63, 3, 71, 40, 96, 87, 80, 95, 25, 116,
+    100, 180, 3, 247, 156, 129, 222, 192, 52, 133, 15, 123, 204, 3, 181, 221,
+    101, 236, 113, 81, 187, 33, 124, 90, 66, 164, 201, 226, 3, 26, 103, 222,
+    59, 141, 41, 248, 65, 242, 230, 4, 121, 103, 204, 78, 213, 166, 75, 148,
+    198, 86, 200, 17, 172, 244, 13, 227, 52, 110, 65, 84, 56, 201, 61, 141,
+    152, 53, 88, 187, 148, 65, 81, 124, 11, 39, 32, 147, 58, 95, 212, 28,
+    190, 15, 221, 117, 83, 192, 37, 125, 159, 197, 202, 181, 237, 66, 177, 196,
+    33, 37, 40, 239, 187, 109, 26, 86, 35, 68, 240, 11, 136, 31, 176, 210,
+    250, 47, 137, 6, 107, 209, 206, 253, 114, 219, 151, 69, 227, 137, 163, 71,
+    118, 179, 84, 4, 223, 77, 236, 6, 154, 228, 96, 68, 157, 129, 237, 47,
+    204, 221, 57, 197, 7, 172, 126, 58, 86, 237, 218, 212, 198, 249, 110, 193,
+    17, 114, 184, 37, 228, 63, 106, 129, 181, 236, 204, 240, 158, 249, 198, 109,
+    81, 244, 219, 90, 122, 204, 168, 10, 241, 18, 200, 160, 237, 123, 164, 40,
+    246, 196, 186, 23, 210, 66, 168, 217, 57, 245, 49, 85, 36, 131, 50, 37,
+    207, 168, 209, 153, 65, 88, 242, 101, 244, 96, 128, 63, 192, 212, 215, 176,
+    123, 173, 4, 162, 205, 225, 53, 29, 187, 26, 20, 164, 13, 4, 90, 49,
+    140, 134, 188, 55, 8, 105, 156, 50, 210, 47, 7, 38, 28, 3, 96, 139,
+    106, 237, 194, 37, 206, 109, 253, 219, 184, 96, 35, 162, 60, 204, 134, 242,
+    248, 179, 82, 20, 123, 98, 93, 133, 105, 33, 84, 226, 146, 244, 150, 164,
+    18, 207, 25, 156, 233, 84, 230, 194, 174, 44, 121, 188, 4, 186, 78, 25,
+    105, 153, 141, 19, 14, 143, 48, 203, 53, 248, 97, 156, 103, 184, 240, 227,
+    92, 48, 159, 81, 30, 102, 67, 121, 29, 161, 106, 14, 95, 137, 224, 180,
+    167, 96, 156, 176, 193, 236, 101, 212, 248, 33, 214, 98, 158, 156, 20, 249,
+    211, 184, 13, 43, 225, 168, 118, 3, 77, 114, 48, 34, 192, 206, 248, 153,
+    102, 224, 146, 236, 141, 86, 63, 29, 43, 248, 109, 106, 99, 242, 55, 238,
+    47, 151, 34, 32, 51, 169, 58, 231, 232, 163, 217, 70, 52, 196, 109, 68,
+    219, 14, 154, 125, 7, 217, 31, 180, 84, 25, 145, 143, 211, 158, 62, 45,
+    33, 82, 234, 113, 143, 13, 189, 111, 147, 200, 154, 124, 174, 121, 115, 2,
+    178, 189, 102, 39, 228, 83, 171, 74, 202, 133, 26, 58, 23, 66, 135, 214,
+    38, 226, 17, 20, 103, 220, 158, 52, 49, 224, 85, 131, 112, 17, 237, 143,
+    41, 141, 229, 24, 54, 140, 6, 55, 5, 185, 87, 64, 65, 76, 117, 61,
+    192, 208, 105, 12, 68, 151, 188, 252, 197, 117, 148, 28, 153, 199, 223, 221,
+    75, 251, 178, 124, 235, 233, 147, 65, 118, 56, 83, 183, 195, 148, 125, 121,
+    157, 80, 2, 67, 40, 83, 9, 46, 71, 70, 180, 218, 183, 242, 174, 113,
+    249, 18, 67, 215, 17, 150, 55, 158, 100, 152, 138, 65, 232, 39, 235, 60,
+    157, 55, 112, 189, 247, 12, 142, 31, 174, 233, 138, 102, 207, 2, 46, 112,
+    184, 121, 155, 229, 144, 140, 142, 9, 119, 190, 205, 189, 95, 155, 251, 21,
+    58, 210, 192, 77, 82, 224, 150, 107, 221, 249, 254, 230, 223, 215, 255, 204,
+    55, 128, 121, 49, 2, 201, 36, 194, 234, 255, 130, 134, 138, 152, 250, 136,
+    156, 223, 194, 72, 163, 34, 244, 35, 247, 186, 222, 19, 101, 164, 134, 153,
+    84, 145, 129, 162, 198, 222, 240, 88, 189, 115, 92, 233, 96, 214, 222, 69,
+    177, 217, 36, 181, 144, 20, 186, 58, 194, 168, 113, 161, 33, 230, 104, 221,
+    115, 186, 137, 203, 13, 57, 102, 44, 121, 205, 250, 82, 135, 201, 73, 18,
+    57, 251, 22, 65, 54, 188, 117, 233, 190, 127, 78, 92, 177, 22, 2, 99,
+    192, 231, 40, 126, 133, 196, 230, 95, 149, 50, 153, 132, 94, 85, 114, 104,
+    145, 176, 130, 209, 203, 8, 167, 35, 4, 114, 123, 240, 112, 173, 18, 187,
+    131, 35, 143, 196, 70, 105, 220, 16, 87, 19, 90, 72, 48, 52, 93, 3,
+    17, 236, 47, 63, 118, 90, 37, 7, 97, 248, 254, 112, 127, 42, 147, 201,
+    84, 146, 12, 134, 48, 189, 62, 97, 151, 56, 170, 59, 100, 155, 198, 64,
+    195, 62, 92, 148, 209, 178, 196, 181, 102, 49, 183, 222, 98, 130, 97, 33,
+    153, 82, 146, 26, 99, 44, 174, 115, 251, 2, 224, 193, 1, 146, 215, 60,
+    28, 108, 138, 231, 154, 56, 171, 211, 112, 121, 177, 183, 254, 252, 246, 51,
+    196, 32, 89, 75, 142, 117, 9, 190, 180, 246, 174, 175, 172, 38, 176, 34,
+    84, 7, 255, 240, 14, 162, 187, 114, 214, 145, 215, 236, 150, 4, 166, 227,
+    216, 45, 172, 222, 152, 215, 220, 113, 155, 205, 22, 67, 168, 14, 227, 253,
+    28, 89, 107, 228, 177, 63, 179, 197, 49, 8, 81, 219, 173, 90, 69, 161,
+    45, 179, 165, 226, 43, 135, 44, 134, 177, 21, 199, 234, 42, 73, 6, 67,
+    24, 208, 31, 190, 197, 28, 85, 147, 50, 195, 99, 32, 239, 31, 46, 74,
+    230, 89, 98, 212, 77, 28, 219, 231, 56, 178, 214, 213, 127, 126, 123, 151,
+    98, 16, 162, 171, 71, 180, 138, 95, 90, 123, 87, 217, 86, 19, 88, 17,
+    48, 107, 111, 172, 214, 226, 18, 212, 72, 10, 93, 29, 97, 84, 182, 222,
+    158, 115, 52, 224, 183, 93, 202, 235, 136, 146, 51, 22, 204, 98, 115, 161,
+    196, 25, 194, 66, 47, 164, 57, 52, 198, 88, 65, 230, 235, 4, 221, 159,
+    2, 57, 179, 120, 56, 216, 9, 211, 213, 121, 87, 182, 242, 9, 175, 229,
+    134, 75, 149, 79, 50, 76, 69, 174, 116, 157, 251, 30, 192, 149, 56, 208,
+    245, 6, 71, 129, 41, 112, 75, 187, 224, 242, 127, 115, 225, 229, 241, 102,
+    149, 64, 178, 150, 1, 234, 18, 97, 117, 241, 65, 67, 69, 76, 125, 68,
+    231, 79, 31, 152, 158, 41, 117, 182, 201, 136, 208, 185, 199, 100, 77, 62,
+    87, 178, 183, 1, 89, 208, 51, 157, 114, 167, 219, 37, 27, 70, 3, 149,
+    140, 210, 165, 32, 174, 38, 180, 144, 96, 104, 186, 6, 34, 197, 94, 126,
+    236, 180, 74, 14, 194, 237, 225, 224, 2, 93, 39, 130, 186, 194, 200, 135,
+    7, 201, 24, 235, 148, 124, 190, 78, 189, 92, 120, 255, 46, 24, 193, 166,
+    15, 51, 175, 178, 254, 84, 59, 143, 168, 57, 24, 17, 96, 103, 124, 194,
+    51, 112, 73, 118, 200, 43, 145, 128, 155, 124, 184, 53, 191, 121, 149, 119,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 212, 246,
+    77, 73, 195, 192, 75, 98, 5, 70, 103, 177, 22, 217, 138, 51, 181, 246,
+    72, 25, 18, 46, 228, 74, 216, 195, 11, 106, 130, 150, 181, 241, 154, 146,
+    155, 157, 150, 196, 10, 140, 206, 127, 44, 175, 9, 102, 119, 241, 144, 50,
+    36, 92, 213, 148, 173, 155, 22, 212, 25, 49, 97, 7, 215, 219, 88, 93,
+    221, 166, 15, 202, 169, 206, 58, 118, 131, 85, 194, 7, 216, 43, 54, 114,
+    49, 222, 117, 88, 29, 190, 155, 167, 119, 255, 41, 57, 43, 39, 49, 149,
+    20, 5, 129, 254, 88, 67, 18, 204, 238, 255, 61, 100, 72, 184, 183, 53,
+    71, 43, 44, 181, 50, 98, 163, 9, 100, 112, 232, 231, 122, 247, 17, 67,
+    230, 79, 78, 154, 152, 255, 91, 9, 117, 125, 90, 150, 83, 127, 159, 232,
+    39, 223, 176, 244, 194, 14, 179, 171, 176, 186, 167, 81, 30, 137, 79, 129,
+    116, 236, 27, 170, 153, 14, 173, 86, 108, 228, 98, 161, 234, 176, 58, 97,
+    43, 83, 22, 248, 254, 226, 115, 122, 236, 51, 27, 207, 40, 48, 98, 53,
+    145, 153, 44, 248, 229, 79, 126, 202, 134, 235, 50, 115, 49, 11, 169, 197,
+    238, 227, 82, 114, 86, 78, 98, 55, 40, 10, 31, 225, 176, 134, 36, 133,
+    193, 227, 122, 200, 144, 109, 115, 106, 142, 86, 88, 119, 100, 196, 58, 21,
+    31, 59, 149, 142, 41, 85, 45, 76, 120, 80, 166, 95, 174, 182, 116, 21,
+    50, 209, 130, 67, 151, 32, 86, 149, 83, 29, 230, 82, 91, 18, 200, 224,
+    205, 211, 244, 243, 34, 134, 209, 158, 156, 41, 45, 227, 182, 18, 234, 250,
+    180, 49, 166, 254, 35, 205, 78, 163, 125, 245, 143, 228, 133, 169, 14, 19,
+    191, 145, 39, 192, 182, 47, 138, 240, 167, 208, 3, 228, 162, 227, 166, 31,
+    66, 180, 251, 14, 69, 201, 255, 99, 153, 28, 123, 75, 125, 105, 83, 162,
+    60, 15, 158, 31, 232, 197, 54, 73, 47, 28, 71, 172, 216, 213, 196, 95,
+    201, 125, 116, 194, 86, 166, 77, 234, 54, 2, 190, 169, 24, 192, 57, 73,
+    249, 174, 254, 28, 188, 122, 154, 234, 15, 181, 202, 251, 32, 21, 17, 190,
+    127, 168, 212, 48, 44, 237, 225, 217, 230, 244, 197, 102, 54, 131, 80, 96,
+    196, 106, 63, 47, 88, 237, 215, 158, 252, 137, 17, 203, 100, 230, 98, 22,
+    79, 151, 248, 27, 172, 144, 37, 52, 142, 4, 51, 197, 55, 209, 210, 179,
+    181, 28, 237, 27, 159, 135, 238, 167, 245, 129, 188, 37, 105, 124, 205, 1,
+    193, 219, 164, 228, 172, 156, 196, 110, 80, 20, 62, 223, 125, 17, 72, 23,
+    159, 219, 244, 141, 61, 218, 230, 212, 1, 172, 176, 238, 200, 149, 21, 45,
+    233, 173, 111, 92, 143, 12, 85, 82, 89, 110, 107, 200, 194, 36, 42, 45,
+    188, 148, 47, 244, 2, 158, 217, 111, 187, 132, 74, 3, 116, 42, 62, 118,
+    55, 1, 82, 170, 90, 152, 240, 160, 81, 190, 65, 113, 232, 42, 100, 191,
+    25, 134, 51, 64, 172, 55, 166, 58, 209, 164, 160, 220, 115, 63, 244, 193,
+    25, 200, 95, 222, 151, 17, 71, 103, 203, 66, 93, 220, 44, 166, 11, 168,
+    215, 10, 116, 244, 173, 80, 83, 50, 182, 36, 141, 221, 135, 187, 245, 251,
+    68, 17, 191, 33, 37, 82, 90, 219, 113, 36, 201, 233, 117, 98, 81, 225,
+    70, 135, 156, 91, 250, 247, 98, 210, 192, 148, 68, 123, 190, 153, 65, 87,
+    216, 144, 51, 139, 208, 232, 196, 210, 129, 240, 103, 76, 181, 171, 158, 68,
+    151, 49, 120, 97, 3, 213, 23, 79, 28, 38, 99, 63, 78, 157, 113, 94,
+    9, 253, 83, 189, 6, 213, 89, 219, 81, 62, 132, 117, 235, 28, 138, 143,
+    227, 198, 215, 35, 90, 6, 223, 230, 40, 93, 75, 219, 22, 239, 31, 36,
+    217, 142, 179, 35, 17, 194, 67, 16, 96, 63, 51, 223, 129, 229, 97, 80,
+    47, 56, 246, 150, 250, 210, 166, 89, 120, 30, 33, 62, 205, 151, 108, 146,
+    94, 56, 142, 69, 173, 183, 149, 190, 143, 250, 232, 153, 172, 81, 251, 206,
+    187, 223, 57, 18, 237, 59, 125, 88, 70, 143, 219, 78, 230, 161, 235, 206,
+    198, 92, 191, 153, 113, 244, 87, 57, 227, 243, 46, 199, 154, 201, 108, 4,
+    97, 79, 48, 157, 114, 146, 239, 65, 225, 56, 101, 244, 41, 201, 30, 119,
+    137, 235, 64, 42, 34, 97, 254, 77, 181, 96, 78, 63, 33, 77, 162, 143,
+    123, 255, 119, 212, 136, 240, 247, 225, 239, 199, 156, 63, 86, 110, 155, 197,
+    164, 96, 250, 162, 245, 39, 55, 246, 88, 199, 223, 175, 209, 245, 151, 204,
+    108, 27, 160, 192, 149, 212, 126, 94, 176, 199, 179, 33, 229, 15, 34, 139,
+    200, 209, 196, 44, 158, 51, 140, 49, 146, 230, 18, 53, 220, 174, 105, 93,
+    199, 113, 131, 13, 244, 109, 5, 49, 251, 56, 247, 33, 198, 193, 16, 18,
+    207, 70, 28, 165, 237, 54, 69, 61, 74, 104, 1, 8, 102, 151, 110, 191,
+    185, 123, 119, 56, 199, 54, 35, 19, 193, 83, 247, 31, 101, 74, 210, 248,
+    135, 2, 57, 192, 8, 116, 137, 168, 74, 106, 99, 209, 9, 14, 175, 162,
+    253, 11, 114, 192, 107, 10, 211, 125, 19, 85, 189, 137, 217, 146, 5, 148,
+    159, 171, 85, 213, 69, 37, 149, 220, 160, 40, 124, 163, 250, 34, 144, 46,
+    35, 171, 245, 7, 122, 169, 209, 181, 2, 69, 125, 193, 141, 55, 75, 93,
+    24, 156, 134, 229, 222, 190, 165, 110, 27, 18, 236, 251, 26, 29, 150, 93,
+    189, 30, 104, 135, 53, 255, 218, 134, 118, 171, 15, 161, 42, 90, 207, 71,
+    222, 184, 3, 24, 170, 164, 178, 220, 214, 141, 153, 72, 84, 90, 101, 53,
+    94, 245, 4, 33, 175, 222, 107, 21, 148, 6, 254, 172, 130, 14, 29, 120,
+    72, 122, 175, 226, 213, 109, 192, 84, 19, 123, 225, 172, 45, 44, 76, 219,
+    224, 107, 119, 29, 96, 127, 22, 144, 232, 84, 124, 236, 110, 2, 164, 73,
+    180, 45, 253, 93, 162, 97, 130, 226, 205, 84, 200, 99, 50, 17, 102, 128,
+    69, 110, 81, 116, 191, 85, 60, 162, 49, 165, 173, 194, 239, 43, 177, 107,
+    154, 236, 180, 184, 8, 209, 120, 162, 128, 122, 32, 63, 130, 202, 157, 173,
+    90, 30, 61, 195, 93, 165, 230, 126, 245, 159, 50, 141, 190, 161, 51, 34,
+    142, 206, 139, 132, 186, 165, 88, 81, 22, 77, 179, 20, 232, 245, 71, 160,
+    166, 100, 137, 83, 171, 55, 54, 95, 121, 239, 187, 231, 84, 147, 152, 23,
+    1, 183, 15, 83, 16, 72, 4, 99, 87, 94, 48, 54, 76, 202, 36, 242,
+    113, 72, 7, 167, 19, 107, 247, 235, 136, 34, 99, 66, 74, 164, 180, 171,
+    226, 72, 143, 207, 234, 196, 162, 223, 140, 19, 37, 182, 233, 243, 165, 190,
+    74, 238, 208, 171, 188, 137, 141, 100, 4, 243, 92, 125, 62, 152, 87, 190,
+    199, 214, 248, 234, 70, 149, 84, 208, 46, 220, 107, 101, 196, 185, 157, 53,
+    136, 246, 97, 47, 130, 174, 173, 61, 102, 11, 189, 205, 149, 185, 31, 253,
+    206, 152, 119, 75, 33, 136, 51, 98, 240, 194, 16, 79, 208, 124, 75, 54,
+    42, 77, 135, 232, 202, 140, 112, 210, 55, 254, 32, 79, 87, 228, 220, 182,
+    147, 1, 249, 75, 56, 8, 114, 84, 6, 183, 46, 158, 56, 76, 198, 126,
+    156, 39, 226, 188, 18, 231, 166, 103, 12, 183, 178, 171, 162, 124, 21, 234,
+    203, 56, 9, 3, 219, 145, 210, 65, 99, 215, 251, 140, 141, 28, 153, 97,
+    133, 13, 4, 62, 44, 84, 185, 65, 250, 178, 176, 82, 241, 160, 19, 251,
+    2, 105, 89, 7, 179, 70, 180, 12, 163, 209, 80, 186, 150, 171, 44, 195,
+    62, 72, 175, 1, 123, 70, 34, 153, 134, 32, 192, 126, 102, 163, 31, 215,
+    194, 160, 103, 176, 249, 69, 96, 17, 27, 216, 147, 237, 75, 114, 40, 145,
+    37, 50, 206, 176, 106, 128, 148, 14, 36, 52, 190, 96, 20, 189, 64, 54,
+    94, 112, 241, 49, 233, 185, 81, 178, 240, 60, 66, 124, 135, 51, 216, 57,
+    188, 112, 1, 138, 71, 115, 55, 97, 3, 233, 205, 47, 69, 162, 138, 134,
+    188, 120, 42, 121, 26, 208, 245, 122, 37, 205, 145, 234, 82, 10, 9, 134,
+    73, 147, 85, 93, 211, 43, 219, 42, 198, 69, 199, 52, 235, 129, 107, 163,
+    114, 36, 199, 118, 250, 176, 140, 3, 171, 156, 209, 95, 203, 129, 145, 184,
+    99, 47, 226, 245, 174, 114, 219, 251, 92, 147, 63, 119, 38, 234, 177, 228,
+    140, 20, 255, 246, 235, 178, 189, 69, 91, 108, 126, 119, 217, 161, 113, 1,
+    6, 191, 118, 177, 208, 145, 222, 5, 41, 143, 216, 8, 194, 158, 96, 39,
+    228, 57, 195, 130, 223, 112, 202, 245, 82, 143, 60, 238, 15, 203, 128, 84,
+    68, 194, 225, 154, 119, 192, 253, 121, 149, 65, 1, 94, 43, 69, 225, 127,
+    164, 51, 201, 169, 64, 198, 231, 121, 116, 247, 29, 229, 100, 30, 156, 1,
+    234, 240, 245, 86, 156, 126, 66, 154, 89, 3, 246, 227, 238, 181, 13, 253,
+    243, 223, 195, 147, 37, 126, 172, 220, 43, 151, 85, 192, 233, 89, 247, 78,
+    110, 241, 72, 136, 15, 211, 154, 195, 189, 129, 235, 243, 106, 76, 229, 6,
+    73, 160, 144, 136, 228, 197, 57, 185, 177, 138, 49, 154, 252, 36, 236, 103,
+    176, 147, 163, 67, 191, 247, 51, 133, 216, 54, 93, 157, 55, 181, 252, 188,
+    125, 147, 123, 66, 215, 30, 68, 11, 141, 191, 149, 88, 33, 102, 100, 101,
+    238, 10, 124, 55, 120, 231, 221, 112, 58, 44, 33, 108, 118, 143, 200, 101,
+    51, 91, 197, 48, 160, 65, 85, 124, 158, 50, 163, 240, 5, 98, 57, 209,
+    36, 106, 165, 65, 210, 186, 147, 226, 27, 26, 245, 218, 10, 98, 235, 112,
+    243, 66, 145, 159, 32, 36, 131, 140, 56, 87, 209, 148, 116, 152, 231, 170,
+    238, 35, 215, 252, 244, 83, 13, 195, 127, 233, 191, 148, 163, 105, 225, 108,
+    117, 213, 248, 231, 136, 230, 186, 193, 199, 108, 138, 122, 148, 208, 2, 16,
+    204, 51, 220, 99, 111, 246, 238, 112, 147, 108, 70, 38, 159, 166, 243, 62,
+    202, 148, 185, 237, 19, 4, 19, 154, 199, 51, 87, 16, 73, 114, 201, 117,
+    187, 210, 121, 47, 100, 67, 38, 154, 14, 63, 141, 136, 23, 116, 18, 87,
+    178, 135, 145, 146, 114, 157, 16, 232, 15, 77, 148, 212, 198, 191, 18, 28,
+    67, 89, 231, 22, 228, 157, 214, 20, 187, 250, 38, 170, 103, 15, 175, 57,
+    10, 53, 166, 107, 93, 161, 204, 141, 223, 182, 195, 249, 117, 173, 85, 128,
+    109, 37, 81, 107, 158, 13, 169, 212, 194, 224, 191, 204, 164, 83, 136, 163,
+    35, 75, 170, 183, 138, 74, 55, 165, 93, 80, 248, 91, 233, 68, 61, 92,
+    70, 75, 247, 14, 244, 79, 191, 119, 4, 138, 250, 159, 7, 110, 247, 189,
+    231, 254, 73, 138, 124, 199, 88, 22, 159, 234, 255, 157, 183, 111, 243, 189,
+    191, 23, 230, 97, 91, 61, 220, 73, 241, 245, 133, 248, 150, 186, 48, 37,
+    17, 215, 161, 97, 87, 220, 54, 36, 197, 235, 52, 58, 49, 186, 103, 60,
+    208, 19, 106, 227, 169, 17, 236, 75, 30, 95, 66, 76, 125, 108, 210, 23,
+    234, 3, 82, 154, 81, 149, 211, 50, 190, 9, 132, 76, 47, 37, 194, 61,
+    142, 169, 113, 210, 231, 33, 156, 201, 84, 180, 131, 142, 161, 109, 6, 48,
+    73, 85, 121, 165, 177, 7, 47, 144, 168, 180, 202, 106, 188, 247, 8, 66,
+    67, 161, 214, 42, 53, 12, 128, 66, 206, 199, 98, 173, 77, 82, 76, 19,
+    30, 20, 167, 222, 165, 163, 29, 66, 130, 115, 174, 217, 236, 8, 155, 98,
+    221, 64, 183, 154, 225, 69, 25, 28, 58, 240, 144, 244, 67, 217, 183, 218,
+    157, 168, 38, 246, 223, 69, 90, 88, 152, 171, 221, 214, 238, 58, 192, 254,
+    44, 61, 53, 179, 84, 85, 249, 48, 219, 150, 70, 159, 208, 107, 139, 113,
+    172, 197, 106, 179, 18, 65, 138, 133, 57, 156, 54, 249, 203, 148, 174, 171,
+    205, 168, 248, 197, 220, 4, 85, 146, 117, 90, 231, 186, 89, 194, 25, 217,
+    135, 168, 141, 198, 100, 34, 204, 29, 138, 220, 162, 232, 99, 170, 25, 94,
+    181, 140, 31, 196, 30, 240, 112, 28, 128, 11, 79, 27, 147, 234, 50, 94,
+    197, 223, 118, 12, 40, 87, 82, 31, 169, 130, 225, 60, 120, 89, 98, 87,
+    71, 153, 195, 86, 127, 214, 41, 197, 117, 109, 16, 191, 240, 89, 29, 244,
+    64, 126, 25, 137, 39, 71, 180, 60, 122, 155, 172, 175, 47, 30, 132, 89,
+    136, 52, 122, 144, 78, 116, 99, 180, 154, 140, 69, 175, 85, 237, 82, 80,
+    253, 195, 255, 132, 191, 86, 248, 13, 186, 87, 209, 252, 247, 35, 100, 7,
+    97, 95, 102, 68, 1, 129, 11, 21, 105, 87, 176, 162, 44, 154, 123, 40,
+    205, 247, 142, 93, 81, 200, 110, 161, 156, 181, 52, 227, 47, 101, 100, 25,
+    1, 245, 23, 88, 129, 38, 220, 161, 248, 187, 62, 180, 159, 98, 21, 52,
+    133, 55, 211, 94, 15, 166, 75, 110, 108, 190, 242, 195, 107, 211, 168, 59,
+    45, 46, 2, 115, 30, 166, 32, 144, 8, 198, 174, 188, 96, 108, 152, 137,
+    72, 249, 219, 80, 6, 39, 175, 126, 185, 161, 110, 149, 207, 138, 59, 247,
+    136, 64, 171, 80, 104, 137, 26, 232, 74, 246, 184, 175, 147, 227, 202, 111,
+    226, 144, 14, 83, 38, 214, 243, 203, 13, 68, 198, 132, 148, 85, 117, 75,
+    217, 144, 3, 131, 201, 149, 89, 163, 5, 38, 74, 113, 207, 251, 54, 102,
+    67, 26, 229, 22, 184, 169, 8, 2, 161, 53, 130, 140, 255, 120, 108, 102,
+    75, 154, 219, 187, 189, 233, 221, 229, 65, 27, 77, 109, 87, 97, 148, 193,
+    189, 75, 101, 15, 7, 200, 8, 251, 184, 250, 124, 45, 174, 97, 147, 177,
+    237, 201, 140, 55, 168, 189, 92, 165, 214, 202, 131, 151, 217, 136, 126, 139,
+    46, 109, 2, 142, 111, 74, 174, 35, 246, 30, 27, 151, 219, 168, 255, 231,
+    104, 125, 112, 126, 87, 207, 84, 92, 149, 111, 39, 106, 13, 241, 194, 94,
+    25, 65, 71, 122, 204, 22, 103, 135, 55, 111, 62, 231, 129, 45, 238, 150,
+    66, 13, 102, 196, 253, 153, 65, 153, 106, 35, 206, 49, 137, 60, 28, 7,
+    32, 203, 218, 207, 237, 180, 130, 153, 118, 254, 147, 3, 10, 220, 154, 206,
+    109, 174, 127, 15, 32, 158, 189, 248, 150, 108, 84, 154, 19, 205, 137, 5,
+    224, 185, 110, 225, 64, 158, 174, 213, 165, 113, 59, 2, 239, 150, 112, 16,
+    228, 168, 244, 104, 240, 177, 85, 172, 31, 248, 22, 139, 238, 180, 246, 96,
+    228, 210, 245, 104, 230, 204, 183, 95, 223, 72, 55, 85, 123, 122, 102, 62,
+    12, 115, 92, 33, 112, 152, 145, 252, 37, 78, 217, 101, 36, 211, 81, 206,
+    24, 115, 121, 75, 89, 248, 42, 201, 139, 112, 18, 6, 171, 63, 216, 133,
+    17, 104, 179, 88, 218, 158, 32, 8, 190, 212, 50, 10, 219, 253, 173, 133,
+    49, 82, 75, 214, 206, 131, 83, 179, 25, 108, 41, 169, 185, 130, 198, 179,
+    235, 5, 7, 56, 47, 194, 23, 26, 8, 124, 88, 168, 111, 130, 233, 121,
+    125, 164, 255, 93, 38, 235, 4, 210, 178, 14, 109, 116, 139, 250, 40, 197,
+    76, 90, 42, 132, 112, 171, 30, 165, 210, 155, 218, 116, 161, 96, 111, 138,
+    27, 23, 254, 40, 15, 184, 48, 152, 123, 140, 117, 24, 91, 191, 160, 105,
+    49, 75, 88, 155, 124, 144, 67, 2, 246, 140, 68, 47, 17, 64, 157, 252,
+    204, 91, 62, 179, 153, 93, 175, 122, 56, 81, 152, 127, 235, 11, 52, 13,
+    63, 42, 106, 73, 201, 49, 67, 122, 12, 54, 3, 110, 121, 182, 20, 152,
+    53, 217, 27, 203, 206, 125, 239, 138, 192, 34, 54, 173, 59, 199, 150, 228,
+    80, 63, 74, 100, 129, 125, 212, 29, 53, 28, 72, 104, 97, 192, 40, 103,
+    128, 108, 26, 139, 162, 195, 3, 226, 125, 207, 62, 129, 241, 85, 70, 230,
+    192, 87, 52, 139, 156, 4, 39, 50, 172, 34, 185, 3, 35, 13, 2, 250,
+    188, 224, 255, 98, 207, 111, 162, 121, 253, 120, 132, 248, 19, 102, 173, 114,
+    101, 224, 2, 9, 142, 230, 110, 194, 6, 207, 135, 94, 138, 89, 104, 22,
+    178, 43, 12, 175, 233, 27, 248, 62, 227, 73, 5, 191, 39, 65, 208, 22,
+    74, 16, 156, 200, 138, 136, 222, 12, 140, 52, 8, 207, 9, 17, 101, 240,
+    84, 242, 52, 189, 247, 244, 74, 135, 63, 201, 164, 20, 18, 17, 146, 59,
+    170, 186, 187, 86, 171, 84, 145, 138, 147, 104, 221, 231, 40, 185, 151, 50,
+    127, 223, 242, 178, 45, 54, 41, 16, 46, 39, 167, 231, 218, 34, 184, 148,
+    95, 28, 115, 151, 154, 224, 17, 254, 203, 31, 214, 91, 228, 72, 147, 236,
+    233, 125, 5, 6, 75, 37, 191, 190, 139, 31, 63, 109, 198, 94, 217, 247,
+    65, 228, 171, 235, 184, 59, 31, 233, 155, 18, 39, 136, 216, 142, 236, 59,
+    98, 183, 93, 252, 53, 141, 62, 233, 119, 116, 212, 112, 61, 189, 153, 39,
+    160, 129, 58, 173, 126, 238, 76, 201, 127, 213, 5, 40, 227, 241, 203, 121,
+    103, 138, 182, 216, 252, 238, 175, 95, 226, 2, 12, 99, 236, 127, 189, 63,
+    161, 10, 170, 24, 1, 128, 188, 21, 78, 74, 230, 183, 172, 200, 113, 83,
+    60, 235, 73, 24, 231, 70, 240, 44, 232, 41, 52, 188, 182, 85, 35, 156,
+    82, 3, 173, 16, 153, 33, 192, 78, 213, 114, 155, 25, 163, 224, 137, 247,
+    164, 3, 120, 193, 30, 139, 29, 168, 136, 153, 223, 41, 238, 157, 134, 245,
+    224, 89, 90, 225, 139, 44, 208, 52, 252, 168, 181, 57, 3, 196, 17, 245,
+    48, 216, 12, 165, 249, 226, 80, 90, 212, 67, 108, 11, 231, 242, 55, 130,
+    2, 188, 86, 138, 223, 254, 85, 102, 143, 79, 128, 145, 211, 242, 232, 243,
+    58, 215, 200, 60, 37, 2, 201, 253, 247, 172, 51, 4, 122, 203, 193, 124,
+    29, 232, 218, 184, 50, 215, 153, 150, 10, 162, 102, 4, 160, 234, 40, 249,
+    44, 118, 253, 193, 194, 151, 117, 58, 37, 252, 132, 41, 178, 6, 241, 219,
+    193, 119, 26, 231, 251, 163, 155, 59, 74, 252, 69, 165, 86, 51, 170, 157,
+    207, 178, 243, 156, 220, 255, 241, 10, 201, 96, 113, 198, 186, 185, 196, 49,
+    125, 86, 237, 122, 17, 8, 255, 10, 13, 188, 68, 29, 78, 215, 23, 113,
+    248, 246, 94, 105, 144, 13, 30, 187, 41, 155, 103, 31, 203, 251, 212, 152,
+    215, 12, 146, 93, 61, 13, 213, 151, 114, 111, 127, 9, 98, 41, 229, 72,
+    197, 206, 68, 251, 83, 242, 234, 91, 44, 125, 206, 189, 179, 41, 193, 213,
+    24, 110, 136, 251, 157, 142, 96, 65, 155, 67, 186, 234, 238, 34, 71, 88,
+    125, 59, 91, 134, 99, 243, 102, 23, 173, 108, 186, 39, 110, 119, 229, 101,
+    250, 59, 246, 132, 179, 60, 136, 22, 7, 99, 55, 176, 66, 204, 169, 205,
+    22, 207, 160, 51, 45, 117, 168, 42, 221, 150, 120, 174, 111, 86, 79, 205,
+    190, 157, 161, 18, 108, 92, 223, 160, 60, 218, 192, 90, 200, 202, 193, 20,
+    248, 110, 240, 211, 167, 224, 116, 88, 66, 216, 236, 3, 141, 202, 102, 182,
+    151, 96, 93, 130, 170, 248, 33, 100, 91, 253, 28, 60, 140, 93, 59, 174,
+    187, 177, 162, 166, 19, 233, 84, 1, 102, 48, 56, 60, 46, 175, 133, 78,
+    185, 200, 114, 59, 42, 14, 217, 107, 10, 196, 114, 191, 72, 212, 87, 130,
+    185, 105, 59, 217, 54, 52, 247, 169, 20, 196, 203, 224, 251, 132, 63, 35,
+    64, 72, 27, 5, 112, 174, 222, 50, 63, 246, 139, 20, 28, 224, 188, 47,
+    92, 104, 32, 237, 125, 154, 161, 50, 131, 249, 233, 170, 219, 105, 152, 139,
+    16, 111, 242, 56, 191, 53, 232, 45, 211, 73, 193, 70, 179, 229, 245, 166,
+    26, 155, 254, 207, 99, 53, 91, 210, 223, 216, 234, 183, 237, 211, 13, 209,
+    105, 159, 107, 195, 165, 100, 16, 137, 138, 36, 182, 163, 146, 23, 12, 66,
+    116, 252, 214, 195, 19, 203, 205, 246, 14, 253, 53, 16, 6, 187, 235, 9,
+    147, 216, 9, 244, 53, 189, 4, 32, 133, 102, 165, 198, 222, 241, 193, 224,
+    59, 216, 140, 76, 35, 81, 251, 124, 137, 53, 111, 199, 38, 8, 71, 46,
+    68, 189, 246, 125, 79, 66, 128, 32, 194, 119, 200, 40, 75, 211, 142, 46,
+    196, 85, 49, 127, 31, 54, 81, 246, 100, 173, 164, 158, 38, 41, 147, 102,
+    174, 32, 146, 228, 143, 234, 107, 185, 242, 94, 200, 134, 76, 41, 28, 126,
+    7, 13, 46, 232, 36, 174, 121, 19, 63, 57, 242, 223, 222, 47, 109, 224,
+    217, 134, 138, 172, 12, 8, 228, 135, 66, 181, 249, 223, 84, 103, 21, 35,
+    202, 162, 252, 109, 114, 121, 189, 175, 228, 39, 32, 205, 30, 154, 53, 181,
+    145, 99, 36, 56, 134, 178, 211, 44, 213, 39, 177, 40, 107, 233, 76, 73,
+    206, 30, 67, 114, 20, 106, 48, 209, 109, 132, 221, 90, 126, 215, 148, 37,
+    67, 137, 144, 107, 89, 31, 96, 209, 249, 49, 121, 199, 168, 3, 22, 221,
+    72, 24, 150, 252, 81, 214, 186, 95, 133, 7, 163, 113, 155, 239, 234, 71,
+    170, 29, 218, 74, 162, 214, 33, 26, 79, 181, 153, 221, 99, 133, 85, 166,
+    13, 91, 133, 32, 247, 22, 70, 199, 232, 19, 158, 169, 141, 246, 188, 196,
+    80, 121, 23, 32, 105, 3, 93, 155, 125, 151, 187, 70, 94, 204, 143, 205,
+    70, 150, 73, 115, 9, 148, 110, 87, 186, 160, 237, 182, 207, 136, 122, 184,
+    140, 150, 243, 28, 245, 158, 99, 238, 8, 9, 233, 35, 14, 220, 146, 96,
+    4, 58, 202, 84, 37, 53, 191, 230, 138, 7, 217, 81, 240, 139, 57, 96,
+    187, 5, 231, 176, 135, 164, 208, 202, 226, 73, 140, 74, 243, 103, 211, 225,
+    146, 9, 248, 147, 176, 44, 35, 201, 227, 39, 115, 222, 251, 103, 99, 46,
+    209, 194, 182, 122, 165, 146, 255, 247, 23, 237, 39, 145, 158, 168, 81, 201,
+    179, 241, 181, 106, 68, 120, 245, 254, 249, 237, 78, 145, 43, 55, 195, 236,
+    82, 48, 125, 81, 244, 157, 149, 123, 49, 105, 96, 74, 34, 179, 95, 194,
+    174, 165, 108, 72, 151, 203, 104, 116, 98, 105, 206, 120, 189, 38, 212, 219,
+    79, 34, 197, 150, 60, 190, 229, 159, 45, 3, 225, 115, 20, 160, 171, 227,
+    11, 249, 129, 18, 226, 71, 215, 159, 134, 97, 175, 8, 48, 145, 151, 225,
+    206, 252, 190, 40, 132, 152, 250, 216, 185, 46, 201, 6, 164, 41, 162, 55,
+    187, 100, 97, 18, 21, 152, 94, 74, 153, 122, 1, 79, 226, 185, 211, 66,
+    37, 143, 80, 110, 183, 145, 122, 238, 130, 100, 161, 111, 197, 134, 173, 189,
+    235, 33, 160, 110, 22, 83, 139, 84, 229, 5, 58, 122, 216, 40, 167, 25,
+    168, 117, 27, 1, 95, 218, 12, 96, 146, 170, 242, 87, 127, 14, 94, 61,
+    77, 117, 137, 212, 101, 243, 16, 132, 134, 95, 177, 84, 106, 24, 124, 131,
+    86, 72, 156, 26, 71, 2, 151, 236, 149, 230, 105, 215, 212, 14, 248, 131,
+    193, 205, 119, 221, 244, 206, 94, 156, 186, 62, 232, 142, 29, 132, 129, 147,
+    196, 71, 154, 164, 152, 38, 60, 40, 83, 161, 87, 91, 58, 132, 25, 230,
+    65, 175, 197, 16, 43, 196, 167, 128, 115, 41, 201, 114, 204, 218, 7, 135,
+    209, 198, 157, 96, 91, 153, 69, 120, 221, 104, 143, 114, 81, 255, 83, 129,
+    33, 90, 243, 7, 172, 234, 241, 191, 223, 138, 50, 56, 116, 253, 61, 245,
+    134, 175, 115, 169, 39, 77, 76, 241, 163, 138, 180, 176, 45, 75, 167, 177,
+    193, 116, 157, 225, 88, 122, 11, 124, 127, 113, 183, 61, 118, 151, 131, 233,
+    20, 24, 49, 148, 198, 194, 22, 124, 252, 169, 63, 101, 67, 251, 25, 183,
+    150, 139, 218, 236, 106, 123, 168, 170, 239, 96, 171, 49, 140, 35, 189, 214,
+    11, 226, 69, 151, 212, 123, 36, 130, 9, 23, 114, 37, 108, 239, 139, 53,
+    65, 75, 190, 141, 229, 227, 44, 160, 224, 83, 137, 101, 218, 103, 29, 59,
+    207, 164, 97, 141, 108, 155, 27, 57, 150, 111, 180, 44, 128, 95, 195, 221,
+    135, 77, 237, 151, 165, 8, 170, 57, 234, 180, 211, 105, 178, 153, 50, 175,
+    19, 77, 7, 145, 200, 68, 133, 58, 9, 165, 89, 205, 198, 73, 83, 187,
+    160, 222, 102, 200, 225, 91, 239, 242, 180, 216, 164, 64, 184, 156, 166, 187,
+    79, 136, 218, 106, 97, 112, 209, 102, 82, 167, 68, 223, 50, 188, 119, 5,
+    62, 149, 60, 253, 224, 56, 29, 22, 158, 54, 59, 201, 100, 188, 151, 163,
+    236, 24, 80, 174, 164, 62, 79, 25, 223, 120, 230, 74, 58, 76, 253, 85,
+    119, 159, 229, 126, 122, 167, 136, 239, 177, 250, 209, 74, 223, 186, 254, 54,
+    180, 228, 124, 253, 68, 115, 93, 238, 240, 178, 196, 174, 142, 47, 155, 172,
+    254, 177, 82, 151, 234, 218, 32, 99, 253, 178, 58, 245, 128, 252, 50, 15,
+    78, 142, 117, 120, 244, 43, 36, 68, 137, 231, 77, 239, 208, 206, 251, 247,
+    53, 38, 252, 3, 170, 80, 72, 68, 114, 236, 146, 210, 214, 69, 150, 77,
+    126, 18, 118, 189, 69, 67, 94, 60, 21, 178, 13, 104, 244, 61, 156, 232,
+    198, 117, 41, 5, 138, 67, 170, 199, 164, 160, 231, 155, 227, 21, 99, 172,
+    237, 26, 145, 181, 19, 117, 214, 114, 70, 10, 241, 123, 251, 89, 208, 172,
+    163, 54, 63, 181, 226, 222, 182, 142, 3, 209, 59, 214, 104, 198, 111, 140,
+    105, 174, 191, 229, 243, 70, 200, 14, 194, 190, 204, 136, 2, 31, 22, 42,
+    210, 174, 125, 89, 88, 41, 246, 80, 135, 243, 1, 186, 162, 141, 189, 88,
+    242, 172, 48, 134, 131, 108, 199, 248, 171, 57, 20, 198, 156, 25, 103, 88,
+    53, 64, 74, 7, 18, 26, 95, 48, 10, 208, 32, 27, 220, 95, 37, 119,
+    104, 219, 94, 202, 200, 50, 2, 247, 46, 176, 31, 76, 165, 95, 237, 107,
+    124, 117, 35, 196, 42, 104, 23, 110, 187, 188, 8, 169, 104, 62, 171, 27,
+    21, 168, 205, 116, 101, 70, 56, 105, 149, 127, 16, 169, 165, 114, 110, 91,
+    199, 142, 242, 171, 28, 4, 57, 42, 30, 81, 150, 220, 216, 97, 249, 155,
+    214, 187, 77, 118, 90, 92, 4, 230, 60, 81, 64, 61, 16, 145, 65, 101,
+    192, 216, 45, 15, 144, 239, 202, 167, 219, 149, 27, 161, 178, 249, 211, 253,
+    42, 199, 76, 133, 142, 213, 137, 167, 8, 36, 2, 191, 165, 47, 24, 27,
+    38, 101, 18, 121, 171, 160, 12, 78, 67, 252, 111, 95, 220, 55, 131, 9,
+    118, 243, 13, 128, 75, 160, 208, 15, 52, 205, 148, 241, 109, 67, 59, 219,
+    137, 222, 127, 86, 65, 7, 128, 60, 36, 61, 217, 113, 228, 184, 96, 42,
+    135, 179, 254, 86, 152, 22, 38, 227, 112, 187, 181, 128, 48, 177, 11, 72,
+    217, 61, 28, 166, 76, 177, 251, 139, 26, 136, 145, 21, 53, 170, 234, 150,
+    175, 61, 6, 27, 143, 55, 178, 91, 10, 76, 148, 226, 131, 235, 13, 203,
+    81, 239, 143, 113, 176, 233, 31, 206, 246, 164, 35, 115, 96, 165, 26, 203,
+    78, 2, 157, 25, 86, 17, 210, 143, 159, 136, 1, 125, 108, 204, 134, 52,
+    215, 44, 109, 79, 16, 4, 95, 106, 25, 5, 227, 240, 216, 204, 150, 41,
+    171, 107, 103, 207, 167, 215, 130, 54, 154, 218, 184, 58, 203, 125, 20, 236,
+    38, 45, 21, 66, 56, 219, 15, 220, 105, 195, 109, 58, 222, 48, 185, 69,
+    131, 133, 127, 20, 137, 92, 24, 76, 174, 194, 53, 159, 103, 150, 202, 30,
+    14, 141, 16, 235, 109, 233, 248, 90, 65, 194, 59, 127, 199, 143, 5, 110,
+    77, 103, 184, 87, 177, 137, 122, 52, 120, 214, 164, 86, 129, 124, 11, 203,
+    119, 90, 123, 48, 114, 105, 244, 52, 115, 102, 213, 161, 225, 36, 149, 164,
+    179, 61, 51, 31, 27, 51, 175, 13, 252, 11, 92, 218, 4, 1, 222, 148,
+    65, 70, 241, 60, 54, 51, 171, 77, 227, 211, 208, 250, 224, 252, 174, 131,
+    168, 184, 207, 197, 226, 68, 63, 203, 23, 184, 1, 71, 185, 37, 87, 159,
+    123, 15, 131, 197, 227, 84, 241, 253, 52, 176, 56, 63, 165, 233, 42, 46,
+    55, 222, 78, 212, 26, 255, 153, 188, 50, 130, 142, 244, 133, 44, 206, 19,
+    110, 222, 124, 211, 31, 90, 193, 49, 132, 26, 204, 149, 231, 47, 227, 40,
+    3, 157, 217, 63, 210, 222, 55, 196, 233, 69, 147, 245, 68, 32, 219, 40,
+    52, 202, 13, 116, 37, 123, 92, 217, 199, 255, 101, 185, 130, 47, 212, 70,
+    129, 98, 15, 120, 56, 14, 64, 139, 169, 131, 199, 117, 25, 47, 236, 225,
+    59, 6, 20, 165, 41, 129, 218, 65, 254, 30, 86, 217, 153, 15, 66, 162,
+    68, 26, 61, 72, 39, 58, 191, 90, 77, 70, 172, 217, 164, 248, 41, 40,
+    240, 239, 241, 66, 209, 43, 124, 136, 64, 33, 103, 237, 49, 216, 168, 41,
+    38, 135, 15, 10, 221, 111, 220, 223, 128, 33, 65, 183, 87, 226, 118, 4,
+    195, 49, 224, 32, 213, 77, 148, 215, 42, 164, 242, 24, 227, 75, 35, 193,
+    104, 187, 203, 182, 86, 236, 53, 215, 9, 174, 69, 204, 146, 78, 27, 242,
+    235, 74, 87, 219, 245, 208, 253, 127, 170, 69, 62, 237, 44, 11, 193, 117,
+    241, 192, 213, 185, 247, 208, 209, 133, 115, 190, 163, 144, 110, 170, 246, 244,
+    204, 124, 33, 38, 176, 54, 105, 133, 117, 143, 41, 77, 166, 196, 231, 25,
+    95, 138, 66, 38, 153, 156, 97, 144, 71, 218, 182, 105, 253, 158, 78, 234,
+    24, 230, 184, 66, 224, 45, 63, 229, 74, 156, 175, 202, 72, 187, 162, 129,
+    48, 230, 242, 150, 178, 237, 84, 143, 11, 224, 36, 12, 75, 126, 204, 16,
+    245, 11, 35, 237, 116, 135, 79, 218, 200, 123, 94, 98, 40, 178, 133, 16,
+    186, 143, 160, 195, 176, 197, 211, 35, 47, 102, 201, 232, 173, 23, 34, 208,
+    123, 176, 169, 33, 64, 16, 97, 181, 100, 20, 171, 231, 71, 23, 98, 164,
+    150, 177, 129, 27, 166, 123, 50, 216, 82, 79, 121, 225, 111, 153, 184, 112,
+    226, 67, 69, 86, 6, 4, 114, 205, 33, 212, 242, 225, 42, 189, 132, 159,
+    101, 81, 126, 184, 57, 178, 208, 217, 111, 25, 145, 123, 203, 10, 14, 112,
+    94, 153, 46, 52, 16, 248, 176, 77, 222, 25, 207, 242, 250, 85, 227, 186,
+    76, 203, 8, 185, 121, 28, 187, 239, 220, 50, 8, 202, 69, 18, 91, 223,
+    73, 133, 6, 33, 58, 126, 107, 239, 135, 235, 232, 123, 7, 240, 148, 8,
+    3, 211, 251, 138, 218, 232, 11, 233, 80, 151, 152, 180, 84, 21, 224, 75,
+    60, 87, 185, 43, 169, 232, 95, 192, 222, 9, 54, 46, 225, 80, 30, 109,
+    96, 45, 14, 30, 70, 160, 147, 87, 211, 214, 81, 83, 135, 250, 42, 142,
+    51, 24, 28, 30, 23, 217, 204, 39, 210, 100, 57, 147, 21, 7, 226, 187,
+    246, 5, 234, 48, 182, 99, 93, 210, 98, 150, 176, 43, 248, 61, 134, 4,
+    241, 5, 136, 94, 34, 128, 39, 229, 133, 182, 124, 123, 47, 186, 34, 243,
+    167, 121, 117, 163, 22, 176, 103, 208, 215, 154, 238, 228, 12, 55, 68, 243,
+    192, 71, 48, 174, 195, 175, 93, 117, 119, 17, 173, 44, 67, 244, 112, 162,
+    45, 254, 203, 22, 104, 26, 126, 84, 212, 146, 143, 98, 134, 244, 24, 108,
+    6, 220, 242, 113, 40, 45, 106, 175, 54, 139, 151, 2, 61, 235, 238, 62,
+    128, 116, 109, 92, 25, 229, 194, 75, 5, 81, 51, 2, 80, 117, 20, 242,
+    22, 59, 240, 238, 97, 197, 180, 29, 129, 250, 195, 9, 157, 68, 108, 71,
+    118, 147, 49, 213, 160, 126, 148, 200, 31, 250, 181, 58, 106, 56, 144, 208,
+    194, 157, 80, 206, 29, 216, 85, 12, 142, 64, 94, 132, 39, 37, 115, 213,
+    86, 100, 182, 167, 30, 251, 170, 12, 253, 35, 120, 22, 116, 154, 26, 94,
+    91, 164, 159, 78, 52, 11, 89, 155, 6, 217, 250, 131, 124, 31, 255, 170,
+    140, 209, 157, 174, 104, 11, 37, 8, 78, 100, 69, 68, 111, 6, 70, 26,
+    4, 233, 224, 253, 20, 210, 197, 25, 177, 225, 121, 89, 152, 27, 154, 8,
+    23, 157, 221, 253, 109, 17, 92, 74, 161, 14, 183, 197, 77, 112, 134, 127,
+    101, 221, 227, 196, 131, 222, 89, 242, 231, 240, 21, 237, 38, 204, 71, 228,
+    202, 221, 4, 18, 1, 209, 220, 153, 12, 131, 19, 188, 9, 178, 177, 43,
+    174, 141, 64, 30, 18, 144, 226, 182, 114, 92, 48, 21, 205, 215, 127, 43,
+    76, 11, 19, 255, 56, 211, 212, 64, 24, 214, 139, 36, 208, 44, 121, 86,
+    24, 67, 207, 54, 237, 124, 219, 146, 10, 99, 78, 130, 189, 44, 148, 32,
+    37, 141, 9, 13, 161, 24, 5, 104, 16, 131, 4, 218, 52, 31, 219, 131,
+    132, 84, 232, 58, 188, 35, 28, 186, 196, 177, 8, 218, 220, 57, 55, 163,
+    237, 71, 121, 219, 14, 2, 146, 21, 18, 34, 202, 253, 168, 249, 104, 103,
+    243, 245, 148, 19, 126, 143, 85, 40, 36, 34, 57, 118, 73, 105, 107, 172,
+    75, 168, 63, 9, 59, 208, 198, 212, 135, 180, 107, 57, 35, 5, 246, 179,
+    243, 162, 104, 86, 223, 27, 145, 212, 113, 111, 91, 71, 143, 230, 147, 107,
+    52, 99, 185, 70, 167, 211, 80, 111, 51, 100, 254, 163, 249, 121, 90, 108,
+    82, 32, 92, 78, 83, 211, 169, 68, 109, 53, 190, 56, 230, 51, 41, 221,
+    34, 225, 115, 37, 29, 38, 240, 164, 181, 193, 252, 63, 61, 221, 68, 249,
+    214, 125, 230, 37, 225, 93, 127, 27, 90, 114, 62, 240, 34, 183, 160, 119,
+    139, 62, 177, 182, 213, 144, 59, 197, 207, 250, 10, 12, 150, 74, 99, 97,
+    11, 62, 126, 218, 145, 188, 175, 243, 130, 213, 75, 203, 109, 118, 95, 200,
+    252, 255, 22, 80, 112, 167, 202, 188, 109, 189, 128, 147, 233, 82, 190, 200,
+    54, 195, 131, 146, 75, 185, 90, 22, 64, 161, 239, 224, 62, 207, 43, 36,
+    78, 13, 173, 1, 197, 118, 196, 115, 186, 229, 106, 7, 124, 207, 238, 232,
+    181, 224, 122, 103, 47, 78, 93, 31, 116, 71, 234, 57, 102, 109, 141, 205,
+    230, 99, 192, 48, 163, 194, 172, 60, 224, 52, 201, 57, 166, 241, 167, 206,
+    158, 45, 247, 141, 86, 117, 246, 209, 252, 193, 152, 143, 254, 183, 10, 80,
+    219, 255, 139, 242, 206, 9, 113, 173, 229, 193, 67, 190, 217, 4, 24, 198,
+    197, 254, 103, 126, 95, 20, 40, 55, 213, 198, 61, 119, 65, 50, 222, 185,
+    236, 67, 216, 208, 251, 158, 80, 55, 11, 167, 203, 42, 252, 140, 29, 61,
+    108, 20, 221, 130, 73, 48, 2, 29, 101, 42, 156, 148, 209, 115, 69, 141,
+    226, 166, 120, 203, 146, 48, 211, 140, 253, 88, 205, 82, 104, 101, 113, 170,
+    70, 37, 157, 198, 79, 84, 166, 234, 215, 246, 212, 53, 34, 60, 244, 127,
+    242, 248, 39, 198, 155, 149, 239, 118, 41, 24, 176, 166, 122, 192, 196, 179,
+    164, 6, 71, 32, 47, 66, 157, 156, 183, 228, 43, 50, 91, 221, 15, 243,
+    85, 6, 240, 159, 60, 11, 58, 77, 13, 47, 163, 82, 193, 39, 112, 240,
+    10, 105, 236, 130, 214, 254, 178, 162, 76, 131, 77, 4, 133, 192, 224, 240,
+    184, 134, 46, 37, 222, 7, 213, 236, 168, 56, 67, 177, 17, 247, 221, 178,
+    180, 223, 11, 88, 189, 104, 229, 77, 119, 114, 6, 149, 34, 247, 96, 173,
+    24, 87, 239, 217, 160, 180, 181, 134, 216, 22, 197, 1, 144, 251, 119, 31,
+    64, 58, 184, 46, 130, 252, 97, 171, 140, 166, 151, 1, 40, 180, 10, 121,
+    11, 147, 120, 119, 190, 236, 90, 128, 211, 249, 110, 25, 4, 101, 172, 9,
+    163, 225, 170, 204, 3, 158, 29, 63, 187, 249, 205, 251, 116, 179, 141, 120,
+    74, 4, 143, 231, 243, 69, 7, 15, 35, 80, 199, 165, 231, 107, 166, 167,
+    205, 125, 21, 71, 151, 12, 14, 15, 133, 226, 102, 157, 105, 50, 146, 199,
+    132, 141, 113, 211, 102, 8, 244, 139, 159, 248, 58, 205, 169, 109, 100, 179,
+    47, 49, 20, 89, 204, 8, 93, 201, 80, 239, 88, 236, 231, 159, 153, 51,
+    234, 116, 178, 254, 185, 194, 92, 56, 113, 175, 172, 43, 3, 2, 57, 232,
+    158, 106, 121, 254, 21, 208, 66, 193, 188, 166, 63, 92, 146, 89, 104, 226,
+    74, 229, 21, 82, 121, 12, 255, 171, 159, 238, 52, 211, 235, 91, 43, 118,
+    148, 229, 138, 87, 172, 102, 73, 39, 131, 121, 251, 37, 165, 227, 158, 19,
+    88, 27, 186, 204, 180, 201, 154, 168, 83, 98, 253, 130, 161, 69, 33, 19,
+    194, 78, 190, 72, 173, 109, 91, 186, 240, 79, 39, 117, 255, 20, 143, 192,
+    226, 145, 105, 111, 149, 98, 250, 172, 199, 244, 34, 16, 227, 20, 26, 101,
+    136, 58, 156, 179, 46, 226, 237, 241, 188, 210, 43, 226, 194, 137, 33, 81,
+    34, 13, 144, 36, 157, 29, 209, 45, 168, 35, 86, 226, 82, 124, 154, 20,
+    120, 249, 246, 33, 230, 155, 62, 68, 61, 26, 60, 107, 82, 43, 206, 62,
+    139, 235, 181, 45, 179, 24, 57, 186, 122, 26, 183, 51, 228, 222, 254, 18,
+    196, 82, 215, 144, 151, 129, 233, 236, 113, 34, 145, 235, 133, 92, 142, 173,
+    210, 156, 165, 193, 179, 137, 207, 236, 255, 42, 246, 240, 26, 88, 28, 145,
+    220, 250, 21, 23, 136, 235, 166, 249, 201, 182, 88, 250, 129, 103, 123, 82,
+    159, 183, 48, 220, 13, 235, 39, 1, 192, 130, 43, 134, 105, 201, 193, 68,
+    142, 176, 92, 29, 235, 176, 10, 118, 19, 152, 132, 33, 28, 227, 137, 110,
+    186, 239, 184, 29, 111, 24, 210, 172, 207, 204, 177, 10, 202, 46, 12, 38,
+    250, 118, 182, 17, 198, 251, 204, 46, 71, 216, 105, 78, 220, 238, 215, 202,
+    233, 118, 241, 21, 123, 120, 13, 44, 14, 198, 110, 125, 132, 133, 46, 128,
+    251, 88, 5, 59, 135, 76, 66, 158, 14, 255, 202, 55, 93, 249, 92, 128,
+    185, 12, 105, 86, 233, 102, 214, 5, 101, 23, 6, 19, 79, 135, 44, 131,
+    93, 102, 90, 234, 77, 84, 167, 49, 240, 65, 222, 172, 158, 135, 97, 39,
+    95, 36, 216, 184, 163, 93, 120, 169, 157, 180, 155, 113, 97, 202, 158, 166,
+    17, 136, 72, 18, 192, 128, 230, 152, 84, 159, 43, 113, 41, 62, 77, 10,
+    60, 242, 123, 158, 115, 195, 31, 34, 141, 137, 159, 40, 237, 220, 253, 187,
+    83, 221, 232, 176, 132, 173, 197, 6, 7, 137, 204, 113, 51, 192, 186, 25,
+    73, 237, 66, 200, 182, 231, 89, 127, 210, 97, 46, 28, 182, 217, 86, 155,
+    143, 1, 146, 116, 79, 53, 178, 127, 132, 104, 33, 238, 94, 83, 145, 46,
+    73, 162, 52, 113, 56, 120, 5, 186, 118, 65, 107, 127, 89, 81, 38, 207,
+    168, 2, 204, 96, 112, 120, 92, 67, 23, 156, 111, 141, 228, 118, 84, 28,
+    175, 214, 236, 142, 72, 243, 181, 129, 32, 29, 92, 23, 65, 126, 190, 219,
+    70, 83, 197, 142, 20, 90, 5, 178, 139, 199, 60, 181, 95, 118, 45, 64,
+    20, 149, 228, 99, 144, 181, 174, 25, 111, 210, 118, 175, 108, 104, 243, 79,
+    40, 149, 139, 221, 235, 21, 126, 70, 128, 144, 54, 10, 224, 65, 192, 99,
+    169, 42, 83, 117, 229, 123, 106, 148, 17, 30, 122, 177, 121, 124, 157, 99,
+    195, 196, 249, 59, 154, 12, 88, 83, 61, 96, 98, 215, 161, 100, 126, 241,
+    11, 40, 56, 221, 101, 94, 184, 208, 64, 199, 250, 41, 95, 100, 27, 239,
+    207, 73, 171, 210, 45, 11, 32, 222, 249, 112, 117, 146, 51, 184, 200, 232,
+    115, 191, 96, 24, 223, 97, 86, 30, 112, 26, 234, 146, 83, 246, 221, 103,
+    79, 152, 245, 200, 43, 180, 123, 230, 99, 106, 205, 90, 187, 146, 159, 140,
+    123, 215, 247, 81, 52, 43, 225, 131, 198, 106, 182, 185, 163, 173, 201, 115,
+    199, 187, 26, 191, 210, 35, 183, 156, 128, 19, 120, 82, 212, 238, 126, 145,
+    144, 224, 34, 242, 107, 176, 115, 156, 254, 160, 177, 131, 45, 57, 31, 120,
+    17, 213, 80, 181, 214, 155, 87, 200, 32, 15, 9, 72, 113, 91, 57, 46,
+    24, 132, 232, 229, 177, 155, 38, 139, 135, 241, 28, 231, 106, 32, 12, 107,
+    203, 18, 2, 109, 26, 129, 227, 207, 66, 42, 116, 29, 94, 159, 14, 93,
+    98, 214, 4, 109, 110, 146, 149, 223, 248, 173, 178, 227, 7, 1, 73, 132,
+    59, 173, 18, 245, 106, 103, 8, 64, 23, 204, 87, 145, 161, 255, 159, 221,
+    118, 173, 5, 152, 70, 162, 235, 248, 15, 106, 222, 147, 76, 16, 239, 91,
+    95, 188, 169, 167, 67, 34, 18, 138, 48, 32, 183, 38, 21, 238, 195, 91,
+    77, 129, 84, 140, 15, 178, 215, 169, 213, 249, 206, 134, 142, 92, 136, 103,
+    241, 250, 158, 132, 29, 64, 153, 238, 141, 80, 150, 187, 1, 92, 149, 170,
+    98, 254, 62, 108, 162, 241, 200, 71, 85, 33, 90, 170, 197, 46, 50, 58,
+    213, 230, 24, 6, 254, 95, 155, 137, 28, 136, 180, 170, 221, 179, 112, 208,
+    218, 38, 122, 50, 195, 45, 215, 183, 76, 82, 59, 204, 65, 64, 57, 213,
+    3, 201, 214, 111, 249, 188, 141, 17, 152, 82, 56, 252, 14, 26, 92, 205,
+    72, 65, 242, 38, 126, 114, 152, 164, 118, 133, 130, 128, 114, 183, 6, 143,
+    177, 222, 239, 101, 7, 34, 45, 164, 112, 229, 28, 52, 184, 135, 144, 130,
+    249, 76, 252, 228, 249, 163, 161, 94, 218, 221, 175, 17, 9, 69, 24, 16,
+    213, 19, 132, 119, 239, 163, 168, 206, 42, 70, 137, 89, 229, 218, 228, 242,
+    103, 67, 45, 85, 236, 23, 25, 29, 228, 115, 12, 3, 127, 161, 195, 202,
+    14, 68, 90, 85, 224, 215, 56, 104, 109, 19, 61, 25, 239, 152, 229, 213,
+    213, 78, 64, 135, 60, 41, 106, 119, 63, 198, 72, 112, 17, 121, 187, 88,
+    183, 78, 127, 80, 214, 207, 152, 146, 129, 60, 134, 228, 40, 212, 1, 184,
+    13, 206, 255, 233, 33, 21, 58, 128, 47, 193, 7, 160, 49, 107, 2, 184,
+    55, 73, 196, 225, 124, 216, 89, 255, 141, 142, 170, 66, 96, 191, 218, 21,
+    167, 180, 252, 179, 53, 74, 134, 15, 61, 214, 178, 62, 192, 191, 239, 98,
+    242, 147, 77, 6, 44, 167, 144, 48, 49, 229, 180, 73, 151, 92, 100, 116,
+    183, 209, 48, 12, 225, 190, 43, 15, 56, 13, 117, 73, 167, 123, 224, 189,
+    169, 76, 244, 100, 155, 90, 179, 115, 162, 177, 105, 190, 23, 14, 91, 226,
+    43, 195, 201, 142, 73, 58, 169, 148, 89, 177, 66, 52, 158, 119, 47, 167,
+    198, 23, 170, 81, 26, 182, 118, 71, 36, 247, 212, 206, 16, 128, 46, 133,
+    174, 63, 95, 227, 35, 167, 236, 71, 10, 45, 140, 89, 203, 237, 30, 212,
+    161, 59, 152, 32, 23, 64, 243, 44, 140, 147, 205, 38, 33, 79, 7, 241,
+    101, 149, 160, 242, 46, 64, 210, 6, 186, 43, 250, 51, 107, 140, 188, 133,
+    3, 135, 195, 182, 190, 101, 79, 83, 134, 68, 36, 9, 96, 64, 115, 76,
+    42, 193, 155, 182, 154, 31, 168, 5, 30, 121, 179, 79, 183, 239, 129, 17};
+
+const uint8_t gf256NibbleTables[256][32] = {
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+     0, 16, 32, 48, 64, 80, 96, 112, 128, 144, 160, 176, 192, 208, 224, 240},
+    {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30,
+     0, 32, 64, 96, 128, 160, 192, 224, 29, 61, 93, 125, 157, 189, 221, 253},
+    {0, 3, 6, 5, 12, 15, 10, 9, 24, 27, 30, 29, 20, 23, 18, 17,
+     0, 48, 96, 80, 192, 240, 160, 144, 157, 173, 253, 205, 93, 109, 61, 13},
+    {0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60,
+     0, 64, 128, 192, 29, 93, 157, 221, 58, 122, 186, 250, 39, 103, 167, 231},
+    {0, 5, 10, 15, 20, 17, 30, 27, 40, 45, 34, 39, 60, 57, 54, 51,
+     0, 80, 160, 240, 93, 13, 253, 173, 186, 234, 26, 74, 231, 183, 71, 23},
+    {0, 6, 12, 10, 24, 30, 20, 18, 48, 54, 60, 58, 40, 46, 36, 34,
+     0, 96, 192, 160, 157, 253, 93, 61, 39, 71, 231, 135, 186, 218, 122, 26},
+    {0, 7, 14, 9, 28, 27, 18, 21, 56, 63, 54, 49, 36, 35, 42, 45,
+     0, 112, 224, 144, 221, 173, 61, 77, 167, 215, 71, 55, 122, 10, 154, 234},
+    {0, 8, 16, 24, 32, 40, 48, 56, 64, 72, 80, 88, 96, 104, 112, 120,
+     0, 128, 29, 157, 58, 186, 39, 167, 116, 244, 105, 233, 78, 206, 83, 211},
+    {0, 9, 18, 27, 36, 45, 54, 63, 72, 65, 90, 83, 108, 101, 126, 119,
+     0, 144, 61, 173, 122, 234, 71, 215, 244, 100, 201, 89, 142, 30, 179, 35},
+    {0, 10, 20, 30, 40, 34, 60, 54, 80, 90, 68, 78, 120, 114, 108, 102,
+     0, 160, 93, 253, 186, 26, 231, 71, 105, 201, 52, 148, 211, 115, 142, 46},
+    {0, 11, 22, 29, 44, 39, 58, 49, 88, 83, 78, 69, 116, 127, 98, 105,
+     0, 176, 125, 205, 250, 74, 135, 55, 233, 89, 148, 36, 19, 163, 110, 222},
+    {0, 12, 24, 20, 48, 60, 40, 36, 96, 108, 120, 116, 80, 92, 72, 68,
+     0, 192, 157, 93, 39, 231, 186, 122, 78, 142, 211, 19, 105, 169, 244, 52},
+    {0, 13, 26, 23, 52, 57, 46, 35, 104, 101, 114, 127, 92, 81, 70, 75,
+     0, 208, 189, 109, 103, 183, 218, 10, 206, 30, 115, 163, 169, 121, 20, 196},
+    {0, 14, 28, 18, 56, 54, 36, 42, 112, 126, 108, 98, 72, 70, 84, 90,
+     0, 224, 221, 61, 167, 71, 122, 154, 83, 179, 142, 110, 244, 20, 41, 201},
+    {0, 15, 30, 17, 60, 51, 34, 45, 120, 119, 102, 105, 68, 75, 90, 85,
+     0, 240, 253, 13, 231, 23, 26, 234, 211, 35, 46, 222, 52, 196, 201, 57},
+    {0, 16, 32, 48, 64, 80, 96, 112, 128, 144, 160, 176, 192, 208, 224, 240,
+     0, 29, 58, 39, 116, 105, 78, 83, 232, 245, 210, 207, 156, 129, 166, 187},
+    {0, 17, 34, 51, 68, 85, 102, 119, 136, 153, 170, 187, 204, 221, 238, 255,
+     0, 13, 26, 23, 52, 57, 46, 35, 104, 101, 114, 127, 92, 81, 70, 75},
+    {0, 18, 36, 54, 72, 90, 108, 126, 144, 130, 180, 166, 216, 202, 252, 238,
+     0, 61, 122, 71, 244, 201, 142, 179, 245, 200, 143, 178, 1, 60, 123, 70},
+    {0, 19, 38, 53, 76, 95, 106, 121, 152, 139, 190, 173, 212, 199, 242, 225,
+     0, 45, 90, 119, 180, 153, 238, 195, 117, 88, 47, 2, 193, 236, 155, 182},
+    {0, 20, 40, 60, 80, 68, 120, 108, 160, 180, 136, 156, 240, 228, 216, 204,
+     0, 93, 186, 231, 105, 52, 211, 142, 210, 143, 104, 53, 187, 230, 1, 92},
+    {0, 21, 42, 63, 84, 65, 126, 107, 168, 189, 130, 151, 252, 233, 214, 195,
+     0, 77, 154, 215, 41, 100, 179, 254, 82, 31, 200, 133, 123, 54, 225, 172},
+    {0, 22, 44, 58, 88, 78, 116, 98, 176, 166, 156, 138, 232, 254, 196, 210,
+     0, 125, 250, 135, 233, 148, 19, 110, 207, 178, 53, 72, 38, 91, 220, 161},
+    {0, 23, 46, 57, 92, 75, 114, 101, 184, 175, 150, 129, 228, 243, 202, 221,
+     0, 109, 218, 183, 169, 196, 115, 30, 79, 34, 149, 248, 230, 139, 60, 81},
+    {0, 24, 48, 40, 96, 120, 80, 72, 192, 216, 240, 232, 160, 184, 144, 136,
+     0, 157, 39, 186, 78, 211, 105, 244, 156, 1, 187, 38, 210, 79, 245, 104},
+    {0, 25, 50, 43, 100, 125, 86, 79, 200, 209, 250, 227, 172, 181, 158, 135,
+     0, 141, 7, 138, 14, 131, 9, 132, 28, 145, 27, 150, 18, 159, 21, 152},
+    {0, 26, 52, 46, 104, 114, 92, 70, 208, 202, 228, 254, 184, 162, 140, 150,
+     0, 189, 103, 218, 206, 115, 169, 20, 129, 60, 230, 91, 79, 242, 40, 149},
+    {0, 27, 54, 45, 108, 119, 90, 65, 216, 195, 238, 245, 180, 175, 130, 153,
+     0, 173, 71, 234, 142, 35, 201, 100, 1, 172, 70, 235, 143, 34, 200, 101},
+    {0, 28, 56, 36, 112, 108, 72, 84, 224, 252, 216, 196, 144, 140, 168, 180,
+     0, 221, 167, 122, 83, 142, 244, 41, 166, 123, 1, 220, 245, 40, 82, 143},
+    {0, 29, 58, 39, 116, 105, 78, 83, 232, 245, 210, 207, 156, 129, 166, 187,
+     0, 205, 135, 74, 19, 222, 148, 89, 38, 235, 161, 108, 53, 248, 178, 127},
+    {0, 30, 60, 34, 120, 102, 68, 90, 240, 238, 204, 210, 136, 150, 180, 170,
+     0, 253, 231, 26, 211, 46, 52, 201, 187, 70, 92, 161, 104, 149, 143, 114},
+    {0, 31, 62, 33, 124, 99, 66, 93, 248, 231, 198, 217, 132, 155, 186, 165,
+     0, 237, 199, 42, 147, 126, 84, 185, 59, 214, 252, 17, 168, 69, 111, 130},
+    {0, 32, 64, 96, 128, 160, 192, 224, 29, 61, 93, 125, 157, 189, 221, 253,
+     0, 58, 116, 78, 232, 210, 156, 166, 205, 247, 185, 131, 37, 31, 81, 107},
+    {0, 33, 66, 99, 132, 165, 198, 231, 21, 52, 87, 118, 145, 176, 211, 242,
+     0, 42, 84, 126, 168, 130, 252, 214, 77, 103, 25, 51, 229, 207, 177, 155},
+    {0, 34, 68, 102, 136, 170, 204, 238, 13, 47, 73, 107, 133, 167, 193, 227,
+     0, 26, 52, 46, 104, 114, 92, 70, 208, 202, 228, 254, 184, 162, 140, 150},
+    {0, 35, 70, 101, 140, 175, 202, 233, 5, 38, 67, 96, 137, 170, 207, 236,
+     0, 10, 20, 30, 40, 34, 60, 54, 80, 90, 68, 78, 120, 114, 108, 102},
+    {0, 36, 72, 108, 144, 180, 216, 252, 61, 25, 117, 81, 173, 137, 229, 193,
+     0, 122, 244, 142, 245, 143, 1, 123, 247, 141, 3, 121, 2, 120, 246, 140},
+    {0, 37, 74, 111, 148, 177, 222, 251, 53, 16, 127, 90, 161, 132, 235, 206,
+     0, 106, 212, 190, 181, 223, 97, 11, 119, 29, 163, 201, 194, 168, 22, 124},
+    {0, 38, 76, 106, 152, 190, 212, 242, 45, 11, 97, 71, 181, 147, 249, 223,
+     0, 90, 180, 238, 117, 47, 193, 155, 234, 176, 94, 4, 159, 197, 43, 113},
+    {0, 39, 78, 105, 156, 187, 210, 245, 37, 2, 107, 76, 185, 158, 247, 208,
+     0, 74, 148, 222, 53, 127, 161, 235, 106, 32, 254, 180, 95, 21, 203, 129},
+    {0, 40, 80, 120, 160, 136, 240, 216, 93, 117, 13, 37, 253, 213, 173, 133,
+     0, 186, 105, 211, 210, 104, 187, 1, 185, 3, 208, 106, 107, 209, 2, 184},
+    {0, 41, 82, 123, 164, 141, 246, 223, 85, 124, 7, 46, 241, 216, 163, 138,
+     0, 170, 73, 227, 146, 56, 219, 113, 57, 147, 112, 218, 171, 1, 226, 72},
+    {0, 42, 84, 126, 168, 130, 252, 214, 77, 103, 25, 51, 229, 207, 177, 155,
+     0, 154, 41, 179, 82, 200, 123, 225, 164, 62, 141, 23, 246, 108, 223, 69},
+    {0, 43, 86, 125, 172, 135, 250, 209, 69, 110, 19, 56, 233, 194, 191, 148,
+     0, 138, 9, 131, 18, 152, 27, 145, 36, 174, 45, 167, 54, 188, 63, 181},
+    {0, 44, 88, 116, 176, 156, 232, 196, 125, 81, 37, 9, 205, 225, 149, 185,
+     0, 250, 233, 19, 207, 53, 38, 220, 131, 121, 106, 144, 76, 182, 165, 95},
+    {0, 45, 90, 119, 180, 153, 238, 195, 117, 88, 47, 2, 193, 236, 155, 182,
+     0, 234, 201, 35, 143, 101, 70, 172, 3, 233, 202, 32, 140, 102, 69, 175},
+    {0, 46, 92, 114, 184, 150, 228, 202, 109, 67, 49, 31, 213, 251, 137, 167,
+     0, 218, 169, 115, 79, 149, 230, 60, 158, 68, 55, 237, 209, 11, 120, 162},
+    {0, 47, 94, 113, 188, 147, 226, 205, 101, 74, 59, 20, 217, 246, 135, 168,
+     0, 202, 137, 67, 15, 197, 134, 76, 30, 212, 151, 93, 17, 219, 152, 82},
+    {0, 48, 96, 80, 192, 240, 160, 144, 157, 173, 253, 205, 93, 109, 61, 13,
+     0, 39, 78, 105, 156, 187, 210, 245, 37, 2, 107, 76, 185, 158, 247, 208},
+    {0, 49, 98, 83, 196, 245, 166, 151, 149, 164, 247, 198, 81, 96, 51, 2,
+     0, 55, 110, 89, 220, 235, 178, 133, 165, 146, 203, 252, 121, 78, 23, 32},
+    {0, 50, 100, 86, 200, 250, 172, 158, 141, 191, 233, 219, 69, 119, 33, 19,
+     0, 7, 14, 9, 28, 27, 18, 21, 56, 63, 54, 49, 36, 35, 42, 45},
+    {0, 51, 102, 85, 204, 255, 170, 153, 133, 182, 227, 208, 73, 122, 47, 28,
+     0, 23, 46, 57, 92, 75, 114, 101, 184, 175, 150, 129, 228, 243, 202, 221},
+    {0, 52, 104, 92, 208, 228, 184, 140, 189, 137, 213, 225, 109, 89, 5, 49,
+     0, 103, 206, 169, 129, 230, 79, 40, 31, 120, 209, 182, 158, 249, 80, 55},
+    {0, 53, 106, 95, 212, 225, 190, 139, 181, 128, 223, 234, 97, 84, 11, 62,
+     0, 119, 238, 153, 193, 182, 47, 88, 159, 232, 113, 6, 94, 41, 176, 199},
+    {0, 54, 108, 90, 216, 238, 180, 130, 173, 155, 193, 247, 117, 67, 25, 47,
+     0, 71, 142, 201, 1, 70, 143, 200, 2, 69, 140, 203, 3, 68, 141, 202},
+    {0, 55, 110, 89, 220, 235, 178, 133, 165, 146, 203, 252, 121, 78, 23, 32,
+     0, 87, 174, 249, 65, 22, 239, 184, 130, 213, 44, 123, 195, 148, 109, 58},
+    {0, 56, 112, 72, 224, 216, 144, 168, 221, 229, 173, 149, 61, 5, 77, 117,
+     0, 167, 83, 244, 166, 1, 245, 82, 81, 246, 2, 165, 247, 80, 164, 3},
+    {0, 57, 114, 75, 228, 221, 150, 175, 213, 236, 167, 158, 49, 8, 67, 122,
+     0, 183, 115, 196, 230, 81, 149, 34, 209, 102, 162, 21, 55, 128, 68, 243},
+    {0, 58, 116, 78, 232, 210, 156, 166, 205, 247, 185, 131, 37, 31, 81, 107,
+     0, 135, 19, 148, 38, 161, 53, 178, 76, 203, 95, 216, 106, 237, 121, 254},
+    {0, 59, 118, 77, 236, 215, 154, 161, 197, 254, 179, 136, 41, 18, 95, 100,
+     0, 151, 51, 164, 102, 241, 85, 194, 204, 91, 255, 104, 170, 61, 153, 14},
+    {0, 60, 120, 68, 240, 204, 136, 180, 253, 193, 133, 185, 13, 49, 117, 73,
+     0, 231, 211, 52, 187, 92, 104, 143, 107, 140, 184, 95, 208, 55, 3, 228},
+    {0, 61, 122, 71, 244, 201, 142, 179, 245, 200, 143, 178, 1, 60, 123, 70,
+     0, 247, 243, 4, 251, 12, 8, 255, 235, 28, 24, 239, 16, 231, 227, 20},
+    {0, 62, 124, 66, 248, 198, 132, 186, 237, 211, 145, 175, 21, 43, 105, 87,
+     0, 199, 147, 84, 59, 252, 168, 111, 118, 177, 229, 34, 77, 138, 222, 25},
+    {0, 63, 126, 65, 252, 195, 130, 189, 229, 218, 155, 164, 25, 38, 103, 88,
+     0, 215, 179, 100, 123, 172, 200, 31, 246, 33, 69, 146, 141, 90, 62, 233},
+    {0, 64, 128, 192, 29, 93, 157, 221, 58, 122, 186, 250, 39, 103, 167, 231,
+     0, 116, 232, 156, 205, 185, 37, 81, 135, 243, 111, 27, 74, 62, 162, 214},
+    {0, 65, 130, 195, 25, 88, 155, 218, 50, 115, 176, 241, 43, 106, 169, 232,
+     0, 100, 200, 172, 141, 233, 69, 33, 7, 99, 207, 171, 138, 238, 66, 38},
+    {0, 66, 132, 198, 21, 87, 145, 211, 42, 104, 174, 236, 63, 125, 187, 249,
+     0, 84, 168, 252, 77, 25, 229, 177, 154, 206, 50, 102, 215, 131, 127, 43},
+    {0, 67, 134, 197, 17, 82, 151, 212, 34, 97, 164, 231, 51, 112, 181, 246,
+     0, 68, 136, 204, 13, 73, 133, 193, 26, 94, 146, 214, 23, 83, 159, 219},
+    {0, 68, 136, 204, 13, 73, 133, 193, 26, 94, 146, 214, 23, 83, 159, 219,
+     0, 52, 104, 92, 208, 228, 184, 140, 189, 137, 213, 225, 109, 89, 5, 49},
+    {0, 69, 138, 207, 9, 76, 131, 198, 18, 87, 152, 221, 27, 94, 145, 212,
+     0, 36, 72, 108, 144, 180, 216, 252, 61, 25, 117, 81, 173, 137, 229, 193},
+    {0, 70, 140, 202, 5, 67, 137, 207, 10, 76, 134, 192, 15, 73, 131, 197,
+     0, 20, 40, 60, 80, 68, 120, 108, 160, 180, 136, 156, 240, 228, 216, 204},
+    {0, 71, 142, 201, 1, 70, 143, 200, 2, 69, 140, 203, 3, 68, 141, 202,
+     0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60},
+    {0, 72, 144, 216, 61, 117, 173, 229, 122, 50, 234, 162, 71, 15, 215, 159,
+     0, 244, 245, 1, 247, 3, 2, 246, 243, 7, 6, 242, 4, 240, 241, 5},
+    {0, 73, 146, 219, 57, 112, 171, 226, 114, 59, 224, 169, 75, 2, 217, 144,
+     0, 228, 213, 49, 183, 83, 98, 134, 115, 151, 166, 66, 196, 32, 17, 245},
+    {0, 74, 148, 222, 53, 127, 161, 235, 106, 32, 254, 180, 95, 21, 203, 129,
+     0, 212, 181, 97, 119, 163, 194, 22, 238, 58, 91, 143, 153, 77, 44, 248},
+    {0, 75, 150, 221, 49, 122, 167, 236, 98, 41, 244, 191, 83, 24, 197, 142,
+     0, 196, 149, 81, 55, 243, 162, 102, 110, 170, 251, 63, 89, 157, 204, 8},
+    {0, 76, 152, 212, 45, 97, 181, 249, 90, 22, 194, 142, 119, 59, 239, 163,
+     0, 180, 117, 193, 234, 94, 159, 43, 201, 125, 188, 8, 35, 151, 86, 226},
+    {0, 77, 154, 215, 41, 100, 179, 254, 82, 31, 200, 133, 123, 54, 225, 172,
+     0, 164, 85, 241, 170, 14, 255, 91, 73, 237, 28, 184, 227, 71, 182, 18},
+    {0, 78, 156, 210, 37, 107, 185, 247, 74, 4, 214, 152, 111, 33, 243, 189,
+     0, 148, 53, 161, 106, 254, 95, 203, 212, 64, 225, 117, 190, 42, 139, 31},
+    {0, 79, 158, 209, 33, 110, 191, 240, 66, 13, 220, 147, 99, 44, 253, 178,
+     0, 132, 21, 145, 42, 174, 63, 187, 84, 208, 65, 197, 126, 250, 107, 239},
+    {0, 80, 160, 240, 93, 13, 253, 173, 186, 234, 26, 74, 231, 183, 71, 23,
+     0, 105, 210, 187, 185, 208, 107, 2, 111, 6, 189, 212, 214, 191, 4, 109},
+    {0, 81, 162, 243, 89, 8, 251, 170, 178, 227, 16, 65, 235, 186, 73, 24,
+     0, 121, 242, 139, 249, 128, 11, 114, 239, 150, 29, 100, 22, 111, 228, 157},
+    {0, 82, 164, 246, 85, 7, 241, 163, 170, 248, 14, 92, 255, 173, 91, 9,
+     0, 73, 146, 219, 57, 112, 171, 226, 114, 59, 224, 169, 75, 2, 217, 144},
+    {0, 83, 166, 245, 81, 2, 247, 164, 162, 241, 4, 87, 243, 160, 85, 6,
+     0, 89, 178, 235, 121, 32, 203, 146, 242, 171, 64, 25, 139, 210, 57, 96},
+    {0, 84, 168, 252, 77, 25, 229, 177, 154, 206, 50, 102, 215, 131, 127, 43,
+     0, 41, 82, 123, 164, 141, 246, 223, 85, 124, 7, 46, 241, 216, 163, 138},
+    {0, 85, 170, 255, 73, 28, 227, 182, 146, 199, 56, 109, 219, 142, 113, 36,
+     0, 57, 114, 75, 228, 221, 150, 175, 213, 236, 167, 158, 49, 8, 67, 122},
+    {0, 86, 172, 250, 69, 19, 233, 191, 138, 220, 38, 112, 207, 153, 99, 53,
+     0, 9, 18, 27, 36, 45, 54, 63, 72, 65, 90, 83, 108, 101, 126, 119},
+    {0, 87, 174, 249, 65, 22, 239, 184, 130, 213, 44, 123, 195, 148, 109, 58,
+     0, 25, 50, 43, 100, 125, 86, 79, 200, 209, 250, 227, 172, 181, 158, 135},
+    {0, 88, 176, 232, 125, 37, 205, 149, 250, 162, 74, 18, 135, 223, 55, 111,
+     0, 233, 207, 38, 131, 106, 76, 165, 27, 242, 212, 61, 152, 113, 87, 190},
+    {0, 89, 178, 235, 121, 32, 203, 146, 242, 171, 64, 25, 139, 210, 57, 96,
+     0, 249, 239, 22, 195, 58, 44, 213, 155, 98, 116, 141, 88, 161, 183, 78},
+    {0, 90, 180, 238, 117, 47, 193, 155, 234, 176, 94, 4, 159, 197, 43, 113,
+     0, 201, 143, 70, 3, 202, 140, 69, 6, 207, 137, 64, 5, 204, 138, 67},
+    {0, 91, 182, 237, 113, 42, 199, 156, 226, 185, 84, 15, 147, 200, 37, 126,
+     0, 217, 175, 118, 67, 154, 236, 53, 134, 95, 41, 240, 197, 28, 106, 179},
+    {0, 92, 184, 228, 109, 49, 213, 137, 218, 134, 98, 62, 183, 235, 15, 83,
+     0, 169, 79, 230, 158, 55, 209, 120, 33, 136, 110, 199, 191, 22, 240, 89},
+    {0, 93, 186, 231, 105, 52, 211, 142, 210, 143, 104, 53, 187, 230, 1, 92,
+     0, 185, 111, 214, 222, 103, 177, 8, 161, 24, 206, 119, 127, 198, 16, 169},
+    {0, 94, 188, 226, 101, 59, 217, 135, 202, 148, 118, 40, 175, 241, 19, 77,
+     0, 137, 15, 134, 30, 151, 17, 152, 60, 181, 51, 186, 34, 171, 45, 164},
+    {0, 95, 190, 225, 97, 62, 223, 128, 194, 157, 124, 35, 163, 252, 29, 66,
+     0, 153, 47, 182, 94, 199, 113, 232, 188, 37, 147, 10, 226, 123, 205, 84},
+    {0, 96, 192, 160, 157, 253, 93, 61, 39, 71, 231, 135, 186, 218, 122, 26,
+     0, 78, 156, 210, 37, 107, 185, 247, 74, 4, 214, 152, 111, 33, 243, 189},
+    {0, 97, 194, 163, 153, 248, 91, 58, 47, 78, 237, 140, 182, 215, 116, 21,
+     0, 94, 188, 226, 101, 59, 217, 135, 202, 148, 118, 40, 175, 241, 19, 77},
+    {0, 98, 196, 166, 149, 247, 81, 51, 55, 85, 243, 145, 162, 192, 102, 4,
+     0, 110, 220, 178, 165, 203, 121, 23, 87, 57, 139, 229, 242, 156, 46, 64},
+    {0, 99, 198, 165, 145, 242, 87, 52, 63, 92, 249, 154, 174, 205, 104, 11,
+     0, 126, 252, 130, 229, 155, 25, 103, 215, 169, 43, 85, 50, 76, 206, 176},
+    {0, 100, 200, 172, 141, 233, 69, 33, 7, 99, 207, 171, 138, 238, 66, 38,
+     0, 14, 28, 18, 56, 54, 36, 42, 112, 126, 108, 98, 72, 70, 84, 90},
+    {0, 101, 202, 175, 137, 236, 67, 38, 15, 106, 197, 160, 134, 227, 76, 41,
+     0, 30, 60, 34, 120, 102, 68, 90, 240, 238, 204, 210, 136, 150, 180, 170},
+    {0, 102, 204, 170, 133, 227, 73, 47, 23, 113, 219, 189, 146, 244, 94, 56,
+     0, 46, 92, 114, 184, 150, 228, 202, 109, 67, 49, 31, 213, 251, 137, 167},
+    {0, 103, 206, 169, 129, 230, 79, 40, 31, 120, 209, 182, 158, 249, 80, 55,
+     0, 62, 124, 66, 248, 198, 132, 186, 237, 211, 145, 175, 21, 43, 105, 87},
+    {0, 104, 208, 184, 189, 213, 109, 5, 103, 15, 183, 223, 218, 178, 10, 98,
+     0, 206, 129, 79, 31, 209, 158, 80, 62, 240, 191, 113, 33, 239, 160, 110},
+    {0, 105, 210, 187, 185, 208, 107, 2, 111, 6, 189, 212, 214, 191, 4, 109,
+     0, 222, 161, 127, 95, 129, 254, 32, 190, 96, 31, 193, 225, 63, 64, 158},
+    {0, 106, 212, 190, 181, 223, 97, 11, 119, 29, 163, 201, 194, 168, 22, 124,
+     0, 238, 193, 47, 159, 113, 94, 176, 35, 205, 226, 12, 188, 82, 125, 147},
+    {0, 107, 214, 189, 177, 218, 103, 12, 127, 20, 169, 194, 206, 165, 24, 115,
+     0, 254, 225, 31, 223, 33, 62, 192, 163, 93, 66, 188, 124, 130, 157, 99},
+    {0, 108, 216, 180, 173, 193, 117, 25, 71, 43, 159, 243, 234, 134, 50, 94,
+     0, 142, 1, 143, 2, 140, 3, 141, 4, 138, 5, 139, 6, 136, 7, 137},
+    {0, 109, 218, 183, 169, 196, 115, 30, 79, 34, 149, 248, 230, 139, 60, 81,
+     0, 158, 33, 191, 66, 220, 99, 253, 132, 26, 165, 59, 198, 88, 231, 121},
+    {0, 110, 220, 178, 165, 203, 121, 23, 87, 57, 139, 229, 242, 156, 46, 64,
+     0, 174, 65, 239, 130, 44, 195, 109, 25, 183, 88, 246, 155, 53, 218, 116},
+    {0, 111, 222, 177, 161, 206, 127, 16, 95, 48, 129, 238, 254, 145, 32, 79,
+     0, 190, 97, 223, 194, 124, 163, 29, 153, 39, 248, 70, 91, 229, 58, 132},
+    {0, 112, 224, 144, 221, 173, 61, 77, 167, 215, 71, 55, 122, 10, 154, 234,
+     0, 83, 166, 245, 81, 2, 247, 164, 162, 241, 4, 87, 243, 160, 85, 6},
+    {0, 113, 226, 147, 217, 168, 59, 74, 175, 222, 77, 60, 118, 7, 148, 229,
+     0, 67, 134, 197, 17, 82, 151, 212, 34, 97, 164, 231, 51, 112, 181, 246},
+    {0, 114, 228, 150, 213, 167, 49, 67, 183, 197, 83, 33, 98, 16, 134, 244,
+     0, 115, 230, 149, 209, 162, 55, 68, 191, 204, 89, 42, 110, 29, 136, 251},
+    {0, 115, 230, 149, 209, 162, 55, 68, 191, 204, 89, 42, 110, 29, 136, 251,
+     0, 99, 198, 165, 145, 242, 87, 52, 63, 92, 249, 154, 174, 205, 104, 11},
+    {0, 116, 232, 156, 205, 185, 37, 81, 135, 243, 111, 27, 74, 62, 162, 214,
+     0, 19, 38, 53, 76, 95, 106, 121, 152, 139, 190, 173, 212, 199, 242, 225},
+    {0, 117, 234, 159, 201, 188, 35, 86, 143, 250, 101, 16, 70, 51, 172, 217,
+     0, 3, 6, 5, 12, 15, 10, 9, 24, 27, 30, 29, 20, 23, 18, 17},
+    {0, 118, 236, 154, 197, 179, 41, 95, 151, 225, 123, 13, 82, 36, 190, 200,
+     0, 51, 102, 85, 204, 255, 170, 153, 133, 182, 227, 208, 73, 122, 47, 28},
+    {0, 119, 238, 153, 193, 182, 47, 88, 159, 232, 113, 6, 94, 41, 176, 199,
+     0, 35, 70, 101, 140, 175, 202, 233, 5, 38, 67, 96, 137, 170, 207, 236},
+    {0, 120, 240, 136, 253, 133, 13, 117, 231, 159, 23, 111, 26, 98, 234, 146,
+     0, 211, 187, 104, 107, 184, 208, 3, 214, 5, 109, 190, 189, 110, 6, 213},
+    {0, 121, 242, 139, 249, 128, 11, 114, 239, 150, 29, 100, 22, 111, 228, 157,
+     0, 195, 155, 88, 43, 232, 176, 115, 86, 149, 205, 14, 125, 190, 230, 37},
+    {0, 122, 244, 142, 245, 143, 1, 123, 247, 141, 3, 121, 2, 120, 246, 140,
+     0, 243, 251, 8, 235, 24, 16, 227, 203, 56, 48, 195, 32, 211, 219, 40},
+    {0, 123, 246, 141, 241, 138, 7, 124, 255, 132, 9, 114, 14, 117, 248, 131,
+     0, 227, 219, 56, 171, 72, 112, 147, 75, 168, 144, 115, 224, 3, 59, 216},
+    {0, 124, 248, 132, 237, 145, 21, 105, 199, 187, 63, 67, 42, 86, 210, 174,
+     0, 147, 59, 168, 118, 229, 77, 222, 236, 127, 215, 68, 154, 9, 161, 50},
+    {0, 125, 250, 135, 233, 148, 19, 110, 207, 178, 53, 72, 38, 91, 220, 161,
+     0, 131, 27, 152, 54, 181, 45, 174, 108, 239, 119, 244, 90, 217, 65, 194},
+    {0, 126, 252, 130, 229, 155, 25, 103, 215, 169, 43, 85, 50, 76, 206, 176,
+     0, 179, 123, 200, 246, 69, 141, 62, 241, 66, 138, 57, 7, 180, 124, 207},
+    {0, 127, 254, 129, 225, 158, 31, 96, 223, 160, 33, 94, 62, 65, 192, 191,
+     0, 163, 91, 248, 182, 21, 237, 78, 113, 210, 42, 137, 199, 100, 156, 63},
+    {0, 128, 29, 157, 58, 186, 39, 167, 116, 244, 105, 233, 78, 206, 83, 211,
+     0, 232, 205, 37, 135, 111, 74, 162, 19, 251, 222, 54, 148, 124, 89, 177},
+    {0, 129, 31, 158, 62, 191, 33, 160, 124, 253, 99, 226, 66, 195, 93, 220,
+     0, 248, 237, 21, 199, 63, 42, 210, 147, 107, 126, 134, 84, 172, 185, 65},
+    {0, 130, 25, 155, 50, 176, 43, 169, 100, 230, 125, 255, 86, 212, 79, 205,
+     0, 200, 141, 69, 7, 207, 138, 66, 14, 198, 131, 75, 9, 193, 132, 76},
+    {0, 131, 27, 152, 54, 181, 45, 174, 108, 239, 119, 244, 90, 217, 65, 194,
+     0, 216, 173, 117, 71, 159, 234, 50, 142, 86, 35, 251, 201, 17, 100, 188},
+    {0, 132, 21, 145, 42, 174, 63, 187, 84, 208, 65, 197, 126, 250, 107, 239,
+     0, 168, 77, 229, 154, 50, 215, 127, 41, 129, 100, 204, 179, 27, 254, 86},
+    {0, 133, 23, 146, 46, 171, 57, 188, 92, 217, 75, 206, 114, 247, 101, 224,
+     0, 184, 109, 213, 218, 98, 183, 15, 169, 17, 196, 124, 115, 203, 30, 166},
+    {0, 134, 17, 151, 34, 164, 51, 181, 68, 194, 85, 211, 102, 224, 119, 241,
+     0, 136, 13, 133, 26, 146, 23, 159, 52, 188, 57, 177, 46, 166, 35, 171},
+    {0, 135, 19, 148, 38, 161, 53, 178, 76, 203, 95, 216, 106, 237, 121, 254,
+     0, 152, 45, 181, 90, 194, 119, 239, 180, 44, 153, 1, 238, 118, 195, 91},
+    {0, 136, 13, 133, 26, 146, 23, 159, 52, 188, 57, 177, 46, 166, 35, 171,
+     0, 104, 208, 184, 189, 213, 109, 5, 103, 15, 183, 223, 218, 178, 10, 98},
+    {0, 137, 15, 134, 30, 151, 17, 152, 60, 181, 51, 186, 34, 171, 45, 164,
+     0, 120, 240, 136, 253, 133, 13, 117, 231, 159, 23, 111, 26, 98, 234, 146},
+    {0, 138, 9, 131, 18, 152, 27, 145, 36, 174, 45, 167, 54, 188, 63, 181,
+     0, 72, 144, 216, 61, 117, 173, 229, 122, 50, 234, 162, 71, 15, 215, 159},
+    {0, 139, 11, 128, 22, 157, 29, 150, 44, 167, 39, 172, 58, 177, 49, 186,
+     0, 88, 176, 232, 125, 37, 205, 149, 250, 162, 74, 18, 135, 223, 55, 111},
+    {0, 140, 5, 137, 10, 134, 15, 131, 20, 152, 17, 157, 30, 146, 27, 151,
+     0, 40, 80, 120, 160, 136, 240, 216, 93, 117, 13, 37, 253, 213, 173, 133},
+    {0, 141, 7, 138, 14, 131, 9, 132, 28, 145, 27, 150, 18, 159, 21, 152,
+     0, 56, 112, 72, 224, 216, 144, 168, 221, 229, 173, 149, 61, 5, 77, 117},
+    {0, 142, 1, 143, 2, 140, 3, 141, 4, 138, 5, 139, 6, 136, 7, 137,
+     0, 8, 16, 24, 32, 40, 48, 56, 64, 72, 80, 88, 96, 104, 112, 120},
+    {0, 143, 3, 140, 6, 137, 5, 138, 12, 131, 15, 128, 10, 133, 9, 134,
+     0, 24, 48, 40, 96, 120, 80, 72, 192, 216, 240, 232, 160, 184, 144, 136},
+    {0, 144, 61, 173, 122, 234, 71, 215, 244, 100, 201, 89, 142, 30, 179, 35,
+     0, 245, 247, 2, 243, 6, 4, 241, 251, 14, 12, 249, 8, 253, 255, 10},
+    {0, 145, 63, 174, 126, 239, 65, 208, 252, 109, 195, 82, 130, 19, 189, 44,
+     0, 229, 215, 50, 179, 86, 100, 129, 123, 158, 172, 73, 200, 45, 31, 250},
+    {0, 146, 57, 171, 114, 224, 75, 217, 228, 118, 221, 79, 150, 4, 175, 61,
+     0, 213, 183, 98, 115, 166, 196, 17, 230, 51, 81, 132, 149, 64, 34, 247},
+    {0, 147, 59, 168, 118, 229, 77, 222, 236, 127, 215, 68, 154, 9, 161, 50,
+     0, 197, 151, 82, 51, 246, 164, 97, 102, 163, 241, 52, 85, 144, 194, 7},
+    {0, 148, 53, 161, 106, 254, 95, 203, 212, 64, 225, 117, 190, 42, 139, 31,
+     0, 181, 119, 194, 238, 91, 153, 44, 193, 116, 182, 3, 47, 154, 88, 237},
+    {0, 149, 55, 162, 110, 251, 89, 204, 220, 73, 235, 126, 178, 39, 133, 16,
+     0, 165, 87, 242, 174, 11, 249, 92, 65, 228, 22, 179, 239, 74, 184, 29},
+    {0, 150, 49, 167, 98, 244, 83, 197, 196, 82, 245, 99, 166, 48, 151, 1,
+     0, 149, 55, 162, 110, 251, 89, 204, 220, 73, 235, 126, 178, 39, 133, 16},
+    {0, 151, 51, 164, 102, 241, 85, 194, 204, 91, 255, 104, 170, 61, 153, 14,
+     0, 133, 23, 146, 46, 171, 57, 188, 92, 217, 75, 206, 114, 247, 101, 224},
+    {0, 152, 45, 181, 90, 194, 119, 239, 180, 44, 153, 1, 238, 118, 195, 91,
+     0, 117, 234, 159, 201, 188, 35, 86, 143, 250, 101, 16, 70, 51, 172, 217},
+    {0, 153, 47, 182, 94, 199, 113, 232, 188, 37, 147, 10, 226, 123, 205, 84,
+     0, 101, 202, 175, 137, 236, 67, 38, 15, 106, 197, 160, 134, 227, 76, 41},
+    {0, 154, 41, 179, 82, 200, 123, 225, 164, 62, 141, 23, 246, 108, 223, 69,
+     0, 85, 170, 255, 73, 28, 227, 182, 146, 199, 56, 109, 219, 142, 113, 36},
+    {0, 155, 43, 176, 86, 205, 125, 230, 172, 55, 135, 28, 250, 97, 209, 74,
+     0, 69, 138, 207, 9, 76, 131, 198, 18, 87, 152, 221, 27, 94, 145, 212},
+    {0, 156, 37, 185, 74, 214, 111, 243, 148, 8, 177, 45, 222, 66, 251, 103,
+     0, 53, 106, 95, 212, 225, 190, 139, 181, 128, 223, 234, 97, 84, 11, 62},
+    {0, 157, 39, 186, 78, 211, 105, 244, 156, 1, 187, 38, 210, 79, 245, 104,
+     0, 37, 74, 111, 148, 177, 222, 251, 53, 16, 127, 90, 161, 132, 235, 206},
+    {0, 158, 33, 191, 66, 220, 99, 253, 132, 26, 165, 59, 198, 88, 231, 121,
+     0, 21, 42, 63, 84, 65, 126, 107, 168, 189, 130, 151, 252, 233, 214, 195},
+    {0, 159, 35, 188, 70, 217, 101, 250, 140, 19, 175, 48, 202, 85, 233, 118,
+     0, 5, 10, 15, 20, 17, 30, 27, 40, 45, 34, 39, 60, 57, 54, 51},
+    {0, 160, 93, 253, 186, 26, 231, 71, 105, 201, 52, 148, 211, 115, 142, 46,
+     0, 210, 185, 107, 111, 189, 214, 4, 222, 12, 103, 181, 177, 99, 8, 218},
+    {0, 161, 95, 254, 190, 31, 225, 64, 97, 192, 62, 159, 223, 126, 128, 33,
+     0, 194, 153, 91, 47, 237, 182, 116, 94, 156, 199, 5, 113, 179, 232, 42},
+    {0, 162, 89, 251, 178, 16, 235, 73, 121, 219, 32, 130, 203, 105, 146, 48,
+     0, 242, 249, 11, 239, 29, 22, 228, 195, 49, 58, 200, 44, 222, 213, 39},
+    {0, 163, 91, 248, 182, 21, 237, 78, 113, 210, 42, 137, 199, 100, 156, 63,
+     0, 226, 217, 59, 175, 77, 118, 148, 67, 161, 154, 120, 236, 14, 53, 215},
+    {0, 164, 85, 241, 170, 14, 255, 91, 73, 237, 28, 184, 227, 71, 182, 18,
+     0, 146, 57, 171, 114, 224, 75, 217, 228, 118, 221, 79, 150, 4, 175, 61},
+    {0, 165, 87, 242, 174, 11, 249, 92, 65, 228, 22, 179, 239, 74, 184, 29,
+     0, 130, 25, 155, 50, 176, 43, 169, 100, 230, 125, 255, 86, 212, 79, 205},
+    {0, 166, 81, 247, 162, 4, 243, 85, 89, 255, 8, 174, 251, 93, 170, 12,
+     0, 178, 121, 203, 242, 64, 139, 57, 249, 75, 128, 50, 11, 185, 114, 192},
+    {0, 167, 83, 244, 166, 1, 245, 82, 81, 246, 2, 165, 247, 80, 164, 3,
+     0, 162, 89, 251, 178, 16, 235, 73, 121, 219, 32, 130, 203, 105, 146, 48},
+    {0, 168, 77, 229, 154, 50, 215, 127, 41, 129, 100, 204, 179, 27, 254, 86,
+     0, 82, 164, 246, 85, 7, 241, 163, 170, 248, 14, 92, 255, 173, 91, 9},
+    {0, 169, 79, 230, 158, 55, 209, 120, 33, 136, 110, 199, 191, 22, 240, 89,
+     0, 66, 132, 198, 21, 87, 145, 211, 42, 104, 174, 236, 63, 125, 187, 249},
+    {0, 170, 73, 227, 146, 56, 219, 113, 57, 147, 112, 218, 171, 1, 226, 72,
+     0, 114, 228, 150, 213, 167, 49, 67, 183, 197, 83, 33, 98, 16, 134, 244},
+    {0, 171, 75, 224, 150, 61, 221, 118, 49, 154, 122, 209, 167, 12, 236, 71,
+     0, 98, 196, 166, 149, 247, 81, 51, 55, 85, 243, 145, 162, 192, 102, 4},
+    {0, 172, 69, 233, 138, 38, 207, 99, 9, 165, 76, 224, 131, 47, 198, 106,
+     0, 18, 36, 54, 72, 90, 108, 126, 144, 130, 180, 166, 216, 202, 252, 238},
+    {0, 173, 71, 234, 142, 35, 201, 100, 1, 172, 70, 235, 143, 34, 200, 101,
+     0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30},
+    {0, 174, 65, 239, 130, 44, 195, 109, 25, 183, 88, 246, 155, 53, 218, 116,
+     0, 50, 100, 86, 200, 250, 172, 158, 141, 191, 233, 219, 69, 119, 33, 19},
+    {0, 175, 67, 236, 134, 41, 197, 106, 17, 190, 82, 253, 151, 56, 212, 123,
+     0, 34, 68, 102, 136, 170, 204, 238, 13, 47, 73, 107, 133, 167, 193, 227},
+    {0, 176, 125, 205, 250, 74, 135, 55, 233, 89, 148, 36, 19, 163, 110, 222,
+     0, 207, 131, 76, 27, 212, 152, 87, 54, 249, 181, 122, 45, 226, 174, 97},
+    {0, 177, 127, 206, 254, 79, 129, 48, 225, 80, 158, 47, 31, 174, 96, 209,
+     0, 223, 163, 124, 91, 132, 248, 39, 182, 105, 21, 202, 237, 50, 78, 145},
+    {0, 178, 121, 203, 242, 64, 139, 57, 249, 75, 128, 50, 11, 185, 114, 192,
+     0, 239, 195, 44, 155, 116, 88, 183, 43, 196, 232, 7, 176, 95, 115, 156},
+    {0, 179, 123, 200, 246, 69, 141, 62, 241, 66, 138, 57, 7, 180, 124, 207,
+     0, 255, 227, 28, 219, 36, 56, 199, 171, 84, 72, 183, 112, 143, 147, 108},
+    {0, 180, 117, 193, 234, 94, 159, 43, 201, 125, 188, 8, 35, 151, 86, 226,
+     0, 143, 3, 140, 6, 137, 5, 138, 12, 131, 15, 128, 10, 133, 9, 134},
+    {0, 181, 119, 194, 238, 91, 153, 44, 193, 116, 182, 3, 47, 154, 88, 237,
+     0, 159, 35, 188, 70, 217, 101, 250, 140, 19, 175, 48, 202, 85, 233, 118},
+    {0, 182, 113, 199, 226, 84, 147, 37, 217, 111, 168, 30, 59, 141, 74, 252,
+     0, 175, 67, 236, 134, 41, 197, 106, 17, 190, 82, 253, 151, 56, 212, 123},
+    {0, 183, 115, 196, 230, 81, 149, 34, 209, 102, 162, 21, 55, 128, 68, 243,
+     0, 191, 99, 220, 198, 121, 165, 26, 145, 46, 242, 77, 87, 232, 52, 139},
+    {0, 184, 109, 213, 218, 98, 183, 15, 169, 17, 196, 124, 115, 203, 30, 166,
+     0, 79, 158, 209, 33, 110, 191, 240, 66, 13, 220, 147, 99, 44, 253, 178},
+    {0, 185, 111, 214, 222, 103, 177, 8, 161, 24, 206, 119, 127, 198, 16, 169,
+     0, 95, 190, 225, 97, 62, 223, 128, 194, 157, 124, 35, 163, 252, 29, 66},
+    {0, 186, 105, 211, 210, 104, 187, 1, 185, 3, 208, 106, 107, 209, 2, 184,
+     0, 111, 222, 177, 161, 206, 127, 16, 95, 48, 129, 238, 254, 145, 32, 79},
+    {0, 187, 107, 208, 214, 109, 189, 6, 177, 10, 218, 97, 103, 220, 12, 183,
+     0, 127, 254, 129, 225, 158, 31, 96, 223, 160, 33, 94, 62, 65, 192, 191},
+    {0, 188, 101, 217, 202, 118, 175, 19, 137, 53, 236, 80, 67, 255, 38, 154,
+     0, 15, 30, 17, 60, 51, 34, 45, 120, 119, 102, 105, 68, 75, 90, 85},
+    {0, 189, 103, 218, 206, 115, 169, 20, 129, 60, 230, 91, 79, 242, 40, 149,
+     0, 31, 62, 33, 124, 99, 66, 93, 248, 231, 198, 217, 132, 155, 186, 165},
+    {0, 190, 97, 223, 194, 124, 163, 29, 153, 39, 248, 70, 91, 229, 58, 132,
+     0, 47, 94, 113, 188, 147, 226, 205, 101, 74, 59, 20, 217, 246, 135, 168},
+    {0, 191, 99, 220, 198, 121, 165, 26, 145, 46, 242, 77, 87, 232, 52, 139,
+     0, 63, 126, 65, 252, 195, 130, 189, 229, 218, 155, 164, 25, 38, 103, 88},
+    {0, 192, 157, 93, 39, 231, 186, 122, 78, 142, 211, 19, 105, 169, 244, 52,
+     0, 156, 37, 185, 74, 214, 111, 243, 148, 8, 177, 45, 222, 66, 251, 103},
+    {0, 193, 159, 94, 35, 226, 188, 125, 70, 135, 217, 24, 101, 164, 250, 59,
+     0, 140, 5, 137, 10, 134, 15, 131, 20, 152, 17, 157, 30, 146, 27, 151},
+    {0, 194, 153, 91, 47, 237, 182, 116, 94, 156, 199, 5, 113, 179, 232, 42,
+     0, 188, 101, 217, 202, 118, 175, 19, 137, 53, 236, 80, 67, 255, 38, 154},
+    {0, 195, 155, 88, 43, 232, 176, 115, 86, 149, 205, 14, 125, 190, 230, 37,
+     0, 172, 69, 233, 138, 38, 207, 99, 9, 165, 76, 224, 131, 47, 198, 106},
+    {0, 196, 149, 81, 55, 243, 162, 102, 110, 170, 251, 63, 89, 157, 204, 8,
+     0, 220, 165, 121, 87, 139, 242, 46, 174, 114, 11, 215, 249, 37, 92, 128},
+    {0, 197, 151, 82, 51, 246, 164, 97, 102, 163, 241, 52, 85, 144, 194, 7,
+     0, 204, 133, 73, 23, 219, 146, 94, 46, 226, 171, 103, 57, 245, 188, 112},
+    {0, 198, 145, 87, 63, 249, 174, 104, 126, 184, 239, 41, 65, 135, 208, 22,
+     0, 252, 229, 25, 215, 43, 50, 206, 179, 79, 86, 170, 100, 152, 129, 125},
+    {0, 199, 147, 84, 59, 252, 168, 111, 118, 177, 229, 34, 77, 138, 222, 25,
+     0, 236, 197, 41, 151, 123, 82, 190, 51, 223, 246, 26, 164, 72, 97, 141},
+    {0, 200, 141, 69, 7, 207, 138, 66, 14, 198, 131, 75, 9, 193, 132, 76,
+     0, 28, 56, 36, 112, 108, 72, 84, 224, 252, 216, 196, 144, 140, 168, 180},
+    {0, 201, 143, 70, 3, 202, 140, 69, 6, 207, 137, 64, 5, 204, 138, 67,
+     0, 12, 24, 20, 48, 60, 40, 36, 96, 108, 120, 116, 80, 92, 72, 68},
+    {0, 202, 137, 67, 15, 197, 134, 76, 30, 212, 151, 93, 17, 219, 152, 82,
+     0, 60, 120, 68, 240, 204, 136, 180, 253, 193, 133, 185, 13, 49, 117, 73},
+    {0, 203, 139, 64, 11, 192, 128, 75, 22, 221, 157, 86, 29, 214, 150, 93,
+     0, 44, 88, 116, 176, 156, 232, 196, 125, 81, 37, 9, 205, 225, 149, 185},
+    {0, 204, 133, 73, 23, 219, 146, 94, 46, 226, 171, 103, 57, 245, 188, 112,
+     0, 92, 184, 228, 109, 49, 213, 137, 218, 134, 98, 62, 183, 235, 15, 83},
+    {0, 205, 135, 74, 19, 222, 148, 89, 38, 235, 161, 108, 53, 248, 178, 127,
+     0, 76, 152, 212, 45, 97, 181, 249, 90, 22, 194, 142, 119, 59, 239, 163},
+    {0, 206, 129, 79, 31, 209, 158, 80, 62, 240, 191, 113, 33, 239, 160, 110,
+     0, 124, 248, 132, 237, 145, 21, 105, 199, 187, 63, 67, 42, 86, 210, 174},
+    {0, 207, 131, 76, 27, 212, 152, 87, 54, 249, 181, 122, 45, 226, 174, 97,
+     0, 108, 216, 180, 173, 193, 117, 25, 71, 43, 159, 243, 234, 134, 50, 94},
+    {0, 208, 189, 109, 103, 183, 218, 10, 206, 30, 115, 163, 169, 121, 20, 196,
+     0, 129, 31, 158, 62, 191, 33, 160, 124, 253, 99, 226, 66, 195, 93, 220},
+    {0, 209, 191, 110, 99, 178, 220, 13, 198, 23, 121, 168, 165, 116, 26, 203,
+     0, 145, 63, 174, 126, 239, 65, 208, 252, 109, 195, 82, 130, 19, 189, 44},
+    {0, 210, 185, 107, 111, 189, 214, 4, 222, 12, 103, 181, 177, 99, 8, 218,
+     0, 161, 95, 254, 190, 31, 225, 64, 97, 192, 62, 159, 223, 126, 128, 33},
+    {0, 211, 187, 104, 107, 184, 208, 3, 214, 5, 109, 190, 189, 110, 6, 213,
+     0, 177, 127, 206, 254, 79, 129, 48, 225, 80, 158, 47, 31, 174, 96, 209},
+    {0, 212, 181, 97, 119, 163, 194, 22, 238, 58, 91, 143, 153, 77, 44, 248,
+     0, 193, 159, 94, 35, 226, 188, 125, 70, 135, 217, 24, 101, 164, 250, 59},
+    {0, 213, 183, 98, 115, 166, 196, 17, 230, 51, 81, 132, 149, 64, 34, 247,
+     0, 209, 191, 110, 99, 178, 220, 13, 198, 23, 121, 168, 165, 116, 26, 203},
+    {0, 214, 177, 103, 127, 169, 206, 24, 254, 40, 79, 153, 129, 87, 48, 230,
+     0, 225, 223, 62, 163, 66, 124, 157, 91, 186, 132, 101, 248, 25, 39, 198},
+    {0, 215, 179, 100, 123, 172, 200, 31, 246, 33, 69, 146, 141, 90, 62, 233,
+     0, 241, 255, 14, 227, 18, 28, 237, 219, 42, 36, 213, 56, 201, 199, 54},
+    {0, 216, 173, 117, 71, 159, 234, 50, 142, 86, 35, 251, 201, 17, 100, 188,
+     0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+    {0, 217, 175, 118, 67, 154, 236, 53, 134, 95, 41, 240, 197, 28, 106, 179,
+     0, 17, 34, 51, 68, 85, 102, 119, 136, 153, 170, 187, 204, 221, 238, 255},
+    {0, 218, 169, 115, 79, 149, 230, 60, 158, 68, 55, 237, 209, 11, 120, 162,
+     0, 33, 66, 99, 132, 165, 198, 231, 21, 52, 87, 118, 145, 176, 211, 242},
+    {0, 219, 171, 112, 75, 144, 224, 59, 150, 77, 61, 230, 221, 6, 118, 173,
+     0, 49, 98, 83, 196, 245, 166, 151, 149, 164, 247, 198, 81, 96, 51, 2},
+    {0, 220, 165, 121, 87, 139, 242, 46, 174, 114, 11, 215, 249, 37, 92, 128,
+     0, 65, 130, 195, 25, 88, 155, 218, 50, 115, 176, 241, 43, 106, 169, 232},
+    {0, 221, 167, 122, 83, 142, 244, 41, 166, 123, 1, 220, 245, 40, 82, 143,
+     0, 81, 162, 243, 89, 8, 251, 170, 178, 227, 16, 65, 235, 186, 73, 24},
+    {0, 222, 161, 127, 95, 129, 254, 32, 190, 96, 31, 193, 225, 63, 64, 158,
+     0, 97, 194, 163, 153, 248, 91, 58, 47, 78, 237, 140, 182, 215, 116, 21},
+    {0, 223, 163, 124, 91, 132, 248, 39, 182, 105, 21, 202, 237, 50, 78, 145,
+     0, 113, 226, 147, 217, 168, 59, 74, 175, 222, 77, 60, 118, 7, 148, 229},
+    {0, 224, 221, 61, 167, 71, 122, 154, 83, 179, 142, 110, 244, 20, 41, 201,
+     0, 166, 81, 247, 162, 4, 243, 85, 89, 255, 8, 174, 251, 93, 170, 12},
+    {0, 225, 223, 62, 163, 66, 124, 157, 91, 186, 132, 101, 248, 25, 39, 198,
+     0, 182, 113, 199, 226, 84, 147, 37, 217, 111, 168, 30, 59, 141, 74, 252},
+    {0, 226, 217, 59, 175, 77, 118, 148, 67, 161, 154, 120, 236, 14, 53, 215,
+     0, 134, 17, 151, 34, 164, 51, 181, 68, 194, 85, 211, 102, 224, 119, 241},
+    {0, 227, 219, 56, 171, 72, 112, 147, 75, 168, 144, 115, 224, 3, 59, 216,
+     0, 150, 49, 167, 98, 244, 83, 197, 196, 82, 245, 99, 166, 48, 151, 1},
+    {0, 228, 213, 49, 183, 83, 98, 134, 115, 151, 166, 66, 196, 32, 17, 245,
+     0, 230, 209, 55, 191, 89, 110, 136, 99, 133, 178, 84, 220, 58, 13, 235},
+    {0, 229, 215, 50, 179, 86, 100, 129, 123, 158, 172, 73, 200, 45, 31, 250,
+     0, 246, 241, 7, 255, 9, 14, 248, 227, 21, 18, 228, 28, 234, 237, 27},
+    {0, 230, 209, 55, 191, 89, 110, 136, 99, 133, 178, 84, 220, 58, 13, 235,
+     0, 198, 145, 87, 63, 249, 174, 104, 126, 184, 239, 41, 65, 135, 208, 22},
+    {0, 231, 211, 52, 187, 92, 104, 143, 107, 140, 184, 95, 208, 55, 3, 228,
+     0, 214, 177, 103, 127, 169, 206, 24, 254, 40, 79, 153, 129, 87, 48, 230},
+    {0, 232, 205, 37, 135, 111, 74, 162, 19, 251, 222, 54, 148, 124, 89, 177,
+     0, 38, 76, 106, 152, 190, 212, 242, 45, 11, 97, 71, 181, 147, 249, 223},
+    {0, 233, 207, 38, 131, 106, 76, 165, 27, 242, 212, 61, 152, 113, 87, 190,
+     0, 54, 108, 90, 216, 238, 180, 130, 173, 155, 193, 247, 117, 67, 25, 47},
+    {0, 234, 201, 35, 143, 101, 70, 172, 3, 233, 202, 32, 140, 102, 69, 175,
+     0, 6, 12, 10, 24, 30, 20, 18, 48, 54, 60, 58, 40, 46, 36, 34},
+    {0, 235, 203, 32, 139, 96, 64, 171, 11, 224, 192, 43, 128, 107, 75, 160,
+     0, 22, 44, 58, 88, 78, 116, 98, 176, 166, 156, 138, 232, 254, 196, 210},
+    {0, 236, 197, 41, 151, 123, 82, 190, 51, 223, 246, 26, 164, 72, 97, 141,
+     0, 102, 204, 170, 133, 227, 73, 47, 23, 113, 219, 189, 146, 244, 94, 56},
+    {0, 237, 199, 42, 147, 126, 84, 185, 59, 214, 252, 17, 168, 69, 111, 130,
+     0, 118, 236, 154, 197, 179, 41, 95, 151, 225, 123, 13, 82, 36, 190, 200},
+    {0, 238, 193, 47, 159, 113, 94, 176, 35, 205, 226, 12, 188, 82, 125, 147,
+     0, 70, 140, 202, 5, 67, 137, 207, 10, 76, 134, 192, 15, 73, 131, 197},
+    {0, 239, 195, 44, 155, 116, 88, 183, 43, 196, 232, 7, 176, 95, 115, 156,
+     0, 86, 172, 250, 69, 19, 233, 191, 138, 220, 38, 112, 207, 153, 99, 53},
+    {0, 240, 253, 13, 231, 23, 26, 234, 211, 35, 46, 222, 52, 196, 201, 57,
+     0, 187, 107, 208, 214, 109, 189, 6, 177, 10, 218, 97, 103, 220, 12, 183},
+    {0, 241, 255, 14, 227, 18, 28, 237, 219, 42, 36, 213, 56, 201, 199, 54,
+     0, 171, 75, 224, 150, 61, 221, 118, 49, 154, 122, 209, 167, 12, 236, 71},
+    {0, 242, 249, 11, 239, 29, 22, 228, 195, 49, 58, 200, 44, 222, 213, 39,
+     0, 155, 43, 176, 86, 205, 125, 230, 172, 55, 135, 28, 250, 97, 209, 74},
+    {0, 243, 251, 8, 235, 24, 16, 227, 203, 56, 48, 195, 32, 211, 219, 40,
+     0, 139, 11, 128, 22, 157, 29, 150, 44, 167, 39, 172, 58, 177, 49, 186},
+    {0, 244, 245, 1, 247, 3, 2, 246, 243, 7, 6, 242, 4, 240, 241, 5,
+     0, 251, 235, 16, 203, 48, 32, 219, 139, 112, 96, 155, 64, 187, 171, 80},
+    {0, 245, 247, 2, 243, 6, 4, 241, 251, 14, 12, 249, 8, 253, 255, 10,
+     0, 235, 203, 32, 139, 96, 64, 171, 11, 224, 192, 43, 128, 107, 75, 160},
+    {0, 246, 241, 7, 255, 9, 14, 248, 227, 21, 18, 228, 28, 234, 237, 27,
+     0, 219, 171, 112, 75, 144, 224, 59, 150, 77, 61, 230, 221, 6, 118, 173},
+    {0, 247, 243, 4, 251, 12, 8, 255, 235, 28, 24, 239, 16, 231, 227, 20,
+     0, 203, 139, 64, 11, 192, 128, 75, 22, 221, 157, 86, 29, 214, 150, 93},
+    {0, 248, 237, 21, 199, 63, 42, 210, 147, 107, 126, 134, 84, 172, 185, 65,
+     0, 59, 118, 77, 236, 215, 154, 161, 197, 254, 179, 136, 41, 18, 95, 100},
+    {0, 249, 239, 22, 195, 58, 44, 213, 155, 98, 116, 141, 88, 161, 183, 78,
+     0, 43, 86, 125, 172, 135, 250, 209, 69, 110, 19, 56, 233, 194, 191, 148},
+    {0, 250, 233, 19, 207, 53, 38, 220, 131, 121, 106, 144, 76, 182, 165, 95,
+     0, 27, 54, 45, 108, 119, 90, 65, 216, 195, 238, 245, 180, 175, 130, 153},
+    {0, 251, 235, 16, 203, 48, 32, 219, 139, 112, 96, 155, 64, 187, 171, 80,
+     0, 11, 22, 29, 44, 39, 58, 49, 88, 83, 78, 69, 116, 127, 98, 105},
+    {0, 252, 229, 25, 215, 43, 50, 206, 179, 79, 86, 170, 100, 152, 129, 125,
+     0, 123, 246, 141, 241, 138, 7, 124, 255, 132, 9, 114, 14, 117, 248, 131},
+    {0, 253, 231, 26, 211, 46, 52, 201, 187, 70, 92, 161, 104, 149, 143, 114,
+     0, 107, 214, 189, 177, 218, 103, 12, 127, 20, 169, 194, 206, 165, 24, 115},
+    {0, 254, 225, 31, 223, 33, 62, 192, 163, 93, 66, 188, 124, 130, 157, 99,
+     0, 91, 182, 237, 113, 42, 199, 156, 226, 185, 84, 15, 147, 200, 37, 126},
+    {0, 255, 227, 28, 219, 36, 56, 199, 171, 84, 72, 183, 112, 143, 147, 108,
+     0, 75, 150, 221, 49, 122, 167, 236, 98, 41, 244, 191, 83, 24, 197, 142}};
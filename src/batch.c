@@ -0,0 +1,665 @@
+/*
+ * Copyright 2025 Naoto Yoshida
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "batch.h"
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <threads.h>
+
+#define READ_BUFFER_SIZE 65536
+
+// records in flight per worker thread
+#define SLOTS_PER_THREAD 8
+
+// "40 " + 177 * 177 modules + "\n"
+#define MAX_OUTPUT_LENGTH (3 + QRCE_MAX_SYMBOL_SIZE * QRCE_MAX_SYMBOL_SIZE + 1)
+
+typedef enum {
+    RECORD_READ = 0,
+    RECORD_TOO_LONG = 1,
+    RECORD_END_OF_INPUT = 2,
+    RECORD_READ_ERROR = 3
+} RecordStatus;
+
+typedef struct RecordReader {
+    FILE *stream;
+    RecordDelimiter delimiter;
+    size_t begin;
+    size_t end;
+    uint8_t buffer[READ_BUFFER_SIZE];
+} RecordReader;
+
+typedef struct BatchSlot {
+    RecordStatus recordStatus;
+    QRCEStatus status;
+    size_t length;
+    size_t outputLength;
+    bool done;
+    uint8_t record[QRCE_MAX_DATA_LENGTH];
+    char output[MAX_OUTPUT_LENGTH];
+} BatchSlot;
+
+typedef struct WorkQueue {
+    mtx_t mutex;
+    size_t *jobs;
+    size_t capacity;
+    size_t first;
+    size_t numJobs;
+} WorkQueue;
+
+typedef struct BatchPool {
+    const QRCEOptions *options;
+    BatchSlot *slots;
+    size_t numSlots;
+    WorkQueue *queues;
+    unsigned int numQueues;
+    unsigned int numWorkers;
+    unsigned int numSynchronizers;
+    atomic_size_t numQueuedJobs;
+    bool finished;
+    mtx_t mutex;
+    cnd_t workAvailable;
+    cnd_t jobDone;
+} BatchPool;
+
+typedef struct BatchWorker {
+    BatchPool *pool;
+    unsigned int index;
+    QRCEWorkspace *workspace;
+    thrd_t thread;
+} BatchWorker;
+
+static bool fillReadBuffer(RecordReader *reader) {
+    if (reader->begin < reader->end) {
+        return true;
+    }
+
+    reader->begin = 0;
+    reader->end = fread(reader->buffer, 1, READ_BUFFER_SIZE, reader->stream);
+
+    return reader->end > 0;
+}
+
+static RecordStatus readDelimitedRecord(RecordReader *reader, uint8_t *record,
+                                        size_t capacity, size_t *length,
+                                        uint8_t delimiter) {
+    size_t numBytes = 0;
+    bool found = false;
+
+    while (!found && fillReadBuffer(reader)) {
+        const uint8_t *p = reader->buffer + reader->begin;
+        size_t available = reader->end - reader->begin;
+        const uint8_t *q = memchr(p, delimiter, available);
+        size_t n = q == NULL ? available : (size_t)(q - p);
+
+        if (numBytes < capacity) {
+            size_t room = capacity - numBytes;
+            memcpy(record + numBytes, p, n < room ? n : room);
+        }
+
+        numBytes += n;
+        reader->begin += q == NULL ? n : n + 1;
+        found = q != NULL;
+    }
+
+    if (ferror(reader->stream)) {
+        return RECORD_READ_ERROR;
+    }
+
+    if (!found && numBytes == 0) {
+        return RECORD_END_OF_INPUT;
+    }
+
+    // accept CRLF line endings
+    if (delimiter == '\n' && 0 < numBytes && numBytes <= capacity &&
+        record[numBytes - 1] == '\r') {
+        numBytes--;
+    }
+
+    *length = numBytes;
+
+    return numBytes <= capacity ? RECORD_READ : RECORD_TOO_LONG;
+}
+
+static bool readBytes(RecordReader *reader, uint8_t *bytes, size_t numBytes) {
+    while (numBytes > 0) {
+        if (!fillReadBuffer(reader)) {
+            return false;
+        }
+
+        size_t available = reader->end - reader->begin;
+        size_t n = numBytes < available ? numBytes : available;
+
+        if (bytes != NULL) {
+            memcpy(bytes, reader->buffer + reader->begin, n);
+            bytes += n;
+        }
+
+        reader->begin += n;
+        numBytes -= n;
+    }
+
+    return true;
+}
+
+static RecordStatus readLengthPrefixedRecord(RecordReader *reader,
+                                             uint8_t *record, size_t capacity,
+                                             size_t *length) {
+    uint8_t prefix[4];
+
+    if (!fillReadBuffer(reader)) {
+        return ferror(reader->stream) ? RECORD_READ_ERROR : RECORD_END_OF_INPUT;
+    }
+
+    if (!readBytes(reader, prefix, 4)) {
+        return RECORD_READ_ERROR;
+    }
+
+    // big-endian length
+    size_t numBytes = (size_t)prefix[0] << 24 | (size_t)prefix[1] << 16 |
+                      (size_t)prefix[2] << 8 | (size_t)prefix[3];
+
+    if (!readBytes(reader, numBytes <= capacity ? record : NULL, numBytes)) {
+        return RECORD_READ_ERROR;
+    }
+
+    *length = numBytes;
+
+    return numBytes <= capacity ? RECORD_READ : RECORD_TOO_LONG;
+}
+
+static RecordStatus readRecord(RecordReader *reader, uint8_t *record,
+                               size_t capacity, size_t *length) {
+    switch (reader->delimiter) {
+    case RECORD_DELIMITER_NUL:
+        return readDelimitedRecord(reader, record, capacity, length, '\0');
+
+    case RECORD_DELIMITER_LENGTH_PREFIX:
+        return readLengthPrefixedRecord(reader, record, capacity, length);
+
+    default:
+        return readDelimitedRecord(reader, record, capacity, length, '\n');
+    }
+}
+
+static size_t formatSymbol(char *output, const QRCESymbol *symbol) {
+    size_t length = sprintf(output, "%u ", symbol->version);
+    size_t numModules = symbol->size * symbol->size;
+
+    for (size_t i = 0; i < numModules; i++) {
+        output[length++] = symbol->modules[i] + '0';
+    }
+
+    output[length++] = '\n';
+
+    return length;
+}
+
+static void reportRecordError(size_t index, QRCEStatus status,
+                              const QRCEOptions *options) {
+    if (status == QRCE_ERROR_INPUT_TOO_LONG_FOR_VERSION) {
+        fprintf(stderr, "Record %zu: Input is too long for version %d\n",
+                index, options->version);
+    } else {
+        fprintf(stderr, "Record %zu: %s\n", index,
+                qrce_getStatusMessage(status));
+    }
+}
+
+static void encodeSlot(BatchSlot *slot, QRCEWorkspace *workspace,
+                       const QRCEOptions *options) {
+    QRCESymbol symbol;
+
+    slot->status = QRCE_ERROR_INPUT_TOO_LONG;
+
+    if (slot->recordStatus == RECORD_READ) {
+        slot->status = qrce_encode(&symbol, workspace, slot->record,
+                                   slot->length, options);
+    }
+
+    if (slot->status == QRCE_SUCCESS) {
+        slot->outputLength = formatSymbol(slot->output, &symbol);
+    } else {
+        slot->output[0] = '\n';
+        slot->outputLength = 1;
+    }
+}
+
+static BatchStatus writeSlot(const BatchSlot *slot, FILE *output,
+                             const QRCEOptions *options,
+                             BatchStatistics *stats) {
+    if (slot->status != QRCE_SUCCESS) {
+        reportRecordError(stats->numRecords, slot->status, options);
+        stats->numFailedRecords++;
+    }
+
+    stats->numRecords++;
+
+    if (fwrite(slot->output, 1, slot->outputLength, output) !=
+        slot->outputLength) {
+        return BATCH_ERROR_WRITE;
+    }
+
+    return BATCH_SUCCESS;
+}
+
+static BatchStatus encodeRecords(RecordReader *reader, FILE *output,
+                                 const QRCEOptions *options,
+                                 BatchStatistics *stats) {
+    BatchSlot *slot = malloc(sizeof(BatchSlot));
+    QRCEWorkspace *workspace = malloc(sizeof(QRCEWorkspace));
+    BatchStatus status = BATCH_ERROR_OUT_OF_MEMORY;
+
+    if (slot != NULL && workspace != NULL) {
+        status = BATCH_SUCCESS;
+
+        while (status == BATCH_SUCCESS) {
+            slot->recordStatus =
+                readRecord(reader, slot->record, QRCE_MAX_DATA_LENGTH,
+                           &slot->length);
+
+            if (slot->recordStatus == RECORD_END_OF_INPUT) {
+                break;
+            }
+
+            if (slot->recordStatus == RECORD_READ_ERROR) {
+                status = BATCH_ERROR_READ;
+                break;
+            }
+
+            encodeSlot(slot, workspace, options);
+            status = writeSlot(slot, output, options, stats);
+        }
+    }
+
+    free(workspace);
+    free(slot);
+
+    return status;
+}
+
+static bool initializeWorkQueue(WorkQueue *queue, size_t capacity) {
+    queue->jobs = malloc(capacity * sizeof(size_t));
+    queue->capacity = capacity;
+    queue->first = 0;
+    queue->numJobs = 0;
+
+    if (queue->jobs == NULL) {
+        return false;
+    }
+
+    if (mtx_init(&queue->mutex, mtx_plain) != thrd_success) {
+        free(queue->jobs);
+        return false;
+    }
+
+    return true;
+}
+
+static void destroyWorkQueue(WorkQueue *queue) {
+    mtx_destroy(&queue->mutex);
+    free(queue->jobs);
+}
+
+static void pushJob(WorkQueue *queue, size_t job) {
+    mtx_lock(&queue->mutex);
+    queue->jobs[(queue->first + queue->numJobs++) % queue->capacity] = job;
+    mtx_unlock(&queue->mutex);
+}
+
+// the owner takes the oldest job so that records finish roughly in order, and
+// thieves take the newest job to stay out of the owner's way
+static bool popJob(WorkQueue *queue, size_t *job, bool steal) {
+    bool found = false;
+
+    mtx_lock(&queue->mutex);
+
+    if (queue->numJobs > 0) {
+        queue->numJobs--;
+
+        if (steal) {
+            *job = queue->jobs[(queue->first + queue->numJobs) %
+                               queue->capacity];
+        } else {
+            *job = queue->jobs[queue->first];
+            queue->first = (queue->first + 1) % queue->capacity;
+        }
+
+        found = true;
+    }
+
+    mtx_unlock(&queue->mutex);
+
+    return found;
+}
+
+static bool takeJob(BatchPool *pool, unsigned int index, size_t *job) {
+    if (popJob(&pool->queues[index], job, false)) {
+        return true;
+    }
+
+    for (unsigned int i = 1; i < pool->numWorkers; i++) {
+        if (popJob(&pool->queues[(index + i) % pool->numWorkers], job, true)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static int runWorker(void *arg) {
+    BatchWorker *worker = arg;
+    BatchPool *pool = worker->pool;
+
+    for (;;) {
+        size_t job;
+
+        if (!takeJob(pool, worker->index, &job)) {
+            mtx_lock(&pool->mutex);
+
+            while (atomic_load(&pool->numQueuedJobs) == 0 && !pool->finished) {
+                cnd_wait(&pool->workAvailable, &pool->mutex);
+            }
+
+            bool finished =
+                atomic_load(&pool->numQueuedJobs) == 0 && pool->finished;
+
+            mtx_unlock(&pool->mutex);
+
+            if (finished) {
+                return 0;
+            }
+
+            continue;
+        }
+
+        atomic_fetch_sub(&pool->numQueuedJobs, 1);
+
+        encodeSlot(&pool->slots[job], worker->workspace, pool->options);
+
+        mtx_lock(&pool->mutex);
+        pool->slots[job].done = true;
+        cnd_signal(&pool->jobDone);
+        mtx_unlock(&pool->mutex);
+    }
+}
+
+static void dispatchSlot(BatchPool *pool, size_t sequence) {
+    size_t job = sequence % pool->numSlots;
+
+    pool->slots[job].done = false;
+    pushJob(&pool->queues[sequence % pool->numWorkers], job);
+    atomic_fetch_add(&pool->numQueuedJobs, 1);
+
+    mtx_lock(&pool->mutex);
+    cnd_signal(&pool->workAvailable);
+    mtx_unlock(&pool->mutex);
+}
+
+static bool isSlotDone(BatchPool *pool, const BatchSlot *slot, bool wait) {
+    mtx_lock(&pool->mutex);
+
+    while (wait && !slot->done) {
+        cnd_wait(&pool->jobDone, &pool->mutex);
+    }
+
+    bool done = slot->done;
+
+    mtx_unlock(&pool->mutex);
+
+    return done;
+}
+
+// the calling thread reads records into a window of slots and writes them out
+// in input order as the workers complete them
+static BatchStatus runPool(BatchPool *pool, RecordReader *reader, FILE *output,
+                           BatchStatistics *stats) {
+    BatchStatus status = BATCH_SUCCESS;
+    bool endOfInput = false;
+    size_t numRead = 0;
+    size_t numWritten = 0;
+
+    for (;;) {
+        while (numWritten < numRead &&
+               isSlotDone(pool, &pool->slots[numWritten % pool->numSlots],
+                          false)) {
+            if (status == BATCH_SUCCESS) {
+                status = writeSlot(&pool->slots[numWritten % pool->numSlots],
+                                   output, pool->options, stats);
+            }
+
+            numWritten++;
+        }
+
+        if (status != BATCH_SUCCESS) {
+            endOfInput = true;
+        }
+
+        if (!endOfInput && numRead - numWritten < pool->numSlots) {
+            BatchSlot *slot = &pool->slots[numRead % pool->numSlots];
+
+            slot->recordStatus =
+                readRecord(reader, slot->record, QRCE_MAX_DATA_LENGTH,
+                           &slot->length);
+
+            if (slot->recordStatus == RECORD_END_OF_INPUT) {
+                endOfInput = true;
+            } else if (slot->recordStatus == RECORD_READ_ERROR) {
+                status = BATCH_ERROR_READ;
+                endOfInput = true;
+            } else {
+                dispatchSlot(pool, numRead++);
+            }
+
+            continue;
+        }
+
+        if (numWritten == numRead) {
+            return status;
+        }
+
+        isSlotDone(pool, &pool->slots[numWritten % pool->numSlots], true);
+    }
+}
+
+static void destroyBatchPool(BatchPool *pool) {
+    for (unsigned int i = 0; i < pool->numQueues; i++) {
+        destroyWorkQueue(&pool->queues[i]);
+    }
+
+    if (pool->numSynchronizers > 2) {
+        cnd_destroy(&pool->jobDone);
+    }
+
+    if (pool->numSynchronizers > 1) {
+        cnd_destroy(&pool->workAvailable);
+    }
+
+    if (pool->numSynchronizers > 0) {
+        mtx_destroy(&pool->mutex);
+    }
+
+    free(pool->queues);
+    free(pool->slots);
+}
+
+static bool initializeBatchPool(BatchPool *pool, const QRCEOptions *options,
+                                unsigned int numThreads) {
+    pool->options = options;
+    pool->numSlots = (size_t)numThreads * SLOTS_PER_THREAD;
+    pool->slots = malloc(pool->numSlots * sizeof(BatchSlot));
+    pool->queues = malloc(numThreads * sizeof(WorkQueue));
+    pool->numQueues = 0;
+    pool->numWorkers = numThreads;
+    pool->numSynchronizers = 0;
+    pool->finished = false;
+    atomic_init(&pool->numQueuedJobs, 0);
+
+    if (pool->slots == NULL || pool->queues == NULL) {
+        destroyBatchPool(pool);
+        return false;
+    }
+
+    if (mtx_init(&pool->mutex, mtx_plain) != thrd_success) {
+        destroyBatchPool(pool);
+        return false;
+    }
+
+    pool->numSynchronizers++;
+
+    if (cnd_init(&pool->workAvailable) != thrd_success) {
+        destroyBatchPool(pool);
+        return false;
+    }
+
+    pool->numSynchronizers++;
+
+    if (cnd_init(&pool->jobDone) != thrd_success) {
+        destroyBatchPool(pool);
+        return false;
+    }
+
+    pool->numSynchronizers++;
+
+    for (; pool->numQueues < numThreads; pool->numQueues++) {
+        if (!initializeWorkQueue(&pool->queues[pool->numQueues],
+                                 pool->numSlots)) {
+            destroyBatchPool(pool);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static BatchStatus encodeRecordsInParallel(RecordReader *reader, FILE *output,
+                                           const QRCEOptions *options,
+                                           unsigned int numThreads,
+                                           BatchStatistics *stats) {
+    BatchPool pool;
+    BatchWorker *workers = calloc(numThreads, sizeof(BatchWorker));
+
+    if (workers == NULL) {
+        return BATCH_ERROR_OUT_OF_MEMORY;
+    }
+
+    if (!initializeBatchPool(&pool, options, numThreads)) {
+        free(workers);
+        return BATCH_ERROR_OUT_OF_MEMORY;
+    }
+
+    BatchStatus status = BATCH_SUCCESS;
+    unsigned int numWorkers = 0;
+
+    for (; numWorkers < numThreads; numWorkers++) {
+        BatchWorker *worker = &workers[numWorkers];
+
+        worker->pool = &pool;
+        worker->index = numWorkers;
+        worker->workspace = malloc(sizeof(QRCEWorkspace));
+
+        if (worker->workspace == NULL) {
+            status = BATCH_ERROR_OUT_OF_MEMORY;
+            break;
+        }
+
+        if (thrd_create(&worker->thread, runWorker, worker) != thrd_success) {
+            free(worker->workspace);
+            status = BATCH_ERROR_THREAD;
+            break;
+        }
+    }
+
+    if (status == BATCH_SUCCESS) {
+        status = runPool(&pool, reader, output, stats);
+    }
+
+    mtx_lock(&pool.mutex);
+    pool.finished = true;
+    cnd_broadcast(&pool.workAvailable);
+    mtx_unlock(&pool.mutex);
+
+    for (unsigned int i = 0; i < numWorkers; i++) {
+        thrd_join(workers[i].thread, NULL);
+        free(workers[i].workspace);
+    }
+
+    destroyBatchPool(&pool);
+    free(workers);
+
+    return status;
+}
+
+/**
+ * Encode every record of the input stream and write one line per record to the
+ * output stream. A record that cannot be encoded is reported on stderr and
+ * produces an empty line, so that output lines always match input records.
+ * All buffers are allocated once and reused for every record.
+ *
+ * With more than one thread, records are encoded by a pool of workers, each
+ * with its own workspace. Every worker has a queue of records and steals from
+ * the others when its own runs dry, so that a few large symbols do not leave
+ * the rest of the pool idle. At most SLOTS_PER_THREAD records per thread are in
+ * flight, and output is written in input order.
+ *
+ * @param input The input stream
+ * @param output The output stream
+ * @param delimiter How records are separated in the input stream
+ * @param options The options
+ * @param numThreads The number of worker threads
+ * @param stats The number of records read and failed
+ * @return BATCH_SUCCESS, or the reason the batch was aborted
+ */
+BatchStatus encodeBatch(FILE *input, FILE *output, RecordDelimiter delimiter,
+                        const QRCEOptions *options, unsigned int numThreads,
+                        BatchStatistics *stats) {
+    RecordReader *reader = malloc(sizeof(RecordReader));
+    BatchStatus status = BATCH_ERROR_OUT_OF_MEMORY;
+
+    stats->numRecords = 0;
+    stats->numFailedRecords = 0;
+
+    if (reader != NULL) {
+        reader->stream = input;
+        reader->delimiter = delimiter;
+        reader->begin = 0;
+        reader->end = 0;
+
+        if (numThreads > 1) {
+            status = encodeRecordsInParallel(reader, output, options,
+                                             numThreads, stats);
+        } else {
+            status = encodeRecords(reader, output, options, stats);
+        }
+    }
+
+    free(reader);
+
+    if (status == BATCH_SUCCESS && fflush(output) != 0) {
+        status = BATCH_ERROR_WRITE;
+    }
+
+    return status;
+}
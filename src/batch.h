@@ -0,0 +1,55 @@
+/*
+ * Copyright 2025 Naoto Yoshida
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef BATCH_H
+#define BATCH_H
+
+#include "qrce.h"
+#include <stddef.h>
+#include <stdio.h>
+
+typedef enum {
+    RECORD_DELIMITER_LINE_FEED = 0,
+    RECORD_DELIMITER_NUL = 1,
+    RECORD_DELIMITER_LENGTH_PREFIX = 2
+} RecordDelimiter;
+
+typedef enum {
+    BATCH_SUCCESS = 0,
+    BATCH_ERROR_READ = 1,
+    BATCH_ERROR_WRITE = 2,
+    BATCH_ERROR_OUT_OF_MEMORY = 3,
+    BATCH_ERROR_THREAD = 4
+} BatchStatus;
+
+typedef struct BatchStatistics {
+    size_t numRecords;
+    size_t numFailedRecords;
+} BatchStatistics;
+
+extern BatchStatus encodeBatch(FILE *input, FILE *output,
+                               RecordDelimiter delimiter,
+                               const QRCEOptions *options,
+                               unsigned int numThreads,
+                               BatchStatistics *stats);
+
+#endif /* BATCH_H */
@@ -22,6 +22,11 @@
 
 #include "charset.h"
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CHARSET_X86
+#include <immintrin.h>
+#endif
+
 static const int alphanumericTable[] = {
     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
@@ -91,3 +96,112 @@ bool isExclusiveAlphanumericSubset(uint8_t b) {
 bool isExclusive8BitByteSubset(uint8_t b) {
     return (b < 0x80 && !isAlphanumeric(b)) || (0x9F < b && b < 0xE0);
 }
+
+static uint8_t classifyCharacter(const uint8_t *data, size_t length,
+                                 size_t i) {
+    uint8_t classes = 0;
+
+    classes |= isNumeric(data[i]) ? CHAR_CLASS_NUMERIC : 0;
+    classes |= isAlphanumeric(data[i]) ? CHAR_CLASS_ALPHANUMERIC : 0;
+    classes |= isExclusiveAlphanumericSubset(data[i])
+                   ? CHAR_CLASS_EXCLUSIVE_ALPHANUMERIC
+                   : 0;
+    classes |=
+        isExclusive8BitByteSubset(data[i]) ? CHAR_CLASS_EXCLUSIVE_8BIT_BYTE : 0;
+    classes |= i + 1 < length && isShiftJISKanji(data[i], data[i + 1])
+                   ? CHAR_CLASS_KANJI
+                   : 0;
+
+    return classes;
+}
+
+#ifdef CHARSET_X86
+// 0xFF in the lanes where lo <= v <= hi, unsigned
+__attribute__((target("sse2"))) static __m128i inRange(__m128i v, uint8_t lo,
+                                                       uint8_t hi) {
+    __m128i offset = _mm_sub_epi8(v, _mm_set1_epi8((char)lo));
+
+    return _mm_cmpeq_epi8(_mm_min_epu8(offset, _mm_set1_epi8((char)(hi - lo))),
+                          offset);
+}
+
+// 0xFF in the lanes equal to c
+__attribute__((target("sse2"))) static __m128i equals(__m128i v, char c) {
+    return _mm_cmpeq_epi8(v, _mm_set1_epi8(c));
+}
+
+// classifies 16 bytes per iteration, as long as the byte after them can be
+// read for the Kanji class; returns the number of bytes classified
+__attribute__((target("sse2"))) static size_t
+classifyCharactersSSE2(uint8_t *classes, const uint8_t *data, size_t length) {
+    size_t i = 0;
+
+    for (; i + 17 <= length; i += 16) {
+        __m128i b1 = _mm_loadu_si128((const __m128i *)(data + i));
+        __m128i b2 = _mm_loadu_si128((const __m128i *)(data + i + 1));
+
+        __m128i numeric = inRange(b1, '0', '9');
+        __m128i symbols = _mm_or_si128(
+            _mm_or_si128(_mm_or_si128(equals(b1, ' '), equals(b1, '$')),
+                         _mm_or_si128(equals(b1, '%'), equals(b1, '*'))),
+            _mm_or_si128(_mm_or_si128(equals(b1, '+'), equals(b1, '-')),
+                         _mm_or_si128(inRange(b1, '.', '/'), equals(b1, ':'))));
+        __m128i exclusiveAlphanumeric =
+            _mm_or_si128(inRange(b1, 'A', 'Z'), symbols);
+        __m128i alphanumeric = _mm_or_si128(numeric, exclusiveAlphanumeric);
+        __m128i exclusiveByte =
+            _mm_or_si128(_mm_andnot_si128(alphanumeric, inRange(b1, 0, 0x7F)),
+                         inRange(b1, 0xA0, 0xDF));
+
+        __m128i lead =
+            _mm_or_si128(inRange(b1, 0x81, 0x9F), inRange(b1, 0xE0, 0xEB));
+        __m128i trail =
+            _mm_andnot_si128(equals(b2, 0x7F), inRange(b2, 0x40, 0xFC));
+        __m128i beyond = _mm_and_si128(equals(b1, (char)0xEB),
+                                       inRange(b2, 0xC0, 0xFF));
+        __m128i kanji = _mm_andnot_si128(beyond, _mm_and_si128(lead, trail));
+
+        __m128i flags = _mm_or_si128(
+            _mm_or_si128(
+                _mm_and_si128(numeric, _mm_set1_epi8(CHAR_CLASS_NUMERIC)),
+                _mm_and_si128(alphanumeric,
+                              _mm_set1_epi8(CHAR_CLASS_ALPHANUMERIC))),
+            _mm_or_si128(
+                _mm_or_si128(
+                    _mm_and_si128(exclusiveAlphanumeric,
+                                  _mm_set1_epi8(
+                                      CHAR_CLASS_EXCLUSIVE_ALPHANUMERIC)),
+                    _mm_and_si128(exclusiveByte,
+                                  _mm_set1_epi8(
+                                      CHAR_CLASS_EXCLUSIVE_8BIT_BYTE))),
+                _mm_and_si128(kanji, _mm_set1_epi8(CHAR_CLASS_KANJI))));
+
+        _mm_storeu_si128((__m128i *)(classes + i), flags);
+    }
+
+    return i;
+}
+#endif
+
+/**
+ * Classifies every byte of the data once, so that the data analysis can test
+ * classes without calling the predicates above again and again. A byte gets
+ * CHAR_CLASS_KANJI if it starts a Shift_JIS Kanji with the byte after it.
+ *
+ * @param classes The CHAR_CLASS_* flags of each byte, length bytes
+ * @param data The data
+ * @param length The length of the data
+ */
+void classifyCharacters(uint8_t *classes, const uint8_t *data, size_t length) {
+    size_t i = 0;
+
+#ifdef CHARSET_X86
+    if (__builtin_cpu_supports("sse2")) {
+        i = classifyCharactersSSE2(classes, data, length);
+    }
+#endif
+
+    for (; i < length; i++) {
+        classes[i] = classifyCharacter(data, length, i);
+    }
+}
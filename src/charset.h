@@ -24,13 +24,23 @@
 #define CHARSET_H
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
+// the classes of a byte set by classifyCharacters
+#define CHAR_CLASS_NUMERIC 1
+#define CHAR_CLASS_ALPHANUMERIC 2
+#define CHAR_CLASS_EXCLUSIVE_ALPHANUMERIC 4
+#define CHAR_CLASS_EXCLUSIVE_8BIT_BYTE 8
+#define CHAR_CLASS_KANJI 16 // a Shift_JIS Kanji together with the next byte
+
 extern int getAlphanumericCode(uint8_t);
 extern bool isNumeric(uint8_t b);
 extern bool isAlphanumeric(uint8_t b);
 extern bool isShiftJISKanji(uint8_t b1, uint8_t b2);
 extern bool isExclusiveAlphanumericSubset(uint8_t b);
 extern bool isExclusive8BitByteSubset(uint8_t b);
+extern void classifyCharacters(uint8_t *classes, const uint8_t *data,
+                               size_t length);
 
 #endif /* CHARSET_H */
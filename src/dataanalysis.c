@@ -22,11 +22,63 @@
 
 #include "dataanalysis.h"
 #include "charset.h"
+#include "dataencoding.h"
+#include <stdlib.h>
 
-static Mode selectMode(const uint8_t *data, size_t length, bool useKanjiMode) {
+// the longest run stored, even so that a capped Kanji run stays on a character
+#define MAX_RUN_LENGTH 0xFFFE
+
+// the mode recommended for the character at a position, from its classes
+static Mode getCharacterMode(uint8_t classes, bool useKanjiMode) {
+    if (classes & CHAR_CLASS_NUMERIC) {
+        return MODE_NUMERIC;
+    }
+
+    if (classes & CHAR_CLASS_ALPHANUMERIC) {
+        return MODE_ALPHANUMERIC;
+    }
+
+    if (useKanjiMode && (classes & CHAR_CLASS_KANJI)) {
+        return MODE_KANJI;
+    }
+
+    return MODE_BYTE;
+}
+
+/**
+ * Classify the data and compute, for every position, the number of bytes from
+ * that position on whose characters all have the same recommended mode. A run
+ * of Kanji characters is counted in steps of two bytes.
+ *
+ * @param classes The classes of the bytes, length bytes
+ * @param runs The run lengths, length elements
+ * @param data The data
+ * @param length The length of the data
+ * @param useKanjiMode Whether to use Kanji mode
+ */
+void analyzeCharacters(uint8_t *classes, uint16_t *runs, const uint8_t *data,
+                       size_t length, bool useKanjiMode) {
+    classifyCharacters(classes, data, length);
+
+    for (size_t i = length; i-- > 0;) {
+        Mode mode = getCharacterMode(classes[i], useKanjiMode);
+        size_t chrlen = mode == MODE_KANJI ? 2 : 1;
+        size_t run = chrlen;
+
+        if (i + chrlen < length &&
+            getCharacterMode(classes[i + chrlen], useKanjiMode) == mode) {
+            run += runs[i + chrlen];
+        }
+
+        runs[i] = run < MAX_RUN_LENGTH ? run : MAX_RUN_LENGTH;
+    }
+}
+
+static Mode selectMode(const uint8_t *classes, size_t length,
+                       bool useKanjiMode) {
     size_t i = 0;
 
-    while (i < length && isNumeric(data[i])) {
+    while (i < length && (classes[i] & CHAR_CLASS_NUMERIC)) {
         i++;
     }
 
@@ -34,7 +86,7 @@ static Mode selectMode(const uint8_t *data, size_t length, bool useKanjiMode) {
         return MODE_NUMERIC;
     }
 
-    while (i < length && isAlphanumeric(data[i])) {
+    while (i < length && (classes[i] & CHAR_CLASS_ALPHANUMERIC)) {
         i++;
     }
 
@@ -43,7 +95,7 @@ static Mode selectMode(const uint8_t *data, size_t length, bool useKanjiMode) {
     }
 
     if (useKanjiMode && i == 0 && length % 2 == 0) {
-        while (i < length && isShiftJISKanji(data[i], data[i + 1])) {
+        while (i < length && (classes[i] & CHAR_CLASS_KANJI)) {
             i += 2;
         }
 
@@ -56,29 +108,58 @@ static Mode selectMode(const uint8_t *data, size_t length, bool useKanjiMode) {
 }
 
 /**
- * Create the segment of the data.
+ * Append the segment of the data to the list.
  *
+ * @param segments The list of segments
  * @param data The data
  * @param length The length of the data
  * @param useKanjiMode Whether to use Kanji mode
- * @return The segment of the data
+ * @return false if the list could not hold the segment
  */
-Segment *createModeSegment(const uint8_t *data, size_t length,
-                           bool useKanjiMode) {
-    Mode mode = selectMode(data, length, useKanjiMode);
+bool createModeSegment(SegmentList *segments, const uint8_t *data,
+                       size_t length, bool useKanjiMode) {
+    uint8_t *classes = malloc(sizeof(uint8_t) * length);
+
+    if (classes == NULL && length > 0) {
+        return false;
+    }
 
-    return newSegment(mode, length);
+    classifyCharacters(classes, data, length);
+
+    bool added =
+        createModeSegmentFromClasses(segments, classes, length, useKanjiMode);
+
+    free(classes);
+
+    return added;
+}
+
+/**
+ * Append the segment of the classified data to the list.
+ *
+ * @param segments The list of segments
+ * @param classes The classes of the bytes of the data, see classifyCharacters
+ * @param length The length of the data
+ * @param useKanjiMode Whether to use Kanji mode
+ * @return false if the list could not hold the segment
+ */
+bool createModeSegmentFromClasses(SegmentList *segments,
+                                  const uint8_t *classes, size_t length,
+                                  bool useKanjiMode) {
+    Mode mode = selectMode(classes, length, useKanjiMode);
+
+    return addSegment(segments, mode, length);
 }
 
-static Mode selectInitialMode(const uint8_t *data, bool useKanjiMode,
+static Mode selectInitialMode(const uint8_t *classes, bool useKanjiMode,
                               VersionClass versionClass) {
-    if (isNumeric(data[0])) {
+    if (classes[0] & CHAR_CLASS_NUMERIC) {
         size_t lookahead = (const size_t[]){4, 4, 5}[versionClass];
 
         for (size_t i = 1; i < lookahead; i++) {
-            if (isNumeric(data[i])) {
+            if (classes[i] & CHAR_CLASS_NUMERIC) {
                 continue;
-            } else if (isExclusive8BitByteSubset(data[i])) {
+            } else if (classes[i] & CHAR_CLASS_EXCLUSIVE_8BIT_BYTE) {
                 return MODE_BYTE;
             } else {
                 break;
@@ -88,9 +169,9 @@ static Mode selectInitialMode(const uint8_t *data, bool useKanjiMode,
         lookahead = (const size_t[]){7, 8, 9}[versionClass];
 
         for (size_t i = 1; i < lookahead; i++) {
-            if (isNumeric(data[i])) {
+            if (classes[i] & CHAR_CLASS_NUMERIC) {
                 continue;
-            } else if (isAlphanumeric(data[i])) {
+            } else if (classes[i] & CHAR_CLASS_ALPHANUMERIC) {
                 return MODE_ALPHANUMERIC;
             } else {
                 break;
@@ -100,11 +181,11 @@ static Mode selectInitialMode(const uint8_t *data, bool useKanjiMode,
         return MODE_NUMERIC;
     }
 
-    if (isAlphanumeric(data[0])) {
+    if (classes[0] & CHAR_CLASS_ALPHANUMERIC) {
         size_t lookahead = (const size_t[]){6, 7, 8}[versionClass];
 
         for (size_t i = 1; i < lookahead; i++) {
-            if (!isAlphanumeric(data[i])) {
+            if (!(classes[i] & CHAR_CLASS_ALPHANUMERIC)) {
                 return MODE_BYTE;
             }
         }
@@ -112,15 +193,15 @@ static Mode selectInitialMode(const uint8_t *data, bool useKanjiMode,
         return MODE_ALPHANUMERIC;
     }
 
-    if (useKanjiMode && isShiftJISKanji(data[0], data[1])) {
-        if (!isExclusive8BitByteSubset(data[2])) {
+    if (useKanjiMode && (classes[0] & CHAR_CLASS_KANJI)) {
+        if (!(classes[2] & CHAR_CLASS_EXCLUSIVE_8BIT_BYTE)) {
             return MODE_KANJI;
         }
 
         size_t lookahead = (const size_t[]){5, 5, 6}[versionClass] * 2;
 
         for (size_t i = 0; i < lookahead; i += 2) {
-            if (!isShiftJISKanji(data[3 + i], data[4 + i])) {
+            if (!(classes[3 + i] & CHAR_CLASS_KANJI)) {
                 return MODE_KANJI;
             }
         }
@@ -129,42 +210,81 @@ static Mode selectInitialMode(const uint8_t *data, bool useKanjiMode,
     return MODE_BYTE;
 }
 
-static Mode recommendNextMode(const uint8_t *data, size_t length,
-                              bool useKanjiMode) {
-    if (isNumeric(data[0])) {
-        return MODE_NUMERIC;
-    }
-
-    if (isAlphanumeric(data[0])) {
-        return MODE_ALPHANUMERIC;
-    }
-
-    if (useKanjiMode && length >= 2) {
-        if (isShiftJISKanji(data[0], data[1])) {
-            return MODE_KANJI;
-        }
-    }
-
-    return MODE_BYTE;
-}
-
 /**
- * Create the segments of the data. Minimize the bit stream length using the
- * algorithm in Annex J of JIS X 0510:2018.
+ * Append the segments of the data to the list. Minimize the bit stream length
+ * using the algorithm in Annex J of JIS X 0510:2018.
  *
+ * @param segments The list of segments
  * @param data The data
  * @param length The length of the data
  * @param useKanjiMode Whether to use Kanji mode
  * @param versionClass The version class
- * @return The segments of the data
+ * @return false if the list could not hold the segments
  */
-Segment *createMixedModeSegments(const uint8_t *data, size_t length,
-                                 bool useKanjiMode, VersionClass versionClass) {
-    if (length < 9 || (useKanjiMode && length < 15)) {
-        return createModeSegment(data, length, useKanjiMode);
+bool createMixedModeSegments(SegmentList *segments, const uint8_t *data,
+                             size_t length, bool useKanjiMode,
+                             VersionClass versionClass) {
+    uint8_t *classes = malloc(sizeof(uint8_t) * length);
+    uint16_t *runs = malloc(sizeof(uint16_t) * length);
+    bool added = false;
+
+    if ((classes != NULL && runs != NULL) || length == 0) {
+        analyzeCharacters(classes, runs, data, length, useKanjiMode);
+        added = createMixedModeSegmentsFromClasses(
+            segments, classes, runs, length, useKanjiMode, versionClass);
     }
 
-    Segment *segments = NULL;
+    free(classes);
+    free(runs);
+
+    return added;
+}
+
+// appends a segment and adds its length in bits to the count of its class
+static bool appendSegment(SegmentList *segments, size_t *numBits,
+                          VersionClass versionClass, Mode mode, size_t length) {
+    if (length == 0) {
+        return true;
+    }
+
+    *numBits += numBitsModeIndicator +
+                getNumBitsCharCountIndicator(versionClass, mode) +
+                getNumBitsEncodedData(mode, length);
+
+    return addSegment(segments, mode, length);
+}
+
+// the state of the algorithm in Annex J for one version class
+typedef struct MixedModeState {
+    VersionClass versionClass;
+    Mode segmentMode;
+    size_t segmentLength;
+    size_t kanjiRunLength;
+    size_t alnumRunLength;
+    size_t numRunLength;
+    size_t position; // of the next character
+} MixedModeState;
+
+static void startMixedMode(MixedModeState *state, const uint8_t *classes,
+                           bool useKanjiMode, VersionClass versionClass) {
+    Mode mode = selectInitialMode(classes, useKanjiMode, versionClass);
+
+    state->versionClass = versionClass;
+    state->segmentMode = mode;
+    state->segmentLength = mode == MODE_KANJI ? 2 : 1;
+    state->kanjiRunLength = 0;
+    state->alnumRunLength = 0;
+    state->numRunLength = 0;
+    state->position = state->segmentLength;
+}
+
+// consumes the character at the position of the state, or a run of them where
+// the outcome does not depend on the individual characters
+static bool stepMixedMode(MixedModeState *state, SegmentList *segments,
+                          size_t *numBits, const uint8_t *classes,
+                          const uint16_t *runs, size_t length,
+                          bool useKanjiMode) {
+    VersionClass versionClass = state->versionClass;
 
     size_t byteToKanjiRunLength = (const size_t[]){9, 12, 13}[versionClass] * 2;
     size_t byteToAlnumRunLength = (const size_t[]){11, 15, 16}[versionClass];
@@ -172,109 +292,482 @@ Segment *createMixedModeSegments(const uint8_t *data, size_t length,
     size_t byteToNum2RunLength = (const size_t[]){6, 8, 9}[versionClass];
     size_t alnumToNumRunLength = (const size_t[]){13, 15, 17}[versionClass];
 
-    size_t kanjiRunLength = 0;
-    size_t alnumRunLength = 0;
-    size_t numRunLength = 0;
+    size_t i = state->position;
+    size_t run = runs[i];
 
-    Mode mode = selectInitialMode(data, useKanjiMode, versionClass);
+    Mode mode = getCharacterMode(classes[i], useKanjiMode);
     size_t chrlen = mode == MODE_KANJI ? 2 : 1;
+    bool changeMode = true;
 
-    Mode segmentMode = mode;
-    size_t segmentLength = chrlen;
+    if (state->segmentMode == MODE_BYTE && mode == MODE_KANJI) {
+        state->segmentLength += state->alnumRunLength + state->numRunLength;
 
-    for (size_t i = chrlen; i < length; i += chrlen) {
-        mode = recommendNextMode(data + i, length - i, useKanjiMode);
-        chrlen = mode == MODE_KANJI ? 2 : 1;
+        chrlen = byteToKanjiRunLength - state->kanjiRunLength;
+        chrlen = run < chrlen ? run : chrlen;
 
-        if (segmentMode == MODE_BYTE && mode == MODE_KANJI) {
-            segmentLength += alnumRunLength + numRunLength;
+        state->kanjiRunLength += chrlen;
+        state->alnumRunLength = 0;
+        state->numRunLength = 0;
 
-            kanjiRunLength += chrlen;
-            alnumRunLength = 0;
-            numRunLength = 0;
+        changeMode = state->kanjiRunLength >= byteToKanjiRunLength;
 
-            if (kanjiRunLength < byteToKanjiRunLength) {
-                continue;
-            }
+    } else if (state->segmentMode == MODE_BYTE &&
+               mode == MODE_ALPHANUMERIC) {
+        state->segmentLength += state->kanjiRunLength + state->numRunLength;
 
-        } else if (segmentMode == MODE_BYTE && mode == MODE_ALPHANUMERIC) {
-            segmentLength += kanjiRunLength + numRunLength;
+        chrlen = byteToAlnumRunLength - state->alnumRunLength;
+        chrlen = run < chrlen ? run : chrlen;
 
-            kanjiRunLength = 0;
-            alnumRunLength += chrlen;
-            numRunLength = 0;
+        state->kanjiRunLength = 0;
+        state->alnumRunLength += chrlen;
+        state->numRunLength = 0;
 
-            if (alnumRunLength < byteToAlnumRunLength) {
-                continue;
+        changeMode = state->alnumRunLength >= byteToAlnumRunLength;
+
+    } else if (state->segmentMode == MODE_BYTE && mode == MODE_NUMERIC) {
+        state->segmentLength += state->kanjiRunLength + state->alnumRunLength;
+
+        if (state->numRunLength < byteToNum1RunLength) {
+            chrlen = byteToNum1RunLength - state->numRunLength;
+            chrlen = run < chrlen ? run : chrlen;
+        }
+
+        state->kanjiRunLength = 0;
+        state->alnumRunLength = 0;
+        state->numRunLength += chrlen;
+
+        if (state->numRunLength < byteToNum1RunLength) {
+            changeMode = false;
+
+        } else if (state->numRunLength < byteToNum2RunLength) {
+            changeMode = i + chrlen >= length ||
+                         (classes[i + chrlen] &
+                          CHAR_CLASS_EXCLUSIVE_ALPHANUMERIC);
+        }
+
+    } else if (state->segmentMode == MODE_ALPHANUMERIC &&
+               mode == MODE_NUMERIC) {
+        chrlen = alnumToNumRunLength - state->numRunLength;
+        chrlen = run < chrlen ? run : chrlen;
+
+        state->numRunLength += chrlen;
+
+        changeMode = state->numRunLength >= alnumToNumRunLength;
+
+    } else {
+        state->segmentLength += state->kanjiRunLength +
+                                state->alnumRunLength + state->numRunLength;
+
+        state->kanjiRunLength = 0;
+        state->alnumRunLength = 0;
+        state->numRunLength = 0;
+
+        if (state->segmentMode == mode) {
+            chrlen = run;
+            state->segmentLength += chrlen;
+            changeMode = false;
+        }
+    }
+
+    state->position = i + chrlen;
+
+    if (!changeMode) {
+        return true;
+    }
+
+    if (!appendSegment(segments, numBits, versionClass, state->segmentMode,
+                       state->segmentLength)) {
+        return false;
+    }
+
+    state->segmentMode = mode;
+    state->segmentLength =
+        state->kanjiRunLength + state->alnumRunLength + state->numRunLength;
+
+    if (state->segmentLength == 0) {
+        state->segmentLength = chrlen;
+    }
+
+    state->kanjiRunLength = 0;
+    state->alnumRunLength = 0;
+    state->numRunLength = 0;
+
+    return true;
+}
+
+// runs the algorithm in Annex J for numClasses version classes from
+// firstClass side by side, in one pass over the data
+static bool segmentMixedMode(SegmentList *segments, size_t *numBits,
+                             const uint8_t *classes, const uint16_t *runs,
+                             size_t length, bool useKanjiMode,
+                             VersionClass firstClass, size_t numClasses) {
+    MixedModeState states[NUM_VERSION_CLASSES];
+
+    for (size_t c = 0; c < numClasses; c++) {
+        numBits[c] = 0;
+    }
+
+    if (length < 9 || (useKanjiMode && length < 15)) {
+        Mode mode = selectMode(classes, length, useKanjiMode);
+
+        for (size_t c = 0; c < numClasses; c++) {
+            if (!appendSegment(&segments[c], &numBits[c], firstClass + c, mode,
+                               length)) {
+                return false;
             }
+        }
 
-        } else if (segmentMode == MODE_BYTE && mode == MODE_NUMERIC) {
-            segmentLength += kanjiRunLength + alnumRunLength;
+        return true;
+    }
 
-            kanjiRunLength = 0;
-            alnumRunLength = 0;
-            numRunLength += chrlen;
+    for (size_t c = 0; c < numClasses; c++) {
+        startMixedMode(&states[c], classes, useKanjiMode, firstClass + c);
+    }
 
-            if (numRunLength < byteToNum1RunLength) {
-                continue;
+    for (;;) {
+        size_t i = length;
+
+        for (size_t c = 0; c < numClasses; c++) {
+            i = states[c].position < i ? states[c].position : i;
+        }
+
+        if (i >= length) {
+            break;
+        }
+
+        for (size_t c = 0; c < numClasses; c++) {
+            if (states[c].position == i &&
+                !stepMixedMode(&states[c], &segments[c], &numBits[c], classes,
+                               runs, length, useKanjiMode)) {
+                return false;
             }
+        }
+    }
+
+    for (size_t c = 0; c < numClasses; c++) {
+        MixedModeState *state = &states[c];
+
+        state->segmentLength += state->kanjiRunLength +
+                                state->alnumRunLength + state->numRunLength;
+
+        if (!appendSegment(&segments[c], &numBits[c], state->versionClass,
+                           state->segmentMode, state->segmentLength)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Append the segments of the analyzed data to the list. Minimize the bit stream
+ * length using the algorithm in Annex J of JIS X 0510:2018, stepping over whole
+ * runs of characters with the same mode wherever the outcome does not depend on
+ * the individual characters.
+ *
+ * @param segments The list of segments
+ * @param classes The classes of the bytes of the data, see analyzeCharacters
+ * @param runs The run lengths, see analyzeCharacters
+ * @param length The length of the data
+ * @param useKanjiMode Whether to use Kanji mode
+ * @param versionClass The version class
+ * @return false if the list could not hold the segments
+ */
+bool createMixedModeSegmentsFromClasses(SegmentList *segments,
+                                        const uint8_t *classes,
+                                        const uint16_t *runs, size_t length,
+                                        bool useKanjiMode,
+                                        VersionClass versionClass) {
+    size_t numBits;
+
+    return segmentMixedMode(segments, &numBits, classes, runs, length,
+                            useKanjiMode, versionClass, 1);
+}
+
+/**
+ * Append the segments of the analyzed data for each version class from
+ * firstClass to lastClass to the list of that class, like
+ * createMixedModeSegmentsFromClasses, in one pass over the data.
+ *
+ * @param segments The lists of segments, indexed by version class
+ * @param numBits The lengths of the bit streams, indexed by version class
+ * @param classes The classes of the bytes of the data, see analyzeCharacters
+ * @param runs The run lengths, see analyzeCharacters
+ * @param length The length of the data
+ * @param useKanjiMode Whether to use Kanji mode
+ * @param firstClass The first version class
+ * @param lastClass The last version class
+ * @return false if a list could not hold the segments
+ */
+bool createMixedModeSegmentsByClass(SegmentList *segments, size_t *numBits,
+                                    const uint8_t *classes,
+                                    const uint16_t *runs, size_t length,
+                                    bool useKanjiMode, VersionClass firstClass,
+                                    VersionClass lastClass) {
+    return segmentMixedMode(segments + firstClass, numBits + firstClass,
+                            classes, runs, length, useKanjiMode, firstClass,
+                            lastClass - firstClass + 1);
+}
+
+#define NUM_MODES 4
+
+static const Mode modes[NUM_MODES] = {MODE_NUMERIC, MODE_ALPHANUMERIC,
+                                      MODE_BYTE, MODE_KANJI};
+
+// whether the character at a position can be encoded in the mode modes[m]
+static bool canEncode(uint8_t classes, size_t m, bool useKanjiMode) {
+    switch (modes[m]) {
+    case MODE_NUMERIC:
+        return classes & CHAR_CLASS_NUMERIC;
+
+    case MODE_ALPHANUMERIC:
+        return classes & CHAR_CLASS_ALPHANUMERIC;
+
+    case MODE_KANJI:
+        return useKanjiMode && (classes & CHAR_CLASS_KANJI);
+
+    default:
+        return true;
+    }
+}
+
+// finds the shortest segments for numClasses version classes from firstClass
+// side by side, in one pass over the data; the trace holds numClasses bytes
+// per position
+static inline bool findOptimalSegments(SegmentList *segments,
+                                       size_t *numBits, uint8_t *trace,
+                                       const uint8_t *classes, size_t length,
+                                       bool useKanjiMode,
+                                       VersionClass firstClass,
+                                       size_t numClasses) {
+    uint32_t headerCosts[NUM_VERSION_CLASSES][NUM_MODES];
+    uint32_t charCosts[NUM_MODES];
+
+    for (size_t m = 0; m < NUM_MODES; m++) {
+        size_t chrlen = modes[m] == MODE_KANJI ? 2 : 1;
+
+        for (size_t c = 0; c < numClasses; c++) {
+            headerCosts[c][m] =
+                6 * (numBitsModeIndicator +
+                     getNumBitsCharCountIndicator(firstClass + c, modes[m]));
+        }
+
+        charCosts[m] = getNumBitsEncodedData(modes[m], 6 * chrlen);
+    }
+
+    // the costs of the last three positions, in sixths of a bit; the cost of
+    // ending a segment at a position is the cheapest one rounded up to a bit
+    uint32_t costs[3][NUM_VERSION_CLASSES][NUM_MODES];
+    uint32_t endCosts[3][NUM_VERSION_CLASSES] = {{0}};
+    uint8_t endModes[3][NUM_VERSION_CLASSES] = {{0}};
+
+    // the slots of the positions j, j - 1 and j - 2
+    size_t slots[3] = {1, 0, 2};
+
+    for (size_t j = 1; j <= length; j++) {
+        uint8_t *jTrace = &trace[j * numClasses];
+        size_t slot = slots[0];
+
+        for (size_t c = 0; c < numClasses; c++) {
+            jTrace[c] = 0;
+            endCosts[slot][c] = UINT32_MAX;
+        }
+
+        for (size_t m = 0; m < NUM_MODES; m++) {
+            size_t chrlen = modes[m] == MODE_KANJI ? 2 : 1;
+            size_t i = j - chrlen;
+            size_t iSlot = slots[chrlen];
+            bool encodable =
+                j >= chrlen && canEncode(classes[i], m, useKanjiMode);
 
-            if (numRunLength < byteToNum2RunLength) {
-                if (i < length - 1 &&
-                    !isExclusiveAlphanumericSubset(data[i + 1])) {
+            for (size_t c = 0; c < numClasses; c++) {
+                uint32_t *cost = &costs[slot][c][m];
+
+                *cost = UINT32_MAX;
+
+                if (!encodable) {
                     continue;
                 }
-            }
 
-        } else if (segmentMode == MODE_ALPHANUMERIC && mode == MODE_NUMERIC) {
-            numRunLength += chrlen;
+                uint32_t newSegmentCost =
+                    endCosts[iSlot][c] + headerCosts[c][m];
+                size_t previous = endModes[iSlot][c];
 
-            if (numRunLength < alnumToNumRunLength) {
-                continue;
-            }
+                if (i > 0 && costs[iSlot][c][m] <= newSegmentCost) {
+                    newSegmentCost = costs[iSlot][c][m];
+                    previous = m;
+                }
 
-        } else {
-            segmentLength += kanjiRunLength + alnumRunLength + numRunLength;
+                *cost = newSegmentCost + charCosts[m];
+                jTrace[c] |= previous << (2 * m);
 
-            kanjiRunLength = 0;
-            alnumRunLength = 0;
-            numRunLength = 0;
+                uint32_t endCost = (*cost + 5) / 6 * 6;
 
-            if (segmentMode == mode) {
-                segmentLength += chrlen;
-                continue;
+                if (endCost < endCosts[slot][c]) {
+                    endCosts[slot][c] = endCost;
+                    endModes[slot][c] = m;
+                }
             }
         }
 
-        Segment *segment = newSegment(segmentMode, segmentLength);
+        slots[2] = slots[1];
+        slots[1] = slot;
+        slots[0] = 3 - slots[1] - slots[2];
+    }
+
+    for (size_t c = 0; c < numClasses; c++) {
+        numBits[c] = endCosts[slots[1]][c] / 6;
 
-        if (segment == NULL) {
-            return NULL;
-        }
+        // the segments come out last to first
+        SegmentList *list = &segments[c];
+        size_t first = list->numSegments;
+        size_t m = endModes[slots[1]][c];
+        size_t segmentLength = 0;
+
+        for (size_t j = length; j > 0;) {
+            size_t previous = (trace[j * numClasses + c] >> (2 * m)) & 3;
 
-        segments = addSegment(segments, segment);
+            segmentLength += modes[m] == MODE_KANJI ? 2 : 1;
+            j -= modes[m] == MODE_KANJI ? 2 : 1;
 
-        segmentMode = mode;
-        segmentLength = kanjiRunLength + alnumRunLength + numRunLength;
+            if (j == 0 || previous != m) {
+                if (!addSegment(list, modes[m], segmentLength)) {
+                    return false;
+                }
+
+                segmentLength = 0;
+                m = previous;
+            }
+        }
+
+        for (size_t i = first, k = list->numSegments; i + 1 < k; i++, k--) {
+            Segment segment = list->segments[i];
 
-        if (segmentLength == 0) {
-            segmentLength = chrlen;
+            list->segments[i] = list->segments[k - 1];
+            list->segments[k - 1] = segment;
         }
+    }
 
-        kanjiRunLength = 0;
-        alnumRunLength = 0;
-        numRunLength = 0;
+    return true;
+}
+
+/**
+ * Compute a lower bound of the length of the bit stream of any segmentation of
+ * the classified data: every byte is counted at its cheapest mode, a digit at
+ * 10/3 bits, another alphanumeric character at 11/2 bits, any other byte at 8
+ * bits or at 13/2 bits with Kanji mode, plus one mode indicator if there is
+ * any data.
+ *
+ * @param classes The classes of the bytes of the data, see classifyCharacters
+ * @param length The length of the data
+ * @param useKanjiMode Whether to use Kanji mode
+ * @return The lower bound in bits
+ */
+size_t getMinNumBitsFromClasses(const uint8_t *classes, size_t length,
+                                bool useKanjiMode) {
+    uint32_t otherCost = useKanjiMode ? 39 : 48;
+    size_t cost = 0;
+
+    for (size_t i = 0; i < length; i++) {
+        cost += classes[i] & CHAR_CLASS_NUMERIC       ? 20
+                : classes[i] & CHAR_CLASS_ALPHANUMERIC ? 33
+                                                       : otherCost;
     }
 
-    segmentLength += kanjiRunLength + alnumRunLength + numRunLength;
+    return length > 0 ? numBitsModeIndicator + (cost + 5) / 6 : 0;
+}
+
+/**
+ * Append the segments of the classified data with the shortest bit stream to
+ * the list. Unlike the algorithm in Annex J of JIS X 0510:2018, the result is
+ * exact: for every position and mode, the shortest encoding of the data up to
+ * that position whose last segment has that mode is kept, with the data bits
+ * counted in sixths of a bit and rounded up where a segment ends.
+ *
+ * @param segments The list of segments
+ * @param trace The previous modes, one byte per position holding the 2-bit
+ *              previous mode of each of the four modes, length + 1 bytes
+ * @param classes The classes of the bytes of the data, see classifyCharacters
+ * @param length The length of the data
+ * @param useKanjiMode Whether to use Kanji mode
+ * @param versionClass The version class
+ * @return false if the list could not hold the segments
+ */
+bool createOptimalSegmentsFromClasses(SegmentList *segments, uint8_t *trace,
+                                      const uint8_t *classes, size_t length,
+                                      bool useKanjiMode,
+                                      VersionClass versionClass) {
+    size_t numBits;
+
+    return findOptimalSegments(segments, &numBits, trace, classes, length,
+                               useKanjiMode, versionClass, 1);
+}
 
-    Segment *segment = newSegment(segmentMode, segmentLength);
+/**
+ * Append the shortest segments of the classified data for each version class
+ * from firstClass to lastClass to the list of that class, like
+ * createOptimalSegmentsFromClasses, in one pass over the data.
+ *
+ * @param segments The lists of segments, indexed by version class
+ * @param numBits The lengths of the bit streams, indexed by version class
+ * @param trace The previous modes, one byte per position and class holding
+ *              the 2-bit previous mode of each of the four modes,
+ *              (lastClass - firstClass + 1) * (length + 1) bytes
+ * @param classes The classes of the bytes of the data, see classifyCharacters
+ * @param length The length of the data
+ * @param useKanjiMode Whether to use Kanji mode
+ * @param firstClass The first version class
+ * @param lastClass The last version class
+ * @return false if a list could not hold the segments
+ */
+bool createOptimalSegmentsByClass(SegmentList *segments, size_t *numBits,
+                                  uint8_t *trace, const uint8_t *classes,
+                                  size_t length, bool useKanjiMode,
+                                  VersionClass firstClass,
+                                  VersionClass lastClass) {
+    size_t numClasses = lastClass - firstClass + 1;
+
+    segments += firstClass;
+    numBits += firstClass;
+
+    // a constant number of classes lets the loops over them be unrolled
+    if (numClasses == 1) {
+        return findOptimalSegments(segments, numBits, trace, classes, length,
+                                   useKanjiMode, firstClass, 1);
+    } else if (numClasses == 2) {
+        return findOptimalSegments(segments, numBits, trace, classes, length,
+                                   useKanjiMode, firstClass, 2);
+    } else {
+        return findOptimalSegments(segments, numBits, trace, classes, length,
+                                   useKanjiMode, firstClass, 3);
+    }
+}
 
-    if (segment == NULL) {
-        return NULL;
+/**
+ * Append the segments of the data with the shortest bit stream to the list.
+ *
+ * @param segments The list of segments
+ * @param data The data
+ * @param length The length of the data
+ * @param useKanjiMode Whether to use Kanji mode
+ * @param versionClass The version class
+ * @return false if the list could not hold the segments
+ */
+bool createOptimalSegments(SegmentList *segments, const uint8_t *data,
+                           size_t length, bool useKanjiMode,
+                           VersionClass versionClass) {
+    uint8_t *classes = malloc(sizeof(uint8_t) * length);
+    uint8_t *trace = malloc(sizeof(uint8_t) * (length + 1));
+    bool added = false;
+
+    if ((classes != NULL || length == 0) && trace != NULL) {
+        classifyCharacters(classes, data, length);
+        added = createOptimalSegmentsFromClasses(
+            segments, trace, classes, length, useKanjiMode, versionClass);
     }
 
-    segments = addSegment(segments, segment);
+    free(classes);
+    free(trace);
 
-    return segments;
+    return added;
 }
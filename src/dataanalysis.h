@@ -29,10 +29,46 @@
 #include <stddef.h>
 #include <stdint.h>
 
-extern Segment *createModeSegment(const uint8_t *data, size_t length,
-                                  bool useKanjiMode);
-extern Segment *createMixedModeSegments(const uint8_t *data, size_t length,
-                                        bool useKanjiMode,
-                                        VersionClass versionClass);
+extern void analyzeCharacters(uint8_t *classes, uint16_t *runs,
+                              const uint8_t *data, size_t length,
+                              bool useKanjiMode);
+extern bool createModeSegment(SegmentList *segments, const uint8_t *data,
+                              size_t length, bool useKanjiMode);
+extern bool createMixedModeSegments(SegmentList *segments,
+                                    const uint8_t *data, size_t length,
+                                    bool useKanjiMode,
+                                    VersionClass versionClass);
+extern bool createModeSegmentFromClasses(SegmentList *segments,
+                                         const uint8_t *classes, size_t length,
+                                         bool useKanjiMode);
+extern bool createMixedModeSegmentsFromClasses(SegmentList *segments,
+                                               const uint8_t *classes,
+                                               const uint16_t *runs,
+                                               size_t length,
+                                               bool useKanjiMode,
+                                               VersionClass versionClass);
+extern bool createMixedModeSegmentsByClass(SegmentList *segments,
+                                           size_t *numBits,
+                                           const uint8_t *classes,
+                                           const uint16_t *runs, size_t length,
+                                           bool useKanjiMode,
+                                           VersionClass firstClass,
+                                           VersionClass lastClass);
+extern bool createOptimalSegments(SegmentList *segments, const uint8_t *data,
+                                  size_t length, bool useKanjiMode,
+                                  VersionClass versionClass);
+extern size_t getMinNumBitsFromClasses(const uint8_t *classes, size_t length,
+                                       bool useKanjiMode);
+extern bool createOptimalSegmentsFromClasses(SegmentList *segments,
+                                             uint8_t *trace,
+                                             const uint8_t *classes,
+                                             size_t length, bool useKanjiMode,
+                                             VersionClass versionClass);
+extern bool createOptimalSegmentsByClass(SegmentList *segments,
+                                         size_t *numBits, uint8_t *trace,
+                                         const uint8_t *classes, size_t length,
+                                         bool useKanjiMode,
+                                         VersionClass firstClass,
+                                         VersionClass lastClass);
 
 #endif /* DATAANALYSIS_H */
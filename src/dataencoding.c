@@ -22,50 +22,50 @@
 
 #include "dataencoding.h"
 #include "charset.h"
+#include "tables.h"
 #include <string.h>
 
-#define numBitsModeIndicator 4
-
-static const size_t numBitsCharCountIndicator[][4] = {
-    {10, 9, 8, 8}, {12, 11, 16, 10}, {14, 13, 16, 12}};
-
-static const size_t numDataCodewords[][4] = {
-    {19, 16, 13, 9},          {34, 28, 22, 16},
-    {55, 44, 34, 26},         {80, 64, 48, 36},
-    {108, 86, 62, 46},        {136, 108, 76, 60},
-    {156, 124, 88, 66},       {194, 154, 110, 86},
-    {232, 182, 132, 100},     {274, 216, 154, 122},
-    {324, 254, 180, 140},     {370, 290, 206, 158},
-    {428, 334, 244, 180},     {461, 365, 261, 197},
-    {523, 415, 295, 223},     {589, 453, 325, 253},
-    {647, 507, 367, 283},     {721, 563, 397, 313},
-    {795, 627, 445, 341},     {861, 669, 485, 385},
-    {932, 714, 512, 406},     {1006, 782, 568, 442},
-    {1094, 860, 614, 464},    {1174, 914, 664, 514},
-    {1276, 1000, 718, 538},   {1370, 1062, 754, 596},
-    {1468, 1128, 808, 628},   {1531, 1193, 871, 661},
-    {1631, 1267, 911, 701},   {1735, 1373, 985, 745},
-    {1843, 1455, 1033, 793},  {1955, 1541, 1115, 845},
-    {2071, 1631, 1171, 901},  {2191, 1725, 1231, 961},
-    {2306, 1812, 1286, 986},  {2434, 1914, 1354, 1054},
-    {2566, 1992, 1426, 1096}, {2702, 2102, 1502, 1142},
-    {2812, 2216, 1582, 1222}, {2956, 2334, 1666, 1276}};
-
-static size_t getNumBitsCharCountIndicator(VersionClass versionClass,
-                                           Mode mode) {
-    // {1, 2, 4, 8} -> {0, 1, 2, 3}
-    return numBitsCharCountIndicator[versionClass][(mode ^ -2) / -3];
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define DATAENCODING_X86
+#include <immintrin.h>
+#endif
+
+// the largest version of each version class
+static const unsigned int lastVersions[NUM_VERSION_CLASSES] = {9, 26, 40};
+
+// the index of a mode in the tables, {1, 2, 4, 8} -> {0, 1, 2, 3}
+static size_t getModeIndex(Mode mode) {
+    return ((int)mode ^ -2) / -3;
+}
+
+/**
+ * Get the width of the character count indicator of a mode.
+ *
+ * @param versionClass The version class
+ * @param mode The mode
+ * @return The number of bits of the character count indicator
+ */
+size_t getNumBitsCharCountIndicator(VersionClass versionClass, Mode mode) {
+    return numBitsCharCountIndicators[versionClass][getModeIndex(mode)];
 }
 
 static size_t getNumDataCodewords(unsigned int version,
                                   ErrorCorrectionLevel ecLevel) {
-    return numDataCodewords[version - 1][ecLevel];
+    return symbolDescriptors[version - 1][ecLevel].numDataCodewords;
 }
 
-static size_t getNumBitsEncodedData(Mode mode, size_t length) {
+/**
+ * Get the number of bits of the data of a segment, without its mode and
+ * character count indicators.
+ *
+ * @param mode The mode
+ * @param length The length of the segment in bytes
+ * @return The number of bits of the encoded data
+ */
+size_t getNumBitsEncodedData(Mode mode, size_t length) {
     switch (mode) {
     case MODE_NUMERIC:
-        return (length / 3 * 10) + (length % 3 / 2 * 7) + (length % 3 % 2 * 7);
+        return (length / 3 * 10) + (length % 3 / 2 * 7) + (length % 3 % 2 * 4);
 
     case MODE_ALPHANUMERIC:
         return (length / 2 * 11) + (length % 2 * 6);
@@ -82,28 +82,69 @@ static size_t getNumBitsEncodedData(Mode mode, size_t length) {
 }
 
 /**
- * Recommend the smallest version that can contain the given data.
+ * Get the length of the bit stream of the segments, without the terminator.
  *
  * @param segments The segments of the data
- * @param ecLevel The error correction level
  * @param versionClass The version class
- * @return The recommended version number
+ * @return The number of bits
  */
-int recommendVersion(const Segment *segments, ErrorCorrectionLevel ecLevel,
-                     VersionClass versionClass) {
+size_t getNumBitsSegments(const SegmentList *segments,
+                          VersionClass versionClass) {
     size_t numBits = 0;
 
-    for (const Segment *segment = segments; segment != NULL;
-         segment = segment->next) {
+    for (size_t i = 0; i < segments->numSegments; i++) {
+        const Segment *segment = &segments->segments[i];
+
         numBits += numBitsModeIndicator;
         numBits += getNumBitsCharCountIndicator(versionClass, segment->mode);
         numBits += getNumBitsEncodedData(segment->mode, segment->length);
     }
 
+    return numBits;
+}
+
+/**
+ * Get the version class of a version.
+ *
+ * @param version The version
+ * @return The version class
+ */
+VersionClass getVersionClass(unsigned int version) {
+    return version < 10 ? VERSION_CLASS_SMALL
+           : version < 27 ? VERSION_CLASS_MEDIUM
+                          : VERSION_CLASS_LARGE;
+}
+
+/**
+ * Recommend the smallest version that can contain the given data.
+ *
+ * @param segments The segments of the data
+ * @param ecLevel The error correction level
+ * @param versionClass The version class
+ * @return The recommended version number
+ */
+int recommendVersion(const SegmentList *segments, ErrorCorrectionLevel ecLevel,
+                     VersionClass versionClass) {
+    size_t numBits = getNumBitsSegments(segments, versionClass);
+
+    return recommendVersionForNumBits(numBits, ecLevel, versionClass);
+}
+
+/**
+ * Recommend the smallest version of the version class that can contain a bit
+ * stream of the given length.
+ *
+ * @param numBits The length of the bit stream, see getNumBitsSegments
+ * @param ecLevel The error correction level
+ * @param versionClass The version class
+ * @return The recommended version number, or -1 if none can contain it
+ */
+int recommendVersionForNumBits(size_t numBits, ErrorCorrectionLevel ecLevel,
+                               VersionClass versionClass) {
     unsigned int start = (const unsigned int[]){1, 10, 27}[versionClass];
-    unsigned int end = (const unsigned int[]){9, 26, 40}[versionClass];
 
-    for (unsigned int version = start; version <= end; version++) {
+    for (unsigned int version = start; version <= lastVersions[versionClass];
+         version++) {
         if (numBits <= getNumDataCodewords(version, ecLevel) * 8) {
             return version;
         }
@@ -112,103 +153,317 @@ int recommendVersion(const Segment *segments, ErrorCorrectionLevel ecLevel,
     return -1;
 }
 
-static void appendBits(uint8_t *array, size_t *index, unsigned int value,
-                       size_t numBits) {
-    *index += numBits;
+/**
+ * Select the version classes whose versions a bit stream of the data could fit
+ * into. The first one is the first that fits the lower bound of the length,
+ * and a segmentation no longer than a single byte mode segment needs no class
+ * after the first one that fits that segment.
+ *
+ * @param firstClass The first version class
+ * @param lastClass The last version class
+ * @param minNumBits The lower bound, see getMinNumBitsFromClasses
+ * @param length The length of the data
+ * @param ecLevel The error correction level
+ * @return false if no version can contain the data
+ */
+bool selectVersionClasses(VersionClass *firstClass, VersionClass *lastClass,
+                          size_t minNumBits, size_t length,
+                          ErrorCorrectionLevel ecLevel) {
+    VersionClass versionClass = VERSION_CLASS_SMALL;
+
+    while (recommendVersionForNumBits(minNumBits, ecLevel, versionClass) ==
+           -1) {
+        if (versionClass == VERSION_CLASS_LARGE) {
+            return false;
+        }
+
+        versionClass++;
+    }
+
+    *firstClass = versionClass;
 
-    for (size_t j = 1; j <= numBits; j++) {
-        size_t i = *index - j;
-        array[i / 8] |= (value & 1) << (7 - i % 8);
-        value >>= 1;
+    // the largest version of a class holds the most bytes in one segment
+    while (versionClass < VERSION_CLASS_LARGE &&
+           length > symbolDescriptors[lastVersions[versionClass] - 1][ecLevel]
+                        .capacities[getModeIndex(MODE_BYTE)]) {
+        versionClass++;
     }
+
+    *lastClass = versionClass;
+
+    return true;
+}
+
+// writes big-endian bits into the codewords through a 64-bit accumulator
+typedef struct BitWriter {
+    uint8_t *codewords;
+    size_t numBytes; // bytes written to the codewords
+    uint64_t bits;   // the low numBits bits are still to be written
+    unsigned int numBits;
+} BitWriter;
+
+// writes out the whole bytes of the accumulator, leaving fewer than 8 bits
+static void flushBits(BitWriter *writer) {
+    // locals, as the byte stores could otherwise alias the writer
+    uint8_t *codewords = writer->codewords + writer->numBytes;
+    uint64_t bits = writer->bits;
+    unsigned int numBits = writer->numBits;
+    size_t numBytes = numBits / 8;
+
+    for (size_t i = 0; i < numBytes; i++) {
+        numBits -= 8;
+        codewords[i] = (uint8_t)(bits >> numBits);
+    }
+
+    writer->numBytes += numBytes;
+    writer->numBits = numBits;
+}
+
+// appends the low numBits bits of the value, at most 56
+static void appendBits(BitWriter *writer, uint64_t value, size_t numBits) {
+    if (writer->numBits + numBits > 64) {
+        flushBits(writer);
+    }
+
+    writer->bits =
+        writer->bits << numBits | (value & (((uint64_t)1 << numBits) - 1));
+    writer->numBits += numBits;
+}
+
+static size_t getNumBitsWritten(const BitWriter *writer) {
+    return writer->numBytes * 8 + writer->numBits;
 }
 
-static void appendModeIndicator(uint8_t *codewords, size_t *index, Mode mode) {
-    appendBits(codewords, index, mode, numBitsModeIndicator);
+static void appendModeIndicator(BitWriter *writer, Mode mode) {
+    appendBits(writer, mode, numBitsModeIndicator);
 }
 
-static void appendCharCountIndicator(uint8_t *codewords, size_t *index,
-                                     size_t charCount,
+static void appendCharCountIndicator(BitWriter *writer, size_t charCount,
                                      VersionClass versionClass, Mode mode) {
-    appendBits(codewords, index, charCount,
+    appendBits(writer, charCount,
                getNumBitsCharCountIndicator(versionClass, mode));
 }
 
-static void appendNumeric(uint8_t *codewords, size_t *index,
-                          const uint8_t *data, size_t length) {
+#ifdef DATAENCODING_X86
+// converts 12 digits to four 10-bit groups per iteration: the digits of each
+// triple are weighted by 100, 10 and 1 and summed in a 32-bit lane, and two
+// lanes are joined into 20 bits; returns the number of digits converted
+__attribute__((target("ssse3"))) static size_t
+appendNumericSSSE3(BitWriter *writer, const uint8_t *data, size_t length) {
+    const __m128i triples =
+        _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m128i weights =
+        _mm_setr_epi8(100, 10, 1, 0, 100, 10, 1, 0, 100, 10, 1, 0, 100, 10, 1,
+                      0);
+    const __m128i pairWeights = _mm_set1_epi32(1 << 16 | 1024);
+    size_t i = 0;
+
+    for (; i + 16 <= length; i += 12) {
+        __m128i digits = _mm_sub_epi8(
+            _mm_loadu_si128((const __m128i *)(data + i)), _mm_set1_epi8('0'));
+        __m128i values = _mm_madd_epi16(
+            _mm_maddubs_epi16(_mm_shuffle_epi8(digits, triples), weights),
+            _mm_set1_epi16(1));
+        __m128i pairs =
+            _mm_madd_epi16(_mm_packs_epi32(values, values), pairWeights);
+        uint64_t upper = (uint32_t)_mm_cvtsi128_si32(pairs);
+        uint64_t lower = (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(pairs, 4));
+
+        appendBits(writer, upper << 20 | lower, 40);
+    }
+
+    return i;
+}
+
+// converts 16 characters to four 22-bit groups of two 11-bit pairs per
+// iteration; returns the number of characters converted
+__attribute__((target("ssse3"))) static size_t
+appendAlphanumericSSSE3(BitWriter *writer, const uint8_t *data, size_t length) {
+    // the codes of " $%*+-./" by their low nibble
+    const __m128i symbols = _mm_setr_epi8(36, 0, 0, 0, 37, 38, 0, 0, 0, 0, 39,
+                                          40, 0, 41, 42, 43);
+    const __m128i pairWeights = _mm_set1_epi16(1 << 8 | 45);
+    const __m128i quadWeights = _mm_set1_epi32(1 << 16 | 2048);
+    size_t i = 0;
+
+    for (; i + 16 <= length; i += 16) {
+        __m128i chars = _mm_loadu_si128((const __m128i *)(data + i));
+        __m128i isLetter = _mm_cmpgt_epi8(chars, _mm_set1_epi8('@'));
+        __m128i isSymbol = _mm_cmplt_epi8(chars, _mm_set1_epi8('0'));
+        __m128i isColon = _mm_cmpeq_epi8(chars, _mm_set1_epi8(':'));
+
+        // digits and letters by their distance from '0', and the rest looked up
+        __m128i codes =
+            _mm_sub_epi8(_mm_sub_epi8(chars, _mm_set1_epi8('0')),
+                         _mm_and_si128(isLetter, _mm_set1_epi8(7)));
+        codes = _mm_or_si128(
+            _mm_andnot_si128(isSymbol, codes),
+            _mm_and_si128(isSymbol,
+                          _mm_shuffle_epi8(symbols,
+                                           _mm_and_si128(chars,
+                                                         _mm_set1_epi8(15)))));
+        codes = _mm_or_si128(_mm_andnot_si128(isColon, codes),
+                             _mm_and_si128(isColon, _mm_set1_epi8(44)));
+
+        // the first character of a pair is the low byte and weighted by 45
+        __m128i pairs = _mm_maddubs_epi16(codes, pairWeights);
+        __m128i quads = _mm_madd_epi16(pairs, quadWeights);
+        uint64_t quad0 = (uint32_t)_mm_cvtsi128_si32(quads);
+        uint64_t quad1 = (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(quads, 4));
+        uint64_t quad2 = (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(quads, 8));
+        uint64_t quad3 = (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(quads, 12));
+
+        appendBits(writer, quad0 << 22 | quad1, 44);
+        appendBits(writer, quad2 << 22 | quad3, 44);
+    }
+
+    return i;
+}
+
+// converts 8 characters to four 26-bit groups of two 13-bit values per
+// iteration; returns the number of bytes converted
+__attribute__((target("ssse3"))) static size_t
+appendKanjiSSSE3(BitWriter *writer, const uint8_t *data, size_t length) {
+    const __m128i swap =
+        _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    const __m128i pairWeights = _mm_set1_epi32(1 << 16 | 8192);
     size_t i = 0;
 
+    for (; i + 16 <= length; i += 16) {
+        __m128i chars = _mm_shuffle_epi8(
+            _mm_loadu_si128((const __m128i *)(data + i)), swap);
+        __m128i values =
+            _mm_and_si128(_mm_sub_epi16(chars, _mm_set1_epi16(0x8140)),
+                          _mm_set1_epi16(0x3FFF));
+        values = _mm_add_epi16(
+            _mm_mullo_epi16(_mm_srli_epi16(values, 8), _mm_set1_epi16(0xC0)),
+            _mm_and_si128(values, _mm_set1_epi16(0xFF)));
+
+        __m128i pairs = _mm_madd_epi16(values, pairWeights);
+        uint64_t pair0 = (uint32_t)_mm_cvtsi128_si32(pairs);
+        uint64_t pair1 = (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(pairs, 4));
+        uint64_t pair2 = (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(pairs, 8));
+        uint64_t pair3 = (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(pairs, 12));
+
+        appendBits(writer, pair0 << 26 | pair1, 52);
+        appendBits(writer, pair2 << 26 | pair3, 52);
+    }
+
+    return i;
+}
+#endif
+
+static void appendNumeric(BitWriter *writer, const uint8_t *data,
+                          size_t length) {
+    size_t i = 0;
+
+#ifdef DATAENCODING_X86
+    if (__builtin_cpu_supports("ssse3")) {
+        i = appendNumericSSSE3(writer, data, length);
+        length -= i;
+    }
+#endif
+
     while (length >= 3) {
         unsigned int value = (data[i] - '0') * 100 + (data[i + 1] - '0') * 10 +
                              (data[i + 2] - '0');
-        appendBits(codewords, index, value, 10);
+        appendBits(writer, value, 10);
         i += 3;
         length -= 3;
     }
 
     if (length == 2) {
         unsigned int value = (data[i] - '0') * 10 + (data[i + 1] - '0');
-        appendBits(codewords, index, value, 7);
+        appendBits(writer, value, 7);
 
     } else if (length == 1) {
         unsigned int value = data[i] - '0';
-        appendBits(codewords, index, value, 4);
+        appendBits(writer, value, 4);
     }
 }
 
-static void appendAlphanumeric(uint8_t *codewords, size_t *index,
-                               const uint8_t *data, size_t length) {
+static void appendAlphanumeric(BitWriter *writer, const uint8_t *data,
+                               size_t length) {
     size_t i = 0;
 
+#ifdef DATAENCODING_X86
+    if (__builtin_cpu_supports("ssse3")) {
+        i = appendAlphanumericSSSE3(writer, data, length);
+        length -= i;
+    }
+#endif
+
     while (length >= 2) {
         unsigned int value = getAlphanumericCode(data[i]) * 45 +
                              getAlphanumericCode(data[i + 1]);
-        appendBits(codewords, index, value, 11);
+        appendBits(writer, value, 11);
         i += 2;
         length -= 2;
     }
 
     if (length == 1) {
         unsigned int value = getAlphanumericCode(data[i]);
-        appendBits(codewords, index, value, 6);
+        appendBits(writer, value, 6);
     }
 }
 
-static void appendByte(uint8_t *codewords, size_t *index, const uint8_t *data,
-                       size_t length) {
-    for (size_t i = 0; i < length; i++) {
-        appendBits(codewords, index, data[i], 8);
+// copies the bytes as they are if the codewords are at a byte boundary, and
+// otherwise shifts each byte by the bits still in the accumulator
+static void appendByte(BitWriter *writer, const uint8_t *data, size_t length) {
+    uint8_t *codewords;
+
+    flushBits(writer);
+    codewords = writer->codewords + writer->numBytes;
+
+    if (writer->numBits == 0) {
+        memcpy(codewords, data, length);
+    } else {
+        uint64_t bits = writer->bits;
+
+        for (size_t i = 0; i < length; i++) {
+            bits = bits << 8 | data[i];
+            codewords[i] = (uint8_t)(bits >> writer->numBits);
+        }
+
+        writer->bits = bits;
     }
+
+    writer->numBytes += length;
 }
 
-static void appendKanji(uint8_t *codewords, size_t *index, const uint8_t *data,
+static void appendKanji(BitWriter *writer, const uint8_t *data,
                         size_t length) {
-    for (size_t i = 0; i < length; i += 2) {
+    size_t i = 0;
+
+#ifdef DATAENCODING_X86
+    if (__builtin_cpu_supports("ssse3")) {
+        i = appendKanjiSSSE3(writer, data, length);
+    }
+#endif
+
+    for (; i < length; i += 2) {
         unsigned int value = (data[i] << 8) | data[i + 1];
         value = (value - 0x8140) & 0x3FFF;
         value = (value >> 8) * 0xC0 + (value & 0xFF);
-        appendBits(codewords, index, value, 13);
+        appendBits(writer, value, 13);
     }
 }
 
-static void appendTerminator(uint8_t *codewords, size_t *index,
-                             size_t numCodewords) {
-    size_t numBits = numCodewords * 8 - *index;
-    appendBits(codewords, index, 0, numBits < 4 ? numBits : 4);
+static void appendTerminator(BitWriter *writer, size_t numCodewords) {
+    size_t numBits = numCodewords * 8 - getNumBitsWritten(writer);
+    appendBits(writer, 0, numBits < 4 ? numBits : 4);
 }
 
-static void appendPadding(uint8_t *codewords, size_t *index,
-                          size_t numCodewords) {
-    size_t numBits = ~*index + 1 & 7;
-    appendBits(codewords, index, 0, numBits);
-
-    size_t numPaddingCodewords = numCodewords - *index / 8;
-    unsigned int value = 0xEC;
+// pads to a byte boundary and fills the remaining codewords with 0xEC and 0x11
+static void appendPadding(BitWriter *writer, size_t numCodewords) {
+    appendBits(writer, 0, (~getNumBitsWritten(writer) + 1) & 7);
+    flushBits(writer);
 
-    for (size_t i = 0; i < numPaddingCodewords; i++) {
-        appendBits(codewords, index, value, 8);
-        value ^= 0xFD;
+    for (size_t i = writer->numBytes; i < numCodewords; i++) {
+        writer->codewords[i] = (i - writer->numBytes) % 2 == 0 ? 0xEC : 0x11;
     }
+
+    writer->numBytes = numCodewords;
 }
 
 /**
@@ -221,36 +476,34 @@ static void appendPadding(uint8_t *codewords, size_t *index,
  * @param versionClass The version class
  */
 void encodeDataCodewords(uint8_t *codewords, size_t numCodewords,
-                         const uint8_t *data, const Segment *segments,
+                         const uint8_t *data, const SegmentList *segments,
                          VersionClass versionClass) {
-    memset(codewords, 0, numCodewords);
-
-    size_t index = 0;
+    BitWriter writer = {codewords, 0, 0, 0};
 
-    for (const Segment *segment = segments; segment != NULL;
-         segment = segment->next) {
+    for (size_t i = 0; i < segments->numSegments; i++) {
+        const Segment *segment = &segments->segments[i];
 
-        appendModeIndicator(codewords, &index, segment->mode);
+        appendModeIndicator(&writer, segment->mode);
         appendCharCountIndicator(
-            codewords, &index,
+            &writer,
             segment->mode == MODE_KANJI ? segment->length / 2 : segment->length,
             versionClass, segment->mode);
 
         switch (segment->mode) {
         case MODE_NUMERIC:
-            appendNumeric(codewords, &index, data, segment->length);
+            appendNumeric(&writer, data, segment->length);
             break;
 
         case MODE_ALPHANUMERIC:
-            appendAlphanumeric(codewords, &index, data, segment->length);
+            appendAlphanumeric(&writer, data, segment->length);
             break;
 
         case MODE_BYTE:
-            appendByte(codewords, &index, data, segment->length);
+            appendByte(&writer, data, segment->length);
             break;
 
         case MODE_KANJI:
-            appendKanji(codewords, &index, data, segment->length);
+            appendKanji(&writer, data, segment->length);
             break;
 
         default:
@@ -260,6 +513,6 @@ void encodeDataCodewords(uint8_t *codewords, size_t numCodewords,
         data += segment->length;
     }
 
-    appendTerminator(codewords, &index, numCodewords);
-    appendPadding(codewords, &index, numCodewords);
+    appendTerminator(&writer, numCodewords);
+    appendPadding(&writer, numCodewords);
 }
@@ -28,11 +28,26 @@
 #include <stddef.h>
 #include <stdint.h>
 
-extern int recommendVersion(const Segment *segments,
+#define numBitsModeIndicator 4
+
+extern size_t getNumBitsCharCountIndicator(VersionClass versionClass,
+                                           Mode mode);
+extern size_t getNumBitsEncodedData(Mode mode, size_t length);
+extern size_t getNumBitsSegments(const SegmentList *segments,
+                                 VersionClass versionClass);
+extern VersionClass getVersionClass(unsigned int version);
+extern int recommendVersion(const SegmentList *segments,
                             ErrorCorrectionLevel ecLevel,
                             VersionClass versionClass);
+extern int recommendVersionForNumBits(size_t numBits,
+                                      ErrorCorrectionLevel ecLevel,
+                                      VersionClass versionClass);
+extern bool selectVersionClasses(VersionClass *firstClass,
+                                 VersionClass *lastClass, size_t minNumBits,
+                                 size_t length, ErrorCorrectionLevel ecLevel);
 extern void encodeDataCodewords(uint8_t *codewords, size_t numCodewords,
-                                const uint8_t *data, const Segment *segments,
+                                const uint8_t *data,
+                                const SegmentList *segments,
                                 VersionClass versionClass);
 
 #endif /* DATAENCODING_H */
@@ -21,10 +21,20 @@
  */
 
 #include "datamasking.h"
+#include "maskpool.h"
 #include "module.h"
+#include "penalty.h"
 #include <limits.h>
+#include <stdatomic.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
+#include <threads.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define DATAMASKING_X86
+#include <immintrin.h>
+#endif
 
 #define N1 3
 #define N2 3
@@ -71,30 +81,171 @@ static bool (*const maskPatternGenerationConditions[])(size_t, size_t) = {
     maskPatternGenerationCondition4, maskPatternGenerationCondition5,
     maskPatternGenerationCondition6, maskPatternGenerationCondition7};
 
+// word MODULE_MATRIX_ROW_WORDS * (y % 12) + i of maskPatternWords[p] is word i
+// of row y of pattern p, over all columns of a row, and the same word of
+// maskPatternColumnWords[p] is word i of column y
+static uint64_t maskPatternWords[8][NUM_MASK_PATTERN_WORDS];
+static uint64_t maskPatternColumnWords[8][NUM_MASK_PATTERN_WORDS];
+static once_flag maskPatternWordsFlag = ONCE_FLAG_INIT;
+
+static void initializeMaskPatternWords(void) {
+    for (size_t pattern = 0; pattern < 8; pattern++) {
+        bool (*condition)(size_t, size_t);
+        uint64_t *words = maskPatternWords[pattern];
+        uint64_t *columnWords = maskPatternColumnWords[pattern];
+        condition = maskPatternGenerationConditions[pattern];
+
+        for (size_t y = 0; y < MASK_PATTERN_PERIOD; y++) {
+            for (size_t x = 0; x < 64 * MODULE_MATRIX_ROW_WORDS; x++) {
+                words[MODULE_MATRIX_ROW_WORDS * y + x / 64] |=
+                    (uint64_t)condition(y, x) << (x % 64);
+                columnWords[MODULE_MATRIX_ROW_WORDS * y + x / 64] |=
+                    (uint64_t)condition(x, y) << (x % 64);
+            }
+        }
+    }
+}
+
+// the penalty baselines of versions 1 to 40, each initialized from the first
+// symbol of its version
+static PenaltyBaseline penaltyBaselines[40];
+static atomic_bool penaltyBaselinesReady[40];
+static mtx_t penaltyBaselinesMutex;
+static bool penaltyBaselinesMutexInitialized = false;
+static once_flag penaltyBaselinesFlag = ONCE_FLAG_INIT;
+
+static void initializePenaltyBaselinesMutex(void) {
+    penaltyBaselinesMutexInitialized =
+        mtx_init(&penaltyBaselinesMutex, mtx_plain) == thrd_success;
+}
+
+// returns the cached baseline of the version, or initializes the given one if
+// the cache cannot be locked
+static const PenaltyBaseline *getPenaltyBaseline(PenaltyBaseline *baseline,
+                                                 const ModuleMatrix *unmasked,
+                                                 size_t size) {
+    size_t index = (size - 21) / 4;
+
+    if (atomic_load_explicit(&penaltyBaselinesReady[index],
+                             memory_order_acquire)) {
+        return &penaltyBaselines[index];
+    }
+
+    call_once(&penaltyBaselinesFlag, initializePenaltyBaselinesMutex);
+
+    if (!penaltyBaselinesMutexInitialized) {
+        initializePenaltyBaseline(baseline, unmasked, size);
+        return baseline;
+    }
+
+    mtx_lock(&penaltyBaselinesMutex);
+
+    if (!atomic_load_explicit(&penaltyBaselinesReady[index],
+                              memory_order_relaxed)) {
+        initializePenaltyBaseline(&penaltyBaselines[index], unmasked, size);
+        atomic_store_explicit(&penaltyBaselinesReady[index], true,
+                              memory_order_release);
+    }
+
+    mtx_unlock(&penaltyBaselinesMutex);
+
+    return &penaltyBaselines[index];
+}
+
+static uint64_t getValidBits(size_t size, size_t i) {
+    if (size >= 64 * (i + 1)) {
+        return ~(uint64_t)0;
+    }
+
+    if (size <= 64 * i) {
+        return 0;
+    }
+
+    return ((uint64_t)1 << (size - 64 * i)) - 1;
+}
+
+static void cutMaskPatternWords(uint64_t *words, const uint64_t *patternWords,
+                                size_t size) {
+    for (size_t k = 0; k < NUM_MASK_PATTERN_WORDS; k++) {
+        words[k] = patternWords[k] &
+                   getValidBits(size, k % MODULE_MATRIX_ROW_WORDS);
+    }
+}
+
+// dst[k] = src[k] ^ (words[k % NUM_MASK_PATTERN_WORDS] & ~function[k]) over
+// the rows of a plane laid out one after another
+static void xorMaskPatternScalar(uint64_t *dst, const uint64_t *src,
+                                 const uint64_t *function,
+                                 const uint64_t *words, size_t length) {
+    for (size_t k = 0; k < length; k++) {
+        dst[k] = src[k] ^ (words[k % NUM_MASK_PATTERN_WORDS] & ~function[k]);
+    }
+}
+
+#ifdef DATAMASKING_X86
+// NUM_MASK_PATTERN_WORDS is a multiple of four, so every vector of four words
+// takes its mask from four consecutive pattern words
+__attribute__((target("avx2"))) static void
+xorMaskPatternAVX2(uint64_t *dst, const uint64_t *src, const uint64_t *function,
+                   const uint64_t *words, size_t length) {
+    size_t k = 0;
+
+    for (; k + 4 <= length; k += 4) {
+        __m256i mask = _mm256_loadu_si256(
+            (const __m256i *)(words + k % NUM_MASK_PATTERN_WORDS));
+        __m256i functionWords =
+            _mm256_loadu_si256((const __m256i *)(function + k));
+        __m256i srcWords = _mm256_loadu_si256((const __m256i *)(src + k));
+
+        _mm256_storeu_si256(
+            (__m256i *)(dst + k),
+            _mm256_xor_si256(srcWords,
+                             _mm256_andnot_si256(functionWords, mask)));
+    }
+
+    for (; k < length; k++) {
+        dst[k] = src[k] ^ (words[k % NUM_MASK_PATTERN_WORDS] & ~function[k]);
+    }
+}
+#endif
+
+static void xorMaskPattern(uint64_t *dst, const uint64_t *src,
+                           const uint64_t *function, const uint64_t *words,
+                           size_t length) {
+#ifdef DATAMASKING_X86
+    if (__builtin_cpu_supports("avx2")) {
+        xorMaskPatternAVX2(dst, src, function, words, length);
+        return;
+    }
+#endif
+
+    xorMaskPatternScalar(dst, src, function, words, length);
+}
+
 /**
- * Applies the data mask pattern to the unmasked matrix.
+ * Applies the data mask pattern to the unmasked matrix. The function patterns
+ * are copied as they are, and the function plane of the masked matrix is
+ * cleared.
+ *
+ * The pattern is taken from precomputed rows, which are cut to the size of the
+ * symbol and XORed into the dark plane outside the function patterns.
  *
  * @param masked The masked matrix
  * @param unmasked The unmasked matrix
  * @param size The size of the symbol in number of modules
  * @param dataMaskPattern The data mask pattern to apply
  */
-void applyDataMaskPattern(uint8_t *masked, const uint8_t *unmasked, size_t size,
-                          unsigned int dataMaskPattern) {
-    bool (*condition)(size_t, size_t);
-    condition = maskPatternGenerationConditions[dataMaskPattern];
-
-    for (size_t y = 0; y < size; y++) {
-        for (size_t x = 0; x < size; x++) {
-            uint8_t module = getModule(unmasked, size, y, x);
-
-            if (module & MODULE_FUNCTION) {
-                placeModule(masked, size, y, x, module ^ MODULE_FUNCTION);
-            } else {
-                placeModule(masked, size, y, x, module ^ condition(y, x));
-            }
-        }
-    }
+void applyDataMaskPattern(ModuleMatrix *masked, const ModuleMatrix *unmasked,
+                          size_t size, unsigned int dataMaskPattern) {
+    uint64_t words[NUM_MASK_PATTERN_WORDS];
+
+    call_once(&maskPatternWordsFlag, initializeMaskPatternWords);
+    cutMaskPatternWords(words, maskPatternWords[dataMaskPattern], size);
+
+    xorMaskPattern(masked->dark[0], unmasked->dark[0], unmasked->function[0],
+                   words, MODULE_MATRIX_ROW_WORDS * size);
+    memset(masked->function, 0, sizeof(masked->function[0]) * size);
+    memcpy(masked->blank, unmasked->blank, sizeof(masked->blank[0]) * size);
 }
 
 /**
@@ -226,31 +377,222 @@ unsigned int calculatePenaltyScoreCondition4(const uint8_t *masked,
            N4;
 }
 
-static unsigned int calculatePenaltyScore(const uint8_t *masked, size_t size) {
-    return calculatePenaltyScoreCondition1(masked, size) +
-           calculatePenaltyScoreCondition2(masked, size) +
-           calculatePenaltyScoreCondition3(masked, size) +
-           calculatePenaltyScoreCondition4(masked, size);
+// cuts the row and column lines of all eight patterns to the size of the symbol
+static void cutMaskPatterns(uint64_t (*rowPatterns)[NUM_MASK_PATTERN_WORDS],
+                            uint64_t (*columnPatterns)[NUM_MASK_PATTERN_WORDS],
+                            size_t size) {
+    call_once(&maskPatternWordsFlag, initializeMaskPatternWords);
+
+    for (unsigned int pattern = 0; pattern < 8; pattern++) {
+        cutMaskPatternWords(rowPatterns[pattern], maskPatternWords[pattern],
+                            size);
+        cutMaskPatternWords(columnPatterns[pattern],
+                            maskPatternColumnWords[pattern], size);
+    }
+}
+
+// scores all eight patterns, on the mask pool for symbols of at least
+// MIN_PARALLEL_MASK_SIZE modules if more than one thread is given
+static unsigned int selectDataMaskPattern(const ModuleMatrix *unmasked,
+                                          size_t size,
+                                          unsigned int numThreads) {
+    uint64_t rowPatterns[8][NUM_MASK_PATTERN_WORDS];
+    uint64_t columnPatterns[8][NUM_MASK_PATTERN_WORDS];
+    unsigned int penaltyScores[8];
+    unsigned int dataMaskPattern = 0;
+    PenaltyBaseline baseline;
+    const PenaltyBaseline *cachedBaseline;
+
+    cutMaskPatterns(rowPatterns, columnPatterns, size);
+    cachedBaseline = getPenaltyBaseline(&baseline, unmasked, size);
+
+    if (numThreads > 1 && size >= MIN_PARALLEL_MASK_SIZE &&
+        startMaskPool(numThreads - 1)) {
+        calculatePackedPenaltyScoresInParallel(penaltyScores, unmasked,
+                                               cachedBaseline, rowPatterns,
+                                               columnPatterns, 8, size,
+                                               numThreads - 1);
+    } else {
+        calculatePackedPenaltyScores(penaltyScores, unmasked, cachedBaseline,
+                                     rowPatterns, columnPatterns, 8, size);
+    }
+
+    for (unsigned int pattern = 1; pattern < 8; pattern++) {
+        if (penaltyScores[dataMaskPattern] > penaltyScores[pattern]) {
+            dataMaskPattern = pattern;
+        }
+    }
+
+    return dataMaskPattern;
 }
 
 /**
  * Applies the data mask pattern to the unmasked matrix and returns the
- * pattern with the lowest penalty score.
+ * pattern with the lowest penalty score. All eight patterns are scored in one
+ * pass over the unmasked matrix, and only the chosen one is applied. The
+ * function patterns are scored once per version.
+ *
+ * @param masked The masked matrix
+ * @param unmasked The unmasked matrix
+ * @param size The size of the symbol in number of modules
+ * @return The data mask pattern with the lowest penalty score
+ */
+unsigned int
+applyDataMaskPatternLowestPenaltyScore(ModuleMatrix *masked,
+                                       const ModuleMatrix *unmasked,
+                                       size_t size) {
+    unsigned int dataMaskPattern = selectDataMaskPattern(unmasked, size, 1);
+
+    applyDataMaskPattern(masked, unmasked, size, dataMaskPattern);
+
+    return dataMaskPattern;
+}
+
+/**
+ * Applies the data mask pattern with the lowest penalty score like
+ * applyDataMaskPatternLowestPenaltyScore, but scores the patterns of symbols
+ * of at least MIN_PARALLEL_MASK_SIZE modules on up to numThreads threads: the
+ * calling thread and the persistent workers of the mask pool. Smaller symbols
+ * are scored on the calling thread, as handing them over costs more than it
+ * saves. The selected pattern is the same, ties going to the lowest pattern.
  *
  * @param masked The masked matrix
  * @param unmasked The unmasked matrix
  * @param size The size of the symbol in number of modules
+ * @param numThreads The number of threads, 1 to 8
  * @return The data mask pattern with the lowest penalty score
  */
-unsigned int applyDataMaskPatternLowestPenaltyScore(uint8_t *masked,
-                                                    const uint8_t *unmasked,
-                                                    size_t size) {
-    unsigned int lowestPenaltyScore = UINT_MAX;
-    unsigned int dataMaskPattern;
+unsigned int applyDataMaskPatternLowestPenaltyScoreInParallel(
+    ModuleMatrix *masked, const ModuleMatrix *unmasked, size_t size,
+    unsigned int numThreads) {
+    unsigned int dataMaskPattern =
+        selectDataMaskPattern(unmasked, size, numThreads);
+
+    applyDataMaskPattern(masked, unmasked, size, dataMaskPattern);
+
+    return dataMaskPattern;
+}
+
+/**
+ * Applies the data mask pattern with the lowest estimated penalty score. For
+ * symbols of at least MIN_ESTIMATED_MASK_SIZE modules, the patterns are ranked
+ * from every MASK_SAMPLING_STEP-th row and column only, which may select a
+ * pattern whose penalty score is not the lowest; the symbol stays valid, as the
+ * format information records whichever pattern is applied. Smaller symbols are
+ * scored exactly.
+ *
+ * @param masked The masked matrix
+ * @param unmasked The unmasked matrix
+ * @param size The size of the symbol in number of modules
+ * @return The applied data mask pattern
+ */
+unsigned int
+applyDataMaskPatternEstimatedLowestPenaltyScore(ModuleMatrix *masked,
+                                                const ModuleMatrix *unmasked,
+                                                size_t size) {
+    uint64_t rowPatterns[8][NUM_MASK_PATTERN_WORDS];
+    uint64_t columnPatterns[8][NUM_MASK_PATTERN_WORDS];
+    unsigned int estimates[8];
+    unsigned int dataMaskPattern = 0;
+
+    if (size < MIN_ESTIMATED_MASK_SIZE) {
+        return applyDataMaskPatternLowestPenaltyScore(masked, unmasked, size);
+    }
+
+    cutMaskPatterns(rowPatterns, columnPatterns, size);
+    estimatePackedPenaltyScores(estimates, unmasked, rowPatterns,
+                                columnPatterns, 8, size, MASK_SAMPLING_STEP);
+
+    for (unsigned int pattern = 1; pattern < 8; pattern++) {
+        if (estimates[dataMaskPattern] > estimates[pattern]) {
+            dataMaskPattern = pattern;
+        }
+    }
+
+    applyDataMaskPattern(masked, unmasked, size, dataMaskPattern);
+
+    return dataMaskPattern;
+}
+
+/**
+ * Masks the unmasked matrix with all eight data mask patterns and scores each
+ * of them, so that the lowest penalty score can be followed while modules of
+ * the unmasked matrix change.
+ *
+ * @param selection The selection
+ * @param unmasked The unmasked matrix
+ * @param size The size of the symbol in number of modules
+ */
+void initializeMaskSelection(MaskSelection *selection,
+                             const ModuleMatrix *unmasked, size_t size) {
+    selection->size = size;
+
+    for (unsigned int pattern = 0; pattern < 8; pattern++) {
+        applyDataMaskPattern(&selection->masked[pattern], unmasked, size,
+                             pattern);
+        initializePenaltyState(&selection->states[pattern],
+                               &selection->masked[pattern], size);
+    }
+}
+
+/**
+ * Masks the changed modules of the unmasked matrix again with all eight data
+ * mask patterns and updates their penalty scores. Only the rows, columns and
+ * 2 x 2 blocks through the changed modules are scored.
+ *
+ * @param selection The selection
+ * @param unmasked The unmasked matrix, with the changes applied
+ * @param changes The changed modules, as listed by listChangedModules
+ * @param numChanges The number of changed modules
+ */
+void updateMaskSelection(MaskSelection *selection,
+                         const ModuleMatrix *unmasked,
+                         const ModulePosition *changes, size_t numChanges) {
+    call_once(&maskPatternWordsFlag, initializeMaskPatternWords);
 
     for (unsigned int pattern = 0; pattern < 8; pattern++) {
-        applyDataMaskPattern(masked, unmasked, size, pattern);
-        unsigned int penaltyScore = calculatePenaltyScore(masked, size);
+        ModuleMatrix *masked = &selection->masked[pattern];
+
+        for (size_t j = 0; j < numChanges; j++) {
+            size_t y = changes[j].y;
+            size_t x = changes[j].x;
+            const uint64_t *words =
+                maskPatternWords[pattern] +
+                MODULE_MATRIX_ROW_WORDS * (y % MASK_PATTERN_PERIOD);
+            unsigned int bit = (unsigned int)(words[x / 64] >> (x % 64)) & 1;
+
+            if (getMatrixBit(unmasked->function, y, x)) {
+                bit = 0;
+            }
+
+            setMatrixBit(masked->dark, y, x,
+                         getMatrixBit(unmasked->dark, y, x) ^ bit);
+            setMatrixBit(masked->blank, y, x,
+                         getMatrixBit(unmasked->blank, y, x));
+        }
+
+        updatePenaltyState(&selection->states[pattern], masked, changes,
+                           numChanges);
+    }
+}
+
+/**
+ * Returns the data mask pattern with the lowest penalty score, ties going to
+ * the lowest pattern, and its masked matrix.
+ *
+ * @param selection The selection
+ * @param masked The masked matrix of the pattern; NULL if not needed
+ * @return The data mask pattern with the lowest penalty score
+ */
+unsigned int getMaskSelectionPattern(const MaskSelection *selection,
+                                     const ModuleMatrix **masked) {
+    unsigned int dataMaskPattern = 0;
+    unsigned int lowestPenaltyScore =
+        getPenaltyStateScore(&selection->states[0]);
+
+    for (unsigned int pattern = 1; pattern < 8; pattern++) {
+        unsigned int penaltyScore =
+            getPenaltyStateScore(&selection->states[pattern]);
 
         if (lowestPenaltyScore > penaltyScore) {
             lowestPenaltyScore = penaltyScore;
@@ -258,7 +600,9 @@ unsigned int applyDataMaskPatternLowestPenaltyScore(uint8_t *masked,
         }
     }
 
-    applyDataMaskPattern(masked, unmasked, size, dataMaskPattern);
+    if (masked != NULL) {
+        *masked = &selection->masked[dataMaskPattern];
+    }
 
     return dataMaskPattern;
 }
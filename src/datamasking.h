@@ -23,11 +23,29 @@
 #ifndef DATAMASKING_H
 #define DATAMASKING_H
 
+#include "module.h"
+#include "penalty.h"
 #include <stddef.h>
 #include <stdint.h>
 
-extern void applyDataMaskPattern(uint8_t *masked, const uint8_t *unmasked,
-                                 size_t size, unsigned int dataMaskPattern);
+// version 25; below it the eight patterns are always scored on one thread
+#define MIN_PARALLEL_MASK_SIZE 117
+
+// version 21; from it on the estimated selection samples every fifth line
+#define MIN_ESTIMATED_MASK_SIZE 101
+#define MASK_SAMPLING_STEP 5
+
+// the unmasked matrix masked with all eight patterns and their penalty scores,
+// kept up to date as modules change
+typedef struct MaskSelection {
+    size_t size;
+    ModuleMatrix masked[8];
+    PenaltyState states[8];
+} MaskSelection;
+
+extern void applyDataMaskPattern(ModuleMatrix *masked,
+                                 const ModuleMatrix *unmasked, size_t size,
+                                 unsigned int dataMaskPattern);
 extern unsigned int calculatePenaltyScoreCondition1(const uint8_t *masked,
                                                     size_t size);
 extern unsigned int calculatePenaltyScoreCondition2(const uint8_t *masked,
@@ -37,7 +55,23 @@ extern unsigned int calculatePenaltyScoreCondition3(const uint8_t *masked,
 extern unsigned int calculatePenaltyScoreCondition4(const uint8_t *masked,
                                                     size_t size);
 extern unsigned int
-applyDataMaskPatternLowestPenaltyScore(uint8_t *masked, const uint8_t *unmasked,
+applyDataMaskPatternLowestPenaltyScore(ModuleMatrix *masked,
+                                       const ModuleMatrix *unmasked,
                                        size_t size);
+extern unsigned int applyDataMaskPatternLowestPenaltyScoreInParallel(
+    ModuleMatrix *masked, const ModuleMatrix *unmasked, size_t size,
+    unsigned int numThreads);
+extern unsigned int
+applyDataMaskPatternEstimatedLowestPenaltyScore(ModuleMatrix *masked,
+                                                const ModuleMatrix *unmasked,
+                                                size_t size);
+extern void initializeMaskSelection(MaskSelection *selection,
+                                    const ModuleMatrix *unmasked, size_t size);
+extern void updateMaskSelection(MaskSelection *selection,
+                                const ModuleMatrix *unmasked,
+                                const ModulePosition *changes,
+                                size_t numChanges);
+extern unsigned int getMaskSelectionPattern(const MaskSelection *selection,
+                                            const ModuleMatrix **masked);
 
 #endif /* DATAMASKING_H */
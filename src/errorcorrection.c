@@ -22,6 +22,164 @@
 
 #include "errorcorrection.h"
 #include "gf256.h"
+#include <string.h>
+
+// the largest number of data codewords in an RS block
+#define MAX_NUM_DATA_CODEWORDS_PER_BLOCK 123
+
+// the number of parity bytes updated at once, a multiple of the SIMD width
+#define MAX_REGISTER_WIDTH 32
+
+// the largest number of RS blocks in a symbol, 81, padded to the SIMD width
+#define MAX_NUM_LANES 96
+
+// the number of RS blocks from which encoding in lockstep is faster
+#define MIN_NUM_BLOCKS_IN_LOCKSTEP 6
+
+/**
+ * Compute the remainder of one block with a linear feedback shift register.
+ * The register is kept in ecCodewords, so the highest term is always at index
+ * zero and each message byte needs one table row and no modulo.
+ *
+ * @param ecCodewords The error correction codewords
+ * @param dataCodewords The data codewords of the block
+ * @param numDataCodewords The number of data codewords of the block
+ * @param products The multiplication table of the generator polynomial
+ * @param numECCodewords The number of error correction codewords
+ */
+static void encodeBlockWithTable(uint8_t *ecCodewords,
+                                 const uint8_t *dataCodewords,
+                                 size_t numDataCodewords,
+                                 const uint8_t *products,
+                                 size_t numECCodewords) {
+    for (size_t j = 0; j < numECCodewords; j++) {
+        ecCodewords[j] = 0;
+    }
+
+    for (size_t i = 0; i < numDataCodewords; i++) {
+        const uint8_t *row =
+            products + (dataCodewords[i] ^ ecCodewords[0]) * numECCodewords;
+
+        for (size_t j = 0; j < numECCodewords - 1; j++) {
+            ecCodewords[j] = ecCodewords[j + 1] ^ row[j];
+        }
+
+        ecCodewords[numECCodewords - 1] = row[numECCodewords - 1];
+    }
+}
+
+/**
+ * Compute the remainder of one block with the SIMD multiply-accumulate kernel.
+ * Instead of shifting the parity register by one byte per data codeword, the
+ * register slides along a buffer, and the whole register is updated at once.
+ *
+ * @param ecCodewords The error correction codewords
+ * @param dataCodewords The data codewords of the block
+ * @param numDataCodewords The number of data codewords of the block
+ * @param generatorPolynomial The coefficients of the generator polynomial from
+ * the highest term, padded with zeros to registerWidth
+ * @param registerWidth The number of parity bytes to update at once
+ * @param numECCodewords The number of error correction codewords
+ */
+static void encodeBlockWithKernel(uint8_t *ecCodewords,
+                                  const uint8_t *dataCodewords,
+                                  size_t numDataCodewords,
+                                  const uint8_t *generatorPolynomial,
+                                  size_t registerWidth, size_t numECCodewords) {
+    uint8_t buffer[MAX_NUM_DATA_CODEWORDS_PER_BLOCK + MAX_REGISTER_WIDTH + 1];
+
+    memset(buffer, 0, numDataCodewords + registerWidth + 1);
+
+    for (size_t i = 0; i < numDataCodewords; i++) {
+        uint8_t factor = dataCodewords[i] ^ buffer[i];
+
+        if (factor) {
+            gf256_multiplyAccumulate(buffer + i + 1, generatorPolynomial,
+                                     factor, registerWidth);
+        }
+    }
+
+    memcpy(ecCodewords, buffer + numDataCodewords, numECCodewords);
+}
+
+/**
+ * Compute the remainder of one block. The scalar kernel is slower than a
+ * table lookup per register stage, so the table is used without SIMD.
+ *
+ * @param ecCodewords The error correction codewords
+ * @param dataCodewords The data codewords of the block
+ * @param numDataCodewords The number of data codewords of the block
+ * @param products The multiplication table of the generator polynomial
+ * @param generatorPolynomial The padded generator polynomial, or NULL to use
+ * the multiplication table
+ * @param numECCodewords The number of error correction codewords
+ */
+static void encodeBlock(uint8_t *ecCodewords, const uint8_t *dataCodewords,
+                        size_t numDataCodewords, const uint8_t *products,
+                        const uint8_t *generatorPolynomial,
+                        size_t numECCodewords) {
+    if (generatorPolynomial) {
+        encodeBlockWithKernel(ecCodewords, dataCodewords, numDataCodewords,
+                              generatorPolynomial,
+                              numECCodewords <= 16 ? 16 : MAX_REGISTER_WIDTH,
+                              numECCodewords);
+    } else {
+        encodeBlockWithTable(ecCodewords, dataCodewords, numDataCodewords,
+                             products, numECCodewords);
+    }
+}
+
+/**
+ * Encode the error correction codewords of all blocks in lockstep. The data
+ * codewords are transposed so that each row holds one codeword of every block,
+ * and the long division runs on whole rows, so the multiply-accumulate kernel
+ * processes one block per lane. Group 1 blocks are one codeword shorter and are
+ * padded with a leading zero, which does not change the remainder.
+ *
+ * @param ecCodewords The error correction codewords
+ * @param dataCodewords The data codewords
+ * @param block The RS block
+ */
+void encodeErrorCorrectionCodewordsInLockstep(uint8_t *ecCodewords,
+                                              const uint8_t *dataCodewords,
+                                              RSBlock block) {
+    uint8_t rows[MAX_NUM_DATA_CODEWORDS_PER_BLOCK + MAX_REGISTER_WIDTH]
+                [MAX_NUM_LANES];
+    size_t numBlocks = block.numBlocks1 + block.numBlocks2;
+    size_t numLanes = (numBlocks + 15) & ~(size_t)15;
+    size_t numSteps = block.numBlocks2 ? block.numDataCodewords2
+                                       : block.numDataCodewords1;
+    const uint8_t *generatorPolynomial =
+        gf256_getMultiplicationTable(block.numECCodewords) +
+        block.numECCodewords;
+
+    memset(rows, 0, sizeof(rows[0]) * (numSteps + block.numECCodewords));
+
+    for (size_t b = 0; b < numBlocks; b++) {
+        size_t numDataCodewords =
+            b < block.numBlocks1 ? block.numDataCodewords1
+                                 : block.numDataCodewords2;
+        size_t offset = numSteps - numDataCodewords;
+
+        for (size_t i = 0; i < numDataCodewords; i++) {
+            rows[offset + i][b] = dataCodewords[i];
+        }
+
+        dataCodewords += numDataCodewords;
+    }
+
+    for (size_t i = 0; i < numSteps; i++) {
+        gf256_multiplyAccumulateRows(rows[i + 1], MAX_NUM_LANES, rows[i],
+                                     generatorPolynomial, block.numECCodewords,
+                                     numLanes);
+    }
+
+    for (size_t b = 0; b < numBlocks; b++) {
+        for (size_t j = 0; j < block.numECCodewords; j++) {
+            ecCodewords[b * block.numECCodewords + j] = rows[numSteps + j][b];
+        }
+    }
+}
 
 /**
  * Encode the error correction codewords.
@@ -33,25 +191,39 @@
 void encodeErrorCorrectionCodewords(uint8_t *ecCodewords,
                                     const uint8_t *dataCodewords,
                                     RSBlock block) {
-    uint8_t generatorPolynomial[68] = {0};
+    if (gf256_getKernel() != GF256_KERNEL_SCALAR &&
+        block.numBlocks1 + block.numBlocks2 >= MIN_NUM_BLOCKS_IN_LOCKSTEP) {
+        encodeErrorCorrectionCodewordsInLockstep(ecCodewords, dataCodewords,
+                                                 block);
+        return;
+    }
 
-    gf256_initialize();
-    gf256_initializeGeneratorPolynomial(generatorPolynomial,
-                                        block.numECCodewords);
+    const uint8_t *products =
+        gf256_getMultiplicationTable(block.numECCodewords);
+    uint8_t paddedGeneratorPolynomial[MAX_REGISTER_WIDTH] = {0};
+    const uint8_t *generatorPolynomial = NULL;
+
+    if (gf256_getKernel() != GF256_KERNEL_SCALAR) {
+
+        // row 1 of the multiplication table holds the coefficients themselves
+        memcpy(paddedGeneratorPolynomial, products + block.numECCodewords,
+               block.numECCodewords);
+        generatorPolynomial = paddedGeneratorPolynomial;
+    }
 
     for (size_t i = 0; i < block.numBlocks1; i++) {
-        gf256_divideByGeneratorPolynomial(
-            ecCodewords + i * block.numECCodewords,
-            dataCodewords + i * block.numDataCodewords1,
-            block.numDataCodewords1, generatorPolynomial, block.numECCodewords);
+        encodeBlock(ecCodewords + i * block.numECCodewords,
+                    dataCodewords + i * block.numDataCodewords1,
+                    block.numDataCodewords1, products, generatorPolynomial,
+                    block.numECCodewords);
     }
 
     for (size_t i = 0; i < block.numBlocks2; i++) {
-        gf256_divideByGeneratorPolynomial(
-            ecCodewords + i * block.numECCodewords +
-                block.numBlocks1 * block.numECCodewords,
-            dataCodewords + i * block.numDataCodewords2 +
-                block.numBlocks1 * block.numDataCodewords1,
-            block.numDataCodewords2, generatorPolynomial, block.numECCodewords);
+        encodeBlock(ecCodewords + i * block.numECCodewords +
+                        block.numBlocks1 * block.numECCodewords,
+                    dataCodewords + i * block.numDataCodewords2 +
+                        block.numBlocks1 * block.numDataCodewords1,
+                    block.numDataCodewords2, products, generatorPolynomial,
+                    block.numECCodewords);
     }
 }
@@ -29,5 +29,7 @@
 extern void encodeErrorCorrectionCodewords(uint8_t *ecCodewords,
                                            const uint8_t *dataCodewords,
                                            RSBlock rsBlock);
+extern void encodeErrorCorrectionCodewordsInLockstep(
+    uint8_t *ecCodewords, const uint8_t *dataCodewords, RSBlock rsBlock);
 
 #endif /* ERRORCORRECTION_H */
@@ -22,38 +22,22 @@
 
 #include "formatandversion.h"
 #include "module.h"
-
-static uint16_t calculateBCHBits(size_t numTotalBits, size_t numDataBits,
-                                 uint8_t dataBits, uint16_t generatorPoly) {
-    uint32_t bchBits = dataBits << (numTotalBits - numDataBits);
-
-    for (size_t i = 0; i < numDataBits; i++) {
-        if (bchBits & (1 << (numTotalBits - 1 - i))) {
-            bchBits ^= generatorPoly << (numDataBits - 1 - i);
-        }
-    }
-
-    return bchBits;
-}
+#include "tables.h"
 
 /**
- * Place format information in the QR code matrix.
+ * Place format information in the QR code matrix. The BCH coded and masked
+ * bits are taken from the generated table.
  *
  * @param matrix The QR code matrix
  * @param size The size of the symbol in number of modules
  * @param ecLevel The error correction level
  * @param dataMaskPattern The data mask pattern
  */
-void placeFormatInformation(uint8_t *matrix, size_t size,
+void placeFormatInformation(ModuleMatrix *matrix, size_t size,
                             ErrorCorrectionLevel ecLevel,
                             unsigned int dataMaskPattern) {
-    uint8_t ecLevelBits = 5 - ecLevel & 3;
-    uint8_t dataMaskPatternBits = dataMaskPattern & 7;
-
-    uint8_t dataBits = (ecLevelBits << 3) | dataMaskPatternBits;
-    uint16_t bchBits = calculateBCHBits(15, 5, dataBits, 0x537);
-    uint16_t formatInformation = (dataBits << 10) | bchBits;
-    formatInformation ^= 0x5412;
+    uint16_t formatInformation =
+        formatInformationWords[ecLevel][dataMaskPattern & 7];
 
     size_t y = 0;
     size_t x = size - 1;
@@ -70,8 +54,11 @@ void placeFormatInformation(uint8_t *matrix, size_t size,
 
         uint8_t module = (formatInformation >> i) & 1;
 
-        placeModule(matrix, size, y++, 8, module);
-        placeModule(matrix, size, 8, x--, module);
+        placeMatrixModule(matrix, y, 8, module);
+        placeMatrixModule(matrix, 8, x, module);
+
+        y++;
+        x--;
     }
 }
 
@@ -82,22 +69,20 @@ void placeFormatInformation(uint8_t *matrix, size_t size,
  * @param size The size of the symbol in number of modules
  * @param version The version number
  */
-void placeVersionInformation(uint8_t *matrix, size_t size,
+void placeVersionInformation(ModuleMatrix *matrix, size_t size,
                              unsigned int version) {
     if (version < 7) {
         return;
     }
 
-    uint8_t dataBits = version & 63;
-    uint16_t bchBits = calculateBCHBits(18, 6, dataBits, 0x1F25);
-    uint32_t versionInformation = (dataBits << 12) | bchBits;
+    uint32_t versionInformation = versionInformationWords[version];
 
     for (size_t i = 0; i < 6; i++) {
         for (size_t j = 0; j < 3; j++) {
             uint8_t module = (versionInformation >> (3 * i + j)) & 1;
 
-            placeModule(matrix, size, i, size - 11 + j, module);
-            placeModule(matrix, size, size - 11 + j, i, module);
+            placeMatrixModule(matrix, i, size - 11 + j, module);
+            placeMatrixModule(matrix, size - 11 + j, i, module);
         }
     }
 }
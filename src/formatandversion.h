@@ -23,14 +23,15 @@
 #ifndef FORMATANDVERSION_H
 #define FORMATANDVERSION_H
 
+#include "module.h"
 #include "typedefs.h"
 #include <stddef.h>
 #include <stdint.h>
 
-extern void placeFormatInformation(uint8_t *matrix, size_t size,
+extern void placeFormatInformation(ModuleMatrix *matrix, size_t size,
                                    ErrorCorrectionLevel ecLevel,
                                    unsigned int dataMaskPattern);
-extern void placeVersionInformation(uint8_t *matrix, size_t size,
+extern void placeVersionInformation(ModuleMatrix *matrix, size_t size,
                                     unsigned int version);
 
 #endif /* FORMATANDVERSION_H */
@@ -21,31 +21,272 @@
  */
 
 #include "gf256.h"
+#include "tables.h"
+#include <stdatomic.h>
 #include <string.h>
+#include <threads.h>
 
-// used to compute the powers of the primitive element 2 under GF(2^8)
-static uint8_t expTable[256];
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define GF256_X86
+#include <immintrin.h>
+#endif
 
-// used to compute the primitive element 2 under GF(2^8)
-static uint8_t logTable[256];
+// the GF(2^8) tables and generator polynomials are generated, see tables.h
+
+static atomic_int currentKernel;
+
+static once_flag kernelFlag = ONCE_FLAG_INIT;
+
+/**
+ * Multiply two elements of GF(2^8).
+ *
+ * @param a The multiplicand
+ * @param b The multiplier
+ * @return The product
+ */
+uint8_t gf256_multiply(uint8_t a, uint8_t b) {
+    if (a == 0 || b == 0) {
+        return 0;
+    }
+
+    return gf256ExpTable[(gf256LogTable[a] + gf256LogTable[b]) % 255];
+}
+
+/**
+ * Get the generator polynomial for Reed-Solomon encoding. The polynomials for
+ * all numbers of error correction codewords in the RS block table are
+ * generated at build time and can be shared between threads.
+ *
+ * @param degree The degree of the generator polynomial
+ * @return The generator polynomial stored in reverse order, or NULL if no RS
+ * block uses the degree
+ */
+const uint8_t *gf256_getGeneratorPolynomial(size_t degree) {
+    if (degree > 30 || gf256GeneratorPolynomialOffsets[degree] < 0) {
+        return NULL;
+    }
+
+    return gf256GeneratorPolynomials + gf256GeneratorPolynomialOffsets[degree];
+}
+
+static GF256Kernel getSupportedKernel(void) {
+#ifdef GF256_X86
+    if (__builtin_cpu_supports("avx2")) {
+        return GF256_KERNEL_AVX2;
+    }
+
+    if (__builtin_cpu_supports("ssse3")) {
+        return GF256_KERNEL_SSSE3;
+    }
+#endif
+
+    return GF256_KERNEL_SCALAR;
+}
+
+static void initializeKernel(void) {
+    atomic_store_explicit(&currentKernel, getSupportedKernel(),
+                          memory_order_relaxed);
+}
+
+/**
+ * Get the multiplication table of the generator polynomial for Reed-Solomon
+ * encoding. The table has 256 rows of degree bytes each, and row f holds the
+ * products of f and the coefficients of the generator polynomial, excluding the
+ * leading one, from the highest term to the constant term. The tables are
+ * generated at build time.
+ *
+ * @param degree The degree of the generator polynomial
+ * @return The multiplication table, or NULL if no RS block uses the degree
+ */
+const uint8_t *gf256_getMultiplicationTable(size_t degree) {
+    if (degree > 30 || gf256GeneratorPolynomialOffsets[degree] < 0) {
+        return NULL;
+    }
+
+    return gf256MultiplicationTables +
+           256 * gf256GeneratorPolynomialOffsets[degree];
+}
+
+/**
+ * Get the kernel used by gf256_multiplyAccumulate().
+ *
+ * @return The kernel
+ */
+GF256Kernel gf256_getKernel(void) {
+    call_once(&kernelFlag, initializeKernel);
+
+    return atomic_load_explicit(&currentKernel, memory_order_relaxed);
+}
 
 /**
- * Initialize the logarithm and exponential tables for GF(2^8).
+ * Select the kernel used by gf256_multiplyAccumulate(). A kernel that the CPU
+ * does not support is replaced by the best one that it does. All kernels give
+ * identical results, so this only matters for testing and benchmarking.
+ *
+ * @param kernel The kernel
+ * @return The kernel actually selected
  */
-void gf256_initialize(void) {
-    unsigned int x = 1;
+GF256Kernel gf256_selectKernel(GF256Kernel kernel) {
+    GF256Kernel supportedKernel = getSupportedKernel();
 
-    for (size_t i = 0; i < 255; i++) {
-        expTable[i] = x;
-        logTable[x] = i;
-        x <<= 1;
+    call_once(&kernelFlag, initializeKernel);
 
-        if (x & 0x100) {
-            x ^= 0x11D;
+    if (kernel > supportedKernel) {
+        kernel = supportedKernel;
+    }
+
+    atomic_store_explicit(&currentKernel, kernel, memory_order_relaxed);
+
+    return kernel;
+}
+
+static void multiplyAccumulateScalar(uint8_t *dst, size_t stride,
+                                     const uint8_t *src,
+                                     const uint8_t *constants, size_t numRows,
+                                     size_t length) {
+    for (size_t j = 0; j < numRows; j++) {
+        const uint8_t *table = gf256NibbleTables[constants[j]];
+        uint8_t *row = dst + j * stride;
+
+        for (size_t i = 0; i < length; i++) {
+            row[i] ^= table[src[i] & 0x0F] ^ table[16 + (src[i] >> 4)];
+        }
+    }
+}
+
+#ifdef GF256_X86
+__attribute__((target("ssse3"))) static void
+multiplyAccumulateSSSE3(uint8_t *dst, size_t stride, const uint8_t *src,
+                        const uint8_t *constants, size_t numRows,
+                        size_t length) {
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    size_t i = 0;
+
+    // split 16 bytes into nibbles once and look up the products for every row
+    for (; i + 16 <= length; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i lowNibbles = _mm_and_si128(x, mask);
+        __m128i highNibbles = _mm_and_si128(_mm_srli_epi64(x, 4), mask);
+
+        for (size_t j = 0; j < numRows; j++) {
+            const uint8_t *table = gf256NibbleTables[constants[j]];
+            __m128i *row = (__m128i *)(dst + j * stride + i);
+            __m128i product = _mm_xor_si128(
+                _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)table),
+                                 lowNibbles),
+                _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(table + 16)),
+                                 highNibbles));
+
+            _mm_storeu_si128(row, _mm_xor_si128(_mm_loadu_si128(row), product));
+        }
+    }
+
+    multiplyAccumulateScalar(dst + i, stride, src + i, constants, numRows,
+                             length - i);
+}
+
+__attribute__((target("avx2"))) static void
+multiplyAccumulateAVX2(uint8_t *dst, size_t stride, const uint8_t *src,
+                       const uint8_t *constants, size_t numRows,
+                       size_t length) {
+    const __m256i mask = _mm256_set1_epi8(0x0F);
+    size_t i = 0;
+
+    for (; i + 32 <= length; i += 32) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(src + i));
+        __m256i lowNibbles = _mm256_and_si256(x, mask);
+        __m256i highNibbles = _mm256_and_si256(_mm256_srli_epi64(x, 4), mask);
+
+        for (size_t j = 0; j < numRows; j++) {
+            const uint8_t *table = gf256NibbleTables[constants[j]];
+            __m256i *row = (__m256i *)(dst + j * stride + i);
+            __m256i product = _mm256_xor_si256(
+                _mm256_shuffle_epi8(
+                    _mm256_broadcastsi128_si256(
+                        _mm_loadu_si128((const __m128i *)table)),
+                    lowNibbles),
+                _mm256_shuffle_epi8(
+                    _mm256_broadcastsi128_si256(
+                        _mm_loadu_si128((const __m128i *)(table + 16))),
+                    highNibbles));
+
+            _mm256_storeu_si256(
+                row, _mm256_xor_si256(_mm256_loadu_si256(row), product));
+        }
+    }
+
+    // stay in VEX encoding for the rest, as mixing in the SSSE3 kernel while
+    // the upper halves are dirty costs more than the whole update
+    for (; i + 16 <= length; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i lowNibbles = _mm_and_si128(x, _mm256_castsi256_si128(mask));
+        __m128i highNibbles = _mm_and_si128(_mm_srli_epi64(x, 4),
+                                            _mm256_castsi256_si128(mask));
+
+        for (size_t j = 0; j < numRows; j++) {
+            const uint8_t *table = gf256NibbleTables[constants[j]];
+            __m128i *row = (__m128i *)(dst + j * stride + i);
+            __m128i product = _mm_xor_si128(
+                _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)table),
+                                 lowNibbles),
+                _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(table + 16)),
+                                 highNibbles));
+
+            _mm_storeu_si128(row, _mm_xor_si128(_mm_loadu_si128(row), product));
         }
     }
 
-    expTable[255] = 1;
+    _mm256_zeroupper();
+
+    multiplyAccumulateScalar(dst + i, stride, src + i, constants, numRows,
+                             length - i);
+}
+#endif
+
+/**
+ * Multiply a vector by a constant and add the products to another vector,
+ * i.e. dst[i] ^= c * src[i] for i from 0 to length - 1.
+ *
+ * @param dst The vector to accumulate into
+ * @param src The vector to multiply
+ * @param c The constant
+ * @param length The length of the vectors
+ */
+void gf256_multiplyAccumulate(uint8_t *dst, const uint8_t *src, uint8_t c,
+                              size_t length) {
+    gf256_multiplyAccumulateRows(dst, 0, src, &c, 1, length);
+}
+
+/**
+ * Multiply a vector by several constants and add the products to the rows of
+ * a matrix, i.e. dst[j * stride + i] ^= constants[j] * src[i]. The vector is
+ * split into nibbles once for all rows.
+ *
+ * @param dst The matrix to accumulate into
+ * @param stride The distance between the rows of the matrix
+ * @param src The vector to multiply, which must not overlap the matrix
+ * @param constants The constants, one per row
+ * @param numRows The number of rows
+ * @param length The length of the vector
+ */
+void gf256_multiplyAccumulateRows(uint8_t *dst, size_t stride,
+                                  const uint8_t *src, const uint8_t *constants,
+                                  size_t numRows, size_t length) {
+    switch (gf256_getKernel()) {
+#ifdef GF256_X86
+    case GF256_KERNEL_AVX2:
+        multiplyAccumulateAVX2(dst, stride, src, constants, numRows, length);
+        break;
+
+    case GF256_KERNEL_SSSE3:
+        multiplyAccumulateSSSE3(dst, stride, src, constants, numRows, length);
+        break;
+#endif
+
+    default:
+        multiplyAccumulateScalar(dst, stride, src, constants, numRows, length);
+        break;
+    }
 }
 
 /**
@@ -65,8 +306,9 @@ void gf256_initializeGeneratorPolynomial(uint8_t *polynomial, size_t degree) {
     // = x^3 +        a^198x^2 +        a^199x + a^3
     for (size_t i = 1; i < degree; i++) {
         for (size_t j = i; j > 0; j--) {
-            polynomial[j] = logTable[expTable[polynomial[j - 1]] ^
-                                     expTable[(polynomial[j] + i) % 255]];
+            polynomial[j] =
+                gf256LogTable[gf256ExpTable[polynomial[j - 1]] ^
+                              gf256ExpTable[(polynomial[j] + i) % 255]];
         }
 
         polynomial[0] = (polynomial[0] + i) % 255;
@@ -101,12 +343,11 @@ void gf256_divideByGeneratorPolynomial(uint8_t *remainder,
         if (buffer[i]) {
 
             // most significant digit of dividend in alpha notation
-            uint8_t factor = logTable[buffer[i]];
+            uint8_t factor = gf256LogTable[buffer[i]];
 
             for (size_t j = 1; j <= generatorPolyLength; j++) {
-                buffer[i + j] ^=
-                    expTable[(factor + generatorPoly[generatorPolyLength - j]) %
-                             255];
+                buffer[i + j] ^= gf256ExpTable
+                    [(factor + generatorPoly[generatorPolyLength - j]) % 255];
             }
         }
     }
@@ -26,7 +26,23 @@
 #include <stddef.h>
 #include <stdint.h>
 
-extern void gf256_initialize(void);
+typedef enum {
+    GF256_KERNEL_SCALAR = 0,
+    GF256_KERNEL_SSSE3 = 1,
+    GF256_KERNEL_AVX2 = 2
+} GF256Kernel;
+
+extern uint8_t gf256_multiply(uint8_t a, uint8_t b);
+extern const uint8_t *gf256_getGeneratorPolynomial(size_t degree);
+extern const uint8_t *gf256_getMultiplicationTable(size_t degree);
+extern GF256Kernel gf256_getKernel(void);
+extern GF256Kernel gf256_selectKernel(GF256Kernel kernel);
+extern void gf256_multiplyAccumulate(uint8_t *dst, const uint8_t *src,
+                                     uint8_t c, size_t length);
+extern void gf256_multiplyAccumulateRows(uint8_t *dst, size_t stride,
+                                         const uint8_t *src,
+                                         const uint8_t *constants,
+                                         size_t numRows, size_t length);
 extern void gf256_initializeGeneratorPolynomial(uint8_t *polynomial,
                                                 size_t degree);
 extern void gf256_divideByGeneratorPolynomial(uint8_t *remainder,
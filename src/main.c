@@ -20,26 +20,19 @@
  * SOFTWARE.
  */
 
-#include "dataanalysis.h"
-#include "dataencoding.h"
-#include "datamasking.h"
-#include "errorcorrection.h"
-#include "finalmessage.h"
-#include "formatandversion.h"
+#include "batch.h"
 #include "module.h"
-#include "moduleplacement.h"
-#include "rsblock.h"
-#include "segment.h"
+#include "qrce.h"
 #include "typedefs.h"
 #include <stdio.h>
 #include <stdlib.h>
 
-#define MAX_DATA_LENGTH 7089
-
 #define printUsageAndExit()                                                    \
     do {                                                                       \
         fprintf(stderr, "Usage: qrce.exe "                                     \
-                        "[/E ErrorCorrectionLevel] [/V Version] [/K] [/O]\n\n" \
+                        "[/E ErrorCorrectionLevel] [/V Version] [/K] [/O] "    \
+                        "[/X] [/A] [/B Delimiter [/J Threads]] "               \
+                        "[/M Threads]\n\n"                                     \
                         "Options:\n"                                           \
                         "  /E ErrorCorrectionLevel   "                         \
                         "Error correction level. L, M, Q, or H.\n"             \
@@ -48,7 +41,20 @@
                         "  /K                        "                         \
                         "Use Kanji mode.\n"                                    \
                         "  /O                        "                         \
-                        "Optimize the length of the bit string.\n");           \
+                        "Optimize the length of the bit string.\n"             \
+                        "  /X                        "                         \
+                        "Minimize the length of the bit string exactly.\n"     \
+                        "  /A                        "                         \
+                        "Pick the mask of large symbols from a sample.\n"      \
+                        "  /B Delimiter              "                         \
+                        "Encode one symbol per record.\n"                      \
+                        "                            "                         \
+                        "L (line feed), N (NUL), or P (length prefix).\n"      \
+                        "  /J Threads                "                         \
+                        "Encode records on 1 to 256 threads.\n"                \
+                        "  /M Threads                "                         \
+                        "Score the mask patterns of large symbols on 1 to 8 "  \
+                        "threads.\n");                                         \
         return EXIT_FAILURE;                                                   \
     } while (0)
 
@@ -79,6 +85,47 @@ static int parseErrorCorrectionLevel(const char *v) {
     }
 }
 
+static int parseRecordDelimiter(const char *v) {
+    if (v[1] != '\0') {
+        return -1;
+    }
+
+    switch (v[0]) {
+    case 'L':
+    case 'l':
+        return RECORD_DELIMITER_LINE_FEED;
+
+    case 'N':
+    case 'n':
+        return RECORD_DELIMITER_NUL;
+
+    case 'P':
+    case 'p':
+        return RECORD_DELIMITER_LENGTH_PREFIX;
+
+    default:
+        return -1;
+    }
+}
+
+static int parseNumThreads(const char *v) {
+    char *endptr;
+    long numThreads = strtol(v, &endptr, 10);
+
+    return *endptr == '\0' && 1 <= numThreads && numThreads <= 256
+               ? (int)numThreads
+               : -1;
+}
+
+static int parseNumMaskThreads(const char *v) {
+    char *endptr;
+    long numThreads = strtol(v, &endptr, 10);
+
+    return *endptr == '\0' && 1 <= numThreads && numThreads <= 8
+               ? (int)numThreads
+               : -1;
+}
+
 static int parseVersion(const char *v) {
     char *endptr;
     long version = strtol(v, &endptr, 10);
@@ -91,6 +138,11 @@ int main(int argc, char *const *argv) {
     int version = -1;
     bool useKanjiMode = false;
     bool useOptimization = false;
+    bool useOptimalSegmentation = false;
+    bool useMaskEstimation = false;
+    int delimiter = -1;
+    int numThreads = -1;
+    int numMaskThreads = 1;
 
     int option = 0;
 
@@ -114,6 +166,17 @@ int main(int argc, char *const *argv) {
                 useOptimization = true;
                 continue;
 
+            case 'X':
+            case 'x':
+                useOptimization = true;
+                useOptimalSegmentation = true;
+                continue;
+
+            case 'A':
+            case 'a':
+                useMaskEstimation = true;
+                continue;
+
             default:
                 option = v[1];
                 continue;
@@ -133,6 +196,27 @@ int main(int argc, char *const *argv) {
             }
             break;
 
+        case 'B':
+        case 'b':
+            if ((delimiter = parseRecordDelimiter(v)) == -1) {
+                printUsageAndExit();
+            }
+            break;
+
+        case 'J':
+        case 'j':
+            if ((numThreads = parseNumThreads(v)) == -1) {
+                printUsageAndExit();
+            }
+            break;
+
+        case 'M':
+        case 'm':
+            if ((numMaskThreads = parseNumMaskThreads(v)) == -1) {
+                printUsageAndExit();
+            }
+            break;
+
         default:
             printUsageAndExit();
         }
@@ -140,145 +224,88 @@ int main(int argc, char *const *argv) {
         option = 0;
     }
 
-    if (option != 0) {
+    if (option != 0 || (numThreads != -1 && delimiter == -1)) {
         printUsageAndExit();
     }
 
-    uint8_t *data = malloc(sizeof(uint8_t) * (MAX_DATA_LENGTH + 1));
-
-    if (data == NULL) {
-        fprintf(stderr, "Out of memory\n");
-        return EXIT_FAILURE;
-    }
-
-    int length = fread(data, sizeof(uint8_t), MAX_DATA_LENGTH + 1, stdin);
-
-    if (ferror(stdin)) {
-        perror("Read error");
-        return EXIT_FAILURE;
-    }
-
-    if (length > MAX_DATA_LENGTH) {
-        fprintf(stderr, "Input is too long\n");
-        return EXIT_FAILURE;
-    }
-
-    Segment *segments;
-    int recommendedVersion;
-    VersionClass versionClass;
+    QRCEOptions options = {ecLevel,           version,
+                           useKanjiMode,      useOptimization,
+                           numMaskThreads,    useMaskEstimation,
+                           useOptimalSegmentation};
 
-    if (useOptimization) {
-        for (versionClass = VERSION_CLASS_SMALL;
-             versionClass <= VERSION_CLASS_LARGE; versionClass++) {
+    if (delimiter != -1) {
+        BatchStatistics stats;
+        BatchStatus status;
 
-            segments = createMixedModeSegments(data, length, useKanjiMode,
-                                               versionClass);
+        qrce_preloadTables();
 
-            if (segments == NULL) {
-                fprintf(stderr, "Out of memory\n");
-                return EXIT_FAILURE;
-            }
+        status = encodeBatch(stdin, stdout, delimiter, &options,
+                             numThreads == -1 ? 1 : numThreads, &stats);
 
-            recommendedVersion =
-                recommendVersion(segments, ecLevel, versionClass);
-
-            if (recommendedVersion != -1) {
-                break;
-            }
-
-            freeSegments(segments);
-        }
+        if (status == BATCH_ERROR_READ) {
+            fprintf(stderr, "Read error in record %zu\n", stats.numRecords);
+            return EXIT_FAILURE;
 
-    } else {
-        segments = createModeSegment(data, length, useKanjiMode);
+        } else if (status == BATCH_ERROR_WRITE) {
+            perror("Write error");
+            return EXIT_FAILURE;
 
-        if (segments == NULL) {
+        } else if (status == BATCH_ERROR_OUT_OF_MEMORY) {
             fprintf(stderr, "Out of memory\n");
             return EXIT_FAILURE;
-        }
-
-        for (versionClass = VERSION_CLASS_SMALL;
-             versionClass <= VERSION_CLASS_LARGE; versionClass++) {
-
-            recommendedVersion =
-                recommendVersion(segments, ecLevel, versionClass);
 
-            if (recommendedVersion != -1) {
-                break;
-            }
+        } else if (status == BATCH_ERROR_THREAD) {
+            fprintf(stderr, "Cannot create threads\n");
+            return EXIT_FAILURE;
         }
-    }
 
-    if (recommendedVersion == -1) {
-        fprintf(stderr, "Input is too long\n");
-        return EXIT_FAILURE;
+        return stats.numFailedRecords == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
     }
 
-    if (version == -1) {
-        version = recommendedVersion;
+    uint8_t *data = malloc(sizeof(uint8_t) * (QRCE_MAX_DATA_LENGTH + 1));
+    QRCEWorkspace *workspace = malloc(sizeof(QRCEWorkspace));
 
-    } else if (version < recommendedVersion) {
-        fprintf(stderr, "Input is too long for version %d\n", version);
+    if (data == NULL || workspace == NULL) {
+        fprintf(stderr, "Out of memory\n");
         return EXIT_FAILURE;
     }
 
-    RSBlock rsBlock = getRSBlock(version, ecLevel);
-
-    size_t numDataCodewords = rsBlock.numBlocks1 * rsBlock.numDataCodewords1 +
-                              rsBlock.numBlocks2 * rsBlock.numDataCodewords2;
-    size_t numECCodewords =
-        (rsBlock.numBlocks1 + rsBlock.numBlocks2) * rsBlock.numECCodewords;
+    int length = fread(data, sizeof(uint8_t), QRCE_MAX_DATA_LENGTH + 1, stdin);
 
-    size_t numCodewords = numDataCodewords + numECCodewords;
-    uint8_t *codewords = malloc((2 * numCodewords + 1) * sizeof(uint8_t));
-
-    if (codewords == NULL) {
-        fprintf(stderr, "Out of memory\n");
+    if (ferror(stdin)) {
+        perror("Read error");
         return EXIT_FAILURE;
     }
 
-    size_t symbolSize = getSymbolSizeInNumModules(version);
-    uint8_t *matrix = malloc(2 * symbolSize * symbolSize * sizeof(uint8_t));
-
-    if (matrix == NULL) {
-        fprintf(stderr, "Out of memory\n");
+    if (length > QRCE_MAX_DATA_LENGTH) {
+        fprintf(stderr, "Input is too long\n");
         return EXIT_FAILURE;
     }
 
-    uint8_t *dataCodewords = codewords;
-    uint8_t *ecCodewords = dataCodewords + numDataCodewords;
-    uint8_t *finalMessage = ecCodewords + numECCodewords;
-    uint8_t *unmasked = matrix;
-    uint8_t *masked = unmasked + symbolSize * symbolSize;
-
-    encodeDataCodewords(dataCodewords, numDataCodewords, data, segments,
-                        versionClass);
-
-    freeSegments(segments);
-    free(data);
-
-    encodeErrorCorrectionCodewords(ecCodewords, dataCodewords, rsBlock);
-    constructFinalMessage(finalMessage, dataCodewords, ecCodewords, rsBlock);
-    placeModules(matrix, symbolSize, version, finalMessage);
+    QRCESymbol symbol;
+    QRCEStatus status = qrce_encode(&symbol, workspace, data, length, &options);
 
-    free(codewords);
+    if (status == QRCE_ERROR_INPUT_TOO_LONG_FOR_VERSION) {
+        fprintf(stderr, "Input is too long for version %d\n", version);
+        return EXIT_FAILURE;
 
-    unsigned int dataMaskPattern =
-        applyDataMaskPatternLowestPenaltyScore(masked, unmasked, symbolSize);
+    } else if (status != QRCE_SUCCESS) {
+        fprintf(stderr, "%s\n", qrce_getStatusMessage(status));
+        return EXIT_FAILURE;
+    }
 
-    placeFormatInformation(masked, symbolSize, ecLevel, dataMaskPattern);
-    placeVersionInformation(masked, symbolSize, version);
+    free(data);
 
-    printf("%d ", version);
+    printf("%u ", symbol.version);
 
-    for (size_t y = 0; y < symbolSize; y++) {
-        for (size_t x = 0; x < symbolSize; x++) {
-            uint8_t module = getModule(masked, symbolSize, y, x);
+    for (size_t y = 0; y < symbol.size; y++) {
+        for (size_t x = 0; x < symbol.size; x++) {
+            uint8_t module = getModule(symbol.modules, symbol.size, y, x);
             putchar(module + '0');
         }
     }
 
-    free(matrix);
+    free(workspace);
 
     return EXIT_SUCCESS;
 }
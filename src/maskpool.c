@@ -0,0 +1,265 @@
+/*
+ * Copyright 2025 Naoto Yoshida
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "maskpool.h"
+#include <stdbool.h>
+#include <threads.h>
+
+// One selection in flight. It lives on the stack of the calling thread, which
+// waits until every pattern has been scored before returning. At most
+// maxNumWorkers workers of the pool score its patterns at a time, on top of
+// the calling thread.
+typedef struct MaskJob {
+    const ModuleMatrix *unmasked;
+    const PenaltyBaseline *baseline;
+    const uint64_t (*rowPatterns)[NUM_MASK_PATTERN_WORDS];
+    const uint64_t (*columnPatterns)[NUM_MASK_PATTERN_WORDS];
+    size_t numPatterns;
+    size_t size;
+    unsigned int *penaltyScores;
+    unsigned int maxNumWorkers;
+    unsigned int numBusyWorkers;
+    size_t nextPattern;
+    size_t numScoredPatterns;
+    struct MaskJob *next;
+} MaskJob;
+
+// The workers are started on first use and run until the process exits. Jobs
+// and their counters are only touched under the mutex.
+typedef struct MaskPool {
+    mtx_t mutex;
+    cnd_t workAvailable;
+    cnd_t jobDone;
+    bool initialized;
+    unsigned int numWorkers;
+    MaskJob *firstJob;
+    MaskJob *lastJob;
+} MaskPool;
+
+static MaskPool pool;
+static once_flag poolFlag = ONCE_FLAG_INIT;
+
+static void initializeMaskPool(void) {
+    if (mtx_init(&pool.mutex, mtx_plain) != thrd_success) {
+        return;
+    }
+
+    if (cnd_init(&pool.workAvailable) != thrd_success) {
+        mtx_destroy(&pool.mutex);
+        return;
+    }
+
+    if (cnd_init(&pool.jobDone) != thrd_success) {
+        cnd_destroy(&pool.workAvailable);
+        mtx_destroy(&pool.mutex);
+        return;
+    }
+
+    pool.initialized = true;
+}
+
+// takes the next pattern of the job, and dequeues the job once all of its
+// patterns have been taken; called with the mutex locked
+static void takeJobPattern(MaskJob *job, size_t *pattern) {
+    *pattern = job->nextPattern++;
+
+    if (job->nextPattern < job->numPatterns) {
+        return;
+    }
+
+    MaskJob *previous = NULL;
+    MaskJob **link = &pool.firstJob;
+
+    while (*link != job) {
+        previous = *link;
+        link = &previous->next;
+    }
+
+    *link = job->next;
+
+    if (pool.lastJob == job) {
+        pool.lastJob = previous;
+    }
+}
+
+// takes the next pattern of the first job that has room for another worker;
+// called with the mutex locked
+static MaskJob *takePattern(size_t *pattern) {
+    for (MaskJob *job = pool.firstJob; job != NULL; job = job->next) {
+        if (job->numBusyWorkers < job->maxNumWorkers) {
+            job->numBusyWorkers++;
+            takeJobPattern(job, pattern);
+            return job;
+        }
+    }
+
+    return NULL;
+}
+
+// scores one pattern outside the mutex, then counts it and frees the slot of
+// the worker if it is one; the job may be gone as soon as the last pattern is
+// counted
+static void scorePattern(MaskJob *job, size_t pattern, bool worker) {
+    unsigned int penaltyScore;
+
+    calculatePackedPenaltyScores(&penaltyScore, job->unmasked, job->baseline,
+                                 &job->rowPatterns[pattern],
+                                 &job->columnPatterns[pattern], 1, job->size);
+
+    mtx_lock(&pool.mutex);
+    job->penaltyScores[pattern] = penaltyScore;
+
+    if (worker) {
+        job->numBusyWorkers--;
+
+        if (job->nextPattern < job->numPatterns) {
+            cnd_broadcast(&pool.workAvailable);
+        }
+    }
+
+    if (++job->numScoredPatterns == job->numPatterns) {
+        cnd_broadcast(&pool.jobDone);
+    }
+
+    mtx_unlock(&pool.mutex);
+}
+
+static int runMaskWorker(void *arg) {
+    (void)arg;
+
+    for (;;) {
+        MaskJob *job;
+        size_t pattern;
+
+        mtx_lock(&pool.mutex);
+
+        while ((job = takePattern(&pattern)) == NULL) {
+            cnd_wait(&pool.workAvailable, &pool.mutex);
+        }
+
+        mtx_unlock(&pool.mutex);
+
+        scorePattern(job, pattern, true);
+    }
+
+    return 0;
+}
+
+/**
+ * Starts the workers of the mask pool up to the given number. The workers are
+ * shared by all threads and run until the process exits, so starting them
+ * again costs nothing.
+ *
+ * @param numWorkers The number of workers, at most MAX_NUM_MASK_POOL_WORKERS
+ * @return true if the workers are running, false if none could be started
+ */
+bool startMaskPool(unsigned int numWorkers) {
+    call_once(&poolFlag, initializeMaskPool);
+
+    if (!pool.initialized) {
+        return false;
+    }
+
+    if (numWorkers > MAX_NUM_MASK_POOL_WORKERS) {
+        numWorkers = MAX_NUM_MASK_POOL_WORKERS;
+    }
+
+    mtx_lock(&pool.mutex);
+
+    while (pool.numWorkers < numWorkers) {
+        thrd_t thread;
+
+        if (thrd_create(&thread, runMaskWorker, NULL) != thrd_success) {
+            break;
+        }
+
+        thrd_detach(thread);
+        pool.numWorkers++;
+    }
+
+    bool started = pool.numWorkers > 0;
+
+    mtx_unlock(&pool.mutex);
+
+    return started;
+}
+
+/**
+ * Calculates the penalty scores of several data mask patterns like
+ * calculatePackedPenaltyScores, one pattern per task. The calling thread
+ * scores patterns alongside at most numWorkers workers of the mask pool, so
+ * the scores are complete even if no worker is free. Each task transposes
+ * into its own scratch matrix on its stack.
+ *
+ * @param penaltyScores The penalty score of each pattern
+ * @param unmasked The unmasked matrix
+ * @param baseline The penalty baseline of the version
+ * @param rowPatterns The row lines of each pattern
+ * @param columnPatterns The column lines of each pattern
+ * @param numPatterns The number of patterns, at most 8
+ * @param size The size of the symbol in number of modules
+ * @param numWorkers The number of workers that may score patterns at a time
+ */
+void calculatePackedPenaltyScoresInParallel(
+    unsigned int *penaltyScores, const ModuleMatrix *unmasked,
+    const PenaltyBaseline *baseline,
+    const uint64_t (*rowPatterns)[NUM_MASK_PATTERN_WORDS],
+    const uint64_t (*columnPatterns)[NUM_MASK_PATTERN_WORDS],
+    size_t numPatterns, size_t size, unsigned int numWorkers) {
+    MaskJob job = {unmasked,    baseline,   rowPatterns,   columnPatterns,
+                   numPatterns, size,       penaltyScores, numWorkers,
+                   0,           0,          0,             NULL};
+
+    if (!startMaskPool(0) || numPatterns == 0 || numWorkers == 0) {
+        calculatePackedPenaltyScores(penaltyScores, unmasked, baseline,
+                                     rowPatterns, columnPatterns, numPatterns,
+                                     size);
+        return;
+    }
+
+    mtx_lock(&pool.mutex);
+
+    if (pool.lastJob == NULL) {
+        pool.firstJob = &job;
+    } else {
+        pool.lastJob->next = &job;
+    }
+
+    pool.lastJob = &job;
+    cnd_broadcast(&pool.workAvailable);
+
+    // take patterns of this job only, as the others have their own callers
+    while (job.nextPattern < job.numPatterns) {
+        size_t pattern;
+
+        takeJobPattern(&job, &pattern);
+        mtx_unlock(&pool.mutex);
+        scorePattern(&job, pattern, false);
+        mtx_lock(&pool.mutex);
+    }
+
+    while (job.numScoredPatterns < job.numPatterns) {
+        cnd_wait(&pool.jobDone, &pool.mutex);
+    }
+
+    mtx_unlock(&pool.mutex);
+}
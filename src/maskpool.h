@@ -0,0 +1,43 @@
+/*
+ * Copyright 2025 Naoto Yoshida
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MASKPOOL_H
+#define MASKPOOL_H
+
+#include "module.h"
+#include "penalty.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// the calling thread and up to seven workers score the eight patterns
+#define MAX_NUM_MASK_POOL_WORKERS 7
+
+extern bool startMaskPool(unsigned int numWorkers);
+extern void calculatePackedPenaltyScoresInParallel(
+    unsigned int *penaltyScores, const ModuleMatrix *unmasked,
+    const PenaltyBaseline *baseline,
+    const uint64_t (*rowPatterns)[NUM_MASK_PATTERN_WORDS],
+    const uint64_t (*columnPatterns)[NUM_MASK_PATTERN_WORDS],
+    size_t numPatterns, size_t size, unsigned int numWorkers);
+
+#endif /* MASKPOOL_H */
@@ -0,0 +1,145 @@
+/*
+ * Copyright 2025 Naoto Yoshida
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "module.h"
+#include <string.h>
+
+/**
+ * Clears all planes of the rows used by a symbol.
+ *
+ * @param matrix The matrix
+ * @param size The size of the symbol in number of modules
+ */
+void clearModuleMatrix(ModuleMatrix *matrix, size_t size) {
+    memset(matrix->dark, 0, sizeof(matrix->dark[0]) * size);
+    memset(matrix->function, 0, sizeof(matrix->function[0]) * size);
+    memset(matrix->blank, 0, sizeof(matrix->blank[0]) * size);
+}
+
+/**
+ * Unpacks the matrix into one byte per module, each holding the module as
+ * MODULE_DARK, MODULE_BLANK and MODULE_FUNCTION flags.
+ *
+ * @param modules The unpacked modules, size * size bytes
+ * @param matrix The matrix
+ * @param size The size of the symbol in number of modules
+ */
+void unpackModuleMatrix(uint8_t *modules, const ModuleMatrix *matrix,
+                        size_t size) {
+    for (size_t y = 0; y < size; y++) {
+        for (size_t i = 0; i < MODULE_MATRIX_ROW_WORDS; i++) {
+            uint64_t dark = matrix->dark[y][i];
+            uint64_t blank = matrix->blank[y][i];
+            uint64_t function = matrix->function[y][i];
+
+            for (size_t x = 64 * i; x < size && x < 64 * (i + 1); x++) {
+                uint8_t module =
+                    (dark & 1) | (blank & 1) << 1 | (function & 1) << 2;
+
+                placeModule(modules, size, y, x, module);
+
+                dark >>= 1;
+                blank >>= 1;
+                function >>= 1;
+            }
+        }
+    }
+}
+
+/**
+ * Lists the modules whose dark, function or blank bit differs between two
+ * matrices of the same size, row by row.
+ *
+ * @param changes The changed modules, room for size * size positions
+ * @param matrix The matrix
+ * @param previous The previous matrix
+ * @param size The size of the symbol in number of modules
+ * @return The number of changed modules
+ */
+size_t listChangedModules(ModulePosition *changes, const ModuleMatrix *matrix,
+                          const ModuleMatrix *previous, size_t size) {
+    size_t numChanges = 0;
+
+    for (size_t y = 0; y < size; y++) {
+        for (size_t i = 0; i < MODULE_MATRIX_ROW_WORDS; i++) {
+            uint64_t changed = (matrix->dark[y][i] ^ previous->dark[y][i]) |
+                               (matrix->function[y][i] ^
+                                previous->function[y][i]) |
+                               (matrix->blank[y][i] ^ previous->blank[y][i]);
+
+            for (size_t k = 0; changed; k++, changed >>= 1) {
+                if (changed & 1) {
+                    changes[numChanges].y = y;
+                    changes[numChanges].x = 64 * i + k;
+                    numChanges++;
+                }
+            }
+        }
+    }
+
+    return numChanges;
+}
+
+// transposes a 64 x 64 block of bits, so that bit x of word y becomes bit y of
+// word x, by swapping ever smaller off-diagonal quadrants
+static void transposeBlock(uint64_t *block) {
+    uint64_t mask = 0x00000000FFFFFFFF;
+
+    for (unsigned int j = 32; j != 0; j >>= 1, mask ^= mask << j) {
+        for (unsigned int k = 0; k < 64; k = (k + j + 1) & ~j) {
+            uint64_t t = ((block[k] >> j) ^ block[k + j]) & mask;
+
+            block[k] ^= t << j;
+            block[k + j] ^= t;
+        }
+    }
+}
+
+/**
+ * Transposes a plane of the matrix 64 x 64 modules at a time, so that the
+ * columns can be scored with the same row operations as the rows. Only the
+ * words covering size modules are written.
+ *
+ * @param transposed The transposed plane
+ * @param plane The plane
+ * @param size The size of the symbol in number of modules
+ */
+void transposeModulePlane(uint64_t (*transposed)[MODULE_MATRIX_ROW_WORDS],
+                          const uint64_t (*plane)[MODULE_MATRIX_ROW_WORDS],
+                          size_t size) {
+    size_t numWords = (size + 63) / 64;
+    uint64_t block[64];
+
+    for (size_t i = 0; i < numWords; i++) {
+        for (size_t j = 0; j < numWords; j++) {
+            for (size_t k = 0; k < 64; k++) {
+                block[k] = 64 * i + k < size ? plane[64 * i + k][j] : 0;
+            }
+
+            transposeBlock(block);
+
+            for (size_t k = 0; k < 64 && 64 * j + k < size; k++) {
+                transposed[64 * j + k][i] = block[k];
+            }
+        }
+    }
+}
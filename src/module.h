@@ -23,6 +23,9 @@
 #ifndef MODULE_H
 #define MODULE_H
 
+#include <stddef.h>
+#include <stdint.h>
+
 #define MODULE_LIGHT 0
 #define MODULE_DARK 1
 #define MODULE_BLANK 2
@@ -34,4 +37,59 @@
         matrix[(size) * (y) + (x)] = (module);                                 \
     } while (0)
 
+#define MODULE_MATRIX_MAX_SIZE 177
+
+// number of 64-bit words per row, enough for MODULE_MATRIX_MAX_SIZE modules
+#define MODULE_MATRIX_ROW_WORDS 3
+
+// Bit-packed matrix. Module (y, x) is bit x % 64 of word x / 64 in row y of
+// each plane, and the bits beyond the size of the symbol are zero.
+typedef struct ModuleMatrix {
+    uint64_t dark[MODULE_MATRIX_MAX_SIZE][MODULE_MATRIX_ROW_WORDS];
+
+    // function patterns, including the reserved areas
+    uint64_t function[MODULE_MATRIX_MAX_SIZE][MODULE_MATRIX_ROW_WORDS];
+
+    // areas reserved for format and version information until they are placed
+    uint64_t blank[MODULE_MATRIX_MAX_SIZE][MODULE_MATRIX_ROW_WORDS];
+} ModuleMatrix;
+
+// the row and column of a module
+typedef struct ModulePosition {
+    size_t y;
+    size_t x;
+} ModulePosition;
+
+#define getMatrixBit(plane, y, x)                                              \
+    ((unsigned int)((plane)[y][(x) / 64] >> ((x) % 64)) & 1)
+#define setMatrixBit(plane, y, x, bit)                                         \
+    do {                                                                       \
+        (plane)[y][(x) / 64] =                                                 \
+            ((plane)[y][(x) / 64] & ~((uint64_t)1 << ((x) % 64))) |            \
+            ((uint64_t)((bit) & 1) << ((x) % 64));                             \
+    } while (0)
+
+// the module as MODULE_DARK, MODULE_BLANK and MODULE_FUNCTION flags
+#define getMatrixModule(matrix, y, x)                                          \
+    (getMatrixBit((matrix)->dark, y, x) |                                      \
+     getMatrixBit((matrix)->blank, y, x) << 1 |                                \
+     getMatrixBit((matrix)->function, y, x) << 2)
+#define placeMatrixModule(matrix, y, x, module)                                \
+    do {                                                                       \
+        setMatrixBit((matrix)->dark, y, x, (module) & MODULE_DARK);            \
+        setMatrixBit((matrix)->blank, y, x, (module) >> 1);                    \
+        setMatrixBit((matrix)->function, y, x, (module) >> 2);                 \
+    } while (0)
+
+extern void clearModuleMatrix(ModuleMatrix *matrix, size_t size);
+extern void unpackModuleMatrix(uint8_t *modules, const ModuleMatrix *matrix,
+                               size_t size);
+extern size_t listChangedModules(ModulePosition *changes,
+                                 const ModuleMatrix *matrix,
+                                 const ModuleMatrix *previous, size_t size);
+extern void
+transposeModulePlane(uint64_t (*transposed)[MODULE_MATRIX_ROW_WORDS],
+                     const uint64_t (*plane)[MODULE_MATRIX_ROW_WORDS],
+                     size_t size);
+
 #endif /* MODULE_H */
@@ -22,30 +22,11 @@
 
 #include "moduleplacement.h"
 #include "module.h"
+#include "tables.h"
+#include <stdatomic.h>
+#include <stdbool.h>
 #include <string.h>
-
-// {number of coordinates, coordinates 1, coordinates 2, ...}
-static const size_t alignmentPatternCoordinates[][8] = {
-    {0, 0, 0, 0, 0, 0, 0, 0},          {2, 6, 18, 0, 0, 0, 0, 0},
-    {2, 6, 22, 0, 0, 0, 0, 0},         {2, 6, 26, 0, 0, 0, 0, 0},
-    {2, 6, 30, 0, 0, 0, 0, 0},         {2, 6, 34, 0, 0, 0, 0, 0},
-    {3, 6, 22, 38, 0, 0, 0, 0},        {3, 6, 24, 42, 0, 0, 0, 0},
-    {3, 6, 26, 46, 0, 0, 0, 0},        {3, 6, 28, 50, 0, 0, 0, 0},
-    {3, 6, 30, 54, 0, 0, 0, 0},        {3, 6, 32, 58, 0, 0, 0, 0},
-    {3, 6, 34, 62, 0, 0, 0, 0},        {4, 6, 26, 46, 66, 0, 0, 0},
-    {4, 6, 26, 48, 70, 0, 0, 0},       {4, 6, 26, 50, 74, 0, 0, 0},
-    {4, 6, 30, 54, 78, 0, 0, 0},       {4, 6, 30, 56, 82, 0, 0, 0},
-    {4, 6, 30, 58, 86, 0, 0, 0},       {4, 6, 34, 62, 90, 0, 0, 0},
-    {5, 6, 28, 50, 72, 94, 0, 0},      {5, 6, 26, 50, 74, 98, 0, 0},
-    {5, 6, 30, 54, 78, 102, 0, 0},     {5, 6, 28, 54, 80, 106, 0, 0},
-    {5, 6, 32, 58, 84, 110, 0, 0},     {5, 6, 30, 58, 86, 114, 0, 0},
-    {5, 6, 34, 62, 90, 118, 0, 0},     {6, 6, 26, 50, 74, 98, 122, 0},
-    {6, 6, 30, 54, 78, 102, 126, 0},   {6, 6, 26, 52, 78, 104, 130, 0},
-    {6, 6, 30, 56, 82, 108, 134, 0},   {6, 6, 34, 60, 86, 112, 138, 0},
-    {6, 6, 30, 58, 86, 114, 142, 0},   {6, 6, 34, 62, 90, 118, 146, 0},
-    {7, 6, 30, 54, 78, 102, 126, 150}, {7, 6, 24, 50, 76, 102, 128, 154},
-    {7, 6, 28, 54, 80, 106, 132, 158}, {7, 6, 32, 58, 84, 110, 136, 162},
-    {7, 6, 26, 54, 82, 110, 138, 166}, {7, 6, 30, 58, 86, 114, 142, 170}};
+#include <threads.h>
 
 /**
  * Returns the size of the symbol in number of modules for the given version.
@@ -54,88 +35,84 @@ static const size_t alignmentPatternCoordinates[][8] = {
  * @return The size of the symbol in number of modules
  */
 size_t getSymbolSizeInNumModules(unsigned int version) {
-    return 17 + 4 * version;
+    return symbolDescriptors[version - 1][0].size;
 }
 
-static void placeHorizontalLine(uint8_t *matrix, size_t size, size_t y,
-                                size_t x, size_t length, uint8_t module) {
+static void placeHorizontalLine(ModuleMatrix *matrix, size_t y, size_t x,
+                                size_t length, uint8_t module) {
     for (size_t i = 0; i < length; i++) {
-        placeModule(matrix, size, y, x + i, module);
+        placeMatrixModule(matrix, y, x + i, module);
     }
 }
 
-static void placeVerticalLine(uint8_t *matrix, size_t size, size_t y, size_t x,
+static void placeVerticalLine(ModuleMatrix *matrix, size_t y, size_t x,
                               size_t length, uint8_t module) {
     for (size_t i = 0; i < length; i++) {
-        placeModule(matrix, size, y + i, x, module);
+        placeMatrixModule(matrix, y + i, x, module);
     }
 }
 
-static void placeRectangle(uint8_t *matrix, size_t size, size_t y, size_t x,
+static void placeRectangle(ModuleMatrix *matrix, size_t y, size_t x,
                            size_t height, size_t width, uint8_t module) {
-    placeHorizontalLine(matrix, size, y, x, width - 1, module);
-    placeVerticalLine(matrix, size, y, x + width - 1, height - 1, module);
-    placeHorizontalLine(matrix, size, y + height - 1, x + 1, width - 1, module);
-    placeVerticalLine(matrix, size, y + 1, x, height - 1, module);
+    placeHorizontalLine(matrix, y, x, width - 1, module);
+    placeVerticalLine(matrix, y, x + width - 1, height - 1, module);
+    placeHorizontalLine(matrix, y + height - 1, x + 1, width - 1, module);
+    placeVerticalLine(matrix, y + 1, x, height - 1, module);
 }
 
-static void placeFilledRectangle(uint8_t *matrix, size_t size, size_t y,
-                                 size_t x, size_t height, size_t width,
-                                 uint8_t module) {
+static void placeFilledRectangle(ModuleMatrix *matrix, size_t y, size_t x,
+                                 size_t height, size_t width, uint8_t module) {
     for (size_t i = 0; i < height; i++) {
         for (size_t j = 0; j < width; j++) {
-            placeModule(matrix, size, y + i, x + j, module);
+            placeMatrixModule(matrix, y + i, x + j, module);
         }
     }
 }
 
-static void placeFinderPattern(uint8_t *matrix, size_t size, size_t y,
-                               size_t x) {
+static void placeFinderPattern(ModuleMatrix *matrix, size_t y, size_t x) {
     uint8_t module = MODULE_FUNCTION | MODULE_DARK;
 
-    placeFilledRectangle(matrix, size, y, x, 7, 7, module);
-    placeRectangle(matrix, size, y + 1, x + 1, 5, 5, module ^ MODULE_DARK);
+    placeFilledRectangle(matrix, y, x, 7, 7, module);
+    placeRectangle(matrix, y + 1, x + 1, 5, 5, module ^ MODULE_DARK);
 }
 
-static void placeFinderPatterns(uint8_t *matrix, size_t size) {
-    placeFinderPattern(matrix, size, 0, 0);
-    placeFinderPattern(matrix, size, 0, size - 7);
-    placeFinderPattern(matrix, size, size - 7, 0);
+static void placeFinderPatterns(ModuleMatrix *matrix, size_t size) {
+    placeFinderPattern(matrix, 0, 0);
+    placeFinderPattern(matrix, 0, size - 7);
+    placeFinderPattern(matrix, size - 7, 0);
 }
 
-static void placeSeparators(uint8_t *matrix, size_t size) {
+static void placeSeparators(ModuleMatrix *matrix, size_t size) {
     uint8_t module = MODULE_FUNCTION | MODULE_LIGHT;
 
-    placeVerticalLine(matrix, size, 0, 7, 7, module);
-    placeHorizontalLine(matrix, size, 7, 0, 8, module);
-    placeVerticalLine(matrix, size, 0, size - 8, 7, module);
-    placeHorizontalLine(matrix, size, 7, size - 8, 8, module);
-    placeHorizontalLine(matrix, size, size - 8, 0, 8, module);
-    placeVerticalLine(matrix, size, size - 7, 7, 7, module);
+    placeVerticalLine(matrix, 0, 7, 7, module);
+    placeHorizontalLine(matrix, 7, 0, 8, module);
+    placeVerticalLine(matrix, 0, size - 8, 7, module);
+    placeHorizontalLine(matrix, 7, size - 8, 8, module);
+    placeHorizontalLine(matrix, size - 8, 0, 8, module);
+    placeVerticalLine(matrix, size - 7, 7, 7, module);
 }
 
-static void placeTimingPatterns(uint8_t *matrix, size_t size) {
+static void placeTimingPatterns(ModuleMatrix *matrix, size_t size) {
     uint8_t module = MODULE_FUNCTION | MODULE_DARK;
 
     for (size_t i = 8; i < size - 8; i++) {
-        placeModule(matrix, size, 6, i, module);
-        placeModule(matrix, size, i, 6, module);
+        placeMatrixModule(matrix, 6, i, module);
+        placeMatrixModule(matrix, i, 6, module);
 
         module ^= MODULE_DARK;
     }
 }
 
-static void placeAlignmentPattern(uint8_t *matrix, size_t size, size_t y,
-                                  size_t x) {
+static void placeAlignmentPattern(ModuleMatrix *matrix, size_t y, size_t x) {
     uint8_t module = MODULE_FUNCTION | MODULE_DARK;
 
-    placeFilledRectangle(matrix, size, y, x, 5, 5, module);
-    placeRectangle(matrix, size, y + 1, x + 1, 3, 3, module ^ MODULE_DARK);
+    placeFilledRectangle(matrix, y, x, 5, 5, module);
+    placeRectangle(matrix, y + 1, x + 1, 3, 3, module ^ MODULE_DARK);
 }
 
-static void placeAlignmentPatterns(uint8_t *matrix, size_t size,
-                                   unsigned int version) {
-    const size_t *coordinates = alignmentPatternCoordinates[version - 1];
+static void placeAlignmentPatterns(ModuleMatrix *matrix, unsigned int version) {
+    const uint8_t *coordinates = alignmentPatternCoordinates[version - 1];
     size_t numCoordinates = coordinates[0];
 
     for (size_t i = 1; i <= numCoordinates; i++) {
@@ -143,30 +120,29 @@ static void placeAlignmentPatterns(uint8_t *matrix, size_t size,
             if ((1 < i && i < numCoordinates) ||
                 (1 < j && j < numCoordinates) ||
                 (i == numCoordinates && j == numCoordinates)) {
-                placeAlignmentPattern(matrix, size, coordinates[i] - 2,
+                placeAlignmentPattern(matrix, coordinates[i] - 2,
                                       coordinates[j] - 2);
             }
         }
     }
 }
 
-static void placeDarkModule(uint8_t *matrix, size_t size,
-                            unsigned int version) {
+static void placeDarkModule(ModuleMatrix *matrix, unsigned int version) {
     uint8_t module = MODULE_FUNCTION | MODULE_DARK;
 
-    placeModule(matrix, size, 4 * version + 9, 8, module);
+    placeMatrixModule(matrix, 4 * version + 9, 8, module);
 }
 
-static void reserveFormatInformation(uint8_t *matrix, size_t size) {
+static void reserveFormatInformation(ModuleMatrix *matrix, size_t size) {
     uint8_t module = MODULE_FUNCTION | MODULE_BLANK;
 
-    placeVerticalLine(matrix, size, 0, 8, 9, module);
-    placeHorizontalLine(matrix, size, 8, 0, 9, module);
-    placeHorizontalLine(matrix, size, 8, size - 8, 8, module);
-    placeVerticalLine(matrix, size, size - 8, 8, 8, module);
+    placeVerticalLine(matrix, 0, 8, 9, module);
+    placeHorizontalLine(matrix, 8, 0, 9, module);
+    placeHorizontalLine(matrix, 8, size - 8, 8, module);
+    placeVerticalLine(matrix, size - 8, 8, 8, module);
 }
 
-static void reserveVersionInformation(uint8_t *matrix, size_t size,
+static void reserveVersionInformation(ModuleMatrix *matrix, size_t size,
                                       unsigned int version) {
     if (version < 7) {
         return;
@@ -174,27 +150,52 @@ static void reserveVersionInformation(uint8_t *matrix, size_t size,
 
     uint8_t module = MODULE_FUNCTION | MODULE_BLANK;
 
-    placeFilledRectangle(matrix, size, 0, size - 11, 6, 3, module);
-    placeFilledRectangle(matrix, size, size - 11, 0, 3, 6, module);
+    placeFilledRectangle(matrix, 0, size - 11, 6, 3, module);
+    placeFilledRectangle(matrix, size - 11, 0, 3, 6, module);
 }
 
-static void placeFunctionPatterns(uint8_t *matrix, size_t size,
-                                  unsigned int version) {
+/**
+ * Places the function patterns of the version in a cleared matrix one module
+ * at a time. placeModules() copies them from a template built with this
+ * instead.
+ *
+ * @param matrix The matrix
+ * @param size The size of the symbol in number of modules
+ * @param version The version number
+ */
+void placeFunctionPatterns(ModuleMatrix *matrix, size_t size,
+                           unsigned int version) {
     reserveFormatInformation(matrix, size);
     reserveVersionInformation(matrix, size, version);
     placeFinderPatterns(matrix, size);
     placeSeparators(matrix, size);
     placeTimingPatterns(matrix, size);
-    placeAlignmentPatterns(matrix, size, version);
-    placeDarkModule(matrix, size, version);
+    placeAlignmentPatterns(matrix, version);
+    placeDarkModule(matrix, version);
 }
 
 static uint8_t getBit(const uint8_t *array, size_t index) {
     return array[index / 8] >> (7 - index % 8) & 1;
 }
 
-static void placeCodewordModules(uint8_t *matrix, size_t size,
-                                 const uint8_t *codewords) {
+// the number of modules left for codewords and remainder bits
+static size_t getNumCodewordModules(unsigned int version) {
+    const SymbolDescriptor *descriptor = &symbolDescriptors[version - 1][0];
+
+    return 8 * descriptor->numCodewords + descriptor->numRemainderBits;
+}
+
+/**
+ * Places the codewords along the placement path around the function patterns
+ * already in the matrix. placeModules() scatters them to indexed positions
+ * instead.
+ *
+ * @param matrix The matrix
+ * @param size The size of the symbol in number of modules
+ * @param codewords The codewords
+ */
+void placeCodewordModules(ModuleMatrix *matrix, size_t size,
+                          const uint8_t *codewords) {
     size_t x = size - 1;
     size_t y = size - 1;
     size_t vy = -1;
@@ -203,9 +204,9 @@ static void placeCodewordModules(uint8_t *matrix, size_t size,
     for (size_t i = 0; i < size / 2; i++) {
         for (size_t j = 0; j < size; j++) {
             for (size_t k = 0; k < 2; k++) {
-                if (getModule(matrix, size, y + vy * j, x - k) == 0) {
-                    placeModule(matrix, size, y + vy * j, x - k,
-                                getBit(codewords, index++));
+                if (!getMatrixBit(matrix->function, y + vy * j, x - k)) {
+                    setMatrixBit(matrix->dark, y + vy * j, x - k,
+                                 getBit(codewords, index++));
                 }
             }
         }
@@ -216,18 +217,156 @@ static void placeCodewordModules(uint8_t *matrix, size_t size,
     }
 }
 
+// follows the same path as placeCodewordModules, recording the positions
+static void indexCodewordModules(uint16_t *positions,
+                                 const ModuleMatrix *matrix, size_t size) {
+    size_t x = size - 1;
+    size_t y = size - 1;
+    size_t vy = -1;
+    size_t index = 0;
+
+    for (size_t i = 0; i < size / 2; i++) {
+        for (size_t j = 0; j < size; j++) {
+            for (size_t k = 0; k < 2; k++) {
+                if (!getMatrixBit(matrix->function, y + vy * j, x - k)) {
+                    positions[index++] =
+                        (uint16_t)((y + vy * j) << 8 | (x - k));
+                }
+            }
+        }
+
+        x -= x == 8 ? 3 : 2;
+        y ^= size - 1;
+        vy = -vy;
+    }
+}
+
+// the function patterns of each version and the positions of the codeword
+// modules of all versions, one after another, each version built on first use
+static ModuleMatrix functionPatternTemplates[40];
+static uint16_t codewordModulePositions[NUM_CODEWORD_MODULE_POSITIONS];
+static atomic_bool versionLayoutsReady[40];
+static mtx_t versionLayoutsMutex;
+static bool versionLayoutsMutexInitialized = false;
+static once_flag versionLayoutsFlag = ONCE_FLAG_INIT;
+
+static void initializeVersionLayoutsMutex(void) {
+    versionLayoutsMutexInitialized =
+        mtx_init(&versionLayoutsMutex, mtx_plain) == thrd_success;
+}
+
+static uint16_t *getVersionPositions(unsigned int version) {
+    uint16_t *positions = codewordModulePositions;
+
+    for (unsigned int v = 1; v < version; v++) {
+        positions += getNumCodewordModules(v);
+    }
+
+    return positions;
+}
+
+// builds the template and the positions of the version unless already built;
+// false if they cannot be built safely
+static bool prepareVersionLayout(unsigned int version) {
+    if (atomic_load_explicit(&versionLayoutsReady[version - 1],
+                             memory_order_acquire)) {
+        return true;
+    }
+
+    call_once(&versionLayoutsFlag, initializeVersionLayoutsMutex);
+
+    if (!versionLayoutsMutexInitialized) {
+        return false;
+    }
+
+    mtx_lock(&versionLayoutsMutex);
+
+    if (!atomic_load_explicit(&versionLayoutsReady[version - 1],
+                              memory_order_relaxed)) {
+        ModuleMatrix *template = &functionPatternTemplates[version - 1];
+        size_t size = getSymbolSizeInNumModules(version);
+
+        clearModuleMatrix(template, size);
+        placeFunctionPatterns(template, size, version);
+        indexCodewordModules(getVersionPositions(version), template, size);
+        atomic_store_explicit(&versionLayoutsReady[version - 1], true,
+                              memory_order_release);
+    }
+
+    mtx_unlock(&versionLayoutsMutex);
+
+    return true;
+}
+
 /**
- * Places the modules in the matrix.
+ * Builds the function pattern templates and codeword module positions of all
+ * 40 versions up front, so that no symbol pays for building them. Optional;
+ * they are otherwise built on first use of each version.
+ *
+ * @return true if all versions are built
+ */
+bool preloadVersionLayouts(void) {
+    for (unsigned int version = 1; version <= 40; version++) {
+        if (!prepareVersionLayout(version)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Returns the positions of the codeword modules of the version in placement
+ * order, so that bit i of the codewords goes to position i. A position holds
+ * the row in its upper and the column in its lower 8 bits. The positions are
+ * indexed on first use and shared by all threads.
+ *
+ * @param version The version number
+ * @param numPositions The number of positions, including the remainder bits
+ * @return The positions; NULL if they could not be indexed
+ */
+const uint16_t *getCodewordModulePositions(unsigned int version,
+                                           size_t *numPositions) {
+    *numPositions = getNumCodewordModules(version);
+
+    return prepareVersionLayout(version) ? getVersionPositions(version) : NULL;
+}
+
+/**
+ * Places the modules in the matrix. The function patterns are copied from the
+ * template of the version, and the codewords are scattered to the positions
+ * indexed for it instead of following the placement path around the function
+ * patterns.
  *
  * @param matrix The matrix
  * @param size The size of the symbol in number of modules
  * @param version The version number
  * @param codewords The codewords
  */
-void placeModules(uint8_t *matrix, size_t size, unsigned int version,
+void placeModules(ModuleMatrix *matrix, size_t size, unsigned int version,
                   const uint8_t *codewords) {
-    memset(matrix, 0, size * size);
+    if (!prepareVersionLayout(version)) {
+        clearModuleMatrix(matrix, size);
+        placeFunctionPatterns(matrix, size, version);
+        placeCodewordModules(matrix, size, codewords);
+        return;
+    }
 
-    placeFunctionPatterns(matrix, size, version);
-    placeCodewordModules(matrix, size, codewords);
+    const ModuleMatrix *template = &functionPatternTemplates[version - 1];
+    const uint16_t *positions = getVersionPositions(version);
+    size_t numPositions = getNumCodewordModules(version);
+
+    memcpy(matrix->dark, template->dark, sizeof(matrix->dark[0]) * size);
+    memcpy(matrix->function, template->function,
+           sizeof(matrix->function[0]) * size);
+    memcpy(matrix->blank, template->blank, sizeof(matrix->blank[0]) * size);
+
+    // the codeword modules are still light, so the dark ones can be ORed in
+    for (size_t index = 0; index < numPositions; index++) {
+        size_t y = positions[index] >> 8;
+        size_t x = positions[index] & 0xFF;
+
+        matrix->dark[y][x / 64] |= (uint64_t)getBit(codewords, index)
+                                   << (x % 64);
+    }
 }
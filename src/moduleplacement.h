@@ -23,11 +23,23 @@
 #ifndef MODULEPLACEMENT_H
 #define MODULEPLACEMENT_H
 
+#include "module.h"
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
+// the number of codeword modules of all 40 versions together
+#define NUM_CODEWORD_MODULE_POSITIONS 441561
+
 extern size_t getSymbolSizeInNumModules(unsigned int version);
-extern void placeModules(uint8_t *matrix, size_t size, unsigned int version,
-                         const uint8_t *codewords);
+extern bool preloadVersionLayouts(void);
+extern const uint16_t *getCodewordModulePositions(unsigned int version,
+                                                  size_t *numPositions);
+extern void placeFunctionPatterns(ModuleMatrix *matrix, size_t size,
+                                  unsigned int version);
+extern void placeCodewordModules(ModuleMatrix *matrix, size_t size,
+                                 const uint8_t *codewords);
+extern void placeModules(ModuleMatrix *matrix, size_t size,
+                         unsigned int version, const uint8_t *codewords);
 
 #endif /* MODULEPLACEMENT_H */
@@ -0,0 +1,820 @@
+/*
+ * Copyright 2025 Naoto Yoshida
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "penalty.h"
+#include <stdbool.h>
+#include <stdlib.h>
+
+#define N1 3
+#define N2 3
+#define N3 40
+#define N4 10
+
+#if defined(__GNUC__)
+#define popcount(word) ((unsigned int)__builtin_popcountll(word))
+#else
+static unsigned int popcount(uint64_t word) {
+    unsigned int count = 0;
+
+    for (; word; word &= word - 1) {
+        count++;
+    }
+
+    return count;
+}
+#endif
+
+static size_t getNumWords(size_t size) {
+    return (size + 63) / 64;
+}
+
+static uint64_t getValidBits(size_t size, size_t i) {
+    if (size >= 64 * (i + 1)) {
+        return ~(uint64_t)0;
+    }
+
+    return ((uint64_t)1 << (size - 64 * i)) - 1;
+}
+
+// bit x of the word is module x + 64 * i + k of the row
+static uint64_t getWordShiftedRight(const uint64_t *row, size_t numWords,
+                                    size_t i, unsigned int k) {
+    uint64_t word = row[i] >> k;
+
+    if (k > 0 && i + 1 < numWords) {
+        word |= row[i + 1] << (64 - k);
+    }
+
+    return word;
+}
+
+// bit x of the word is module x + 64 * i - 1 of the row
+static uint64_t getWordShiftedLeft(const uint64_t *row, size_t i) {
+    uint64_t word = row[i] << 1;
+
+    if (i > 0) {
+        word |= row[i - 1] >> 63;
+    }
+
+    return word;
+}
+
+static void getLightRow(uint64_t *light, const uint64_t *dark,
+                        const uint64_t *blank, size_t size) {
+    for (size_t i = 0; i < getNumWords(size); i++) {
+        light[i] = ~dark[i] & ~blank[i] & getValidBits(size, i);
+    }
+}
+
+// bit x of each word is set if modules x to x + length - 1 are all set
+static void getWindows(uint64_t *windows, const uint64_t *row, size_t numWords,
+                       unsigned int length) {
+    for (size_t i = 0; i < numWords; i++) {
+        windows[i] = row[i];
+
+        for (unsigned int k = 1; k < length; k++) {
+            windows[i] &= getWordShiftedRight(row, numWords, i, k);
+        }
+    }
+}
+
+// terms at every position, for the full scans
+static const uint64_t allSpans[MODULE_MATRIX_ROW_WORDS] = {
+    ~(uint64_t)0, ~(uint64_t)0, ~(uint64_t)0};
+
+// A run of length five or more scores N1 + (length - 5). The run covers
+// length - 4 windows of five modules, one of which starts the run, so the
+// score is the number of windows plus N1 - 1 for each window that starts a run.
+// Only windows starting in the spans are counted.
+static unsigned int calculateRunPenaltyScore(const uint64_t *row,
+                                             const uint64_t *spans,
+                                             size_t numWords) {
+    unsigned int penaltyScore = 0;
+    uint64_t windows[MODULE_MATRIX_ROW_WORDS];
+
+    getWindows(windows, row, numWords, 5);
+
+    for (size_t i = 0; i < numWords; i++) {
+        uint64_t spanWindows = windows[i] & spans[i];
+
+        penaltyScore +=
+            popcount(spanWindows) +
+            (N1 - 1) * popcount(spanWindows & ~getWordShiftedLeft(row, i));
+    }
+
+    return penaltyScore;
+}
+
+static unsigned int calculateLinePenaltyScoreCondition1(const uint64_t *dark,
+                                                        const uint64_t *light,
+                                                        const uint64_t *spans,
+                                                        size_t numWords) {
+    return calculateRunPenaltyScore(dark, spans, numWords) +
+           calculateRunPenaltyScore(light, spans, numWords);
+}
+
+// The finder-like pattern is the core 1:1:3:1:1 (dark, light, three dark,
+// light, dark) with four light modules before or after it.
+static unsigned int calculateLinePenaltyScoreCondition3(const uint64_t *dark,
+                                                        const uint64_t *light,
+                                                        const uint64_t *spans,
+                                                        size_t numWords) {
+    uint64_t lightWindows[MODULE_MATRIX_ROW_WORDS];
+    uint64_t darkWindows[MODULE_MATRIX_ROW_WORDS];
+    uint64_t cores[MODULE_MATRIX_ROW_WORDS];
+    unsigned int numPatterns = 0;
+
+    getWindows(lightWindows, light, numWords, 4);
+    getWindows(darkWindows, dark, numWords, 3);
+
+    for (size_t i = 0; i < numWords; i++) {
+        cores[i] = dark[i] & getWordShiftedRight(light, numWords, i, 1) &
+                   getWordShiftedRight(darkWindows, numWords, i, 2) &
+                   getWordShiftedRight(light, numWords, i, 5) &
+                   getWordShiftedRight(dark, numWords, i, 6);
+    }
+
+    for (size_t i = 0; i < numWords; i++) {
+        uint64_t before =
+            lightWindows[i] & getWordShiftedRight(cores, numWords, i, 4);
+        uint64_t after =
+            cores[i] & getWordShiftedRight(lightWindows, numWords, i, 7);
+
+        numPatterns += popcount(before & spans[i]) + popcount(after & spans[i]);
+    }
+
+    return N3 * numPatterns;
+}
+
+// counts the 2 x 2 blocks starting in the spans, given the columns of two rows
+// that are of the same color
+static unsigned int countBlocks(const uint64_t *pairs, const uint64_t *spans,
+                                size_t numWords) {
+    unsigned int numBlocks = 0;
+
+    for (size_t i = 0; i < numWords; i++) {
+        numBlocks += popcount(pairs[i] & spans[i] &
+                              getWordShiftedRight(pairs, numWords, i, 1));
+    }
+
+    return numBlocks;
+}
+
+// counts the 2 x 2 blocks of dark and light modules across two rows
+static unsigned int countColorBlocks(const uint64_t *upperDark,
+                                     const uint64_t *upperLight,
+                                     const uint64_t *lowerDark,
+                                     const uint64_t *lowerLight,
+                                     const uint64_t *spans, size_t numWords) {
+    uint64_t pairs[2][MODULE_MATRIX_ROW_WORDS];
+
+    for (size_t i = 0; i < numWords; i++) {
+        pairs[0][i] = upperDark[i] & lowerDark[i];
+        pairs[1][i] = upperLight[i] & lowerLight[i];
+    }
+
+    return countBlocks(pairs[0], spans, numWords) +
+           countBlocks(pairs[1], spans, numWords);
+}
+
+// counts the 2 x 2 blocks of blank modules across rows y and y + 1
+static unsigned int countBlankBlocks(const ModuleMatrix *matrix, size_t y,
+                                     size_t numWords) {
+    uint64_t pairs[MODULE_MATRIX_ROW_WORDS];
+
+    for (size_t i = 0; i < numWords; i++) {
+        pairs[i] = matrix->blank[y][i] & matrix->blank[y + 1][i];
+    }
+
+    return countBlocks(pairs, allSpans, numWords);
+}
+
+/**
+ * Calculates the penalty score for evaluation condition 1 from the packed
+ * rows of the masked matrix and of its transpose.
+ *
+ * @param masked The masked matrix
+ * @param transposed The transpose of the masked matrix
+ * @param size The size of the symbol in number of modules
+ * @return The penalty score for evaluation condition 1
+ */
+unsigned int
+calculatePackedPenaltyScoreCondition1(const ModuleMatrix *masked,
+                                      const ModuleMatrix *transposed,
+                                      size_t size) {
+    size_t numWords = getNumWords(size);
+    unsigned int penaltyScore = 0;
+
+    for (size_t y = 0; y < size; y++) {
+        uint64_t light[MODULE_MATRIX_ROW_WORDS];
+
+        getLightRow(light, masked->dark[y], masked->blank[y], size);
+        penaltyScore += calculateLinePenaltyScoreCondition1(
+            masked->dark[y], light, allSpans, numWords);
+        getLightRow(light, transposed->dark[y], transposed->blank[y], size);
+        penaltyScore += calculateLinePenaltyScoreCondition1(
+            transposed->dark[y], light, allSpans, numWords);
+    }
+
+    return penaltyScore;
+}
+
+/**
+ * Calculates the penalty score for evaluation condition 2 from the packed
+ * rows of the masked matrix.
+ *
+ * @param masked The masked matrix
+ * @param size The size of the symbol in number of modules
+ * @return The penalty score for evaluation condition 2
+ */
+unsigned int
+calculatePackedPenaltyScoreCondition2(const ModuleMatrix *masked, size_t size) {
+    size_t numWords = getNumWords(size);
+    unsigned int numBlocks = 0;
+    uint64_t light[2][MODULE_MATRIX_ROW_WORDS];
+
+    getLightRow(light[0], masked->dark[0], masked->blank[0], size);
+
+    for (size_t y = 0; y < size - 1; y++) {
+        getLightRow(light[(y + 1) % 2], masked->dark[y + 1],
+                    masked->blank[y + 1], size);
+
+        numBlocks += countColorBlocks(masked->dark[y], light[y % 2],
+                                      masked->dark[y + 1], light[(y + 1) % 2],
+                                      allSpans, numWords) +
+                     countBlankBlocks(masked, y, numWords);
+    }
+
+    return N2 * numBlocks;
+}
+
+/**
+ * Calculates the penalty score for evaluation condition 3 from the packed
+ * rows of the masked matrix and of its transpose.
+ *
+ * @param masked The masked matrix
+ * @param transposed The transpose of the masked matrix
+ * @param size The size of the symbol in number of modules
+ * @return The penalty score for evaluation condition 3
+ */
+unsigned int
+calculatePackedPenaltyScoreCondition3(const ModuleMatrix *masked,
+                                      const ModuleMatrix *transposed,
+                                      size_t size) {
+    size_t numWords = getNumWords(size);
+    unsigned int penaltyScore = 0;
+
+    for (size_t y = 0; y < size; y++) {
+        uint64_t light[MODULE_MATRIX_ROW_WORDS];
+
+        getLightRow(light, masked->dark[y], masked->blank[y], size);
+        penaltyScore += calculateLinePenaltyScoreCondition3(
+            masked->dark[y], light, allSpans, numWords);
+        getLightRow(light, transposed->dark[y], transposed->blank[y], size);
+        penaltyScore += calculateLinePenaltyScoreCondition3(
+            transposed->dark[y], light, allSpans, numWords);
+    }
+
+    return penaltyScore;
+}
+
+static unsigned int calculateDarkPenaltyScore(int numDarkModules,
+                                              size_t size) {
+    int numTotalModules = size * size;
+
+    return abs(numDarkModules * 2 - numTotalModules) * 10 / numTotalModules *
+           N4;
+}
+
+/**
+ * Calculates the penalty score for evaluation condition 4 from the packed
+ * rows of the masked matrix.
+ *
+ * @param masked The masked matrix
+ * @param size The size of the symbol in number of modules
+ * @return The penalty score for evaluation condition 4
+ */
+unsigned int
+calculatePackedPenaltyScoreCondition4(const ModuleMatrix *masked, size_t size) {
+    int numDarkModules = 0;
+
+    for (size_t y = 0; y < size; y++) {
+        for (size_t i = 0; i < getNumWords(size); i++) {
+            numDarkModules += popcount(masked->dark[y][i]);
+        }
+    }
+
+    return calculateDarkPenaltyScore(numDarkModules, size);
+}
+
+/**
+ * Calculates the total penalty score of the masked matrix. The columns are
+ * scored as the rows of the transposed dark and blank planes.
+ *
+ * @param masked The masked matrix
+ * @param size The size of the symbol in number of modules
+ * @return The penalty score
+ */
+unsigned int calculatePackedPenaltyScore(const ModuleMatrix *masked,
+                                         size_t size) {
+    ModuleMatrix transposed;
+
+    transposeModulePlane(transposed.dark, masked->dark, size);
+    transposeModulePlane(transposed.blank, masked->blank, size);
+
+    return calculatePackedPenaltyScoreCondition1(masked, &transposed, size) +
+           calculatePackedPenaltyScoreCondition2(masked, size) +
+           calculatePackedPenaltyScoreCondition3(masked, &transposed, size) +
+           calculatePackedPenaltyScoreCondition4(masked, size);
+}
+
+// Every term of a line covers at most the modules x - 1 to x + 10 around the
+// position x it is counted at (a run start looks one module back, and a
+// finder-like pattern spans eleven modules), so a term depends on the mask
+// only if one of those modules is a data module.
+static void getSpans(uint64_t *spans, const uint64_t *function, size_t size) {
+    size_t numWords = getNumWords(size);
+    uint64_t data[MODULE_MATRIX_ROW_WORDS];
+
+    for (size_t i = 0; i < numWords; i++) {
+        data[i] = ~function[i] & getValidBits(size, i);
+    }
+
+    for (size_t i = 0; i < MODULE_MATRIX_ROW_WORDS; i++) {
+        spans[i] = 0;
+    }
+
+    for (size_t i = 0; i < numWords; i++) {
+        spans[i] = getWordShiftedLeft(data, i);
+
+        for (unsigned int k = 0; k <= 10; k++) {
+            spans[i] |= getWordShiftedRight(data, numWords, i, k);
+        }
+    }
+}
+
+static bool hasSpans(const uint64_t *spans, size_t numWords) {
+    for (size_t i = 0; i < numWords; i++) {
+        if (spans[i]) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Initializes the penalty baseline of the function patterns of a version from
+ * an unmasked matrix of that version. The function patterns are the same in
+ * every symbol of a version and are not masked, so every term of the penalty
+ * score that lies entirely within them is scored once here. The spans mark the
+ * positions of the remaining terms, which are scored for each mask pattern.
+ *
+ * @param baseline The baseline
+ * @param unmasked An unmasked matrix of the version
+ * @param size The size of the symbol in number of modules
+ */
+void initializePenaltyBaseline(PenaltyBaseline *baseline,
+                               const ModuleMatrix *unmasked, size_t size) {
+    size_t numWords = getNumWords(size);
+    ModuleMatrix transposed;
+    unsigned int numBlocks = 0;
+
+    transposeModulePlane(transposed.dark, unmasked->dark, size);
+    transposeModulePlane(transposed.function, unmasked->function, size);
+    transposeModulePlane(transposed.blank, unmasked->blank, size);
+
+    baseline->penaltyScore = 0;
+    baseline->numDarkModules = 0;
+
+    for (size_t y = 0; y < size; y++) {
+        getSpans(baseline->rowSpans[y], unmasked->function[y], size);
+        getSpans(baseline->columnSpans[y], transposed.function[y], size);
+    }
+
+    for (size_t y = 0; y < size; y++) {
+        uint64_t rowLight[MODULE_MATRIX_ROW_WORDS];
+        uint64_t columnLight[MODULE_MATRIX_ROW_WORDS];
+        uint64_t rowFixed[MODULE_MATRIX_ROW_WORDS];
+        uint64_t columnFixed[MODULE_MATRIX_ROW_WORDS];
+
+        getLightRow(rowLight, unmasked->dark[y], unmasked->blank[y], size);
+        getLightRow(columnLight, transposed.dark[y], transposed.blank[y],
+                    size);
+
+        for (size_t i = 0; i < numWords; i++) {
+            rowFixed[i] = ~baseline->rowSpans[y][i];
+            columnFixed[i] = ~baseline->columnSpans[y][i];
+            baseline->numDarkModules +=
+                popcount(unmasked->dark[y][i] & unmasked->function[y][i]);
+        }
+
+        baseline->penaltyScore +=
+            calculateLinePenaltyScoreCondition1(unmasked->dark[y], rowLight,
+                                                rowFixed, numWords) +
+            calculateLinePenaltyScoreCondition1(
+                transposed.dark[y], columnLight, columnFixed, numWords) +
+            calculateLinePenaltyScoreCondition3(unmasked->dark[y], rowLight,
+                                                rowFixed, numWords) +
+            calculateLinePenaltyScoreCondition3(
+                transposed.dark[y], columnLight, columnFixed, numWords);
+
+        if (y + 1 < size) {
+            uint64_t lowerLight[MODULE_MATRIX_ROW_WORDS];
+
+            getLightRow(lowerLight, unmasked->dark[y + 1],
+                        unmasked->blank[y + 1], size);
+
+            for (size_t i = 0; i < numWords; i++) {
+                rowFixed[i] = ~(baseline->rowSpans[y][i] |
+                                baseline->rowSpans[y + 1][i]);
+            }
+
+            numBlocks += countColorBlocks(unmasked->dark[y], rowLight,
+                                          unmasked->dark[y + 1], lowerLight,
+                                          rowFixed, numWords) +
+                         countBlankBlocks(unmasked, y, numWords);
+        }
+    }
+
+    baseline->penaltyScore += N2 * numBlocks;
+}
+
+// masks line y of a plane with the pattern words for that line, and gets the
+// light modules from the modules that are neither blank nor outside the symbol
+static void getMaskedLine(uint64_t *dark, uint64_t *light,
+                          const uint64_t *unmaskedDark,
+                          const uint64_t *function, const uint64_t *open,
+                          const uint64_t *pattern, size_t y, size_t numWords) {
+    const uint64_t *words =
+        pattern + MODULE_MATRIX_ROW_WORDS * (y % MASK_PATTERN_PERIOD);
+
+    for (size_t i = 0; i < numWords; i++) {
+        dark[i] = unmaskedDark[i] ^ (words[i] & ~function[i]);
+        light[i] = ~dark[i] & open[i];
+    }
+}
+
+/**
+ * Calculates the penalty scores of several data mask patterns in a single pass
+ * over the unmasked matrix, without writing any masked matrix. Each row and
+ * each column is masked once per pattern and scored for all four conditions
+ * while it is at hand; condition 2 keeps the previous masked row per pattern.
+ * Only the terms in the spans of the baseline are scored, and the score of the
+ * function patterns is added from the baseline.
+ *
+ * The patterns are given as MASK_PATTERN_PERIOD lines of
+ * MODULE_MATRIX_ROW_WORDS words, cut to the size of the symbol. Line y % 12 of
+ * rowPatterns[p] masks row y, and line x % 12 of columnPatterns[p] masks
+ * column x, with bit y of the column set if module (y, x) is masked.
+ *
+ * @param penaltyScores The penalty score of each pattern
+ * @param unmasked The unmasked matrix
+ * @param baseline The penalty baseline of the version
+ * @param rowPatterns The row lines of each pattern
+ * @param columnPatterns The column lines of each pattern
+ * @param numPatterns The number of patterns, at most 8
+ * @param size The size of the symbol in number of modules
+ */
+void calculatePackedPenaltyScores(
+    unsigned int *penaltyScores, const ModuleMatrix *unmasked,
+    const PenaltyBaseline *baseline,
+    const uint64_t (*rowPatterns)[NUM_MASK_PATTERN_WORDS],
+    const uint64_t (*columnPatterns)[NUM_MASK_PATTERN_WORDS],
+    size_t numPatterns, size_t size) {
+    size_t numWords = getNumWords(size);
+    ModuleMatrix transposed;
+    uint64_t dark[2][8][MODULE_MATRIX_ROW_WORDS];
+    uint64_t light[2][8][MODULE_MATRIX_ROW_WORDS];
+    int numDarkModules[8] = {0};
+    unsigned int numBlocks[8] = {0};
+
+    transposeModulePlane(transposed.dark, unmasked->dark, size);
+    transposeModulePlane(transposed.function, unmasked->function, size);
+    transposeModulePlane(transposed.blank, unmasked->blank, size);
+
+    for (size_t p = 0; p < numPatterns; p++) {
+        penaltyScores[p] = baseline->penaltyScore;
+    }
+
+    for (size_t y = 0; y < size; y++) {
+        const uint64_t *rowSpans = baseline->rowSpans[y];
+        const uint64_t *columnSpans = baseline->columnSpans[y];
+        bool hasRowSpans = hasSpans(rowSpans, numWords);
+        bool hasColumnSpans = hasSpans(columnSpans, numWords);
+        uint64_t pairSpans[MODULE_MATRIX_ROW_WORDS];
+        uint64_t rowOpen[MODULE_MATRIX_ROW_WORDS];
+        uint64_t columnOpen[MODULE_MATRIX_ROW_WORDS];
+
+        for (size_t i = 0; i < numWords; i++) {
+            rowOpen[i] = ~unmasked->blank[y][i] & getValidBits(size, i);
+            columnOpen[i] = ~transposed.blank[y][i] & getValidBits(size, i);
+            pairSpans[i] =
+                y > 0 ? baseline->rowSpans[y - 1][i] | rowSpans[i] : 0;
+        }
+
+        for (size_t p = 0; p < numPatterns; p++) {
+            uint64_t *row = dark[y % 2][p];
+            uint64_t *rowLight = light[y % 2][p];
+
+            getMaskedLine(row, rowLight, unmasked->dark[y],
+                          unmasked->function[y], rowOpen, rowPatterns[p], y,
+                          numWords);
+
+            if (hasRowSpans) {
+                penaltyScores[p] +=
+                    calculateLinePenaltyScoreCondition1(row, rowLight,
+                                                        rowSpans, numWords) +
+                    calculateLinePenaltyScoreCondition3(row, rowLight,
+                                                        rowSpans, numWords);
+
+                for (size_t i = 0; i < numWords; i++) {
+                    numDarkModules[p] +=
+                        popcount(row[i] & ~unmasked->function[y][i]);
+                }
+            }
+
+            if (hasColumnSpans) {
+                uint64_t column[MODULE_MATRIX_ROW_WORDS];
+                uint64_t columnLight[MODULE_MATRIX_ROW_WORDS];
+
+                getMaskedLine(column, columnLight, transposed.dark[y],
+                              transposed.function[y], columnOpen,
+                              columnPatterns[p], y, numWords);
+
+                penaltyScores[p] +=
+                    calculateLinePenaltyScoreCondition1(
+                        column, columnLight, columnSpans, numWords) +
+                    calculateLinePenaltyScoreCondition3(
+                        column, columnLight, columnSpans, numWords);
+            }
+
+            if (y > 0) {
+                numBlocks[p] += countColorBlocks(
+                    dark[(y + 1) % 2][p], light[(y + 1) % 2][p], row,
+                    rowLight, pairSpans, numWords);
+            }
+        }
+    }
+
+    for (size_t p = 0; p < numPatterns; p++) {
+        penaltyScores[p] +=
+            N2 * numBlocks[p] +
+            calculateDarkPenaltyScore(
+                baseline->numDarkModules + numDarkModules[p], size);
+    }
+}
+
+/**
+ * Estimates the penalty scores of several data mask patterns from every step-th
+ * row and column. Conditions 1 and 3 are scored on the sampled lines,
+ * condition 2 on the row pairs starting at the sampled rows, and the sum is
+ * scaled by step; condition 4 is counted exactly. A step that shares no factor
+ * with 12 samples every row and column phase of the patterns. The estimates
+ * only rank the patterns and are not penalty scores.
+ *
+ * The patterns are given as for calculatePackedPenaltyScores.
+ *
+ * @param estimates The estimated penalty score of each pattern
+ * @param unmasked The unmasked matrix
+ * @param rowPatterns The row lines of each pattern
+ * @param columnPatterns The column lines of each pattern
+ * @param numPatterns The number of patterns, at most 8
+ * @param size The size of the symbol in number of modules
+ * @param step The distance between sampled lines
+ */
+void estimatePackedPenaltyScores(
+    unsigned int *estimates, const ModuleMatrix *unmasked,
+    const uint64_t (*rowPatterns)[NUM_MASK_PATTERN_WORDS],
+    const uint64_t (*columnPatterns)[NUM_MASK_PATTERN_WORDS],
+    size_t numPatterns, size_t size, size_t step) {
+    size_t numWords = getNumWords(size);
+    ModuleMatrix transposed;
+    int numDarkModules[8] = {0};
+
+    transposeModulePlane(transposed.dark, unmasked->dark, size);
+    transposeModulePlane(transposed.function, unmasked->function, size);
+    transposeModulePlane(transposed.blank, unmasked->blank, size);
+
+    for (size_t p = 0; p < numPatterns; p++) {
+        estimates[p] = 0;
+    }
+
+    for (size_t y = 0; y < size; y += step) {
+        uint64_t rowOpen[2][MODULE_MATRIX_ROW_WORDS];
+        uint64_t columnOpen[MODULE_MATRIX_ROW_WORDS];
+        size_t numRows = y + 1 < size ? 2 : 1;
+
+        for (size_t i = 0; i < numWords; i++) {
+            rowOpen[0][i] = ~unmasked->blank[y][i] & getValidBits(size, i);
+            rowOpen[1][i] = ~unmasked->blank[y + numRows - 1][i] &
+                            getValidBits(size, i);
+            columnOpen[i] = ~transposed.blank[y][i] & getValidBits(size, i);
+        }
+
+        for (size_t p = 0; p < numPatterns; p++) {
+            uint64_t dark[2][MODULE_MATRIX_ROW_WORDS];
+            uint64_t light[2][MODULE_MATRIX_ROW_WORDS];
+            uint64_t column[MODULE_MATRIX_ROW_WORDS];
+            uint64_t columnLight[MODULE_MATRIX_ROW_WORDS];
+
+            for (size_t j = 0; j < numRows; j++) {
+                getMaskedLine(dark[j], light[j], unmasked->dark[y + j],
+                              unmasked->function[y + j], rowOpen[j],
+                              rowPatterns[p], y + j, numWords);
+            }
+
+            getMaskedLine(column, columnLight, transposed.dark[y],
+                          transposed.function[y], columnOpen,
+                          columnPatterns[p], y, numWords);
+
+            estimates[p] +=
+                calculateLinePenaltyScoreCondition1(dark[0], light[0],
+                                                    allSpans, numWords) +
+                calculateLinePenaltyScoreCondition1(column, columnLight,
+                                                    allSpans, numWords) +
+                calculateLinePenaltyScoreCondition3(dark[0], light[0],
+                                                    allSpans, numWords) +
+                calculateLinePenaltyScoreCondition3(column, columnLight,
+                                                    allSpans, numWords);
+
+            if (numRows == 2) {
+                estimates[p] +=
+                    N2 * countColorBlocks(dark[0], light[0], dark[1], light[1],
+                                          allSpans, numWords);
+            }
+        }
+    }
+
+    for (size_t y = 0; y < size; y++) {
+        for (size_t p = 0; p < numPatterns; p++) {
+            const uint64_t *words =
+                rowPatterns[p] +
+                MODULE_MATRIX_ROW_WORDS * (y % MASK_PATTERN_PERIOD);
+
+            for (size_t i = 0; i < numWords; i++) {
+                numDarkModules[p] +=
+                    popcount(unmasked->dark[y][i] ^
+                             (words[i] & ~unmasked->function[y][i]));
+            }
+        }
+    }
+
+    for (size_t p = 0; p < numPatterns; p++) {
+        estimates[p] = estimates[p] * step +
+                       calculateDarkPenaltyScore(numDarkModules[p], size);
+    }
+}
+
+static unsigned int calculateLinePenaltyScore(const uint64_t *dark,
+                                              const uint64_t *blank,
+                                              size_t size) {
+    size_t numWords = getNumWords(size);
+    uint64_t light[MODULE_MATRIX_ROW_WORDS];
+
+    getLightRow(light, dark, blank, size);
+
+    return calculateLinePenaltyScoreCondition1(dark, light, allSpans,
+                                               numWords) +
+           calculateLinePenaltyScoreCondition3(dark, light, allSpans, numWords);
+}
+
+// the score of condition 2 for the blocks across rows y and y + 1
+static unsigned int calculatePairPenaltyScore(const ModuleMatrix *masked,
+                                              size_t y, size_t size) {
+    size_t numWords = getNumWords(size);
+    uint64_t upperLight[MODULE_MATRIX_ROW_WORDS];
+    uint64_t lowerLight[MODULE_MATRIX_ROW_WORDS];
+
+    getLightRow(upperLight, masked->dark[y], masked->blank[y], size);
+    getLightRow(lowerLight, masked->dark[y + 1], masked->blank[y + 1], size);
+
+    return N2 * (countColorBlocks(masked->dark[y], upperLight,
+                                  masked->dark[y + 1], lowerLight, allSpans,
+                                  numWords) +
+                 countBlankBlocks(masked, y, numWords));
+}
+
+static int countRowDarkModules(const ModuleMatrix *masked, size_t y,
+                               size_t size) {
+    int numDarkModules = 0;
+
+    for (size_t i = 0; i < getNumWords(size); i++) {
+        numDarkModules += popcount(masked->dark[y][i]);
+    }
+
+    return numDarkModules;
+}
+
+/**
+ * Initializes the incremental penalty state of a masked matrix, scoring every
+ * row, column and pair of rows.
+ *
+ * @param state The state
+ * @param masked The masked matrix
+ * @param size The size of the symbol in number of modules
+ */
+void initializePenaltyState(PenaltyState *state, const ModuleMatrix *masked,
+                            size_t size) {
+    state->size = size;
+
+    transposeModulePlane(state->transposedDark, masked->dark, size);
+    transposeModulePlane(state->transposedBlank, masked->blank, size);
+
+    for (size_t y = 0; y < size; y++) {
+        state->rowPenaltyScores[y] =
+            calculateLinePenaltyScore(masked->dark[y], masked->blank[y], size);
+        state->columnPenaltyScores[y] = calculateLinePenaltyScore(
+            state->transposedDark[y], state->transposedBlank[y], size);
+        state->pairPenaltyScores[y] =
+            y + 1 < size ? calculatePairPenaltyScore(masked, y, size) : 0;
+        state->rowDarkModules[y] = countRowDarkModules(masked, y, size);
+    }
+}
+
+/**
+ * Updates the incremental penalty state after modules of the masked matrix
+ * have changed. Only the rows and columns through the changed modules and the
+ * pairs of rows around them are scored again.
+ *
+ * @param state The state
+ * @param masked The masked matrix, with the changes applied
+ * @param changes The changed modules
+ * @param numChanges The number of changed modules
+ */
+void updatePenaltyState(PenaltyState *state, const ModuleMatrix *masked,
+                        const ModulePosition *changes, size_t numChanges) {
+    size_t size = state->size;
+    bool changedRows[MODULE_MATRIX_MAX_SIZE] = {false};
+    bool changedColumns[MODULE_MATRIX_MAX_SIZE] = {false};
+
+    for (size_t j = 0; j < numChanges; j++) {
+        size_t y = changes[j].y;
+        size_t x = changes[j].x;
+
+        setMatrixBit(state->transposedDark, x, y,
+                     getMatrixBit(masked->dark, y, x));
+        setMatrixBit(state->transposedBlank, x, y,
+                     getMatrixBit(masked->blank, y, x));
+        changedRows[y] = true;
+        changedColumns[x] = true;
+    }
+
+    for (size_t y = 0; y < size; y++) {
+        if (changedRows[y]) {
+            state->rowPenaltyScores[y] = calculateLinePenaltyScore(
+                masked->dark[y], masked->blank[y], size);
+            state->rowDarkModules[y] = countRowDarkModules(masked, y, size);
+        }
+
+        if (changedColumns[y]) {
+            state->columnPenaltyScores[y] = calculateLinePenaltyScore(
+                state->transposedDark[y], state->transposedBlank[y], size);
+        }
+
+        if (y + 1 < size && (changedRows[y] || changedRows[y + 1])) {
+            state->pairPenaltyScores[y] =
+                calculatePairPenaltyScore(masked, y, size);
+        }
+    }
+}
+
+/**
+ * Returns the total penalty score held by the incremental penalty state.
+ *
+ * @param state The state
+ * @return The penalty score
+ */
+unsigned int getPenaltyStateScore(const PenaltyState *state) {
+    unsigned int penaltyScore = 0;
+    int numDarkModules = 0;
+
+    for (size_t y = 0; y < state->size; y++) {
+        penaltyScore += state->rowPenaltyScores[y] +
+                        state->columnPenaltyScores[y] +
+                        state->pairPenaltyScores[y];
+        numDarkModules += state->rowDarkModules[y];
+    }
+
+    return penaltyScore +
+           calculateDarkPenaltyScore(numDarkModules, state->size);
+}
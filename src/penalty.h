@@ -0,0 +1,91 @@
+/*
+ * Copyright 2025 Naoto Yoshida
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef PENALTY_H
+#define PENALTY_H
+
+#include "module.h"
+#include <stddef.h>
+#include <stdint.h>
+
+// All eight data mask patterns repeat every 12 rows and every 12 columns
+#define MASK_PATTERN_PERIOD 12
+#define NUM_MASK_PATTERN_WORDS (MASK_PATTERN_PERIOD * MODULE_MATRIX_ROW_WORDS)
+
+// The part of the penalty score that lies within the function patterns of a
+// version, and the positions of the terms of each row and column that do not
+typedef struct PenaltyBaseline {
+    unsigned int penaltyScore;
+    int numDarkModules;
+    uint64_t rowSpans[MODULE_MATRIX_MAX_SIZE][MODULE_MATRIX_ROW_WORDS];
+    uint64_t columnSpans[MODULE_MATRIX_MAX_SIZE][MODULE_MATRIX_ROW_WORDS];
+} PenaltyBaseline;
+
+// The penalty score of a masked matrix, kept per row, column and pair of rows
+// so that it can be updated after a few modules change. The transposed planes
+// follow the matrix for scoring the columns.
+typedef struct PenaltyState {
+    size_t size;
+    unsigned int rowPenaltyScores[MODULE_MATRIX_MAX_SIZE];
+    unsigned int columnPenaltyScores[MODULE_MATRIX_MAX_SIZE];
+    unsigned int pairPenaltyScores[MODULE_MATRIX_MAX_SIZE];
+    int rowDarkModules[MODULE_MATRIX_MAX_SIZE];
+    uint64_t transposedDark[MODULE_MATRIX_MAX_SIZE][MODULE_MATRIX_ROW_WORDS];
+    uint64_t transposedBlank[MODULE_MATRIX_MAX_SIZE][MODULE_MATRIX_ROW_WORDS];
+} PenaltyState;
+
+extern unsigned int
+calculatePackedPenaltyScoreCondition1(const ModuleMatrix *masked,
+                                      const ModuleMatrix *transposed,
+                                      size_t size);
+extern unsigned int
+calculatePackedPenaltyScoreCondition2(const ModuleMatrix *masked, size_t size);
+extern unsigned int
+calculatePackedPenaltyScoreCondition3(const ModuleMatrix *masked,
+                                      const ModuleMatrix *transposed,
+                                      size_t size);
+extern unsigned int
+calculatePackedPenaltyScoreCondition4(const ModuleMatrix *masked, size_t size);
+extern unsigned int calculatePackedPenaltyScore(const ModuleMatrix *masked,
+                                                size_t size);
+extern void initializePenaltyBaseline(PenaltyBaseline *baseline,
+                                      const ModuleMatrix *unmasked,
+                                      size_t size);
+extern void calculatePackedPenaltyScores(
+    unsigned int *penaltyScores, const ModuleMatrix *unmasked,
+    const PenaltyBaseline *baseline,
+    const uint64_t (*rowPatterns)[NUM_MASK_PATTERN_WORDS],
+    const uint64_t (*columnPatterns)[NUM_MASK_PATTERN_WORDS],
+    size_t numPatterns, size_t size);
+extern void estimatePackedPenaltyScores(
+    unsigned int *estimates, const ModuleMatrix *unmasked,
+    const uint64_t (*rowPatterns)[NUM_MASK_PATTERN_WORDS],
+    const uint64_t (*columnPatterns)[NUM_MASK_PATTERN_WORDS],
+    size_t numPatterns, size_t size, size_t step);
+extern void initializePenaltyState(PenaltyState *state,
+                                   const ModuleMatrix *masked, size_t size);
+extern void updatePenaltyState(PenaltyState *state, const ModuleMatrix *masked,
+                               const ModulePosition *changes,
+                               size_t numChanges);
+extern unsigned int getPenaltyStateScore(const PenaltyState *state);
+
+#endif /* PENALTY_H */
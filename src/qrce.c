@@ -0,0 +1,253 @@
+/*
+ * Copyright 2025 Naoto Yoshida
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "qrce.h"
+#include "charset.h"
+#include "dataanalysis.h"
+#include "dataencoding.h"
+#include "datamasking.h"
+#include "errorcorrection.h"
+#include "finalmessage.h"
+#include "formatandversion.h"
+#include "moduleplacement.h"
+#include "rsblock.h"
+
+/**
+ * Initialize the options with the defaults of the command line tool.
+ *
+ * @param options The options
+ */
+void qrce_initializeOptions(QRCEOptions *options) {
+    options->ecLevel = ERROR_CORRECTION_LEVEL_L;
+    options->version = -1;
+    options->useKanjiMode = false;
+    options->useOptimization = false;
+    options->numMaskThreads = 1;
+    options->useMaskEstimation = false;
+    options->useOptimalSegmentation = false;
+}
+
+/**
+ * Build the per-version tables of all 40 versions now instead of on first use
+ * of each version, for long-running callers that want even latencies. Optional
+ * and thread-safe.
+ *
+ * @return true if the tables are built; otherwise they are built on first use
+ *         or the encoder falls back to building each symbol from scratch
+ */
+bool qrce_preloadTables(void) {
+    return preloadVersionLayouts();
+}
+
+/**
+ * Encode the data into a QR code symbol. The symbol refers to the workspace and
+ * is valid until the workspace is used again. Reentrant as long as concurrent
+ * calls use different workspaces.
+ *
+ * @param symbol The encoded symbol
+ * @param workspace The workspace
+ * @param data The data
+ * @param length The length of the data
+ * @param options The options
+ * @return QRCE_SUCCESS, or the reason the data could not be encoded
+ */
+QRCEStatus qrce_encode(QRCESymbol *symbol, QRCEWorkspace *workspace,
+                       const uint8_t *data, size_t length,
+                       const QRCEOptions *options) {
+    if (length > QRCE_MAX_DATA_LENGTH) {
+        return QRCE_ERROR_INPUT_TOO_LONG;
+    }
+
+    if (options->useOptimization && !options->useOptimalSegmentation) {
+        analyzeCharacters(workspace->classes, workspace->runs, data, length,
+                          options->useKanjiMode);
+    } else {
+        classifyCharacters(workspace->classes, data, length);
+    }
+
+    VersionClass firstClass;
+    VersionClass lastClass;
+    size_t minNumBits = getMinNumBitsFromClasses(workspace->classes, length,
+                                                 options->useKanjiMode);
+
+    if (!selectVersionClasses(&firstClass, &lastClass, minNumBits, length,
+                              options->ecLevel)) {
+        return QRCE_ERROR_INPUT_TOO_LONG;
+    }
+
+    VersionClass versionClass;
+
+    // a requested version of a larger class needs that class segmented too;
+    // one of a smaller class cannot fit, which the checks below report once
+    // the data is known to fit some version
+    if (options->version != -1 &&
+        getVersionClass(options->version) > lastClass) {
+        lastClass = getVersionClass(options->version);
+    }
+
+    SegmentList segments[NUM_VERSION_CLASSES];
+    size_t numBits[NUM_VERSION_CLASSES];
+    int recommendedVersion = -1;
+
+    for (size_t c = 0; c < NUM_VERSION_CLASSES; c++) {
+        initializeSegmentList(&segments[c], workspace->segments[c],
+                              QRCE_MAX_DATA_LENGTH);
+    }
+
+    // segment the data for all selected version classes in one pass; a bit
+    // stream longer than a single byte mode segment, which only the Annex J
+    // segmentation could produce, takes a second pass for the rest
+    for (;;) {
+        bool added;
+
+        if (options->useOptimization && options->useOptimalSegmentation) {
+            added = createOptimalSegmentsByClass(
+                segments, numBits, workspace->trace, workspace->classes,
+                length, options->useKanjiMode, firstClass, lastClass);
+
+        } else if (options->useOptimization) {
+            added = createMixedModeSegmentsByClass(
+                segments, numBits, workspace->classes, workspace->runs, length,
+                options->useKanjiMode, firstClass, lastClass);
+
+        } else {
+            added = createModeSegmentFromClasses(&segments[firstClass],
+                                                 workspace->classes, length,
+                                                 options->useKanjiMode);
+
+            for (size_t c = firstClass; c <= lastClass; c++) {
+                segments[c] = segments[firstClass];
+                numBits[c] = getNumBitsSegments(&segments[c], c);
+            }
+        }
+
+        if (!added) {
+            return QRCE_ERROR_OUT_OF_MEMORY;
+        }
+
+        for (versionClass = firstClass; versionClass <= lastClass;
+             versionClass++) {
+
+            recommendedVersion = recommendVersionForNumBits(
+                numBits[versionClass], options->ecLevel, versionClass);
+
+            if (recommendedVersion != -1) {
+                break;
+            }
+        }
+
+        if (recommendedVersion != -1 || lastClass == VERSION_CLASS_LARGE) {
+            break;
+        }
+
+        firstClass = lastClass + 1;
+        lastClass = VERSION_CLASS_LARGE;
+    }
+
+    if (recommendedVersion == -1) {
+        return QRCE_ERROR_INPUT_TOO_LONG;
+    }
+
+    unsigned int version = recommendedVersion;
+
+    if (options->version != -1) {
+        if (options->version < recommendedVersion) {
+            return QRCE_ERROR_INPUT_TOO_LONG_FOR_VERSION;
+        }
+
+        // the character count indicators take the widths of the class of the
+        // requested version, which may be a larger one
+        version = options->version;
+        versionClass = getVersionClass(version);
+
+        int smallestVersion = recommendVersionForNumBits(
+            numBits[versionClass], options->ecLevel, versionClass);
+
+        if (smallestVersion == -1 || smallestVersion > options->version) {
+            return QRCE_ERROR_INPUT_TOO_LONG_FOR_VERSION;
+        }
+    }
+
+    RSBlock rsBlock = getRSBlock(version, options->ecLevel);
+
+    size_t numDataCodewords = rsBlock.numBlocks1 * rsBlock.numDataCodewords1 +
+                              rsBlock.numBlocks2 * rsBlock.numDataCodewords2;
+    size_t numECCodewords =
+        (rsBlock.numBlocks1 + rsBlock.numBlocks2) * rsBlock.numECCodewords;
+
+    uint8_t *dataCodewords = workspace->codewords;
+    uint8_t *ecCodewords = dataCodewords + numDataCodewords;
+    uint8_t *finalMessage = ecCodewords + numECCodewords;
+
+    size_t symbolSize = getSymbolSizeInNumModules(version);
+
+    encodeDataCodewords(dataCodewords, numDataCodewords, data,
+                        &segments[versionClass], versionClass);
+    encodeErrorCorrectionCodewords(ecCodewords, dataCodewords, rsBlock);
+    constructFinalMessage(finalMessage, dataCodewords, ecCodewords, rsBlock);
+    placeModules(&workspace->unmasked, symbolSize, version, finalMessage);
+
+    unsigned int dataMaskPattern =
+        options->useMaskEstimation
+            ? applyDataMaskPatternEstimatedLowestPenaltyScore(
+                  &workspace->masked, &workspace->unmasked, symbolSize)
+            : applyDataMaskPatternLowestPenaltyScoreInParallel(
+                  &workspace->masked, &workspace->unmasked, symbolSize,
+                  options->numMaskThreads);
+
+    placeFormatInformation(&workspace->masked, symbolSize, options->ecLevel,
+                           dataMaskPattern);
+    placeVersionInformation(&workspace->masked, symbolSize, version);
+    unpackModuleMatrix(workspace->modules, &workspace->masked, symbolSize);
+
+    symbol->version = version;
+    symbol->size = symbolSize;
+    symbol->dataMaskPattern = dataMaskPattern;
+    symbol->modules = workspace->modules;
+
+    return QRCE_SUCCESS;
+}
+
+/**
+ * Get the message describing the status.
+ *
+ * @param status The status
+ * @return The message
+ */
+const char *qrce_getStatusMessage(QRCEStatus status) {
+    switch (status) {
+    case QRCE_SUCCESS:
+        return "Success";
+
+    case QRCE_ERROR_INPUT_TOO_LONG:
+        return "Input is too long";
+
+    case QRCE_ERROR_INPUT_TOO_LONG_FOR_VERSION:
+        return "Input is too long for the version";
+
+    case QRCE_ERROR_OUT_OF_MEMORY:
+        return "Out of memory";
+
+    default:
+        return "Unknown error";
+    }
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright 2025 Naoto Yoshida
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QRCE_H
+#define QRCE_H
+
+#include "module.h"
+#include "segment.h"
+#include "typedefs.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define QRCE_MAX_DATA_LENGTH 7089
+#define QRCE_MAX_NUM_CODEWORDS 3706
+#define QRCE_MAX_SYMBOL_SIZE 177
+
+typedef enum {
+    QRCE_SUCCESS = 0,
+    QRCE_ERROR_INPUT_TOO_LONG = 1,
+    QRCE_ERROR_INPUT_TOO_LONG_FOR_VERSION = 2,
+    QRCE_ERROR_OUT_OF_MEMORY = 3
+} QRCEStatus;
+
+typedef struct QRCEOptions {
+    ErrorCorrectionLevel ecLevel;
+    int version; // -1 selects the smallest version that can contain the data
+    bool useKanjiMode;
+    bool useOptimization;
+    unsigned int numMaskThreads; // 0 or 1 scores the mask patterns serially
+    bool useMaskEstimation;      // may pick a mask that is not the best one
+    bool useOptimalSegmentation; // with useOptimization, the shortest segments
+} QRCEOptions;
+
+// Caller-owned scratch memory for one encoding at a time. Sized for version 40
+// so that it can be reused for any input without reallocation.
+typedef struct QRCEWorkspace {
+    Segment segments[NUM_VERSION_CLASSES][QRCE_MAX_DATA_LENGTH];
+    uint8_t classes[QRCE_MAX_DATA_LENGTH];
+    uint16_t runs[QRCE_MAX_DATA_LENGTH];
+    uint8_t trace[NUM_VERSION_CLASSES * (QRCE_MAX_DATA_LENGTH + 1)];
+    uint8_t codewords[2 * QRCE_MAX_NUM_CODEWORDS + 1];
+    ModuleMatrix unmasked;
+    ModuleMatrix masked;
+    uint8_t modules[QRCE_MAX_SYMBOL_SIZE * QRCE_MAX_SYMBOL_SIZE];
+} QRCEWorkspace;
+
+typedef struct QRCESymbol {
+    unsigned int version;
+    size_t size;
+    unsigned int dataMaskPattern;
+    const uint8_t *modules; // size * size modules, MODULE_LIGHT or MODULE_DARK
+} QRCESymbol;
+
+extern void qrce_initializeOptions(QRCEOptions *options);
+extern bool qrce_preloadTables(void);
+extern QRCEStatus qrce_encode(QRCESymbol *symbol, QRCEWorkspace *workspace,
+                              const uint8_t *data, size_t length,
+                              const QRCEOptions *options);
+extern const char *qrce_getStatusMessage(QRCEStatus status);
+
+#endif /* QRCE_H */
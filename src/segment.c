@@ -23,44 +23,54 @@
 #include "segment.h"
 #include <stdlib.h>
 
-Segment *newSegment(Mode mode, size_t length) {
+void initializeSegmentList(SegmentList *list, Segment *segments,
+                           size_t capacity) {
+    list->segments = segments;
+    list->numSegments = 0;
+    list->capacity = segments != NULL ? (uint32_t)capacity : 0;
+    list->ownsSegments = segments == NULL;
+}
+
+bool addSegment(SegmentList *list, Mode mode, size_t length) {
     if (length == 0) {
-        return NULL;
+        return true;
     }
 
-    Segment *segment = (Segment *)malloc(sizeof(Segment));
-
-    if (segment == NULL) {
-        return NULL;
+    if (length > UINT32_MAX) {
+        return false;
     }
 
-    segment->mode = mode;
-    segment->length = length;
-    segment->next = NULL;
-
-    return segment;
-}
+    if (list->numSegments == list->capacity) {
+        if (!list->ownsSegments || list->capacity > UINT32_MAX / 2) {
+            return false;
+        }
 
-Segment *addSegment(Segment *segments, Segment *segment) {
-    if (segments == NULL) {
-        return segment;
-    }
+        uint32_t capacity = list->capacity != 0 ? list->capacity * 2 : 8;
+        Segment *segments =
+            (Segment *)realloc(list->segments, sizeof(Segment) * capacity);
 
-    Segment *p = segments;
+        if (segments == NULL) {
+            return false;
+        }
 
-    while (p->next != NULL) {
-        p = p->next;
+        list->segments = segments;
+        list->capacity = capacity;
     }
 
-    p->next = segment;
+    Segment *segment = &list->segments[list->numSegments++];
 
-    return segments;
+    segment->mode = mode;
+    segment->length = (uint32_t)length;
+
+    return true;
 }
 
-void freeSegments(Segment *segments) {
-    while (segments != NULL) {
-        Segment *next = segments->next;
-        free(segments);
-        segments = next;
+void freeSegmentList(SegmentList *list) {
+    if (list->ownsSegments) {
+        free(list->segments);
     }
+
+    list->segments = NULL;
+    list->numSegments = 0;
+    list->capacity = 0;
 }
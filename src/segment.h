@@ -24,18 +24,28 @@
 #define SEGMENT_H
 
 #include "typedefs.h"
+#include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
-typedef struct Segment Segment;
-
-struct Segment {
+typedef struct Segment {
     Mode mode;
-    size_t length;
-    struct Segment *next;
-};
+    uint32_t length;
+} Segment;
+
+// Segments in order in one array. Caller-owned storage has a fixed capacity;
+// a list initialized without storage grows on the heap and is released with
+// freeSegmentList.
+typedef struct SegmentList {
+    Segment *segments;
+    uint32_t numSegments;
+    uint32_t capacity;
+    bool ownsSegments;
+} SegmentList;
 
-extern Segment *newSegment(Mode mode, size_t length);
-extern Segment *addSegment(Segment *segments, Segment *segment);
-extern void freeSegments(Segment *segments);
+extern void initializeSegmentList(SegmentList *list, Segment *segments,
+                                  size_t capacity);
+extern bool addSegment(SegmentList *list, Mode mode, size_t length);
+extern void freeSegmentList(SegmentList *list);
 
 #endif /* SEGMENT_H */
@@ -0,0 +1,79 @@
+/*
+ * Copyright 2025 Naoto Yoshida
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef TABLES_H
+#define TABLES_H
+
+#include <stdint.h>
+
+// Everything about a symbol of one version and error correction level. The
+// second group of blocks, if any, holds one more data codeword per block.
+typedef struct SymbolDescriptor {
+    uint16_t numDataCodewords;
+    uint16_t numCodewords; // data and error correction codewords
+    uint16_t capacities[4]; // numeric, alphanumeric, byte and kanji characters
+    uint8_t size;
+    uint8_t numRemainderBits;
+    uint8_t numBlocks1;
+    uint8_t numDataCodewords1;
+    uint8_t numBlocks2;
+    uint8_t numECCodewords; // per block
+} SymbolDescriptor;
+
+// The tables below are generated by tools/gentables.c at build time.
+
+// indexed by version - 1 and error correction level
+extern const SymbolDescriptor symbolDescriptors[40][4];
+
+// {number of coordinates, coordinates 1, coordinates 2, ...} per version - 1
+extern const uint8_t alignmentPatternCoordinates[40][8];
+
+// indexed by version class and {numeric, alphanumeric, byte, kanji}
+extern const uint8_t numBitsCharCountIndicators[3][4];
+
+// 15-bit format information, masked, per error correction level and data mask
+// pattern
+extern const uint16_t formatInformationWords[4][8];
+
+// 18-bit version information per version; 0 below version 7
+extern const uint32_t versionInformationWords[41];
+
+// powers of the primitive element 2 under GF(2^8), and their logarithms
+extern const uint8_t gf256ExpTable[256];
+extern const uint8_t gf256LogTable[256];
+
+// per degree, the offset of the generator polynomial into
+// gf256GeneratorPolynomials and of its rows of 256 products into
+// gf256MultiplicationTables; -1 for the degrees no RS block uses
+extern const int16_t gf256GeneratorPolynomialOffsets[31];
+
+// the generator polynomials in alpha notation, stored in reverse order
+extern const uint8_t gf256GeneratorPolynomials[];
+
+// products of every element with the coefficients of each generator polynomial
+extern const uint8_t gf256MultiplicationTables[];
+
+// products of every element with the low nibbles 0x00-0x0F followed by the
+// high nibbles 0x00-0xF0, so that c * x = table[x & 0xF] ^ table[16 + (x >> 4)]
+extern const uint8_t gf256NibbleTables[256][32];
+
+#endif /* TABLES_H */
@@ -43,4 +43,6 @@ typedef enum {
     VERSION_CLASS_LARGE = 2
 } VersionClass;
 
+#define NUM_VERSION_CLASSES 3
+
 #endif /* TYPEDEFS_H */
@@ -0,0 +1,133 @@
+#include "batch.h"
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+static size_t runBatch(const char *input, size_t inputLength,
+                       RecordDelimiter delimiter, unsigned int numThreads,
+                       char *output, size_t outputCapacity,
+                       BatchStatistics *stats) {
+    FILE *in = tmpfile();
+    FILE *out = tmpfile();
+    QRCEOptions options;
+
+    qrce_initializeOptions(&options);
+
+    fwrite(input, 1, inputLength, in);
+    rewind(in);
+
+    assert(encodeBatch(in, out, delimiter, &options, numThreads, stats) ==
+           BATCH_SUCCESS);
+
+    rewind(out);
+    size_t outputLength = fread(output, 1, outputCapacity, out);
+
+    fclose(in);
+    fclose(out);
+
+    return outputLength;
+}
+
+static void test_encodeBatch_Delimiters(void) {
+    static char expected[4096];
+    static char output[4096];
+    BatchStatistics stats;
+
+    size_t expectedLength = runBatch("HELLO\n12345\r\nhello", 18,
+                                     RECORD_DELIMITER_LINE_FEED, 1, expected,
+                                     sizeof(expected), &stats);
+
+    assert(stats.numRecords == 3);
+    assert(stats.numFailedRecords == 0);
+    assert(expectedLength == 3 * (2 + 21 * 21 + 1));
+    assert(memcmp(expected, "1 ", 2) == 0);
+
+    size_t outputLength =
+        runBatch("HELLO\00012345\000hello\000", 18, RECORD_DELIMITER_NUL, 1,
+                 output, sizeof(output), &stats);
+
+    assert(stats.numRecords == 3);
+    assert(outputLength == expectedLength);
+    assert(memcmp(output, expected, expectedLength) == 0);
+
+    outputLength = runBatch("\0\0\0\5HELLO\0\0\0\00512345\0\0\0\5hello", 27,
+                            RECORD_DELIMITER_LENGTH_PREFIX, 1, output,
+                            sizeof(output), &stats);
+
+    assert(stats.numRecords == 3);
+    assert(outputLength == expectedLength);
+    assert(memcmp(output, expected, expectedLength) == 0);
+
+    printf("test_encodeBatch_Delimiters() passed\n");
+}
+
+static void test_encodeBatch_FailedRecord(void) {
+    static char input[8000];
+    static char output[4096];
+    BatchStatistics stats;
+
+    // the second record is longer than any symbol can hold
+    memset(input, '1', sizeof(input));
+    input[0] = '\n';
+    input[sizeof(input) - 2] = '\n';
+
+    size_t outputLength = runBatch(input, sizeof(input),
+                                   RECORD_DELIMITER_LINE_FEED, 1, output,
+                                   sizeof(output), &stats);
+
+    assert(stats.numRecords == 3);
+    assert(stats.numFailedRecords == 1);
+    assert(outputLength == 2 * (2 + 21 * 21 + 1) + 1);
+    assert(output[2 + 21 * 21 + 1] == '\n');
+
+    printf("test_encodeBatch_FailedRecord() passed\n");
+}
+
+static void test_encodeBatch_Threads(void) {
+    static char input[40000];
+    static char expected[400000];
+    static char output[400000];
+    BatchStatistics stats;
+    size_t inputLength = 0;
+
+    // small and large symbols interleaved, with a failure in between
+    for (size_t i = 0; i < 100; i++) {
+        size_t length = i % 10 == 0 ? 1500 : i % 7;
+
+        if (i == 55) {
+            length = 8000;
+        }
+
+        memset(input + inputLength, 'A' + i % 26, length);
+        inputLength += length;
+        input[inputLength++] = '\n';
+    }
+
+    size_t expectedLength =
+        runBatch(input, inputLength, RECORD_DELIMITER_LINE_FEED, 1, expected,
+                 sizeof(expected), &stats);
+
+    assert(stats.numRecords == 100);
+    assert(stats.numFailedRecords == 1);
+
+    for (unsigned int numThreads = 2; numThreads <= 8; numThreads *= 2) {
+        size_t outputLength =
+            runBatch(input, inputLength, RECORD_DELIMITER_LINE_FEED,
+                     numThreads, output, sizeof(output), &stats);
+
+        assert(stats.numRecords == 100);
+        assert(stats.numFailedRecords == 1);
+        assert(outputLength == expectedLength);
+        assert(memcmp(output, expected, expectedLength) == 0);
+    }
+
+    printf("test_encodeBatch_Threads() passed\n");
+}
+
+int main(void) {
+    test_encodeBatch_Delimiters();
+    test_encodeBatch_FailedRecord();
+    test_encodeBatch_Threads();
+
+    return 0;
+}
@@ -1,6 +1,8 @@
 #include "../src/charset.h"
 #include <assert.h>
+#include <stdbool.h>
 #include <stdio.h>
+#include <stdlib.h>
 
 static void test_getAlphanumericCode(void) {
     assert(getAlphanumericCode('0') == 0);
@@ -116,11 +118,60 @@ static void test_isShiftJISKanji(void) {
     printf("test_isShiftJISKanji() passed\n");
 }
 
+static void test_classifyCharacters(void) {
+    uint8_t data[1000];
+    uint8_t classes[1000];
+
+    srand(1);
+
+    for (size_t length = 0; length <= sizeof(data); length += 37) {
+        for (size_t i = 0; i < length; i++) {
+            // mostly Shift_JIS lead and trail bytes, so that pairs occur
+            data[i] = rand() % 2 ? rand() : 0x40 + rand() % 0xC0;
+        }
+
+        classifyCharacters(classes, data, length);
+
+        for (size_t i = 0; i < length; i++) {
+            bool kanji =
+                i + 1 < length && isShiftJISKanji(data[i], data[i + 1]);
+
+            assert(!(classes[i] & CHAR_CLASS_NUMERIC) == !isNumeric(data[i]));
+            assert(!(classes[i] & CHAR_CLASS_ALPHANUMERIC) ==
+                   !isAlphanumeric(data[i]));
+            assert(!(classes[i] & CHAR_CLASS_EXCLUSIVE_ALPHANUMERIC) ==
+                   !isExclusiveAlphanumericSubset(data[i]));
+            assert(!(classes[i] & CHAR_CLASS_EXCLUSIVE_8BIT_BYTE) ==
+                   !isExclusive8BitByteSubset(data[i]));
+            assert(!(classes[i] & CHAR_CLASS_KANJI) == !kanji);
+        }
+    }
+
+    // every byte value, in both positions of a pair
+    for (unsigned int b = 0; b < 256; b++) {
+        for (size_t i = 0; i < 40; i++) {
+            data[i] = i % 2 ? b : 0xEB - i / 4;
+        }
+
+        classifyCharacters(classes, data, 40);
+
+        for (size_t i = 0; i + 1 < 40; i++) {
+            assert(!(classes[i] & CHAR_CLASS_KANJI) ==
+                   !isShiftJISKanji(data[i], data[i + 1]));
+            assert(!(classes[i] & CHAR_CLASS_ALPHANUMERIC) ==
+                   !isAlphanumeric(data[i]));
+        }
+    }
+
+    printf("test_classifyCharacters() passed\n");
+}
+
 int main(void) {
     test_getAlphanumericCode();
     test_isNumeric();
     test_isAlphanumeric();
     test_isShiftJISKanji();
+    test_classifyCharacters();
 
     return 0;
 }
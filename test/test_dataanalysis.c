@@ -1,173 +1,221 @@
 #include "../src/dataanalysis.h"
+#include "../src/charset.h"
+#include "../src/dataencoding.h"
 #include <assert.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 #define SPACE "\x81\x40"
 
+// the segments of the last analysis, released by the next one
+static SegmentList segments;
+
+static const Segment *createMode(const uint8_t *data, size_t length,
+                                 bool useKanjiMode) {
+    freeSegmentList(&segments);
+    initializeSegmentList(&segments, NULL, 0);
+
+    bool added = createModeSegment(&segments, data, length, useKanjiMode);
+    assert(added);
+
+    return segments.segments;
+}
+
+static const Segment *createMixedMode(const uint8_t *data, size_t length,
+                                      bool useKanjiMode,
+                                      VersionClass versionClass) {
+    freeSegmentList(&segments);
+    initializeSegmentList(&segments, NULL, 0);
+
+    bool added = createMixedModeSegments(&segments, data, length,
+                                         useKanjiMode, versionClass);
+    assert(added);
+
+    return segments.segments;
+}
+
+static const Segment *createOptimal(const uint8_t *data, size_t length,
+                                    bool useKanjiMode,
+                                    VersionClass versionClass) {
+    freeSegmentList(&segments);
+    initializeSegmentList(&segments, NULL, 0);
+
+    bool added = createOptimalSegments(&segments, data, length, useKanjiMode,
+                                       versionClass);
+    assert(added);
+
+    return segments.segments;
+}
+
+static bool hasNextSegment(const Segment *segment) {
+    return segment + 1 < segments.segments + segments.numSegments;
+}
+
 static void test_createModeSegment(void) {
-    Segment *segment;
+    const Segment *segment;
 
-    segment = createModeSegment((const uint8_t *)"1", 1, true);
+    segment = createMode((const uint8_t *)"1", 1, true);
     assert(segment->mode == MODE_NUMERIC);
 
-    segment = createModeSegment((const uint8_t *)"A", 1, true);
+    segment = createMode((const uint8_t *)"A", 1, true);
     assert(segment->mode == MODE_ALPHANUMERIC);
 
-    segment = createModeSegment((const uint8_t *)"a", 1, true);
+    segment = createMode((const uint8_t *)"a", 1, true);
     assert(segment->mode == MODE_BYTE);
 
-    segment = createModeSegment((const uint8_t *)SPACE, 2, true);
+    segment = createMode((const uint8_t *)SPACE, 2, true);
     assert(segment->mode == MODE_KANJI);
 
-    segment = createModeSegment((const uint8_t *)SPACE, 2, false);
+    segment = createMode((const uint8_t *)SPACE, 2, false);
     assert(segment->mode == MODE_BYTE);
 
-    segment = createModeSegment((const uint8_t *)SPACE "\x81", 3, true);
+    segment = createMode((const uint8_t *)SPACE "\x81", 3, true);
     assert(segment->mode == MODE_BYTE);
 
-    segment = createModeSegment((const uint8_t *)SPACE SPACE, 4, true);
+    segment = createMode((const uint8_t *)SPACE SPACE, 4, true);
     assert(segment->mode == MODE_KANJI);
 
-    segment = createModeSegment((const uint8_t *)SPACE "3D", 4, true);
+    segment = createMode((const uint8_t *)SPACE "3D", 4, true);
     assert(segment->mode == MODE_BYTE);
 
-    segment = createModeSegment((const uint8_t *)"1B3D", 4, true);
+    segment = createMode((const uint8_t *)"1B3D", 4, true);
     assert(segment->mode == MODE_ALPHANUMERIC);
 
-    segment = createModeSegment((const uint8_t *)"1B3d", 4, true);
+    segment = createMode((const uint8_t *)"1B3d", 4, true);
     assert(segment->mode == MODE_BYTE);
 
     printf("test_createModeSegment() passed\n");
 }
 
 static void test_createMixedModeSegments_UseMixedMode(void) {
-    Segment *segment;
+    const Segment *segment;
     const uint8_t *data;
 
     data = (const uint8_t *)"123456G?";
-    segment = createMixedModeSegments(data, 8, false, VERSION_CLASS_SMALL);
+    segment = createMixedMode(data, 8, false, VERSION_CLASS_SMALL);
     assert(segment->mode == MODE_BYTE);
 
     data = (const uint8_t *)"123456G?9";
-    segment = createMixedModeSegments(data, 9, false, VERSION_CLASS_SMALL);
+    segment = createMixedMode(data, 9, false, VERSION_CLASS_SMALL);
     assert(segment->mode == MODE_ALPHANUMERIC);
 
     data = (const uint8_t *)SPACE "?" SPACE SPACE SPACE SPACE SPACE "?";
-    segment = createMixedModeSegments(data, 14, true, VERSION_CLASS_LARGE);
+    segment = createMixedMode(data, 14, true, VERSION_CLASS_LARGE);
     assert(segment->mode == MODE_BYTE);
 
     data = (const uint8_t *)SPACE "?" SPACE SPACE SPACE SPACE SPACE "??";
-    segment = createMixedModeSegments(data, 15, true, VERSION_CLASS_LARGE);
+    segment = createMixedMode(data, 15, true, VERSION_CLASS_LARGE);
     assert(segment->mode == MODE_KANJI);
 
     printf("test_createMixedModeSegments_UseMixedMode() passed\n");
 }
 
 static void test_selectInitialMode_Numeric(void) {
-    Segment *segment;
+    const Segment *segment;
     const uint8_t *data;
 
     data = (const uint8_t *)"1234?F789";
 
-    segment = createMixedModeSegments(data, 9, false, VERSION_CLASS_MEDIUM);
+    segment = createMixedMode(data, 9, false, VERSION_CLASS_MEDIUM);
     assert(segment->mode == MODE_NUMERIC);
 
-    segment = createMixedModeSegments(data, 9, false, VERSION_CLASS_LARGE);
+    segment = createMixedMode(data, 9, false, VERSION_CLASS_LARGE);
     assert(segment->mode == MODE_BYTE);
 
     data = (const uint8_t *)"1234567H9";
 
-    segment = createMixedModeSegments(data, 9, false, VERSION_CLASS_SMALL);
+    segment = createMixedMode(data, 9, false, VERSION_CLASS_SMALL);
     assert(segment->mode == MODE_NUMERIC);
 
-    segment = createMixedModeSegments(data, 9, false, VERSION_CLASS_MEDIUM);
+    segment = createMixedMode(data, 9, false, VERSION_CLASS_MEDIUM);
     assert(segment->mode == MODE_ALPHANUMERIC);
 
     printf("test_selectInitialMode_Numeric() passed\n");
 }
 
 static void test_selectInitialMode_Alphanumeric(void) {
-    Segment *segment;
+    const Segment *segment;
     const uint8_t *data;
 
     data = (const uint8_t *)"ABCDEF?HI";
 
-    segment = createMixedModeSegments(data, 9, false, VERSION_CLASS_SMALL);
+    segment = createMixedMode(data, 9, false, VERSION_CLASS_SMALL);
     assert(segment->mode == MODE_ALPHANUMERIC);
 
-    segment = createMixedModeSegments(data, 9, false, VERSION_CLASS_MEDIUM);
+    segment = createMixedMode(data, 9, false, VERSION_CLASS_MEDIUM);
     assert(segment->mode == MODE_BYTE);
 
     data = (const uint8_t *)"ABCDEFG?I";
 
-    segment = createMixedModeSegments(data, 9, false, VERSION_CLASS_MEDIUM);
+    segment = createMixedMode(data, 9, false, VERSION_CLASS_MEDIUM);
     assert(segment->mode == MODE_ALPHANUMERIC);
 
-    segment = createMixedModeSegments(data, 9, false, VERSION_CLASS_LARGE);
+    segment = createMixedMode(data, 9, false, VERSION_CLASS_LARGE);
     assert(segment->mode == MODE_BYTE);
 
     printf("test_selectInitialMode_Alphanumeric() passed\n");
 }
 
 static void test_selectInitialMode_Kanji(void) {
-    Segment *segment;
+    const Segment *segment;
     const uint8_t *data;
 
     data = (const uint8_t *)SPACE "3456789012345";
 
-    segment = createMixedModeSegments(data, 15, false, VERSION_CLASS_SMALL);
+    segment = createMixedMode(data, 15, false, VERSION_CLASS_SMALL);
     assert(segment->mode == MODE_BYTE);
 
-    segment = createMixedModeSegments(data, 15, true, VERSION_CLASS_SMALL);
+    segment = createMixedMode(data, 15, true, VERSION_CLASS_SMALL);
     assert(segment->mode == MODE_KANJI);
 
     data = (const uint8_t *)SPACE "?" SPACE SPACE SPACE SPACE SPACE "45";
 
-    segment = createMixedModeSegments(data, 15, true, VERSION_CLASS_MEDIUM);
+    segment = createMixedMode(data, 15, true, VERSION_CLASS_MEDIUM);
     assert(segment->mode == MODE_BYTE);
 
-    segment = createMixedModeSegments(data, 15, true, VERSION_CLASS_LARGE);
+    segment = createMixedMode(data, 15, true, VERSION_CLASS_LARGE);
     assert(segment->mode == MODE_KANJI);
 
     printf("test_selectInitialMode_Kanji() passed\n");
 }
 
 static void test_selectInitialMode_Byte(void) {
-    Segment *segment;
+    const Segment *segment;
     const uint8_t *data;
 
     data = (const uint8_t *)"?23456789";
 
-    segment = createMixedModeSegments(data, 9, false, VERSION_CLASS_SMALL);
+    segment = createMixedMode(data, 9, false, VERSION_CLASS_SMALL);
     assert(segment->mode == MODE_BYTE);
 
     printf("test_selectInitialMode_Byte() passed\n");
 }
 
 static void test_createMixedModeSegments_ByteToKanji(void) {
-    Segment *segment;
+    const Segment *segment;
     const uint8_t *data;
 
     data = (const uint8_t *)"?" SPACE SPACE SPACE SPACE SPACE SPACE SPACE SPACE
         SPACE SPACE SPACE SPACE;
 
-    segment = createMixedModeSegments(data, 25, true, VERSION_CLASS_MEDIUM);
+    segment = createMixedMode(data, 25, true, VERSION_CLASS_MEDIUM);
 
     assert(segment->mode == MODE_BYTE);
     assert(segment->length == 1);
-    assert(segment->next != NULL);
+    assert(hasNextSegment(segment));
 
-    segment = segment->next;
+    segment++;
 
     assert(segment->mode == MODE_KANJI);
     assert(segment->length == 24);
 
-    segment = createMixedModeSegments(data, 25, false, VERSION_CLASS_MEDIUM);
+    segment = createMixedMode(data, 25, false, VERSION_CLASS_MEDIUM);
 
     assert(segment->mode == MODE_BYTE);
     assert(segment->length == 25);
 
-    segment = createMixedModeSegments(data, 25, true, VERSION_CLASS_LARGE);
+    segment = createMixedMode(data, 25, true, VERSION_CLASS_LARGE);
 
     assert(segment->mode == MODE_BYTE);
     assert(segment->length == 25);
@@ -175,13 +223,13 @@ static void test_createMixedModeSegments_ByteToKanji(void) {
     data = (const uint8_t *)"?2" SPACE SPACE SPACE SPACE SPACE SPACE SPACE SPACE
         SPACE;
 
-    segment = createMixedModeSegments(data, 20, true, VERSION_CLASS_SMALL);
+    segment = createMixedMode(data, 20, true, VERSION_CLASS_SMALL);
 
     assert(segment->mode == MODE_BYTE);
     assert(segment->length == 2);
-    assert(segment->next != NULL);
+    assert(hasNextSegment(segment));
 
-    segment = segment->next;
+    segment++;
 
     assert(segment->mode == MODE_KANJI);
     assert(segment->length == 18);
@@ -189,13 +237,13 @@ static void test_createMixedModeSegments_ByteToKanji(void) {
     data = (const uint8_t *)"?BC" SPACE SPACE SPACE SPACE SPACE SPACE SPACE
         SPACE SPACE;
 
-    segment = createMixedModeSegments(data, 21, true, VERSION_CLASS_SMALL);
+    segment = createMixedMode(data, 21, true, VERSION_CLASS_SMALL);
 
     assert(segment->mode == MODE_BYTE);
     assert(segment->length == 3);
-    assert(segment->next != NULL);
+    assert(hasNextSegment(segment));
 
-    segment = segment->next;
+    segment++;
 
     assert(segment->mode == MODE_KANJI);
     assert(segment->length == 18);
@@ -204,46 +252,46 @@ static void test_createMixedModeSegments_ByteToKanji(void) {
 }
 
 static void test_createMixedModeSegments_ByteToAlphanumeric(void) {
-    Segment *segment;
+    const Segment *segment;
     const uint8_t *data;
 
     data = (const uint8_t *)"?BCDEFGHIJKLMNOP";
-    segment = createMixedModeSegments(data, 16, false, VERSION_CLASS_MEDIUM);
+    segment = createMixedMode(data, 16, false, VERSION_CLASS_MEDIUM);
 
     assert(segment->mode == MODE_BYTE);
     assert(segment->length == 1);
-    assert(segment->next != NULL);
+    assert(hasNextSegment(segment));
 
-    segment = segment->next;
+    segment++;
 
     assert(segment->mode == MODE_ALPHANUMERIC);
     assert(segment->length == 15);
 
-    segment = createMixedModeSegments(data, 16, false, VERSION_CLASS_LARGE);
+    segment = createMixedMode(data, 16, false, VERSION_CLASS_LARGE);
 
     assert(segment->mode == MODE_BYTE);
     assert(segment->length == 16);
 
     data = (const uint8_t *)"?2CDEFGHIJKLM";
-    segment = createMixedModeSegments(data, 13, false, VERSION_CLASS_SMALL);
+    segment = createMixedMode(data, 13, false, VERSION_CLASS_SMALL);
 
     assert(segment->mode == MODE_BYTE);
     assert(segment->length == 2);
-    assert(segment->next != NULL);
+    assert(hasNextSegment(segment));
 
-    segment = segment->next;
+    segment++;
 
     assert(segment->mode == MODE_ALPHANUMERIC);
     assert(segment->length == 11);
 
     data = (const uint8_t *)"?" SPACE "DEFGHIJKLMNO";
-    segment = createMixedModeSegments(data, 15, true, VERSION_CLASS_SMALL);
+    segment = createMixedMode(data, 15, true, VERSION_CLASS_SMALL);
 
     assert(segment->mode == MODE_BYTE);
     assert(segment->length == 3);
-    assert(segment->next != NULL);
+    assert(hasNextSegment(segment));
 
-    segment = segment->next;
+    segment++;
 
     assert(segment->mode == MODE_ALPHANUMERIC);
     assert(segment->length == 12);
@@ -252,70 +300,70 @@ static void test_createMixedModeSegments_ByteToAlphanumeric(void) {
 }
 
 static void test_createMixedModeSegments_ByteToNumeric(void) {
-    Segment *segment;
+    const Segment *segment;
     const uint8_t *data;
 
     data = (const uint8_t *)"?23456789";
-    segment = createMixedModeSegments(data, 9, false, VERSION_CLASS_MEDIUM);
+    segment = createMixedMode(data, 9, false, VERSION_CLASS_MEDIUM);
 
     assert(segment->mode == MODE_BYTE);
     assert(segment->length == 1);
-    assert(segment->next != NULL);
+    assert(hasNextSegment(segment));
 
-    segment = segment->next;
+    segment++;
 
     assert(segment->mode == MODE_NUMERIC);
     assert(segment->length == 8);
 
-    segment = createMixedModeSegments(data, 9, false, VERSION_CLASS_LARGE);
+    segment = createMixedMode(data, 9, false, VERSION_CLASS_LARGE);
 
     assert(segment->mode == MODE_BYTE);
     assert(segment->length == 1);
-    assert(segment->next != NULL);
+    assert(hasNextSegment(segment));
 
-    segment = segment->next;
+    segment++;
 
     assert(segment->mode == MODE_NUMERIC);
     assert(segment->length == 8);
 
     data = (const uint8_t *)"?23456789J";
-    segment = createMixedModeSegments(data, 10, false, VERSION_CLASS_LARGE);
+    segment = createMixedMode(data, 10, false, VERSION_CLASS_LARGE);
 
     assert(segment->mode == MODE_BYTE);
     assert(segment->length == 1);
-    assert(segment->next != NULL);
+    assert(hasNextSegment(segment));
 
-    segment = segment->next;
+    segment++;
 
     assert(segment->mode == MODE_NUMERIC);
     assert(segment->length == 8);
 
     data = (const uint8_t *)"?23456789?";
-    segment = createMixedModeSegments(data, 10, false, VERSION_CLASS_LARGE);
+    segment = createMixedMode(data, 10, false, VERSION_CLASS_LARGE);
 
     assert(segment->mode == MODE_BYTE);
     assert(segment->length == 10);
 
     data = (const uint8_t *)"?B3456789";
-    segment = createMixedModeSegments(data, 9, false, VERSION_CLASS_MEDIUM);
+    segment = createMixedMode(data, 9, false, VERSION_CLASS_MEDIUM);
 
     assert(segment->mode == MODE_BYTE);
     assert(segment->length == 2);
-    assert(segment->next != NULL);
+    assert(hasNextSegment(segment));
 
-    segment = segment->next;
+    segment++;
 
     assert(segment->mode == MODE_NUMERIC);
     assert(segment->length == 7);
 
     data = (const uint8_t *)"?" SPACE "456789JKLMNO";
-    segment = createMixedModeSegments(data, 15, true, VERSION_CLASS_SMALL);
+    segment = createMixedMode(data, 15, true, VERSION_CLASS_SMALL);
 
     assert(segment->mode == MODE_BYTE);
     assert(segment->length == 3);
-    assert(segment->next != NULL);
+    assert(hasNextSegment(segment));
 
-    segment = segment->next;
+    segment++;
 
     assert(segment->mode == MODE_NUMERIC);
     assert(segment->length == 6);
@@ -324,22 +372,22 @@ static void test_createMixedModeSegments_ByteToNumeric(void) {
 }
 
 static void test_createMixedModeSegments_AlphanumericToNumeric(void) {
-    Segment *segment;
+    const Segment *segment;
     const uint8_t *data;
 
     data = (const uint8_t *)"A2345678901234";
-    segment = createMixedModeSegments(data, 14, false, VERSION_CLASS_SMALL);
+    segment = createMixedMode(data, 14, false, VERSION_CLASS_SMALL);
 
     assert(segment->mode == MODE_ALPHANUMERIC);
     assert(segment->length == 1);
-    assert(segment->next != NULL);
+    assert(hasNextSegment(segment));
 
-    segment = segment->next;
+    segment++;
 
     assert(segment->mode == MODE_NUMERIC);
     assert(segment->length == 13);
 
-    segment = createMixedModeSegments(data, 14, false, VERSION_CLASS_MEDIUM);
+    segment = createMixedMode(data, 14, false, VERSION_CLASS_MEDIUM);
 
     assert(segment->mode == MODE_ALPHANUMERIC);
     assert(segment->length == 14);
@@ -348,12 +396,12 @@ static void test_createMixedModeSegments_AlphanumericToNumeric(void) {
 }
 
 static void test_createMixedModeSegments_ByteToByte(void) {
-    Segment *segment;
+    const Segment *segment;
     const uint8_t *data;
 
     data = (const uint8_t *)"?2C" SPACE "F7" SPACE "J?" SPACE "?5?";
 
-    segment = createMixedModeSegments(data, 16, true, VERSION_CLASS_SMALL);
+    segment = createMixedMode(data, 16, true, VERSION_CLASS_SMALL);
 
     assert(segment->mode == MODE_BYTE);
     assert(segment->length == 16);
@@ -362,11 +410,11 @@ static void test_createMixedModeSegments_ByteToByte(void) {
 }
 
 static void test_createMixedModeSegments_AlnumToAlnum(void) {
-    Segment *segment;
+    const Segment *segment;
     const uint8_t *data;
 
     data = (const uint8_t *)"A23D5678I";
-    segment = createMixedModeSegments(data, 9, false, VERSION_CLASS_SMALL);
+    segment = createMixedMode(data, 9, false, VERSION_CLASS_SMALL);
 
     assert(segment->mode == MODE_ALPHANUMERIC);
     assert(segment->length == 9);
@@ -375,60 +423,60 @@ static void test_createMixedModeSegments_AlnumToAlnum(void) {
 }
 
 static void test_createMixedModeSegments_ChangeMode(void) {
-    Segment *segment;
+    const Segment *segment;
     const uint8_t *data;
 
     data = (const uint8_t *)SPACE "3" SPACE "F" SPACE "?012345P?";
 
-    segment = createMixedModeSegments(data, 17, true, VERSION_CLASS_SMALL);
+    segment = createMixedMode(data, 17, true, VERSION_CLASS_SMALL);
 
     assert(segment->mode == MODE_KANJI);
     assert(segment->length == 2);
-    assert(segment->next != NULL);
+    assert(hasNextSegment(segment));
 
-    segment = segment->next;
+    segment++;
 
     assert(segment->mode == MODE_NUMERIC);
     assert(segment->length == 1);
-    assert(segment->next != NULL);
+    assert(hasNextSegment(segment));
 
-    segment = segment->next;
+    segment++;
 
     assert(segment->mode == MODE_KANJI);
     assert(segment->length == 2);
-    assert(segment->next != NULL);
+    assert(hasNextSegment(segment));
 
-    segment = segment->next;
+    segment++;
 
     assert(segment->mode == MODE_ALPHANUMERIC);
     assert(segment->length == 1);
-    assert(segment->next != NULL);
+    assert(hasNextSegment(segment));
 
-    segment = segment->next;
+    segment++;
 
     assert(segment->mode == MODE_KANJI);
     assert(segment->length == 2);
-    assert(segment->next != NULL);
+    assert(hasNextSegment(segment));
 
-    segment = segment->next;
+    segment++;
 
     assert(segment->mode == MODE_BYTE);
     assert(segment->length == 1);
-    assert(segment->next != NULL);
+    assert(hasNextSegment(segment));
 
-    segment = segment->next;
+    segment++;
 
     assert(segment->mode == MODE_NUMERIC);
     assert(segment->length == 6);
-    assert(segment->next != NULL);
+    assert(hasNextSegment(segment));
 
-    segment = segment->next;
+    segment++;
 
     assert(segment->mode == MODE_ALPHANUMERIC);
     assert(segment->length == 1);
-    assert(segment->next != NULL);
+    assert(hasNextSegment(segment));
 
-    segment = segment->next;
+    segment++;
 
     assert(segment->mode == MODE_BYTE);
     assert(segment->length == 1);
@@ -437,29 +485,29 @@ static void test_createMixedModeSegments_ChangeMode(void) {
 }
 
 static void test_createMixedModeSegments_Single(void) {
-    Segment *segment;
+    const Segment *segment;
     const uint8_t *data;
 
     data = (const uint8_t *)"?????????";
-    segment = createMixedModeSegments(data, 9, false, VERSION_CLASS_SMALL);
+    segment = createMixedMode(data, 9, false, VERSION_CLASS_SMALL);
 
     assert(segment->mode == MODE_BYTE);
     assert(segment->length == 9);
 
     data = (const uint8_t *)SPACE SPACE SPACE SPACE SPACE SPACE SPACE SPACE;
-    segment = createMixedModeSegments(data, 16, true, VERSION_CLASS_SMALL);
+    segment = createMixedMode(data, 16, true, VERSION_CLASS_SMALL);
 
     assert(segment->mode == MODE_KANJI);
     assert(segment->length == 16);
 
     data = (const uint8_t *)"ABCDEFGHI";
-    segment = createMixedModeSegments(data, 9, false, VERSION_CLASS_SMALL);
+    segment = createMixedMode(data, 9, false, VERSION_CLASS_SMALL);
 
     assert(segment->mode == MODE_ALPHANUMERIC);
     assert(segment->length == 9);
 
     data = (const uint8_t *)"123456789";
-    segment = createMixedModeSegments(data, 9, false, VERSION_CLASS_SMALL);
+    segment = createMixedMode(data, 9, false, VERSION_CLASS_SMALL);
 
     assert(segment->mode == MODE_NUMERIC);
     assert(segment->length == 9);
@@ -467,7 +515,169 @@ static void test_createMixedModeSegments_Single(void) {
     printf("test_createMixedModeSegments_Single() passed\n");
 }
 
+static void test_analyzeCharacters(void) {
+    const uint8_t *data = (const uint8_t *)"123AB" SPACE SPACE "ab\x81";
+    uint8_t classes[12];
+    uint16_t runs[12];
+
+    analyzeCharacters(classes, runs, data, 12, true);
+
+    const uint16_t expected[] = {3, 2, 1, 2, 1, 4, 1, 2, 4, 3, 2, 1};
+
+    for (size_t i = 0; i < 12; i++) {
+        assert(runs[i] == expected[i]);
+    }
+
+    analyzeCharacters(classes, runs, data, 12, false);
+
+    const uint16_t expectedBytes[] = {3, 2, 1, 2, 1, 7, 6, 5, 4, 3, 2, 1};
+
+    for (size_t i = 0; i < 12; i++) {
+        assert(runs[i] == expectedBytes[i]);
+    }
+
+    printf("test_analyzeCharacters() passed\n");
+}
+
+static void test_createOptimalSegments(void) {
+    const Segment *segment;
+    const uint8_t *data;
+
+    // Annex J keeps the whole data in byte mode
+    data = (const uint8_t *)"a050B5AB68A5";
+    segment = createOptimal(data, 12, false, VERSION_CLASS_SMALL);
+
+    assert(segment->mode == MODE_BYTE);
+    assert(segment->length == 1);
+    assert(hasNextSegment(segment));
+
+    segment++;
+
+    assert(segment->mode == MODE_ALPHANUMERIC);
+    assert(segment->length == 11);
+    assert(!hasNextSegment(segment));
+    assert(getNumBitsSegments(&segments, VERSION_CLASS_SMALL) == 94);
+
+    data = (const uint8_t *)"12" SPACE SPACE "123456789";
+    segment = createOptimal(data, 15, true, VERSION_CLASS_SMALL);
+
+    assert(segment->mode == MODE_NUMERIC);
+    assert(segment->length == 2);
+    assert(hasNextSegment(segment));
+
+    segment++;
+
+    assert(segment->mode == MODE_KANJI);
+    assert(segment->length == 4);
+    assert(hasNextSegment(segment));
+
+    segment++;
+
+    assert(segment->mode == MODE_NUMERIC);
+    assert(segment->length == 9);
+    assert(!hasNextSegment(segment));
+
+    segment = createOptimal(data, 0, true, VERSION_CLASS_SMALL);
+
+    assert(segments.numSegments == 0);
+
+    printf("test_createOptimalSegments() passed\n");
+}
+
+static void test_createOptimalSegments_NotLongerThanMixedMode(void) {
+    static const char chars[] = "0123456789ABC:a?\x81\x40\xE0";
+    uint8_t data[300];
+
+    srand(1);
+
+    for (unsigned int i = 0; i < 1000; i++) {
+        size_t length = rand() % sizeof(data);
+        bool useKanjiMode = rand() % 2;
+        VersionClass versionClass = rand() % 3;
+
+        for (size_t j = 0; j < length; j++) {
+            data[j] = chars[rand() % (sizeof(chars) - 1)];
+        }
+
+        createMixedMode(data, length, useKanjiMode, versionClass);
+        size_t numBits = getNumBitsSegments(&segments, versionClass);
+
+        createOptimal(data, length, useKanjiMode, versionClass);
+        assert(getNumBitsSegments(&segments, versionClass) <= numBits);
+    }
+
+    printf("test_createOptimalSegments_NotLongerThanMixedMode() passed\n");
+}
+
+static bool isSameSegmentList(const SegmentList *list) {
+    return list->numSegments == segments.numSegments &&
+           memcmp(list->segments, segments.segments,
+                  sizeof(Segment) * list->numSegments) == 0;
+}
+
+static void test_createSegmentsByClass(void) {
+    static const char chars[] = "0123456789ABC:a?\x81\x40\xE0";
+    static Segment storage[NUM_VERSION_CLASSES][300];
+    uint8_t data[300];
+    uint8_t classes[300];
+    uint16_t runs[300];
+    uint8_t trace[NUM_VERSION_CLASSES * (300 + 1)];
+
+    srand(2);
+
+    for (unsigned int i = 0; i < 1000; i++) {
+        size_t length = rand() % sizeof(data);
+        bool useKanjiMode = rand() % 2;
+        VersionClass firstClass = rand() % 3;
+        VersionClass lastClass = firstClass + rand() % (3 - firstClass);
+        SegmentList lists[NUM_VERSION_CLASSES];
+        size_t numBits[NUM_VERSION_CLASSES];
+
+        for (size_t j = 0; j < length; j++) {
+            data[j] = chars[rand() % (sizeof(chars) - 1)];
+        }
+
+        for (size_t c = 0; c < NUM_VERSION_CLASSES; c++) {
+            initializeSegmentList(&lists[c], storage[c], 300);
+        }
+
+        analyzeCharacters(classes, runs, data, length, useKanjiMode);
+        bool added = createMixedModeSegmentsByClass(
+            lists, numBits, classes, runs, length, useKanjiMode, firstClass,
+            lastClass);
+        assert(added);
+
+        for (VersionClass c = firstClass; c <= lastClass; c++) {
+            createMixedMode(data, length, useKanjiMode, c);
+            assert(isSameSegmentList(&lists[c]));
+            assert(numBits[c] == getNumBitsSegments(&segments, c));
+
+            lists[c].numSegments = 0;
+        }
+
+        classifyCharacters(classes, data, length);
+        added = createOptimalSegmentsByClass(lists, numBits, trace, classes,
+                                             length, useKanjiMode, firstClass,
+                                             lastClass);
+        assert(added);
+
+        size_t minNumBits =
+            getMinNumBitsFromClasses(classes, length, useKanjiMode);
+
+        for (VersionClass c = firstClass; c <= lastClass; c++) {
+            createOptimal(data, length, useKanjiMode, c);
+            assert(isSameSegmentList(&lists[c]));
+            assert(numBits[c] == getNumBitsSegments(&segments, c));
+            assert(numBits[c] >= minNumBits);
+        }
+    }
+
+    printf("test_createSegmentsByClass() passed\n");
+}
+
 int main(void) {
+    test_analyzeCharacters();
+
     test_createModeSegment();
 
     test_createMixedModeSegments_UseMixedMode();
@@ -489,5 +699,12 @@ int main(void) {
     test_createMixedModeSegments_ChangeMode();
     test_createMixedModeSegments_Single();
 
+    test_createOptimalSegments();
+    test_createOptimalSegments_NotLongerThanMixedMode();
+
+    test_createSegmentsByClass();
+
+    freeSegmentList(&segments);
+
     return 0;
 }
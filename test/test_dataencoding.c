@@ -1,17 +1,30 @@
+#include "../src/charset.h"
 #include "../src/dataencoding.h"
 #include "../src/segment.h"
 #include <assert.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #define SPACE "\x81\x40"
 
+// an empty list of up to four segments, reused by every test
+static SegmentList *newSegmentList(void) {
+    static Segment storage[4];
+    static SegmentList segments;
+
+    initializeSegmentList(&segments, storage, 4);
+
+    return &segments;
+}
+
 static void test_encodeDataCodewords_Numeric(void) {
     const uint8_t *data = (const uint8_t *)"01234567";
     size_t numDataCodewords = 16;
     uint8_t dataCodewords[16];
 
-    Segment *segments = newSegment(MODE_NUMERIC, 8);
+    SegmentList *segments = newSegmentList();
+    addSegment(segments, MODE_NUMERIC, 8);
 
     encodeDataCodewords(dataCodewords, numDataCodewords, data, segments,
                         VERSION_CLASS_SMALL);
@@ -29,7 +42,8 @@ static void test_encodeDataCodewords_Alphanumeric(void) {
     size_t numDataCodewords = 13;
     uint8_t dataCodewords[13];
 
-    Segment *segments = newSegment(MODE_ALPHANUMERIC, 11);
+    SegmentList *segments = newSegmentList();
+    addSegment(segments, MODE_ALPHANUMERIC, 11);
 
     encodeDataCodewords(dataCodewords, numDataCodewords, data, segments,
                         VERSION_CLASS_SMALL);
@@ -47,7 +61,8 @@ static void test_encodeDataCodewords_Byte(void) {
     size_t numDataCodewords = 16;
     uint8_t dataCodewords[16];
 
-    Segment *segments = newSegment(MODE_BYTE, 13);
+    SegmentList *segments = newSegmentList();
+    addSegment(segments, MODE_BYTE, 13);
 
     encodeDataCodewords(dataCodewords, numDataCodewords, data, segments,
                         VERSION_CLASS_SMALL);
@@ -65,7 +80,8 @@ static void test_encodeDataCodewords_Kanji(void) {
     size_t numDataCodewords = 9;
     uint8_t dataCodewords[9];
 
-    Segment *segments = newSegment(MODE_KANJI, 8);
+    SegmentList *segments = newSegmentList();
+    addSegment(segments, MODE_KANJI, 8);
 
     encodeDataCodewords(dataCodewords, numDataCodewords, data, segments,
                         VERSION_CLASS_SMALL);
@@ -83,11 +99,11 @@ static void test_encodeDataCodewords_Mixed(void) {
     size_t numDataCodewords = 16;
     uint8_t dataCodewords[16];
 
-    Segment *segments = NULL;
-    segments = addSegment(segments, newSegment(MODE_NUMERIC, 5));
-    segments = addSegment(segments, newSegment(MODE_ALPHANUMERIC, 4));
-    segments = addSegment(segments, newSegment(MODE_BYTE, 3));
-    segments = addSegment(segments, newSegment(MODE_KANJI, 2));
+    SegmentList *segments = newSegmentList();
+    addSegment(segments, MODE_NUMERIC, 5);
+    addSegment(segments, MODE_ALPHANUMERIC, 4);
+    addSegment(segments, MODE_BYTE, 3);
+    addSegment(segments, MODE_KANJI, 2);
 
     encodeDataCodewords(dataCodewords, numDataCodewords, data, segments,
                         VERSION_CLASS_SMALL);
@@ -100,12 +116,267 @@ static void test_encodeDataCodewords_Mixed(void) {
     printf("test_encodeDataCodewords_Mixed() passed\n");
 }
 
+static void test_encodeDataCodewords_AlignedByte(void) {
+    const uint8_t *data = (const uint8_t *)"1234AB";
+    size_t numDataCodewords = 9;
+    uint8_t dataCodewords[9];
+
+    // the byte data starts at bit 40 and is copied as it is
+    SegmentList *segments = newSegmentList();
+    addSegment(segments, MODE_NUMERIC, 4);
+    addSegment(segments, MODE_BYTE, 2);
+
+    encodeDataCodewords(dataCodewords, numDataCodewords, data, segments,
+                        VERSION_CLASS_SMALL);
+
+    const uint8_t expected[] = {0x10, 0x10, 0x7B, 0x44, 0x02,
+                                0x41, 0x42, 0x00, 0xEC};
+
+    assert(memcmp(dataCodewords, expected, numDataCodewords) == 0);
+
+    printf("test_encodeDataCodewords_AlignedByte() passed\n");
+}
+
+static void test_encodeDataCodewords_LongByte(void) {
+    static uint8_t data[2953];
+    static uint8_t dataCodewords[2956];
+    static uint8_t expected[2956] = {0};
+    size_t numDataCodewords = 2956;
+
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)(i * 37 + 11);
+    }
+
+    SegmentList *segments = newSegmentList();
+    addSegment(segments, MODE_BYTE, sizeof(data));
+
+    encodeDataCodewords(dataCodewords, numDataCodewords, data, segments,
+                        VERSION_CLASS_LARGE);
+
+    // mode indicator, 16-bit character count and the data shifted by 4 bits,
+    // then the terminator in the low bits of the last codeword
+    expected[0] = 0x40 | sizeof(data) >> 12;
+    expected[1] = (uint8_t)(sizeof(data) >> 4);
+    expected[2] = (uint8_t)(sizeof(data) << 4) | data[0] >> 4;
+
+    for (size_t i = 1; i < sizeof(data); i++) {
+        expected[2 + i] = (uint8_t)(data[i - 1] << 4) | data[i] >> 4;
+    }
+
+    expected[2 + sizeof(data)] = (uint8_t)(data[sizeof(data) - 1] << 4);
+
+    assert(memcmp(dataCodewords, expected, numDataCodewords) == 0);
+
+    printf("test_encodeDataCodewords_LongByte() passed\n");
+}
+
+// the bit-by-bit encoder that the packers must match
+static void putBits(uint8_t *array, size_t *index, unsigned int value,
+                    size_t numBits) {
+    for (size_t j = 1; j <= numBits; j++, (*index)++) {
+        unsigned int bit = value >> (numBits - j) & 1;
+        array[*index / 8] |= bit << (7 - *index % 8);
+    }
+}
+
+static void encodeSegmentBitwise(uint8_t *expected, size_t numCodewords,
+                                 const uint8_t *data, Mode mode,
+                                 size_t length) {
+    size_t index = 0;
+
+    memset(expected, 0, numCodewords);
+    putBits(expected, &index, mode, 4);
+
+    if (mode == MODE_NUMERIC) {
+        putBits(expected, &index, length, 14);
+
+        for (size_t i = 0; i < length; i += 3) {
+            size_t n = length - i < 3 ? length - i : 3;
+            unsigned int value = 0;
+
+            for (size_t j = 0; j < n; j++) {
+                value = value * 10 + (data[i + j] - '0');
+            }
+
+            putBits(expected, &index, value, n * 3 + 1);
+        }
+
+    } else if (mode == MODE_ALPHANUMERIC) {
+        putBits(expected, &index, length, 13);
+
+        for (size_t i = 0; i + 1 < length; i += 2) {
+            putBits(expected, &index,
+                    getAlphanumericCode(data[i]) * 45 +
+                        getAlphanumericCode(data[i + 1]),
+                    11);
+        }
+
+        if (length % 2 == 1) {
+            putBits(expected, &index, getAlphanumericCode(data[length - 1]),
+                    6);
+        }
+
+    } else {
+        putBits(expected, &index, length / 2, 12);
+
+        for (size_t i = 0; i < length; i += 2) {
+            unsigned int value = data[i] << 8 | data[i + 1];
+            value -= value >= 0xE040 ? 0xC140 : 0x8140;
+            putBits(expected, &index, (value >> 8) * 0xC0 + (value & 0xFF),
+                    13);
+        }
+    }
+
+    size_t numBits = numCodewords * 8 - index;
+    putBits(expected, &index, 0, numBits < 4 ? numBits : 4);
+    putBits(expected, &index, 0, (8 - index % 8) % 8);
+
+    for (size_t i = index / 8; i < numCodewords; i++) {
+        expected[i] = (i - index / 8) % 2 == 0 ? 0xEC : 0x11;
+    }
+}
+
+static void assertSegmentEncoding(const uint8_t *data, Mode mode,
+                                  size_t length) {
+    static uint8_t dataCodewords[2956];
+    static uint8_t expected[2956];
+    SegmentList *segments = newSegmentList();
+    addSegment(segments, mode, length);
+
+    encodeDataCodewords(dataCodewords, sizeof(dataCodewords), data, segments,
+                        VERSION_CLASS_LARGE);
+    encodeSegmentBitwise(expected, sizeof(expected), data, mode, length);
+
+    assert(memcmp(dataCodewords, expected, sizeof(expected)) == 0);
+}
+
+static void test_encodeDataCodewords_LongSegments(void) {
+    static const char alphanumeric[] =
+        "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ $%*+-./:";
+    static uint8_t data[7089];
+
+    srand(1);
+
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = '0' + rand() % 10;
+    }
+
+    for (size_t length = 1; length <= 64; length++) {
+        assertSegmentEncoding(data, MODE_NUMERIC, length);
+    }
+
+    assertSegmentEncoding(data, MODE_NUMERIC, 7089);
+
+    for (size_t i = 0; i < 4296; i++) {
+        data[i] = alphanumeric[rand() % 45];
+    }
+
+    for (size_t length = 1; length <= 64; length++) {
+        assertSegmentEncoding(data, MODE_ALPHANUMERIC, length);
+    }
+
+    assertSegmentEncoding(data, MODE_ALPHANUMERIC, 4296);
+
+    // both Shift_JIS ranges, 0x8140-0x9FFC and 0xE040-0xEBBF
+    for (size_t i = 0; i < 2 * 1817; i += 2) {
+        data[i] = rand() % 2 ? 0x81 + rand() % 31 : 0xE0 + rand() % 11;
+        data[i + 1] = 0x40 + rand() % 0xBD;
+    }
+
+    for (size_t length = 2; length <= 64; length += 2) {
+        assertSegmentEncoding(data, MODE_KANJI, length);
+    }
+
+    assertSegmentEncoding(data, MODE_KANJI, 2 * 1817);
+
+    printf("test_encodeDataCodewords_LongSegments() passed\n");
+}
+
+static void test_getNumBitsSegments(void) {
+    SegmentList *segments = newSegmentList();
+
+    // one digit left over takes 4 bits, two take 7 bits
+    addSegment(segments, MODE_NUMERIC, 7);
+    assert(getNumBitsSegments(segments, VERSION_CLASS_SMALL) == 4 + 10 + 24);
+
+    segments = newSegmentList();
+    addSegment(segments, MODE_NUMERIC, 8);
+    addSegment(segments, MODE_KANJI, 4);
+    assert(getNumBitsSegments(segments, VERSION_CLASS_MEDIUM) ==
+           4 + 12 + 27 + 4 + 10 + 26);
+
+    printf("test_getNumBitsSegments() passed\n");
+}
+
+static void test_recommendVersionForNumBits(void) {
+    assert(getVersionClass(1) == VERSION_CLASS_SMALL);
+    assert(getVersionClass(9) == VERSION_CLASS_SMALL);
+    assert(getVersionClass(10) == VERSION_CLASS_MEDIUM);
+    assert(getVersionClass(26) == VERSION_CLASS_MEDIUM);
+    assert(getVersionClass(27) == VERSION_CLASS_LARGE);
+    assert(getVersionClass(40) == VERSION_CLASS_LARGE);
+
+    // version 1-L holds 19 data codewords, version 9-L 232 and 10-L 274
+    assert(recommendVersionForNumBits(0, ERROR_CORRECTION_LEVEL_L,
+                                      VERSION_CLASS_SMALL) == 1);
+    assert(recommendVersionForNumBits(19 * 8, ERROR_CORRECTION_LEVEL_L,
+                                      VERSION_CLASS_SMALL) == 1);
+    assert(recommendVersionForNumBits(19 * 8 + 1, ERROR_CORRECTION_LEVEL_L,
+                                      VERSION_CLASS_SMALL) == 2);
+    assert(recommendVersionForNumBits(232 * 8 + 1, ERROR_CORRECTION_LEVEL_L,
+                                      VERSION_CLASS_SMALL) == -1);
+    assert(recommendVersionForNumBits(232 * 8 + 1, ERROR_CORRECTION_LEVEL_L,
+                                      VERSION_CLASS_MEDIUM) == 10);
+
+    printf("test_recommendVersionForNumBits() passed\n");
+}
+
+static void test_selectVersionClasses(void) {
+    VersionClass firstClass;
+    VersionClass lastClass;
+
+    // 200 bytes fit into version 9-L as a byte mode segment
+    assert(selectVersionClasses(&firstClass, &lastClass, 4 + 200 * 10 / 3,
+                                200, ERROR_CORRECTION_LEVEL_L));
+    assert(firstClass == VERSION_CLASS_SMALL);
+    assert(lastClass == VERSION_CLASS_SMALL);
+
+    // 500 digits may fit into version 9-L, 500 bytes only into version 15-L
+    assert(selectVersionClasses(&firstClass, &lastClass, 4 + 500 * 10 / 3,
+                                500, ERROR_CORRECTION_LEVEL_L));
+    assert(firstClass == VERSION_CLASS_SMALL);
+    assert(lastClass == VERSION_CLASS_MEDIUM);
+
+    assert(selectVersionClasses(&firstClass, &lastClass, 4 + 500 * 8, 500,
+                                ERROR_CORRECTION_LEVEL_L));
+    assert(firstClass == VERSION_CLASS_MEDIUM);
+    assert(lastClass == VERSION_CLASS_MEDIUM);
+
+    // 2900 bytes fit into version 40-L, but not into 40-H
+    assert(selectVersionClasses(&firstClass, &lastClass, 4 + 2900 * 8, 2900,
+                                ERROR_CORRECTION_LEVEL_L));
+    assert(firstClass == VERSION_CLASS_LARGE);
+    assert(lastClass == VERSION_CLASS_LARGE);
+
+    assert(!selectVersionClasses(&firstClass, &lastClass, 4 + 2900 * 8, 2900,
+                                 ERROR_CORRECTION_LEVEL_H));
+
+    printf("test_selectVersionClasses() passed\n");
+}
+
 int main(void) {
+    test_getNumBitsSegments();
+    test_recommendVersionForNumBits();
+    test_selectVersionClasses();
+
     test_encodeDataCodewords_Numeric();
     test_encodeDataCodewords_Alphanumeric();
     test_encodeDataCodewords_Byte();
     test_encodeDataCodewords_Kanji();
     test_encodeDataCodewords_Mixed();
+    test_encodeDataCodewords_AlignedByte();
+    test_encodeDataCodewords_LongByte();
+    test_encodeDataCodewords_LongSegments();
 
     return 0;
 }
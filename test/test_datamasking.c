@@ -1,7 +1,9 @@
 #include "datamasking.h"
 #include "module.h"
+#include "moduleplacement.h"
 #include "test_module.h"
 #include <assert.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -9,8 +11,8 @@ static void test_applyDataMaskPatternN(unsigned int pattern,
                                        const uint8_t *expected) {
     size_t symbolSize = 21;
 
-    uint8_t *unmasked = malloc(symbolSize * symbolSize * sizeof(uint8_t));
-    uint8_t *masked = malloc(symbolSize * symbolSize * sizeof(uint8_t));
+    ModuleMatrix *unmasked = malloc(sizeof(ModuleMatrix));
+    ModuleMatrix *masked = malloc(sizeof(ModuleMatrix));
 
     const uint8_t *input = (const uint8_t *)"555555546000045555555"
                                             "544444546000045444445"
@@ -34,11 +36,11 @@ static void test_applyDataMaskPatternN(unsigned int pattern,
                                             "544444546000000000000"
                                             "555555546000000000000";
 
-    initializeMatrix(unmasked, input, symbolSize);
+    initializeModuleMatrix(unmasked, input, symbolSize);
 
     applyDataMaskPattern(masked, unmasked, symbolSize, pattern);
 
-    matrixEquals(masked, expected, symbolSize);
+    moduleMatrixEquals(masked, expected, symbolSize);
 
     printf("test_applyDataMaskPattern%u() passed\n", pattern);
 }
@@ -251,6 +253,196 @@ static void test_applyDataMaskPattern7(void) {
     test_applyDataMaskPatternN(7, expected);
 }
 
+static bool isMasked(unsigned int pattern, size_t y, size_t x) {
+    switch (pattern) {
+    case 0:
+        return (y + x) % 2 == 0;
+    case 1:
+        return y % 2 == 0;
+    case 2:
+        return x % 3 == 0;
+    case 3:
+        return (y + x) % 3 == 0;
+    case 4:
+        return ((y / 2) + (x / 3)) % 2 == 0;
+    case 5:
+        return (y * x) % 2 + (y * x) % 3 == 0;
+    case 6:
+        return ((y * x) % 2 + (y * x) % 3) % 2 == 0;
+    default:
+        return ((y + x) % 2 + (y * x) % 3) % 2 == 0;
+    }
+}
+
+static void test_applyDataMaskPattern_allSizes(void) {
+    ModuleMatrix *unmasked = malloc(sizeof(ModuleMatrix));
+    ModuleMatrix *masked = malloc(sizeof(ModuleMatrix));
+
+    srand(1);
+
+    for (size_t size = 21; size <= 177; size += 4) {
+        clearModuleMatrix(unmasked, size);
+
+        for (size_t y = 0; y < size; y++) {
+            for (size_t x = 0; x < size; x++) {
+                uint8_t module = rand() % 2;
+
+                if (rand() % 4 == 0) {
+                    module |= MODULE_FUNCTION | (rand() % 2) * MODULE_BLANK;
+                }
+
+                placeMatrixModule(unmasked, y, x, module);
+            }
+        }
+
+        for (unsigned int pattern = 0; pattern < 8; pattern++) {
+            applyDataMaskPattern(masked, unmasked, size, pattern);
+
+            for (size_t y = 0; y < size; y++) {
+                for (size_t i = 0; i < MODULE_MATRIX_ROW_WORDS; i++) {
+                    assert(masked->function[y][i] == 0);
+                    assert(masked->blank[y][i] == unmasked->blank[y][i]);
+                }
+
+                for (size_t x = 0; x < MODULE_MATRIX_ROW_WORDS * 64; x++) {
+                    bool dark = getMatrixBit(unmasked->dark, y, x);
+
+                    if (x < size && !getMatrixBit(unmasked->function, y, x)) {
+                        dark ^= isMasked(pattern, y, x);
+                    }
+
+                    assert(getMatrixBit(masked->dark, y, x) == dark);
+                }
+            }
+        }
+    }
+
+    free(unmasked);
+    free(masked);
+
+    printf("test_applyDataMaskPattern_allSizes() passed\n");
+}
+
+static void test_applyDataMaskPatternLowestPenaltyScoreInParallel(void) {
+    uint8_t codewords[NUM_RANDOM_SYMBOL_CODEWORDS];
+    ModuleMatrix *unmasked = malloc(sizeof(ModuleMatrix));
+    ModuleMatrix *masked = malloc(sizeof(ModuleMatrix));
+    ModuleMatrix *expected = malloc(sizeof(ModuleMatrix));
+
+    for (unsigned int version = 1; version <= 40; version++) {
+        size_t size = makeRandomSymbol(unmasked, codewords, version, version);
+
+        unsigned int pattern =
+            applyDataMaskPatternLowestPenaltyScore(expected, unmasked, size);
+
+        // fewer threads than the pool has workers after the first pass
+        for (unsigned int numThreads = 8; numThreads >= 1; numThreads--) {
+            assert(applyDataMaskPatternLowestPenaltyScoreInParallel(
+                       masked, unmasked, size, numThreads) == pattern);
+
+            for (size_t y = 0; y < size; y++) {
+                for (size_t i = 0; i < MODULE_MATRIX_ROW_WORDS; i++) {
+                    assert(masked->dark[y][i] == expected->dark[y][i]);
+                }
+            }
+        }
+    }
+
+    free(unmasked);
+    free(masked);
+    free(expected);
+
+    printf("test_applyDataMaskPatternLowestPenaltyScoreInParallel() passed\n");
+}
+
+static void test_applyDataMaskPatternEstimatedLowestPenaltyScore(void) {
+    uint8_t codewords[NUM_RANDOM_SYMBOL_CODEWORDS];
+    ModuleMatrix *unmasked = malloc(sizeof(ModuleMatrix));
+    ModuleMatrix *masked = malloc(sizeof(ModuleMatrix));
+    ModuleMatrix *expected = malloc(sizeof(ModuleMatrix));
+
+    for (unsigned int version = 1; version <= 40; version++) {
+        size_t size = makeRandomSymbol(unmasked, codewords, version, version);
+
+        unsigned int pattern = applyDataMaskPatternEstimatedLowestPenaltyScore(
+            masked, unmasked, size);
+
+        assert(pattern < 8);
+
+        // small symbols are scored exactly
+        if (size < MIN_ESTIMATED_MASK_SIZE) {
+            assert(pattern == applyDataMaskPatternLowestPenaltyScore(
+                                  expected, unmasked, size));
+        }
+
+        applyDataMaskPattern(expected, unmasked, size, pattern);
+
+        for (size_t y = 0; y < size; y++) {
+            for (size_t i = 0; i < MODULE_MATRIX_ROW_WORDS; i++) {
+                assert(masked->dark[y][i] == expected->dark[y][i]);
+            }
+        }
+    }
+
+    free(unmasked);
+    free(masked);
+    free(expected);
+
+    printf("test_applyDataMaskPatternEstimatedLowestPenaltyScore() passed\n");
+}
+
+static void test_updateMaskSelection(void) {
+    uint8_t codewords[NUM_RANDOM_SYMBOL_CODEWORDS];
+    ModuleMatrix *unmasked = malloc(sizeof(ModuleMatrix));
+    ModuleMatrix *previous = malloc(sizeof(ModuleMatrix));
+    ModuleMatrix *expected = malloc(sizeof(ModuleMatrix));
+    MaskSelection *selection = malloc(sizeof(MaskSelection));
+    ModulePosition *changes = malloc(sizeof(ModulePosition) * 177 * 177);
+
+    for (unsigned int version = 1; version <= 40; version++) {
+        size_t size = makeRandomSymbol(unmasked, codewords, version, version);
+        initializeMaskSelection(selection, unmasked, size);
+
+        for (size_t i = 0; i < 5; i++) {
+            const ModuleMatrix *masked;
+
+            // change a few codewords, leaving the function patterns alone
+            *previous = *unmasked;
+
+            for (size_t j = 0; j < 3; j++) {
+                codewords[rand() % sizeof(codewords)] = rand();
+            }
+
+            placeModules(unmasked, size, version, codewords);
+
+            size_t numChanges =
+                listChangedModules(changes, unmasked, previous, size);
+
+            updateMaskSelection(selection, unmasked, changes, numChanges);
+
+            unsigned int pattern = getMaskSelectionPattern(selection, &masked);
+
+            assert(pattern == applyDataMaskPatternLowestPenaltyScore(
+                                  expected, unmasked, size));
+
+            for (size_t y = 0; y < size; y++) {
+                for (size_t k = 0; k < MODULE_MATRIX_ROW_WORDS; k++) {
+                    assert(masked->dark[y][k] == expected->dark[y][k]);
+                    assert(masked->blank[y][k] == expected->blank[y][k]);
+                }
+            }
+        }
+    }
+
+    free(unmasked);
+    free(previous);
+    free(expected);
+    free(selection);
+    free(changes);
+
+    printf("test_updateMaskSelection() passed\n");
+}
+
 static void test_calculatePenaltyScoreCondition1(void) {
     size_t symbolSize = 21;
     uint8_t *matrix = malloc(symbolSize * symbolSize * sizeof(uint8_t));
@@ -598,8 +790,8 @@ static void test_calculatePenaltyScoreCondition4(void) {
 static void test_applyDataMaskPatternLowestPenaltyScore(void) {
     size_t symbolSize = 21;
 
-    uint8_t *unmasked = malloc(symbolSize * symbolSize * sizeof(uint8_t));
-    uint8_t *masked = malloc(symbolSize * symbolSize * sizeof(uint8_t));
+    ModuleMatrix *unmasked = malloc(sizeof(ModuleMatrix));
+    ModuleMatrix *masked = malloc(sizeof(ModuleMatrix));
 
     const uint8_t *input = (const uint8_t *)"555555546001045555555"
                                             "544444546011045444445"
@@ -623,7 +815,7 @@ static void test_applyDataMaskPatternLowestPenaltyScore(void) {
                                             "544444546100100010010"
                                             "555555546011110110000";
 
-    initializeMatrix(unmasked, input, symbolSize);
+    initializeModuleMatrix(unmasked, input, symbolSize);
 
     unsigned int pattern =
         applyDataMaskPatternLowestPenaltyScore(masked, unmasked, symbolSize);
@@ -642,6 +834,7 @@ int main(void) {
     test_applyDataMaskPattern5();
     test_applyDataMaskPattern6();
     test_applyDataMaskPattern7();
+    test_applyDataMaskPattern_allSizes();
 
     test_calculatePenaltyScoreCondition1();
     test_calculatePenaltyScoreCondition2();
@@ -649,6 +842,9 @@ int main(void) {
     test_calculatePenaltyScoreCondition4();
 
     test_applyDataMaskPatternLowestPenaltyScore();
+    test_applyDataMaskPatternLowestPenaltyScoreInParallel();
+    test_applyDataMaskPatternEstimatedLowestPenaltyScore();
+    test_updateMaskSelection();
 
     return 0;
 }
@@ -1,6 +1,8 @@
 #include "errorcorrection.h"
+#include "gf256.h"
 #include <assert.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 static void test_encodeErrorCorrectionCodewords_1M(void) {
@@ -50,9 +52,70 @@ static void test_encodeErrorCorrectionCodewords_5Q(void) {
     printf("test_encodeErrorCorrectionCodewords_5Q() passed\n");
 }
 
+static void encodeAllRSBlocks(const uint8_t *dataCodewords) {
+    uint8_t ecCodewords[3706];
+    uint8_t expected[3706];
+
+    for (unsigned int version = 1; version <= 40; version++) {
+        for (int ecLevel = ERROR_CORRECTION_LEVEL_L;
+             ecLevel <= ERROR_CORRECTION_LEVEL_H; ecLevel++) {
+            RSBlock rsBlock = getRSBlock(version, ecLevel);
+            size_t numBlocks = rsBlock.numBlocks1 + rsBlock.numBlocks2;
+            const uint8_t *data = dataCodewords;
+
+            encodeErrorCorrectionCodewords(ecCodewords, dataCodewords,
+                                           rsBlock);
+
+            for (size_t i = 0; i < numBlocks; i++) {
+                size_t numDataCodewords = i < rsBlock.numBlocks1
+                                              ? rsBlock.numDataCodewords1
+                                              : rsBlock.numDataCodewords2;
+
+                gf256_divideByGeneratorPolynomial(
+                    expected + i * rsBlock.numECCodewords, data,
+                    numDataCodewords,
+                    gf256_getGeneratorPolynomial(rsBlock.numECCodewords),
+                    rsBlock.numECCodewords);
+
+                data += numDataCodewords;
+            }
+
+            assert(memcmp(ecCodewords, expected,
+                          numBlocks * rsBlock.numECCodewords) == 0);
+
+            encodeErrorCorrectionCodewordsInLockstep(ecCodewords,
+                                                     dataCodewords, rsBlock);
+
+            assert(memcmp(ecCodewords, expected,
+                          numBlocks * rsBlock.numECCodewords) == 0);
+        }
+    }
+}
+
+static void test_encodeErrorCorrectionCodewords_allRSBlocks(void) {
+    uint8_t dataCodewords[3706];
+
+    srand(1);
+
+    for (size_t i = 0; i < sizeof(dataCodewords); i++) {
+        dataCodewords[i] = rand() & 0xFF;
+    }
+
+    for (int kernel = GF256_KERNEL_SCALAR; kernel <= GF256_KERNEL_AVX2;
+         kernel++) {
+        gf256_selectKernel(kernel);
+        encodeAllRSBlocks(dataCodewords);
+    }
+
+    gf256_selectKernel(GF256_KERNEL_AVX2);
+
+    printf("test_encodeErrorCorrectionCodewords_allRSBlocks() passed\n");
+}
+
 int main(void) {
     test_encodeErrorCorrectionCodewords_1M();
     test_encodeErrorCorrectionCodewords_5Q();
+    test_encodeErrorCorrectionCodewords_allRSBlocks();
 
     return 0;
 }
@@ -7,7 +7,7 @@
 
 static void test_placeFormatInformation(void) {
     size_t symbolSize = 21;
-    uint8_t *matrix = malloc(symbolSize * symbolSize * sizeof(uint8_t));
+    ModuleMatrix *matrix = malloc(sizeof(ModuleMatrix));
 
     const uint8_t *input = (const uint8_t *)"111111102101101111111"
                                             "100000102111101000001"
@@ -31,7 +31,7 @@ static void test_placeFormatInformation(void) {
                                             "100000102000000110110"
                                             "111111102111010010100";
 
-    initializeMatrix(matrix, input, symbolSize);
+    initializeModuleMatrix(matrix, input, symbolSize);
 
     placeFormatInformation(matrix, symbolSize, ERROR_CORRECTION_LEVEL_M, 2);
 
@@ -57,14 +57,14 @@ static void test_placeFormatInformation(void) {
                                                "100000100000000110110"
                                                "111111101111010010100";
 
-    matrixEquals(matrix, expected, symbolSize);
+    moduleMatrixEquals(matrix, expected, symbolSize);
 
     printf("test_placeFormatInformation() passed\n");
 }
 
 static void test_placeVersionInformation(void) {
     size_t symbolSize = 45;
-    uint8_t *matrix = malloc(symbolSize * symbolSize * sizeof(uint8_t));
+    ModuleMatrix *matrix = malloc(sizeof(ModuleMatrix));
 
     const uint8_t *input =
         (const uint8_t *)"111111102000000000000000000000000022201111111"
@@ -113,7 +113,7 @@ static void test_placeVersionInformation(void) {
                          "100000102000000000000000000000000000000000000"
                          "111111102000000000000000000000000000000000000";
 
-    initializeMatrix(matrix, input, symbolSize);
+    initializeModuleMatrix(matrix, input, symbolSize);
 
     placeVersionInformation(matrix, symbolSize, 7);
 
@@ -164,7 +164,7 @@ static void test_placeVersionInformation(void) {
                          "100000102000000000000000000000000000000000000"
                          "111111102000000000000000000000000000000000000";
 
-    matrixEquals(matrix, expected, symbolSize);
+    moduleMatrixEquals(matrix, expected, symbolSize);
 
     printf("test_placeVersionInformation() passed\n");
 }
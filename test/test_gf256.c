@@ -3,10 +3,79 @@
 #include <stdio.h>
 #include <string.h>
 
-void test_gf256_initialize(void) {
-    gf256_initialize();
+void test_gf256_multiply(void) {
+    for (unsigned int a = 0; a < 256; a++) {
+        for (unsigned int b = 0; b < 256; b++) {
+
+            // carry-less multiplication reduced by x^8 + x^4 + x^3 + x^2 + 1
+            unsigned int expected = 0;
+
+            for (unsigned int i = 0; i < 8; i++) {
+                if (b & (1 << i)) {
+                    expected ^= a << i;
+                }
+            }
+
+            for (unsigned int i = 15; i >= 8; i--) {
+                if (expected & (1 << i)) {
+                    expected ^= 0x11D << (i - 8);
+                }
+            }
+
+            assert(gf256_multiply(a, b) == expected);
+        }
+    }
+
+    printf("test_gf256_multiply() passed\n");
+}
+
+void test_gf256_getGeneratorPolynomial(void) {
+    const size_t degrees[] = {7, 10, 13, 15, 16, 17, 18,
+                              20, 22, 24, 26, 28, 30};
+
+    for (size_t i = 0; i < sizeof(degrees) / sizeof(degrees[0]); i++) {
+        uint8_t expected[30] = {0};
+
+        gf256_initializeGeneratorPolynomial(expected, degrees[i]);
 
-    printf("test_gf256_initialize() passed\n");
+        assert(memcmp(gf256_getGeneratorPolynomial(degrees[i]), expected,
+                      degrees[i]) == 0);
+    }
+
+    assert(gf256_getGeneratorPolynomial(68) == NULL);
+
+    printf("test_gf256_getGeneratorPolynomial() passed\n");
+}
+
+void test_gf256_getMultiplicationTable(void) {
+    const size_t degrees[] = {7, 10, 13, 15, 16, 17, 18,
+                              20, 22, 24, 26, 28, 30};
+
+    for (size_t i = 0; i < sizeof(degrees) / sizeof(degrees[0]); i++) {
+        const uint8_t *generatorPolynomial =
+            gf256_getGeneratorPolynomial(degrees[i]);
+        const uint8_t *products = gf256_getMultiplicationTable(degrees[i]);
+
+        for (unsigned int f = 0; f < 256; f++) {
+            for (size_t j = 0; j < degrees[i]; j++) {
+
+                // coefficients are stored as exponents of the primitive element
+                uint8_t coefficient = 1;
+
+                for (size_t k = 0; k < generatorPolynomial[degrees[i] - 1 - j];
+                     k++) {
+                    coefficient = gf256_multiply(coefficient, 2);
+                }
+
+                assert(products[f * degrees[i] + j] ==
+                       gf256_multiply(f, coefficient));
+            }
+        }
+    }
+
+    assert(gf256_getMultiplicationTable(68) == NULL);
+
+    printf("test_gf256_getMultiplicationTable() passed\n");
 }
 
 void test_gf256_initializeGeneratorPolynomial(void) {
@@ -166,9 +235,90 @@ void test_gf256_divideByGeneratorPolynomial(void) {
     printf("test_gf256_divideByGeneratorPolynomial() passed\n");
 }
 
+void test_gf256_multiplyAccumulate(void) {
+    uint8_t src[70];
+    uint8_t dst[70];
+    uint8_t expected[70];
+
+    for (size_t i = 0; i < sizeof(src); i++) {
+        src[i] = (uint8_t)(i * 37 + 11);
+    }
+
+    for (int kernel = GF256_KERNEL_SCALAR; kernel <= GF256_KERNEL_AVX2;
+         kernel++) {
+        gf256_selectKernel(kernel);
+
+        for (unsigned int c = 0; c < 256; c++) {
+            for (size_t length = 0; length <= sizeof(src); length++) {
+                for (size_t i = 0; i < sizeof(dst); i++) {
+                    dst[i] = (uint8_t)(i ^ c);
+                    expected[i] = (uint8_t)(i ^ c);
+
+                    if (i < length) {
+                        expected[i] ^= gf256_multiply(c, src[i]);
+                    }
+                }
+
+                gf256_multiplyAccumulate(dst, src, c, length);
+
+                assert(memcmp(dst, expected, sizeof(dst)) == 0);
+            }
+        }
+    }
+
+    gf256_selectKernel(GF256_KERNEL_AVX2);
+
+    printf("test_gf256_multiplyAccumulate() passed\n");
+}
+
+void test_gf256_multiplyAccumulateRows(void) {
+    const uint8_t constants[] = {0, 1, 2, 0x53, 0xCA, 0xFF};
+    const size_t numRows = sizeof(constants);
+    const size_t stride = 80;
+    uint8_t src[70];
+    uint8_t dst[6 * 80];
+    uint8_t expected[6 * 80];
+
+    for (size_t i = 0; i < sizeof(src); i++) {
+        src[i] = (uint8_t)(i * 91 + 5);
+    }
+
+    for (int kernel = GF256_KERNEL_SCALAR; kernel <= GF256_KERNEL_AVX2;
+         kernel++) {
+        gf256_selectKernel(kernel);
+
+        for (size_t length = 0; length <= sizeof(src); length++) {
+            for (size_t j = 0; j < numRows; j++) {
+                for (size_t i = 0; i < stride; i++) {
+                    dst[j * stride + i] = (uint8_t)(i + j);
+                    expected[j * stride + i] = (uint8_t)(i + j);
+
+                    if (i < length) {
+                        expected[j * stride + i] ^=
+                            gf256_multiply(constants[j], src[i]);
+                    }
+                }
+            }
+
+            gf256_multiplyAccumulateRows(dst, stride, src, constants, numRows,
+                                         length);
+
+            assert(memcmp(dst, expected, sizeof(dst)) == 0);
+        }
+    }
+
+    gf256_selectKernel(GF256_KERNEL_AVX2);
+
+    printf("test_gf256_multiplyAccumulateRows() passed\n");
+}
+
 int main(void) {
-    test_gf256_initialize();
+    test_gf256_multiply();
     test_gf256_initializeGeneratorPolynomial();
+    test_gf256_getGeneratorPolynomial();
+    test_gf256_getMultiplicationTable();
+    test_gf256_multiplyAccumulate();
+    test_gf256_multiplyAccumulateRows();
     test_gf256_divideByGeneratorPolynomial_Divisible();
     test_gf256_divideByGeneratorPolynomial();
 
@@ -1,4 +1,6 @@
 #include "test_module.h"
+#include "moduleplacement.h"
+#include <stdlib.h>
 
 void initializeMatrix(uint8_t *matrix, const uint8_t *input,
                       size_t symbolSize) {
@@ -17,3 +19,46 @@ bool matrixEquals(const uint8_t *matrix, const uint8_t *expected,
 
     return true;
 }
+
+void initializeModuleMatrix(ModuleMatrix *matrix, const uint8_t *input,
+                            size_t symbolSize) {
+    clearModuleMatrix(matrix, symbolSize);
+
+    for (size_t y = 0; y < symbolSize; y++) {
+        for (size_t x = 0; x < symbolSize; x++) {
+            placeMatrixModule(matrix, y, x, input[symbolSize * y + x] - '0');
+        }
+    }
+}
+
+bool moduleMatrixEquals(const ModuleMatrix *matrix, const uint8_t *expected,
+                        size_t symbolSize) {
+    for (size_t y = 0; y < symbolSize; y++) {
+        for (size_t x = 0; x < symbolSize; x++) {
+            if (getMatrixModule(matrix, y, x) !=
+                (unsigned int)(expected[symbolSize * y + x] - '0')) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// fills NUM_RANDOM_SYMBOL_CODEWORDS codewords with random bytes from the seed
+// and places them into the matrix as an unmasked symbol of the version;
+// returns the size of the symbol
+size_t makeRandomSymbol(ModuleMatrix *matrix, uint8_t *codewords,
+                        unsigned int version, unsigned int seed) {
+    size_t size = getSymbolSizeInNumModules(version);
+
+    srand(seed);
+
+    for (size_t i = 0; i < NUM_RANDOM_SYMBOL_CODEWORDS; i++) {
+        codewords[i] = rand();
+    }
+
+    placeModules(matrix, size, version, codewords);
+
+    return size;
+}
@@ -1,13 +1,24 @@
 #ifndef TEST_MODULE_H
 #define TEST_MODULE_H
 
+#include "module.h"
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
+// the codewords of version 40, enough for the codewords and remainder bits of
+// any version
+#define NUM_RANDOM_SYMBOL_CODEWORDS 3706
+
 extern void initializeMatrix(uint8_t *matrix, const uint8_t *input,
                              size_t symbolSize);
 extern bool matrixEquals(const uint8_t *matrix, const uint8_t *expected,
                          size_t symbolSize);
+extern void initializeModuleMatrix(ModuleMatrix *matrix, const uint8_t *input,
+                                   size_t symbolSize);
+extern bool moduleMatrixEquals(const ModuleMatrix *matrix,
+                               const uint8_t *expected, size_t symbolSize);
+extern size_t makeRandomSymbol(ModuleMatrix *matrix, uint8_t *codewords,
+                               unsigned int version, unsigned int seed);
 
 #endif /* TEST_MODULE_H */
@@ -4,6 +4,7 @@
 #include <assert.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 static void test_getSymbolSizeInNumModules(void) {
     assert(getSymbolSizeInNumModules(1) == 21);
@@ -16,7 +17,7 @@ static void test_getSymbolSizeInNumModules(void) {
 
 static void test_placeFunctionPatterns(void) {
     size_t symbolSize = 45;
-    uint8_t *matrix = malloc(symbolSize * symbolSize * sizeof(uint8_t));
+    ModuleMatrix *matrix = malloc(sizeof(ModuleMatrix));
 
     const uint8_t codewords[196] = {0};
 
@@ -69,14 +70,14 @@ static void test_placeFunctionPatterns(void) {
                          "544444546000000000000000000000000000000000000"
                          "555555546000000000000000000000000000000000000";
 
-    matrixEquals(matrix, expected, symbolSize);
+    moduleMatrixEquals(matrix, expected, symbolSize);
 
     printf("test_placeFunctionPatterns() passed\n");
 }
 
 static void test_placeCodewordModules(void) {
     size_t symbolSize = 21;
-    uint8_t *matrix = malloc(symbolSize * symbolSize * sizeof(uint8_t));
+    ModuleMatrix *matrix = malloc(sizeof(ModuleMatrix));
 
     uint8_t codewords[] = {0x10, 0x20, 0x0C, 0x56, 0x61, 0x80, 0xEC,
                            0x11, 0xEC, 0x11, 0xEC, 0x11, 0xEC, 0x11,
@@ -107,15 +108,111 @@ static void test_placeCodewordModules(void) {
                                                "544444546100100010010"
                                                "555555546011110110000";
 
-    matrixEquals(matrix, expected, symbolSize);
+    moduleMatrixEquals(matrix, expected, symbolSize);
 
     printf("test_placeCodewordModules() passed\n");
 }
 
+static void test_getCodewordModulePositions(void) {
+    uint8_t codewords[NUM_RANDOM_SYMBOL_CODEWORDS];
+    ModuleMatrix *matrix = malloc(sizeof(ModuleMatrix));
+    ModuleMatrix *functions = malloc(sizeof(ModuleMatrix));
+    size_t totalNumPositions = 0;
+
+    for (unsigned int version = 1; version <= 40; version++) {
+        size_t symbolSize =
+            makeRandomSymbol(matrix, codewords, version, version);
+        size_t numPositions;
+
+        clearModuleMatrix(functions, symbolSize);
+        placeFunctionPatterns(functions, symbolSize, version);
+
+        const uint16_t *positions =
+            getCodewordModulePositions(version, &numPositions);
+
+        assert(positions != NULL);
+
+        // walk the placement path around the function patterns
+        size_t x = symbolSize - 1;
+        size_t y = symbolSize - 1;
+        size_t vy = -1;
+        size_t index = 0;
+
+        for (size_t i = 0; i < symbolSize / 2; i++) {
+            for (size_t j = 0; j < symbolSize; j++) {
+                for (size_t k = 0; k < 2; k++) {
+                    size_t my = y + vy * j;
+                    size_t mx = x - k;
+
+                    if (getMatrixBit(functions->function, my, mx)) {
+                        continue;
+                    }
+
+                    assert(index < numPositions);
+                    assert(positions[index] == (my << 8 | mx));
+                    assert(getMatrixBit(matrix->dark, my, mx) ==
+                           (codewords[index / 8] >> (7 - index % 8) & 1u));
+                    index++;
+                }
+            }
+
+            x -= x == 8 ? 3 : 2;
+            y ^= symbolSize - 1;
+            vy = -vy;
+        }
+
+        assert(index == numPositions);
+        totalNumPositions += numPositions;
+    }
+
+    assert(totalNumPositions == NUM_CODEWORD_MODULE_POSITIONS);
+
+    free(matrix);
+    free(functions);
+
+    printf("test_getCodewordModulePositions() passed\n");
+}
+
+static void test_preloadVersionLayouts(void) {
+    uint8_t codewords[NUM_RANDOM_SYMBOL_CODEWORDS];
+    ModuleMatrix *matrix = malloc(sizeof(ModuleMatrix));
+    ModuleMatrix *expected = malloc(sizeof(ModuleMatrix));
+
+    assert(preloadVersionLayouts());
+
+    // the templates match the patterns placed module by module, and replace
+    // whatever the matrix held before
+    for (unsigned int version = 1; version <= 40; version++) {
+        memset(matrix, 0xFF, sizeof(ModuleMatrix));
+
+        size_t symbolSize =
+            makeRandomSymbol(matrix, codewords, version, version);
+
+        clearModuleMatrix(expected, symbolSize);
+        placeFunctionPatterns(expected, symbolSize, version);
+        placeCodewordModules(expected, symbolSize, codewords);
+
+        for (size_t y = 0; y < symbolSize; y++) {
+            for (size_t i = 0; i < MODULE_MATRIX_ROW_WORDS; i++) {
+                assert(matrix->dark[y][i] == expected->dark[y][i]);
+                assert(matrix->function[y][i] == expected->function[y][i]);
+                assert(matrix->blank[y][i] == expected->blank[y][i]);
+            }
+        }
+    }
+
+    free(matrix);
+    free(expected);
+
+    printf("test_preloadVersionLayouts() passed\n");
+}
+
 int main(void) {
     test_getSymbolSizeInNumModules();
     test_placeFunctionPatterns();
     test_placeCodewordModules();
+    test_getCodewordModulePositions();
+    test_preloadVersionLayouts();
 
     return 0;
 }
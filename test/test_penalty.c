@@ -0,0 +1,280 @@
+#include "datamasking.h"
+#include "module.h"
+#include "moduleplacement.h"
+#include "penalty.h"
+#include "test_module.h"
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static void packModules(ModuleMatrix *matrix, const uint8_t *modules,
+                        size_t size) {
+    clearModuleMatrix(matrix, size);
+
+    for (size_t y = 0; y < size; y++) {
+        for (size_t x = 0; x < size; x++) {
+            placeMatrixModule(matrix, y, x, getModule(modules, size, y, x));
+        }
+    }
+}
+
+// fills the matrix with runs of light, dark and blank modules
+static void generateModules(uint8_t *modules, size_t size) {
+    size_t i = 0;
+
+    while (i < size * size) {
+        uint8_t module = rand() % 16 == 0 ? MODULE_BLANK : rand() % 2;
+        size_t length = 1 + rand() % (rand() % 4 == 0 ? 12 : 3);
+
+        for (; length > 0 && i < size * size; length--) {
+            modules[i++] = module;
+        }
+    }
+}
+
+static void assertPenaltyScoresEqual(const uint8_t *modules, size_t size) {
+    ModuleMatrix *masked = malloc(sizeof(ModuleMatrix));
+    ModuleMatrix *transposed = malloc(sizeof(ModuleMatrix));
+
+    packModules(masked, modules, size);
+    transposeModulePlane(transposed->dark, masked->dark, size);
+    transposeModulePlane(transposed->blank, masked->blank, size);
+
+    unsigned int penaltyScore1 = calculatePenaltyScoreCondition1(modules, size);
+    unsigned int penaltyScore2 = calculatePenaltyScoreCondition2(modules, size);
+    unsigned int penaltyScore3 = calculatePenaltyScoreCondition3(modules, size);
+    unsigned int penaltyScore4 = calculatePenaltyScoreCondition4(modules, size);
+
+    assert(calculatePackedPenaltyScoreCondition1(masked, transposed, size) ==
+           penaltyScore1);
+    assert(calculatePackedPenaltyScoreCondition2(masked, size) ==
+           penaltyScore2);
+    assert(calculatePackedPenaltyScoreCondition3(masked, transposed, size) ==
+           penaltyScore3);
+    assert(calculatePackedPenaltyScoreCondition4(masked, size) ==
+           penaltyScore4);
+    assert(calculatePackedPenaltyScore(masked, size) ==
+           penaltyScore1 + penaltyScore2 + penaltyScore3 + penaltyScore4);
+
+    free(masked);
+    free(transposed);
+}
+
+static void test_transposeModulePlane(void) {
+    ModuleMatrix *matrix = malloc(sizeof(ModuleMatrix));
+    ModuleMatrix *transposed = malloc(sizeof(ModuleMatrix));
+
+    for (size_t size = 21; size <= 177; size += 4) {
+        clearModuleMatrix(matrix, size);
+
+        for (size_t y = 0; y < size; y++) {
+            for (size_t x = 0; x < size; x++) {
+                setMatrixBit(matrix->dark, y, x, rand());
+            }
+        }
+
+        transposeModulePlane(transposed->dark, matrix->dark, size);
+
+        for (size_t y = 0; y < size; y++) {
+            for (size_t x = 0; x < (size + 63) / 64 * 64; x++) {
+                unsigned int expected =
+                    x < size ? getMatrixBit(matrix->dark, x, y) : 0;
+
+                assert(getMatrixBit(transposed->dark, y, x) == expected);
+            }
+        }
+    }
+
+    free(matrix);
+    free(transposed);
+
+    printf("test_transposeModulePlane() passed\n");
+}
+
+static void test_calculatePackedPenaltyScore_random(void) {
+    uint8_t *modules = malloc(177 * 177);
+
+    srand(1);
+
+    for (size_t size = 21; size <= 177; size += 4) {
+        for (size_t i = 0; i < 10; i++) {
+            generateModules(modules, size);
+            assertPenaltyScoresEqual(modules, size);
+        }
+    }
+
+    free(modules);
+
+    printf("test_calculatePackedPenaltyScore_random() passed\n");
+}
+
+static void test_calculatePackedPenaltyScore_symbols(void) {
+    uint8_t codewords[NUM_RANDOM_SYMBOL_CODEWORDS];
+    uint8_t *modules = malloc(177 * 177);
+    ModuleMatrix *unmasked = malloc(sizeof(ModuleMatrix));
+    ModuleMatrix *masked = malloc(sizeof(ModuleMatrix));
+
+    for (unsigned int version = 1; version <= 40; version++) {
+        size_t size = makeRandomSymbol(unmasked, codewords, version, version);
+
+        for (unsigned int pattern = 0; pattern < 8; pattern++) {
+            applyDataMaskPattern(masked, unmasked, size, pattern);
+            unpackModuleMatrix(modules, masked, size);
+            assertPenaltyScoresEqual(modules, size);
+        }
+    }
+
+    free(modules);
+    free(unmasked);
+    free(masked);
+
+    printf("test_calculatePackedPenaltyScore_symbols() passed\n");
+}
+
+static bool isMasked(unsigned int pattern, size_t y, size_t x) {
+    switch (pattern) {
+    case 0:
+        return (y + x) % 2 == 0;
+    case 1:
+        return y % 2 == 0;
+    case 2:
+        return x % 3 == 0;
+    case 3:
+        return (y + x) % 3 == 0;
+    case 4:
+        return ((y / 2) + (x / 3)) % 2 == 0;
+    case 5:
+        return (y * x) % 2 + (y * x) % 3 == 0;
+    case 6:
+        return ((y * x) % 2 + (y * x) % 3) % 2 == 0;
+    default:
+        return ((y + x) % 2 + (y * x) % 3) % 2 == 0;
+    }
+}
+
+static void generatePatterns(uint64_t (*rowPatterns)[NUM_MASK_PATTERN_WORDS],
+                             uint64_t (*columnPatterns)[NUM_MASK_PATTERN_WORDS],
+                             size_t size) {
+    for (unsigned int pattern = 0; pattern < 8; pattern++) {
+        for (size_t k = 0; k < NUM_MASK_PATTERN_WORDS; k++) {
+            rowPatterns[pattern][k] = 0;
+            columnPatterns[pattern][k] = 0;
+        }
+
+        for (size_t y = 0; y < MASK_PATTERN_PERIOD; y++) {
+            for (size_t x = 0; x < size; x++) {
+                size_t k = MODULE_MATRIX_ROW_WORDS * y + x / 64;
+
+                rowPatterns[pattern][k] |= (uint64_t)isMasked(pattern, y, x)
+                                           << (x % 64);
+                columnPatterns[pattern][k] |= (uint64_t)isMasked(pattern, x, y)
+                                              << (x % 64);
+            }
+        }
+    }
+}
+
+static void test_calculatePackedPenaltyScores(void) {
+    uint8_t codewords[NUM_RANDOM_SYMBOL_CODEWORDS];
+    uint64_t rowPatterns[8][NUM_MASK_PATTERN_WORDS];
+    uint64_t columnPatterns[8][NUM_MASK_PATTERN_WORDS];
+    unsigned int penaltyScores[8];
+    ModuleMatrix *unmasked = malloc(sizeof(ModuleMatrix));
+    ModuleMatrix *masked = malloc(sizeof(ModuleMatrix));
+    PenaltyBaseline *baseline = malloc(sizeof(PenaltyBaseline));
+
+    for (unsigned int version = 1; version <= 40; version++) {
+        size_t size = makeRandomSymbol(unmasked, codewords, version, version);
+        initializePenaltyBaseline(baseline, unmasked, size);
+
+        // the baseline holds for any other symbol of the version
+        makeRandomSymbol(unmasked, codewords, version, 40 + version);
+        generatePatterns(rowPatterns, columnPatterns, size);
+        calculatePackedPenaltyScores(penaltyScores, unmasked, baseline,
+                                     rowPatterns, columnPatterns, 8, size);
+
+        for (unsigned int pattern = 0; pattern < 8; pattern++) {
+            applyDataMaskPattern(masked, unmasked, size, pattern);
+            assert(penaltyScores[pattern] ==
+                   calculatePackedPenaltyScore(masked, size));
+        }
+    }
+
+    free(unmasked);
+    free(masked);
+    free(baseline);
+
+    printf("test_calculatePackedPenaltyScores() passed\n");
+}
+
+// changes up to 32 modules scattered over the matrix, or a block of them
+static void changeModules(ModuleMatrix *matrix, size_t size) {
+    size_t numChanges = 1 + rand() % 32;
+    size_t y0 = rand() % size;
+    size_t x0 = rand() % size;
+    bool isBlock = rand() % 2 == 0;
+
+    for (size_t j = 0; j < numChanges; j++) {
+        size_t y = isBlock ? (y0 + j / 6) % size : (size_t)rand() % size;
+        size_t x = isBlock ? (x0 + j % 6) % size : (size_t)rand() % size;
+        uint8_t module = rand() % 16 == 0 ? MODULE_BLANK : rand() % 2;
+
+        placeMatrixModule(matrix, y, x, module);
+    }
+}
+
+static void test_updatePenaltyState(void) {
+    uint8_t *modules = malloc(177 * 177);
+    ModuleMatrix *masked = malloc(sizeof(ModuleMatrix));
+    ModuleMatrix *previous = malloc(sizeof(ModuleMatrix));
+    PenaltyState *state = malloc(sizeof(PenaltyState));
+    ModulePosition *changes = malloc(sizeof(ModulePosition) * 177 * 177);
+
+    srand(5);
+
+    for (size_t size = 21; size <= 177; size += 4) {
+        generateModules(modules, size);
+        packModules(masked, modules, size);
+        initializePenaltyState(state, masked, size);
+
+        assert(getPenaltyStateScore(state) ==
+               calculatePackedPenaltyScore(masked, size));
+
+        for (size_t i = 0; i < 20; i++) {
+            *previous = *masked;
+            changeModules(masked, size);
+
+            size_t numChanges =
+                listChangedModules(changes, masked, previous, size);
+
+            for (size_t j = 0; j < numChanges; j++) {
+                assert(getMatrixModule(masked, changes[j].y, changes[j].x) !=
+                       getMatrixModule(previous, changes[j].y, changes[j].x));
+            }
+
+            updatePenaltyState(state, masked, changes, numChanges);
+
+            assert(getPenaltyStateScore(state) ==
+                   calculatePackedPenaltyScore(masked, size));
+        }
+    }
+
+    free(modules);
+    free(masked);
+    free(previous);
+    free(state);
+    free(changes);
+
+    printf("test_updatePenaltyState() passed\n");
+}
+
+int main(void) {
+    test_transposeModulePlane();
+    test_calculatePackedPenaltyScore_random();
+    test_calculatePackedPenaltyScore_symbols();
+    test_calculatePackedPenaltyScores();
+    test_updatePenaltyState();
+
+    return 0;
+}
@@ -0,0 +1,157 @@
+#include "qrce.h"
+#include "test_module.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void test_qrce_encode(void) {
+    QRCEWorkspace *workspace = malloc(sizeof(QRCEWorkspace));
+    QRCEOptions options;
+    QRCESymbol symbol;
+
+    qrce_initializeOptions(&options);
+    options.ecLevel = ERROR_CORRECTION_LEVEL_M;
+
+    QRCEStatus status = qrce_encode(&symbol, workspace,
+                                    (const uint8_t *)"01234567", 8, &options);
+
+    const uint8_t *expected = (const uint8_t *)"111111100011101111111"
+                                               "100000101110001000001"
+                                               "101110100110001011101"
+                                               "101110100101101011101"
+                                               "101110101101101011101"
+                                               "100000100001001000001"
+                                               "111111101010101111111"
+                                               "000000000000000000000"
+                                               "101010100010100010010"
+                                               "110100001011010100010"
+                                               "000110111011011101110"
+                                               "110011010101110110010"
+                                               "001001110111011100001"
+                                               "000000001010001000010"
+                                               "111111100000100010001"
+                                               "100000100010001001011"
+                                               "101110101110101011101"
+                                               "101110100101010101110"
+                                               "101110101101011100101"
+                                               "100000100001110111000"
+                                               "111111101001011100101";
+
+    assert(status == QRCE_SUCCESS);
+    assert(symbol.version == 1);
+    assert(symbol.size == 21);
+    assert(matrixEquals(symbol.modules, expected, symbol.size));
+
+    free(workspace);
+
+    printf("test_qrce_encode() passed\n");
+}
+
+static void test_qrce_encode_ReuseWorkspace(void) {
+    QRCEWorkspace *workspace = malloc(sizeof(QRCEWorkspace));
+    uint8_t *data = malloc(QRCE_MAX_DATA_LENGTH);
+    uint8_t *modules = malloc(QRCE_MAX_SYMBOL_SIZE * QRCE_MAX_SYMBOL_SIZE);
+    QRCEOptions options;
+    QRCESymbol symbol;
+
+    qrce_initializeOptions(&options);
+    memset(data, '7', QRCE_MAX_DATA_LENGTH);
+
+    // the large symbol must not leave anything behind for the small one
+    assert(qrce_encode(&symbol, workspace, data, 100, &options) ==
+           QRCE_SUCCESS);
+    memcpy(modules, symbol.modules, symbol.size * symbol.size);
+
+    assert(qrce_encode(&symbol, workspace, data, QRCE_MAX_DATA_LENGTH,
+                       &options) == QRCE_SUCCESS);
+    assert(symbol.version == 40);
+
+    assert(qrce_encode(&symbol, workspace, data, 100, &options) ==
+           QRCE_SUCCESS);
+    assert(memcmp(modules, symbol.modules, symbol.size * symbol.size) == 0);
+
+    free(modules);
+    free(data);
+    free(workspace);
+
+    printf("test_qrce_encode_ReuseWorkspace() passed\n");
+}
+
+static void test_qrce_encode_Error(void) {
+    QRCEWorkspace *workspace = malloc(sizeof(QRCEWorkspace));
+    uint8_t *data = malloc(QRCE_MAX_DATA_LENGTH + 1);
+    QRCEOptions options;
+    QRCESymbol symbol;
+
+    qrce_initializeOptions(&options);
+    memset(data, '7', QRCE_MAX_DATA_LENGTH + 1);
+
+    assert(qrce_encode(&symbol, workspace, data, QRCE_MAX_DATA_LENGTH + 1,
+                       &options) == QRCE_ERROR_INPUT_TOO_LONG);
+
+    options.ecLevel = ERROR_CORRECTION_LEVEL_H;
+
+    assert(qrce_encode(&symbol, workspace, data, QRCE_MAX_DATA_LENGTH,
+                       &options) == QRCE_ERROR_INPUT_TOO_LONG);
+
+    options.version = 1;
+
+    assert(qrce_encode(&symbol, workspace, data, 100, &options) ==
+           QRCE_ERROR_INPUT_TOO_LONG_FOR_VERSION);
+
+    // data that fits no version is too long, whatever version is requested
+    for (size_t i = 0; i < 2900; i++) {
+        data[i] = "a1"[i % 2];
+    }
+
+    options.ecLevel = ERROR_CORRECTION_LEVEL_M;
+    options.version = 16;
+
+    assert(qrce_encode(&symbol, workspace, data, 2900, &options) ==
+           QRCE_ERROR_INPUT_TOO_LONG);
+
+    options.useOptimization = true;
+
+    assert(qrce_encode(&symbol, workspace, data, 2900, &options) ==
+           QRCE_ERROR_INPUT_TOO_LONG);
+
+    free(data);
+    free(workspace);
+
+    printf("test_qrce_encode_Error() passed\n");
+}
+
+static void test_qrce_encode_OptimalSegmentation(void) {
+    QRCEWorkspace *workspace = malloc(sizeof(QRCEWorkspace));
+    const uint8_t *data = (const uint8_t *)"58050CG14:4Da214F1FF";
+    QRCEOptions options;
+    QRCESymbol symbol;
+
+    qrce_initializeOptions(&options);
+    options.useOptimization = true;
+
+    assert(qrce_encode(&symbol, workspace, data, 20, &options) ==
+           QRCE_SUCCESS);
+    assert(symbol.version == 2);
+
+    // byte mode for the "a" only instead of for the rest of the data
+    options.useOptimalSegmentation = true;
+
+    assert(qrce_encode(&symbol, workspace, data, 20, &options) ==
+           QRCE_SUCCESS);
+    assert(symbol.version == 1);
+
+    free(workspace);
+
+    printf("test_qrce_encode_OptimalSegmentation() passed\n");
+}
+
+int main(void) {
+    test_qrce_encode();
+    test_qrce_encode_ReuseWorkspace();
+    test_qrce_encode_OptimalSegmentation();
+    test_qrce_encode_Error();
+
+    return 0;
+}
@@ -0,0 +1,56 @@
+#include "../src/segment.h"
+#include <assert.h>
+#include <stdio.h>
+
+static void test_addSegment_Storage(void) {
+    Segment storage[2];
+    SegmentList segments;
+
+    initializeSegmentList(&segments, storage, 2);
+
+    assert(addSegment(&segments, MODE_NUMERIC, 3));
+    assert(addSegment(&segments, MODE_BYTE, 0));
+    assert(addSegment(&segments, MODE_KANJI, 4));
+    assert(!addSegment(&segments, MODE_BYTE, 1));
+
+    assert(segments.segments == storage);
+    assert(segments.numSegments == 2);
+    assert(storage[0].mode == MODE_NUMERIC && storage[0].length == 3);
+    assert(storage[1].mode == MODE_KANJI && storage[1].length == 4);
+
+    freeSegmentList(&segments);
+
+    printf("test_addSegment_Storage() passed\n");
+}
+
+static void test_addSegment_Heap(void) {
+    const Mode modes[] = {MODE_NUMERIC, MODE_ALPHANUMERIC, MODE_BYTE,
+                          MODE_KANJI};
+    SegmentList segments;
+
+    initializeSegmentList(&segments, NULL, 0);
+
+    for (size_t i = 0; i < 1000; i++) {
+        assert(addSegment(&segments, modes[i % 4], i + 1));
+    }
+
+    assert(segments.numSegments == 1000);
+
+    for (size_t i = 0; i < 1000; i++) {
+        assert(segments.segments[i].mode == modes[i % 4]);
+        assert(segments.segments[i].length == i + 1);
+    }
+
+    freeSegmentList(&segments);
+
+    assert(segments.numSegments == 0);
+
+    printf("test_addSegment_Heap() passed\n");
+}
+
+int main(void) {
+    test_addSegment_Storage();
+    test_addSegment_Heap();
+
+    return 0;
+}
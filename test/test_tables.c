@@ -0,0 +1,93 @@
+#include "tables.h"
+#include <assert.h>
+#include <stdio.h>
+
+static void test_symbolDescriptors(void) {
+    static const unsigned int numRemainderBits[] = {
+        0, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3,
+        4, 4, 4, 4, 4, 4, 4, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0};
+
+    for (unsigned int version = 1; version <= 40; version++) {
+        for (unsigned int ecLevel = 0; ecLevel < 4; ecLevel++) {
+            const SymbolDescriptor *descriptor =
+                &symbolDescriptors[version - 1][ecLevel];
+            unsigned int numBlocks =
+                descriptor->numBlocks1 + descriptor->numBlocks2;
+
+            assert(descriptor->size == 17 + 4 * version);
+            assert(descriptor->numRemainderBits ==
+                   numRemainderBits[version - 1]);
+            assert(descriptor->numDataCodewords ==
+                   numBlocks * descriptor->numDataCodewords1 +
+                       descriptor->numBlocks2);
+            assert(descriptor->numCodewords ==
+                   descriptor->numDataCodewords +
+                       numBlocks * descriptor->numECCodewords);
+            assert(descriptor->numCodewords ==
+                   symbolDescriptors[version - 1][0].numCodewords);
+        }
+    }
+
+    // 1-M, 1-H and 40-L
+    assert(symbolDescriptors[0][1].numDataCodewords == 16);
+    assert(symbolDescriptors[0][3].capacities[0] == 17);
+    assert(symbolDescriptors[0][3].capacities[1] == 10);
+    assert(symbolDescriptors[0][3].capacities[2] == 7);
+    assert(symbolDescriptors[0][3].capacities[3] == 4);
+    assert(symbolDescriptors[39][0].numCodewords == 3706);
+    assert(symbolDescriptors[39][0].capacities[0] == 7089);
+    assert(symbolDescriptors[39][0].capacities[1] == 4296);
+    assert(symbolDescriptors[39][0].capacities[2] == 2953);
+    assert(symbolDescriptors[39][0].capacities[3] == 1817);
+
+    printf("test_symbolDescriptors() passed\n");
+}
+
+static void test_alignmentPatternCoordinates(void) {
+    assert(alignmentPatternCoordinates[0][0] == 0);
+    assert(alignmentPatternCoordinates[1][0] == 2);
+    assert(alignmentPatternCoordinates[1][2] == 18);
+    assert(alignmentPatternCoordinates[39][0] == 7);
+    assert(alignmentPatternCoordinates[39][7] == 170);
+
+    printf("test_alignmentPatternCoordinates() passed\n");
+}
+
+static void test_formatInformationWords(void) {
+    // L, M, Q and H with data mask patterns 0 and 7
+    assert(formatInformationWords[0][0] == 0x77C4);
+    assert(formatInformationWords[0][7] == 0x6976);
+    assert(formatInformationWords[1][0] == 0x5412);
+    assert(formatInformationWords[1][7] == 0x4AA0);
+    assert(formatInformationWords[2][0] == 0x355F);
+    assert(formatInformationWords[2][7] == 0x2BED);
+    assert(formatInformationWords[3][0] == 0x1689);
+    assert(formatInformationWords[3][7] == 0x083B);
+
+    printf("test_formatInformationWords() passed\n");
+}
+
+static void test_versionInformationWords(void) {
+    for (unsigned int version = 0; version < 7; version++) {
+        assert(versionInformationWords[version] == 0);
+    }
+
+    for (unsigned int version = 7; version <= 40; version++) {
+        assert(versionInformationWords[version] >> 12 == version);
+    }
+
+    assert(versionInformationWords[7] == 0x07C94);
+    assert(versionInformationWords[21] == 0x15683);
+    assert(versionInformationWords[40] == 0x28C69);
+
+    printf("test_versionInformationWords() passed\n");
+}
+
+int main(void) {
+    test_symbolDescriptors();
+    test_alignmentPatternCoordinates();
+    test_formatInformationWords();
+    test_versionInformationWords();
+
+    return 0;
+}
@@ -0,0 +1,415 @@
+/*
+ * Copyright 2025 Naoto Yoshida
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the “Software”), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Generates the read-only tables declared in src/tables.h. Build with the
+// "tables" target of the Makefile, which runs this program and compiles its
+// output, so that the encoder builds no tables at startup or per symbol.
+//
+// Usage: gentables.exe output.c
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// RS block table {numBlocks1, numDataCodewords1, numBlocks2, numECCodewords}
+static const unsigned int rsBlockTable[][4][4] = {
+    {{1, 19, 0, 7}, {1, 16, 0, 10}, {1, 13, 0, 13}, {1, 9, 0, 17}},
+    {{1, 34, 0, 10}, {1, 28, 0, 16}, {1, 22, 0, 22}, {1, 16, 0, 28}},
+    {{1, 55, 0, 15}, {1, 44, 0, 26}, {2, 17, 0, 18}, {2, 13, 0, 22}},
+    {{1, 80, 0, 20}, {2, 32, 0, 18}, {2, 24, 0, 26}, {4, 9, 0, 16}},
+    {{1, 108, 0, 26}, {2, 43, 0, 24}, {2, 15, 2, 18}, {2, 11, 2, 22}},
+    {{2, 68, 0, 18}, {4, 27, 0, 16}, {4, 19, 0, 24}, {4, 15, 0, 28}},
+    {{2, 78, 0, 20}, {4, 31, 0, 18}, {2, 14, 4, 18}, {4, 13, 1, 26}},
+    {{2, 97, 0, 24}, {2, 38, 2, 22}, {4, 18, 2, 22}, {4, 14, 2, 26}},
+    {{2, 116, 0, 30}, {3, 36, 2, 22}, {4, 16, 4, 20}, {4, 12, 4, 24}},
+    {{2, 68, 2, 18}, {4, 43, 1, 26}, {6, 19, 2, 24}, {6, 15, 2, 28}},
+    {{4, 81, 0, 20}, {1, 50, 4, 30}, {4, 22, 4, 28}, {3, 12, 8, 24}},
+    {{2, 92, 2, 24}, {6, 36, 2, 22}, {4, 20, 6, 26}, {7, 14, 4, 28}},
+    {{4, 107, 0, 26}, {8, 37, 1, 22}, {8, 20, 4, 24}, {12, 11, 4, 22}},
+    {{3, 115, 1, 30}, {4, 40, 5, 24}, {11, 16, 5, 20}, {11, 12, 5, 24}},
+    {{5, 87, 1, 22}, {5, 41, 5, 24}, {5, 24, 7, 30}, {11, 12, 7, 24}},
+    {{5, 98, 1, 24}, {7, 45, 3, 28}, {15, 19, 2, 24}, {3, 15, 13, 30}},
+    {{1, 107, 5, 28}, {10, 46, 1, 28}, {1, 22, 15, 28}, {2, 14, 17, 28}},
+    {{5, 120, 1, 30}, {9, 43, 4, 26}, {17, 22, 1, 28}, {2, 14, 19, 28}},
+    {{3, 113, 4, 28}, {3, 44, 11, 26}, {17, 21, 4, 26}, {9, 13, 16, 26}},
+    {{3, 107, 5, 28}, {3, 41, 13, 26}, {15, 24, 5, 30}, {15, 15, 10, 28}},
+    {{4, 116, 4, 28}, {17, 42, 0, 26}, {17, 22, 6, 28}, {19, 16, 6, 30}},
+    {{2, 111, 7, 28}, {17, 46, 0, 28}, {7, 24, 16, 30}, {34, 13, 0, 24}},
+    {{4, 121, 5, 30}, {4, 47, 14, 28}, {11, 24, 14, 30}, {16, 15, 14, 30}},
+    {{6, 117, 4, 30}, {6, 45, 14, 28}, {11, 24, 16, 30}, {30, 16, 2, 30}},
+    {{8, 106, 4, 26}, {8, 47, 13, 28}, {7, 24, 22, 30}, {22, 15, 13, 30}},
+    {{10, 114, 2, 28}, {19, 46, 4, 28}, {28, 22, 6, 28}, {33, 16, 4, 30}},
+    {{8, 122, 4, 30}, {22, 45, 3, 28}, {8, 23, 26, 30}, {12, 15, 28, 30}},
+    {{3, 117, 10, 30}, {3, 45, 23, 28}, {4, 24, 31, 30}, {11, 15, 31, 30}},
+    {{7, 116, 7, 30}, {21, 45, 7, 28}, {1, 23, 37, 30}, {19, 15, 26, 30}},
+    {{5, 115, 10, 30}, {19, 47, 10, 28}, {15, 24, 25, 30}, {23, 15, 25, 30}},
+    {{13, 115, 3, 30}, {2, 46, 29, 28}, {42, 24, 1, 30}, {23, 15, 28, 30}},
+    {{17, 115, 0, 30}, {10, 46, 23, 28}, {10, 24, 35, 30}, {19, 15, 35, 30}},
+    {{17, 115, 1, 30}, {14, 46, 21, 28}, {29, 24, 19, 30}, {11, 15, 46, 30}},
+    {{13, 115, 6, 30}, {14, 46, 23, 28}, {44, 24, 7, 30}, {59, 16, 1, 30}},
+    {{12, 121, 7, 30}, {12, 47, 26, 28}, {39, 24, 14, 30}, {22, 15, 41, 30}},
+    {{6, 121, 14, 30}, {6, 47, 34, 28}, {46, 24, 10, 30}, {2, 15, 64, 30}},
+    {{17, 122, 4, 30}, {29, 46, 14, 28}, {49, 24, 10, 30}, {24, 15, 46, 30}},
+    {{4, 122, 18, 30}, {13, 46, 32, 28}, {48, 24, 14, 30}, {42, 15, 32, 30}},
+    {{20, 117, 4, 30}, {40, 47, 7, 28}, {43, 24, 22, 30}, {10, 15, 67, 30}},
+    {{19, 118, 6, 30}, {18, 47, 31, 28}, {34, 24, 34, 30}, {20, 15, 61, 30}}};
+
+// {number of coordinates, coordinates 1, coordinates 2, ...}
+static const unsigned int alignmentPatternCoordinates[][8] = {
+    {0, 0, 0, 0, 0, 0, 0, 0},          {2, 6, 18, 0, 0, 0, 0, 0},
+    {2, 6, 22, 0, 0, 0, 0, 0},         {2, 6, 26, 0, 0, 0, 0, 0},
+    {2, 6, 30, 0, 0, 0, 0, 0},         {2, 6, 34, 0, 0, 0, 0, 0},
+    {3, 6, 22, 38, 0, 0, 0, 0},        {3, 6, 24, 42, 0, 0, 0, 0},
+    {3, 6, 26, 46, 0, 0, 0, 0},        {3, 6, 28, 50, 0, 0, 0, 0},
+    {3, 6, 30, 54, 0, 0, 0, 0},        {3, 6, 32, 58, 0, 0, 0, 0},
+    {3, 6, 34, 62, 0, 0, 0, 0},        {4, 6, 26, 46, 66, 0, 0, 0},
+    {4, 6, 26, 48, 70, 0, 0, 0},       {4, 6, 26, 50, 74, 0, 0, 0},
+    {4, 6, 30, 54, 78, 0, 0, 0},       {4, 6, 30, 56, 82, 0, 0, 0},
+    {4, 6, 30, 58, 86, 0, 0, 0},       {4, 6, 34, 62, 90, 0, 0, 0},
+    {5, 6, 28, 50, 72, 94, 0, 0},      {5, 6, 26, 50, 74, 98, 0, 0},
+    {5, 6, 30, 54, 78, 102, 0, 0},     {5, 6, 28, 54, 80, 106, 0, 0},
+    {5, 6, 32, 58, 84, 110, 0, 0},     {5, 6, 30, 58, 86, 114, 0, 0},
+    {5, 6, 34, 62, 90, 118, 0, 0},     {6, 6, 26, 50, 74, 98, 122, 0},
+    {6, 6, 30, 54, 78, 102, 126, 0},   {6, 6, 26, 52, 78, 104, 130, 0},
+    {6, 6, 30, 56, 82, 108, 134, 0},   {6, 6, 34, 60, 86, 112, 138, 0},
+    {6, 6, 30, 58, 86, 114, 142, 0},   {6, 6, 34, 62, 90, 118, 146, 0},
+    {7, 6, 30, 54, 78, 102, 126, 150}, {7, 6, 24, 50, 76, 102, 128, 154},
+    {7, 6, 28, 54, 80, 106, 132, 158}, {7, 6, 32, 58, 84, 110, 136, 162},
+    {7, 6, 26, 54, 82, 110, 138, 166}, {7, 6, 30, 58, 86, 114, 142, 170}};
+
+// bits of the character count indicator of numeric, alphanumeric, byte and
+// kanji mode for versions 1-9, 10-26 and 27-40
+static const unsigned int numBitsCharCountIndicator[][4] = {
+    {10, 9, 8, 8}, {12, 11, 16, 10}, {14, 13, 16, 12}};
+
+static uint8_t expTable[256];
+static uint8_t logTable[256];
+
+static void initializeExpAndLogTables(void) {
+    unsigned int x = 1;
+
+    for (unsigned int i = 0; i < 256; i++) {
+        expTable[i] = x;
+        logTable[x] = i % 255;
+        x = x << 1 ^ (x & 0x80 ? 0x11D : 0);
+    }
+
+    logTable[0] = 0;
+    logTable[1] = 0;
+}
+
+static uint8_t multiply(uint8_t a, uint8_t b) {
+    return a && b ? expTable[(logTable[a] + logTable[b]) % 255] : 0;
+}
+
+static unsigned int getVersionClass(unsigned int version) {
+    return version <= 9 ? 0 : version <= 26 ? 1 : 2;
+}
+
+static unsigned int getNumCodewordModules(unsigned int version) {
+    unsigned int numModules = (16 * version + 128) * version + 64;
+
+    if (version >= 2) {
+        unsigned int numAlignmentPatterns = version / 7 + 2;
+
+        numModules -= (25 * numAlignmentPatterns - 10) * numAlignmentPatterns -
+                      55;
+
+        if (version >= 7) {
+            numModules -= 36;
+        }
+    }
+
+    return numModules;
+}
+
+// the most characters of each mode that fit one segment into numDataBits
+static void calculateCapacities(unsigned int *capacities,
+                                unsigned int numDataBits,
+                                unsigned int versionClass) {
+    for (unsigned int mode = 0; mode < 4; mode++) {
+        unsigned int numCountBits =
+            numBitsCharCountIndicator[versionClass][mode];
+        unsigned int numBits = numDataBits - 4 - numCountBits;
+        unsigned int capacity;
+
+        switch (mode) {
+        case 0:
+            capacity = numBits / 10 * 3 +
+                       (numBits % 10 >= 7 ? 2 : numBits % 10 >= 4 ? 1 : 0);
+            break;
+
+        case 1:
+            capacity = numBits / 11 * 2 + (numBits % 11 >= 6);
+            break;
+
+        case 2:
+            capacity = numBits / 8;
+            break;
+
+        default:
+            capacity = numBits / 13;
+            break;
+        }
+
+        if (capacity > (1u << numCountBits) - 1) {
+            capacity = (1u << numCountBits) - 1;
+        }
+
+        capacities[mode] = capacity;
+    }
+}
+
+static uint32_t calculateBCHBits(unsigned int numTotalBits,
+                                 unsigned int numDataBits, uint32_t dataBits,
+                                 uint32_t generatorPoly) {
+    uint32_t bchBits = dataBits << (numTotalBits - numDataBits);
+
+    for (unsigned int i = 0; i < numDataBits; i++) {
+        if (bchBits & (1u << (numTotalBits - 1 - i))) {
+            bchBits ^= generatorPoly << (numDataBits - 1 - i);
+        }
+    }
+
+    return bchBits;
+}
+
+static void writeSymbolDescriptors(FILE *file) {
+    fprintf(file, "const SymbolDescriptor symbolDescriptors[40][4] = {\n");
+
+    for (unsigned int version = 1; version <= 40; version++) {
+        fprintf(file, "    {");
+
+        for (unsigned int ecLevel = 0; ecLevel < 4; ecLevel++) {
+            const unsigned int *block = rsBlockTable[version - 1][ecLevel];
+            unsigned int numDataCodewords =
+                block[0] * block[1] + block[2] * (block[1] + 1);
+            unsigned int numCodewords =
+                numDataCodewords + (block[0] + block[2]) * block[3];
+            unsigned int capacities[4];
+
+            calculateCapacities(capacities, 8 * numDataCodewords,
+                                getVersionClass(version));
+
+            fprintf(file,
+                    "%s{%u, %u, {%u, %u, %u, %u}, %u, %u, %u, %u, %u, %u}",
+                    ecLevel ? ",\n     " : "", numDataCodewords, numCodewords,
+                    capacities[0], capacities[1], capacities[2], capacities[3],
+                    17 + 4 * version,
+                    getNumCodewordModules(version) - 8 * numCodewords,
+                    block[0], block[1], block[2], block[3]);
+        }
+
+        fprintf(file, "}%s\n", version < 40 ? "," : "};");
+    }
+}
+
+static void writeAlignmentPatternCoordinates(FILE *file) {
+    fprintf(file, "\nconst uint8_t alignmentPatternCoordinates[40][8] = {\n");
+
+    for (unsigned int version = 1; version <= 40; version++) {
+        const unsigned int *coordinates =
+            alignmentPatternCoordinates[version - 1];
+
+        fprintf(file, "    {%u, %u, %u, %u, %u, %u, %u, %u}%s\n",
+                coordinates[0], coordinates[1], coordinates[2], coordinates[3],
+                coordinates[4], coordinates[5], coordinates[6], coordinates[7],
+                version < 40 ? "," : "};");
+    }
+}
+
+static void writeCharCountIndicatorBits(FILE *file) {
+    fprintf(file, "\nconst uint8_t numBitsCharCountIndicators[3][4] = {\n");
+
+    for (unsigned int versionClass = 0; versionClass < 3; versionClass++) {
+        const unsigned int *numBits = numBitsCharCountIndicator[versionClass];
+
+        fprintf(file, "    {%u, %u, %u, %u}%s\n", numBits[0], numBits[1],
+                numBits[2], numBits[3], versionClass < 2 ? "," : "};");
+    }
+}
+
+static void writeFormatAndVersionInformation(FILE *file) {
+    fprintf(file, "\nconst uint16_t formatInformationWords[4][8] = {\n");
+
+    for (unsigned int ecLevel = 0; ecLevel < 4; ecLevel++) {
+        fprintf(file, "    {");
+
+        for (unsigned int pattern = 0; pattern < 8; pattern++) {
+            // L, M, Q and H are 01, 00, 11 and 10
+            uint32_t dataBits = ((5 - ecLevel) & 3) << 3 | pattern;
+            uint32_t word =
+                (dataBits << 10 | calculateBCHBits(15, 5, dataBits, 0x537)) ^
+                0x5412;
+
+            fprintf(file, "%s0x%04X", pattern ? ", " : "", (unsigned int)word);
+        }
+
+        fprintf(file, "}%s\n", ecLevel < 3 ? "," : "};");
+    }
+
+    fprintf(file, "\nconst uint32_t versionInformationWords[41] = {");
+
+    for (unsigned int version = 0; version <= 40; version++) {
+        uint32_t word =
+            version < 7 ? 0
+                        : version << 12 |
+                              calculateBCHBits(18, 6, version, 0x1F25);
+
+        fprintf(file, "%s0x%05X", version % 6 ? ", " : "\n    ",
+                (unsigned int)word);
+        fprintf(file, "%s", version < 40 ? (version % 6 == 5 ? "," : "")
+                                         : "};\n");
+    }
+}
+
+// the degrees used by the RS block table in ascending order; returns the count
+static unsigned int listGeneratorPolynomialDegrees(unsigned int *degrees) {
+    unsigned int numDegrees = 0;
+
+    for (unsigned int degree = 1; degree <= 30; degree++) {
+        for (unsigned int i = 0; i < 40 * 4; i++) {
+            if (rsBlockTable[i / 4][i % 4][3] == degree) {
+                degrees[numDegrees++] = degree;
+                break;
+            }
+        }
+    }
+
+    return numDegrees;
+}
+
+// writes values as the initializer of an array of bytes, 16 per line
+static void writeBytes(FILE *file, const uint8_t *values, unsigned int count) {
+    for (unsigned int i = 0; i < count; i++) {
+        fprintf(file, "%s%u", i % 16 ? ", " : "\n    ", values[i]);
+        fprintf(file, "%s", i + 1 < count ? (i % 16 == 15 ? "," : "")
+                                          : "};\n");
+    }
+}
+
+static void writeGF256Tables(FILE *file) {
+    unsigned int degrees[30];
+    unsigned int numDegrees = listGeneratorPolynomialDegrees(degrees);
+    int offsets[31];
+    static uint8_t polys[30 * 31 / 2];
+    static uint8_t products[256 * 30 * 31 / 2];
+    unsigned int numCoefficients = 0;
+
+    fprintf(file, "\nconst uint8_t gf256ExpTable[256] = {");
+    writeBytes(file, expTable, 256);
+    fprintf(file, "\nconst uint8_t gf256LogTable[256] = {");
+    writeBytes(file, logTable, 256);
+
+    for (unsigned int degree = 0; degree <= 30; degree++) {
+        offsets[degree] = -1;
+    }
+
+    for (unsigned int i = 0; i < numDegrees; i++) {
+        uint8_t poly[31] = {1};
+
+        // (x - 2^0)(x - 2^1)...(x - 2^(degree - 1)), poly[k] the x^k term
+        for (unsigned int j = 0; j < degrees[i]; j++) {
+            for (unsigned int k = j + 1; k > 0; k--) {
+                poly[k] = poly[k - 1] ^ multiply(poly[k], expTable[j]);
+            }
+
+            poly[0] = multiply(poly[0], expTable[j]);
+        }
+
+        offsets[degrees[i]] = numCoefficients;
+
+        // in alpha notation from x^0 to x^(degree - 1)
+        for (unsigned int k = 0; k < degrees[i]; k++) {
+            polys[numCoefficients + k] = logTable[poly[k]];
+        }
+
+        // row f holds f times the coefficients from x^(degree - 1) to x^0
+        for (unsigned int f = 0; f < 256; f++) {
+            for (unsigned int j = 1; j <= degrees[i]; j++) {
+                products[256 * numCoefficients + f * degrees[i] + j - 1] =
+                    multiply(f, poly[degrees[i] - j]);
+            }
+        }
+
+        numCoefficients += degrees[i];
+    }
+
+    fprintf(file, "\nconst int16_t gf256GeneratorPolynomialOffsets[31] = {");
+
+    for (unsigned int degree = 0; degree <= 30; degree++) {
+        fprintf(file, "%s%d", degree % 16 ? ", " : "\n    ", offsets[degree]);
+        fprintf(file, "%s", degree < 30 ? (degree % 16 == 15 ? "," : "")
+                                        : "};\n");
+    }
+
+    fprintf(file, "\nconst uint8_t gf256GeneratorPolynomials[%u] = {",
+            numCoefficients);
+    writeBytes(file, polys, numCoefficients);
+    fprintf(file, "\nconst uint8_t gf256MultiplicationTables[%u] = {",
+            256 * numCoefficients);
+    writeBytes(file, products, 256 * numCoefficients);
+
+    fprintf(file, "\nconst uint8_t gf256NibbleTables[256][32] = {\n");
+
+    for (unsigned int c = 0; c < 256; c++) {
+        fprintf(file, "    {");
+
+        for (unsigned int x = 0; x < 32; x++) {
+            fprintf(file, "%s%u", x == 0 ? "" : x == 16 ? ",\n     " : ", ",
+                    multiply(c, x < 16 ? x : (x - 16) << 4));
+        }
+
+        fprintf(file, "}%s\n", c < 255 ? "," : "};");
+    }
+}
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        fprintf(stderr, "Usage: gentables.exe output.c\n");
+        return EXIT_FAILURE;
+    }
+
+    FILE *file = fopen(argv[1], "w");
+
+    if (file == NULL) {
+        perror(argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    initializeExpAndLogTables();
+
+    fprintf(file, "// Generated by tools/gentables.c. Do not edit.\n\n"
+                  "#include \"tables.h\"\n\n");
+    writeSymbolDescriptors(file);
+    writeAlignmentPatternCoordinates(file);
+    writeCharCountIndicatorBits(file);
+    writeFormatAndVersionInformation(file);
+    writeGF256Tables(file);
+
+    if (fclose(file) != 0) {
+        perror(argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    return 0;
+}